@@ -38,13 +38,17 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Progress.h"
 
 namespace open3d {
 
 namespace {
 
 using namespace color_map;
-void OptimizeImageCoorNonrigid(
+
+/// Returns false if the optimization has been cancelled.
+bool OptimizeImageCoorNonrigid(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
@@ -55,20 +59,24 @@ void OptimizeImageCoorNonrigid(
         const std::vector<std::vector<int>>& visiblity_vertex_to_image,
         const std::vector<std::vector<int>>& visiblity_image_to_vertex,
         std::vector<double>& proxy_intensity,
-        const ColorMapOptimizationOption& option) {
+        const ColorMapOptimizationOption& option,
+        utility::ProgressToken* progress) {
     auto n_vertex = mesh.vertices_.size();
     int n_camera = int(camera.parameters_.size());
     SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
                                visiblity_vertex_to_image, proxy_intensity,
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
+        if (progress != nullptr && progress->IsCancelled()) {
+            return false;
+        }
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
-        double residual = 0.0;
-        double residual_reg = 0.0;
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int c = 0; c < n_camera; c++) {
+        std::vector<double> residuals(n_camera, 0.0);
+        std::vector<double> residuals_reg(n_camera, 0.0);
+        utility::ParallelFor(0, n_camera, [&](int c) {
+            // Cameras are the unit of parallelism; the per-camera systems
+            // are built serially.
+            utility::ScopedMaxThreads single_thread(1);
             int nonrigidval = warping_fields[c].anchor_w_ *
                               warping_fields[c].anchor_h_ * 2;
             double rr_reg = 0.0;
@@ -127,23 +135,29 @@ void OptimizeImageCoorNonrigid(
             }
             camera.parameters_[c].extrinsic_ = pose;
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-            {
-                residual += r2;
-                residual_reg += rr_reg;
-            }
+            residuals[c] = r2;
+            residuals_reg[c] = rr_reg;
+        });
+        double residual = 0.0;
+        double residual_reg = 0.0;
+        for (int c = 0; c < n_camera; c++) {
+            residual += residuals[c];
+            residual_reg += residuals_reg[c];
         }
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
         SetProxyIntensityForVertex(mesh, images_gray, warping_fields, camera,
                                    visiblity_vertex_to_image, proxy_intensity,
                                    option.image_boundary_margin_);
+        if (progress != nullptr) {
+            progress->Add();
+        }
     }
+    return true;
 }
 
-void OptimizeImageCoorRigid(
+/// Returns false if the optimization has been cancelled.
+bool OptimizeImageCoorRigid(
         const geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::Image>>& images_gray,
         const std::vector<std::shared_ptr<geometry::Image>>& images_dx,
@@ -152,20 +166,23 @@ void OptimizeImageCoorRigid(
         const std::vector<std::vector<int>>& visiblity_vertex_to_image,
         const std::vector<std::vector<int>>& visiblity_image_to_vertex,
         std::vector<double>& proxy_intensity,
-        const ColorMapOptimizationOption& option) {
+        const ColorMapOptimizationOption& option,
+        utility::ProgressToken* progress) {
     int total_num_ = 0;
     int n_camera = int(camera.parameters_.size());
     SetProxyIntensityForVertex(mesh, images_gray, camera,
                                visiblity_vertex_to_image, proxy_intensity,
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
+        if (progress != nullptr && progress->IsCancelled()) {
+            return false;
+        }
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
-        double residual = 0.0;
-        total_num_ = 0;
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (int c = 0; c < n_camera; c++) {
+        std::vector<double> residuals(n_camera, 0.0);
+        utility::ParallelFor(0, n_camera, [&](int c) {
+            // Cameras are the unit of parallelism; the per-camera systems
+            // are built serially.
+            utility::ScopedMaxThreads single_thread(1);
             Eigen::Matrix4d pose;
             pose = camera.parameters_[c].extrinsic_;
 
@@ -198,20 +215,24 @@ void OptimizeImageCoorRigid(
                                                                          JTr);
             pose = delta * pose;
             camera.parameters_[c].extrinsic_ = pose;
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-            {
-                residual += r2;
-                total_num_ += int(visiblity_image_to_vertex[c].size());
-            }
+            residuals[c] = r2;
+        });
+        double residual = 0.0;
+        total_num_ = 0;
+        for (int c = 0; c < n_camera; c++) {
+            residual += residuals[c];
+            total_num_ += int(visiblity_image_to_vertex[c].size());
         }
         utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})", residual,
                           residual / total_num_);
         SetProxyIntensityForVertex(mesh, images_gray, camera,
                                    visiblity_vertex_to_image, proxy_intensity,
                                    option.image_boundary_margin_);
+        if (progress != nullptr) {
+            progress->Add();
+        }
     }
+    return true;
 }
 
 std::tuple<std::vector<std::shared_ptr<geometry::Image>>,
@@ -280,8 +301,12 @@ void ColorMapOptimization(
         const std::vector<std::shared_ptr<geometry::RGBDImage>>& images_rgbd,
         camera::PinholeCameraTrajectory& camera,
         const ColorMapOptimizationOption& option
-        /* = ColorMapOptimizationOption()*/) {
+        /* = ColorMapOptimizationOption()*/,
+        utility::ProgressToken* progress /* = nullptr*/) {
     utility::LogDebug("[ColorMapOptimization]");
+    if (progress != nullptr) {
+        progress->Reset(option.maximum_iteration_);
+    }
     std::vector<std::shared_ptr<geometry::Image>> images_gray, images_dx,
             images_dy, images_color, images_depth;
     std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
@@ -299,25 +324,40 @@ void ColorMapOptimization(
                     option.maximum_allowable_depth_,
                     option.depth_threshold_for_visiblity_check_);
 
+    // The optimization refines the camera in place; keep the input to restore
+    // it on cancellation.
+    camera::PinholeCameraTrajectory camera_init;
+    if (progress != nullptr) {
+        camera_init = camera;
+    }
     std::vector<double> proxy_intensity;
     if (option.non_rigid_camera_coordinate_) {
         utility::LogDebug("[ColorMapOptimization] :: Non-Rigid Optimization");
         auto warping_uv_ = CreateWarpingFields(images_gray, option);
         auto warping_uv_init_ = CreateWarpingFields(images_gray, option);
-        OptimizeImageCoorNonrigid(
-                mesh, images_gray, images_dx, images_dy, warping_uv_,
-                warping_uv_init_, camera, visiblity_vertex_to_image,
-                visiblity_image_to_vertex, proxy_intensity, option);
+        if (!OptimizeImageCoorNonrigid(
+                    mesh, images_gray, images_dx, images_dy, warping_uv_,
+                    warping_uv_init_, camera, visiblity_vertex_to_image,
+                    visiblity_image_to_vertex, proxy_intensity, option,
+                    progress)) {
+            utility::LogDebug("[ColorMapOptimization] Cancelled.");
+            camera = camera_init;
+            return;
+        }
         SetGeometryColorAverage(mesh, images_color, warping_uv_, camera,
                                 visiblity_vertex_to_image,
                                 option.image_boundary_margin_,
                                 option.invisible_vertex_color_knn_);
     } else {
         utility::LogDebug("[ColorMapOptimization] :: Rigid Optimization");
-        OptimizeImageCoorRigid(mesh, images_gray, images_dx, images_dy, camera,
-                               visiblity_vertex_to_image,
-                               visiblity_image_to_vertex, proxy_intensity,
-                               option);
+        if (!OptimizeImageCoorRigid(mesh, images_gray, images_dx, images_dy,
+                                    camera, visiblity_vertex_to_image,
+                                    visiblity_image_to_vertex, proxy_intensity,
+                                    option, progress)) {
+            utility::LogDebug("[ColorMapOptimization] Cancelled.");
+            camera = camera_init;
+            return;
+        }
         SetGeometryColorAverage(mesh, images_color, camera,
                                 visiblity_vertex_to_image,
                                 option.image_boundary_margin_,
@@ -43,6 +43,9 @@ class Image;
 namespace camera {
 class PinholeCameraTrajectory;
 }
+namespace utility {
+class ProgressToken;
+}
 
 namespace color_map {
 
@@ -145,11 +148,13 @@ public:
 /// \param camera Cameras’ parameters.
 /// \param option Color map optimization options. Takes the original
 /// ColorMapOptimizationOption values by default.
+/// \param progress Optionally receives progress per iteration. If it is
+/// cancelled, mesh and camera are left unchanged.
 void ColorMapOptimization(
         geometry::TriangleMesh& mesh,
         const std::vector<std::shared_ptr<geometry::RGBDImage>>& imgs_rgbd,
         camera::PinholeCameraTrajectory& camera,
-        const ColorMapOptimizationOption& option =
-                ColorMapOptimizationOption());
+        const ColorMapOptimizationOption& option = ColorMapOptimizationOption(),
+        utility::ProgressToken* progress = nullptr);
 }  // namespace color_map
 }  // namespace open3d
@@ -30,9 +30,12 @@
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Memory.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -44,22 +47,26 @@ class AccumulatedPoint {
 public:
     AccumulatedPoint()
         : num_of_points_(0),
+          first_index_(-1),
           point_(0.0, 0.0, 0.0),
           normal_(0.0, 0.0, 0.0),
           color_(0.0, 0.0, 0.0) {}
 
 public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
+    /// \p cloud is a PointCloud or a PointCloudF.
+    template <typename CloudT>
+    void AddPoint(const CloudT &cloud, int index) {
+        if (num_of_points_ == 0) first_index_ = index;
+        point_ += cloud.points_[index].template cast<double>();
         if (cloud.HasNormals()) {
             if (!std::isnan(cloud.normals_[index](0)) &&
                 !std::isnan(cloud.normals_[index](1)) &&
                 !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
+                normal_ += cloud.normals_[index].template cast<double>();
             }
         }
         if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
+            color_ += cloud.colors_[index].template cast<double>();
         }
         num_of_points_++;
     }
@@ -76,6 +83,8 @@ public:
 
 public:
     int num_of_points_;
+    /// Index of the first point added to this voxel.
+    int first_index_;
     Eigen::Vector3d point_;
     Eigen::Vector3d normal_;
     Eigen::Vector3d color_;
@@ -139,6 +148,105 @@ private:
     std::unordered_map<int, int> classes;
 };
 
+/// Shared by PointCloud and PointCloudF. If \p first_indices is given, it
+/// receives the index of the first input point of every output voxel. The
+/// voxel map is built in \p arena, or in an arena local to the call if it is
+/// null.
+template <typename CloudT>
+void VoxelDownSampleT(const CloudT &input,
+                      double voxel_size,
+                      CloudT &output,
+                      utility::Arena *arena,
+                      std::vector<size_t> *first_indices = nullptr) {
+    typedef typename decltype(output.points_)::value_type::Scalar Scalar;
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSample] voxel_size <= 0.");
+    }
+    if (&output == &input) {
+        utility::LogError("[VoxelDownSample] output must not be the input.");
+    }
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = input.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError("[VoxelDownSample] voxel_size is too small.");
+    }
+    // The voxel map draws from an arena, so it is built with a few large
+    // allocations instead of one per voxel. A caller-owned arena keeps its
+    // memory across calls; a local one releases it when the call returns.
+    std::unique_ptr<utility::Arena> local_arena;
+    if (arena == nullptr) {
+        local_arena.reset(new utility::Arena(1 << 20, "VoxelDownSample"));
+        arena = local_arena.get();
+    } else {
+        arena->Reset();
+    }
+    typedef std::pair<const Eigen::Vector3i, AccumulatedPoint> VoxelEntry;
+    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
+                       utility::hash_eigen::hash<Eigen::Vector3i>,
+                       std::equal_to<Eigen::Vector3i>,
+                       utility::ArenaAllocator<VoxelEntry>>
+            voxelindex_to_accpoint(
+                    0, utility::hash_eigen::hash<Eigen::Vector3i>(),
+                    std::equal_to<Eigen::Vector3i>(),
+                    utility::ArenaAllocator<VoxelEntry>(*arena));
+
+    Eigen::Vector3d ref_coord;
+    Eigen::Vector3i voxel_index;
+    for (int i = 0; i < (int)input.points_.size(); i++) {
+        ref_coord = (input.points_[i].template cast<double>() -
+                     voxel_min_bound) /
+                    voxel_size;
+        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                int(floor(ref_coord(2)));
+        voxelindex_to_accpoint[voxel_index].AddPoint(input, i);
+    }
+    bool has_normals = input.HasNormals();
+    bool has_colors = input.HasColors();
+    // Resizing keeps the capacity of the output attributes.
+    size_t num_voxels = voxelindex_to_accpoint.size();
+    output.points_.resize(num_voxels);
+    output.normals_.resize(has_normals ? num_voxels : 0);
+    output.colors_.resize(has_colors ? num_voxels : 0);
+    if (first_indices != nullptr) first_indices->resize(num_voxels);
+    size_t vidx = 0;
+    for (const auto &accpoint : voxelindex_to_accpoint) {
+        output.points_[vidx] =
+                accpoint.second.GetAveragePoint().template cast<Scalar>();
+        if (has_normals) {
+            output.normals_[vidx] =
+                    accpoint.second.GetAverageNormal().template cast<Scalar>();
+        }
+        if (has_colors) {
+            output.colors_[vidx] =
+                    accpoint.second.GetAverageColor().template cast<Scalar>();
+        }
+        if (first_indices != nullptr) {
+            (*first_indices)[vidx] = size_t(accpoint.second.first_index_);
+        }
+        vidx++;
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)input.points_.size(), (int)output.points_.size());
+}
+
+/// Replaces the attributes of \p output with the rows \p indices of every
+/// attribute of \p input that has one row per point.
+void SelectAttributes(const PointCloud &input,
+                      const std::vector<size_t> &indices,
+                      PointCloud &output) {
+    output.attributes_.clear();
+    for (const auto &attribute : input.attributes_) {
+        if (input.HasAttribute(attribute.first)) {
+            output.attributes_[attribute.first] =
+                    attribute.second.Select(indices);
+        }
+    }
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -147,19 +255,24 @@ std::shared_ptr<PointCloud> PointCloud::SelectDownSample(
     auto output = std::make_shared<PointCloud>();
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
+    bool has_attributes = !attributes_.empty();
 
     std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
     for (size_t i : indices) {
         mask[i] = !invert;
     }
 
+    // The selected indices are collected once and shared by all attributes.
+    std::vector<size_t> selected;
     for (size_t i = 0; i < points_.size(); i++) {
         if (mask[i]) {
             output->points_.push_back(points_[i]);
             if (has_normals) output->normals_.push_back(normals_[i]);
             if (has_colors) output->colors_.push_back(colors_[i]);
+            if (has_attributes) selected.push_back(i);
         }
     }
+    if (has_attributes) SelectAttributes(*this, selected, *output);
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -254,43 +367,25 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SelectDownSample(
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         double voxel_size) const {
     auto output = std::make_shared<PointCloud>();
-    if (voxel_size <= 0.0) {
-        utility::LogError("[VoxelDownSample] voxel_size <= 0.");
-    }
-    Eigen::Vector3d voxel_size3 =
-            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
-    Eigen::Vector3d voxel_min_bound = GetMinBound() - voxel_size3 * 0.5;
-    Eigen::Vector3d voxel_max_bound = GetMaxBound() + voxel_size3 * 0.5;
-    if (voxel_size * std::numeric_limits<int>::max() <
-        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
-        utility::LogError("[VoxelDownSample] voxel_size is too small.");
-    }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    VoxelDownSample(voxel_size, *output);
+    return output;
+}
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
-        }
-        if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
-        }
+PointCloud &PointCloud::VoxelDownSample(
+        double voxel_size,
+        PointCloud &output,
+        utility::Arena *arena /* = nullptr*/) const {
+    OPEN3D_TRACE_ZONE("PointCloud::VoxelDownSample");
+    if (attributes_.empty()) {
+        VoxelDownSampleT(*this, voxel_size, output, arena);
+        output.attributes_.clear();
+    } else {
+        // Attributes are not averaged; every voxel takes the values of its
+        // first point.
+        std::vector<size_t> first_indices;
+        VoxelDownSampleT(*this, voxel_size, output, arena, &first_indices);
+        SelectAttributes(*this, first_indices, output);
     }
-    utility::LogDebug(
-            "Pointcloud down sampled from {:d} points to {:d} points.",
-            (int)points_.size(), (int)output->points_.size());
     return output;
 }
 
@@ -332,6 +427,8 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
     }
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
+    bool has_attributes = !attributes_.empty();
+    std::vector<size_t> first_indices;
     int cnt = 0;
     cubic_id.resize(voxelindex_to_accpoint.size(), 8);
     cubic_id.setConstant(-1);
@@ -353,8 +450,14 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
             int cid = original_id[i].cubic_id;
             cubic_id(cnt, cid) = int(pid);
         }
+        if (has_attributes) {
+            first_indices.push_back(original_id[0].point_id);
+        }
         cnt++;
     }
+    // As in VoxelDownSample, every voxel takes the attribute values of its
+    // first point.
+    if (has_attributes) SelectAttributes(*this, first_indices, *output);
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -500,5 +603,57 @@ std::shared_ptr<TriangleMesh> TriangleMesh::Crop(
     return SelectDownSample(bbox.GetPointIndicesWithinBoundingBox(vertices_));
 }
 
+std::shared_ptr<PointCloudF> PointCloudF::SelectDownSample(
+        const std::vector<size_t> &indices, bool invert /* = false */) const {
+    auto output = std::make_shared<PointCloudF>();
+    bool has_normals = HasNormals();
+    bool has_colors = HasColors();
+
+    std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
+    for (size_t i : indices) {
+        mask[i] = !invert;
+    }
+
+    for (size_t i = 0; i < points_.size(); i++) {
+        if (mask[i]) {
+            output->points_.push_back(points_[i]);
+            if (has_normals) output->normals_.push_back(normals_[i]);
+            if (has_colors) output->colors_.push_back(colors_[i]);
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            (int)points_.size(), (int)output->points_.size());
+    return output;
+}
+
+std::shared_ptr<PointCloudF> PointCloudF::VoxelDownSample(
+        double voxel_size) const {
+    auto output = std::make_shared<PointCloudF>();
+    VoxelDownSample(voxel_size, *output);
+    return output;
+}
+
+PointCloudF &PointCloudF::VoxelDownSample(
+        double voxel_size,
+        PointCloudF &output,
+        utility::Arena *arena /* = nullptr*/) const {
+    OPEN3D_TRACE_ZONE("PointCloudF::VoxelDownSample");
+    VoxelDownSampleT(*this, voxel_size, output, arena);
+    return output;
+}
+
+std::shared_ptr<PointCloudF> PointCloudF::UniformDownSample(
+        size_t every_k_points) const {
+    if (every_k_points == 0) {
+        utility::LogError("[UniformDownSample] Illegal sample rate.");
+    }
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < points_.size(); i += every_k_points) {
+        indices.push_back(i);
+    }
+    return SelectDownSample(indices);
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -28,7 +28,10 @@
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -217,7 +220,8 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
     }
 }
 
-Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
+template <typename CloudT>
+Eigen::Vector3d ComputeNormal(const CloudT &cloud,
                               const std::vector<int> &indices,
                               bool fast_normal_computation) {
     if (indices.size() == 0) {
@@ -227,7 +231,8 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     Eigen::Matrix<double, 9, 1> cumulants;
     cumulants.setZero();
     for (size_t i = 0; i < indices.size(); i++) {
-        const Eigen::Vector3d &point = cloud.points_[indices[i]];
+        const Eigen::Vector3d point =
+                cloud.points_[indices[i]].template cast<double>();
         cumulants(0) += point(0);
         cumulants(1) += point(1);
         cumulants(2) += point(2);
@@ -258,6 +263,52 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
+/// Shared by PointCloud and PointCloudF. The covariance and its eigenvector
+/// are computed in double precision.
+template <typename CloudT>
+void EstimateNormalsT(CloudT &cloud,
+                      const KDTreeSearchParam &search_param,
+                      bool fast_normal_computation) {
+    typedef typename decltype(cloud.normals_)::value_type Normal;
+    typedef typename Normal::Scalar Scalar;
+    bool has_normal = cloud.HasNormals();
+    if (has_normal == false) {
+        cloud.normals_.resize(cloud.points_.size());
+    }
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(cloud);
+    utility::ParallelForRange(
+            0, (int)cloud.points_.size(), [&](int begin, int end) {
+                std::vector<int> indices;
+                std::vector<double> distance2;
+                for (int i = begin; i < end; i++) {
+                    Eigen::Vector3d normal;
+                    if (kdtree.Search(cloud.points_[i], search_param, indices,
+                                      distance2) >= 3) {
+                        normal = ComputeNormal(cloud, indices,
+                                               fast_normal_computation);
+                        if (normal.norm() == 0.0) {
+                            if (has_normal) {
+                                normal = cloud.normals_[i]
+                                                 .template cast<double>();
+                            } else {
+                                normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                            }
+                        }
+                        if (has_normal &&
+                            normal.dot(cloud.normals_[i]
+                                               .template cast<double>()) <
+                                    0.0) {
+                            normal *= -1.0;
+                        }
+                        cloud.normals_[i] = normal.template cast<Scalar>();
+                    } else {
+                        cloud.normals_[i] = Normal(0.0, 0.0, 1.0);
+                    }
+                }
+            });
+}
+
 }  // unnamed namespace
 
 namespace geometry {
@@ -265,37 +316,16 @@ namespace geometry {
 bool PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
-    bool has_normal = HasNormals();
-    if (HasNormals() == false) {
-        normals_.resize(points_.size());
-    }
-    KDTreeFlann kdtree;
-    kdtree.SetGeometry(*this);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-                }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-        }
-    }
+    OPEN3D_TRACE_ZONE("PointCloud::EstimateNormals");
+    EstimateNormalsT(*this, search_param, fast_normal_computation);
+    return true;
+}
 
+bool PointCloudF::EstimateNormals(
+        const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
+        bool fast_normal_computation /* = true */) {
+    OPEN3D_TRACE_ZONE("PointCloudF::EstimateNormals");
+    EstimateNormalsT(*this, search_param, fast_normal_computation);
     return true;
 }
 
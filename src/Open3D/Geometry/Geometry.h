@@ -64,6 +64,12 @@ public:
         OrientedBoundingBox = 11,
         /// AxisAlignedBoundingBox
         AxisAlignedBoundingBox = 12,
+        /// InstancedGeometry
+        InstancedGeometry = 13,
+        /// PointCloudF
+        PointCloudF = 14,
+        /// TriangleMeshF
+        TriangleMeshF = 15,
     };
 
 public:
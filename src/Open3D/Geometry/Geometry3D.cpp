@@ -27,130 +27,185 @@
 #include "Open3D/Geometry/Geometry3D.h"
 
 #include <Eigen/Dense>
-#include <numeric>
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/VectorKernels.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+template <typename Scalar>
+using Points = std::vector<Eigen::Matrix<Scalar, 3, 1>>;
+
+template <typename Scalar>
+void ResizeAndPaintUniformColorT(Points<Scalar>& colors,
+                                 const size_t size,
+                                 const Eigen::Vector3d& color) {
+    Eigen::Vector3d clipped_color = color;
+    if (color.minCoeff() < 0 || color.maxCoeff() > 1) {
+        utility::LogWarning(
+                "invalid color in PaintUniformColor, clipping to [0, 1]");
+        clipped_color = clipped_color.array()
+                                .max(Eigen::Vector3d(0, 0, 0).array())
+                                .matrix();
+        clipped_color = clipped_color.array()
+                                .min(Eigen::Vector3d(1, 1, 1).array())
+                                .matrix();
+    }
+    utility::FillVectors(colors, size, clipped_color);
+}
+
+template <typename Scalar>
+void TranslatePointsT(const Eigen::Vector3d& translation,
+                      Points<Scalar>& points,
+                      bool relative) {
+    Eigen::Vector3d transform = translation;
+    if (!relative) {
+        transform -= utility::ComputeCentroid(points);
+    }
+    utility::TranslateVectors(transform, points);
+}
+
+/// Applies p <- (p - c) * scale + c, where c is the center of the points if
+/// \p center is true and the origin otherwise.
+template <typename Scalar>
+void ScalePointsT(double scale, Points<Scalar>& points, bool center) {
+    Eigen::Vector3d points_center(0, 0, 0);
+    if (center && !points.empty()) {
+        points_center = utility::ComputeCentroid(points);
+    }
+    utility::ScaleVectors(scale, points_center, points);
+}
+
+/// Applies p <- A * (p - c) + c, where c is the center of the points if
+/// \p center is true and the origin otherwise.
+template <typename Scalar>
+void TransformAroundCenterT(const Eigen::Matrix3d& A,
+                            Points<Scalar>& points,
+                            bool center) {
+    Eigen::Vector3d points_center(0, 0, 0);
+    if (center && !points.empty()) {
+        points_center = utility::ComputeCentroid(points);
+    }
+    utility::TransformVectorsAroundCenter(A, points_center, points);
+}
+
+}  // unnamed namespace
+
 Eigen::Vector3d Geometry3D::ComputeMinBound(
         const std::vector<Eigen::Vector3d>& points) const {
-    if (points.empty()) {
-        return Eigen::Vector3d(0.0, 0.0, 0.0);
-    }
-    return std::accumulate(
-            points.begin(), points.end(), points[0],
-            [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                return a.array().min(b.array()).matrix();
-            });
+    return utility::ComputeMinBound(points);
+}
+
+Eigen::Vector3d Geometry3D::ComputeMinBound(
+        const std::vector<Eigen::Vector3f>& points) const {
+    return utility::ComputeMinBound(points);
 }
 
 Eigen::Vector3d Geometry3D::ComputeMaxBound(
         const std::vector<Eigen::Vector3d>& points) const {
-    if (points.empty()) {
-        return Eigen::Vector3d(0.0, 0.0, 0.0);
-    }
-    return std::accumulate(
-            points.begin(), points.end(), points[0],
-            [](const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
-                return a.array().max(b.array()).matrix();
-            });
+    return utility::ComputeMaxBound(points);
+}
+
+Eigen::Vector3d Geometry3D::ComputeMaxBound(
+        const std::vector<Eigen::Vector3f>& points) const {
+    return utility::ComputeMaxBound(points);
 }
+
 Eigen::Vector3d Geometry3D::ComputeCenter(
         const std::vector<Eigen::Vector3d>& points) const {
-    Eigen::Vector3d center(0, 0, 0);
-    if (points.empty()) {
-        return center;
-    }
-    center = std::accumulate(points.begin(), points.end(), center);
-    center /= double(points.size());
-    return center;
+    return utility::ComputeCentroid(points);
+}
+
+Eigen::Vector3d Geometry3D::ComputeCenter(
+        const std::vector<Eigen::Vector3f>& points) const {
+    return utility::ComputeCentroid(points);
 }
 
 void Geometry3D::ResizeAndPaintUniformColor(
         std::vector<Eigen::Vector3d>& colors,
         const size_t size,
         const Eigen::Vector3d& color) const {
-    colors.resize(size);
-    Eigen::Vector3d clipped_color = color;
-    if (color.minCoeff() < 0 || color.maxCoeff() > 1) {
-        utility::LogWarning(
-                "invalid color in PaintUniformColor, clipping to [0, 1]");
-        clipped_color = clipped_color.array()
-                                .max(Eigen::Vector3d(0, 0, 0).array())
-                                .matrix();
-        clipped_color = clipped_color.array()
-                                .min(Eigen::Vector3d(1, 1, 1).array())
-                                .matrix();
-    }
-    for (size_t i = 0; i < size; i++) {
-        colors[i] = clipped_color;
-    }
+    ResizeAndPaintUniformColorT(colors, size, color);
+}
+
+void Geometry3D::ResizeAndPaintUniformColor(
+        std::vector<Eigen::Vector3f>& colors,
+        const size_t size,
+        const Eigen::Vector3d& color) const {
+    ResizeAndPaintUniformColorT(colors, size, color);
 }
 
 void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
                                  std::vector<Eigen::Vector3d>& points) const {
-    for (auto& point : points) {
-        Eigen::Vector4d new_point =
-                transformation *
-                Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        point = new_point.head<3>() / new_point(3);
-    }
+    utility::TransformPoints(transformation, points);
+}
+
+void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
+                                 std::vector<Eigen::Vector3f>& points) const {
+    utility::TransformPoints(transformation, points);
 }
 
 void Geometry3D::TransformNormals(const Eigen::Matrix4d& transformation,
                                   std::vector<Eigen::Vector3d>& normals) const {
-    for (auto& normal : normals) {
-        Eigen::Vector4d new_normal =
-                transformation *
-                Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0);
-        normal = new_normal.head<3>();
-    }
+    utility::AffineTransformVectors(
+            transformation.block<3, 3>(0, 0), Eigen::Vector3d::Zero(), normals);
+}
+
+void Geometry3D::TransformNormals(const Eigen::Matrix4d& transformation,
+                                  std::vector<Eigen::Vector3f>& normals) const {
+    utility::AffineTransformVectors(
+            transformation.block<3, 3>(0, 0), Eigen::Vector3d::Zero(), normals);
 }
 
 void Geometry3D::TranslatePoints(const Eigen::Vector3d& translation,
                                  std::vector<Eigen::Vector3d>& points,
                                  bool relative) const {
-    Eigen::Vector3d transform = translation;
-    if (!relative) {
-        transform -= ComputeCenter(points);
-    }
-    for (auto& point : points) {
-        point += transform;
-    }
+    TranslatePointsT(translation, points, relative);
+}
+
+void Geometry3D::TranslatePoints(const Eigen::Vector3d& translation,
+                                 std::vector<Eigen::Vector3f>& points,
+                                 bool relative) const {
+    TranslatePointsT(translation, points, relative);
 }
 
 void Geometry3D::ScalePoints(const double scale,
                              std::vector<Eigen::Vector3d>& points,
                              bool center) const {
-    Eigen::Vector3d points_center(0, 0, 0);
-    if (center && !points.empty()) {
-        points_center = ComputeCenter(points);
-    }
-    for (auto& point : points) {
-        point = (point - points_center) * scale + points_center;
-    }
+    ScalePointsT(scale, points, center);
+}
+
+void Geometry3D::ScalePoints(const double scale,
+                             std::vector<Eigen::Vector3f>& points,
+                             bool center) const {
+    ScalePointsT(scale, points, center);
 }
 
 void Geometry3D::RotatePoints(const Eigen::Matrix3d& R,
                               std::vector<Eigen::Vector3d>& points,
                               bool center) const {
-    Eigen::Vector3d points_center(0, 0, 0);
-    if (center && !points.empty()) {
-        points_center = ComputeCenter(points);
-    }
-    for (auto& point : points) {
-        point = R * (point - points_center) + points_center;
-    }
+    TransformAroundCenterT(R, points, center);
+}
+
+void Geometry3D::RotatePoints(const Eigen::Matrix3d& R,
+                              std::vector<Eigen::Vector3f>& points,
+                              bool center) const {
+    TransformAroundCenterT(R, points, center);
 }
 
 void Geometry3D::RotateNormals(const Eigen::Matrix3d& R,
                                std::vector<Eigen::Vector3d>& normals,
                                bool center) const {
-    for (auto& normal : normals) {
-        normal = R * normal;
-    }
+    utility::AffineTransformVectors(R, Eigen::Vector3d::Zero(), normals);
+}
+
+void Geometry3D::RotateNormals(const Eigen::Matrix3d& R,
+                               std::vector<Eigen::Vector3f>& normals,
+                               bool center) const {
+    utility::AffineTransformVectors(R, Eigen::Vector3d::Zero(), normals);
 }
 
 Eigen::Matrix3d Geometry3D::GetRotationMatrixFromXYZ(
@@ -198,6 +198,37 @@ protected:
     void RotateNormals(const Eigen::Matrix3d& R,
                        std::vector<Eigen::Vector3d>& normals,
                        bool center) const;
+
+    /// Single-precision overloads of the helpers above, used by PointCloudF
+    /// and TriangleMeshF. Rigid and affine transforms, translations, scaling
+    /// and rotations cast the matrix and offsets to float and run in single
+    /// precision. Projective transforms, bounds and centers are computed in
+    /// double precision.
+    Eigen::Vector3d ComputeMinBound(
+            const std::vector<Eigen::Vector3f>& points) const;
+    Eigen::Vector3d ComputeMaxBound(
+            const std::vector<Eigen::Vector3f>& points) const;
+    Eigen::Vector3d ComputeCenter(
+            const std::vector<Eigen::Vector3f>& points) const;
+    void ResizeAndPaintUniformColor(std::vector<Eigen::Vector3f>& colors,
+                                    const size_t size,
+                                    const Eigen::Vector3d& color) const;
+    void TransformPoints(const Eigen::Matrix4d& transformation,
+                         std::vector<Eigen::Vector3f>& points) const;
+    void TransformNormals(const Eigen::Matrix4d& transformation,
+                          std::vector<Eigen::Vector3f>& normals) const;
+    void TranslatePoints(const Eigen::Vector3d& translation,
+                         std::vector<Eigen::Vector3f>& points,
+                         bool relative) const;
+    void ScalePoints(const double scale,
+                     std::vector<Eigen::Vector3f>& points,
+                     bool center) const;
+    void RotatePoints(const Eigen::Matrix3d& R,
+                      std::vector<Eigen::Vector3f>& points,
+                      bool center) const;
+    void RotateNormals(const Eigen::Matrix3d& R,
+                       std::vector<Eigen::Vector3f>& normals,
+                       bool center) const;
 };
 
 }  // namespace geometry
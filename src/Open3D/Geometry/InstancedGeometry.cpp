@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/InstancedGeometry.h"
+
+#include "Open3D/Geometry/BoundingVolume.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Corners of the bounding box of the base geometry, transformed into world
+/// coordinates for every instance.
+std::vector<Eigen::Vector3d> ComputeInstanceBoxPoints(
+        const InstancedGeometry &instanced) {
+    std::vector<Eigen::Vector3d> points;
+    if (instanced.IsEmpty()) {
+        return points;
+    }
+    const std::vector<Eigen::Vector3d> corners =
+            instanced.base_geometry_->GetAxisAlignedBoundingBox()
+                    .GetBoxPoints();
+    points.reserve(corners.size() * instanced.transforms_.size());
+    for (const auto &transformation : instanced.transforms_) {
+        for (const auto &corner : corners) {
+            points.push_back(transformation.block<3, 3>(0, 0) * corner +
+                             transformation.block<3, 1>(0, 3));
+        }
+    }
+    return points;
+}
+
+}  // unnamed namespace
+
+InstancedGeometry &InstancedGeometry::Clear() {
+    base_geometry_.reset();
+    transforms_.clear();
+    colors_.clear();
+    return *this;
+}
+
+bool InstancedGeometry::IsEmpty() const {
+    return !HasValidBaseGeometry() || base_geometry_->IsEmpty() ||
+           !HasInstances();
+}
+
+Eigen::Vector3d InstancedGeometry::GetMinBound() const {
+    return ComputeMinBound(ComputeInstanceBoxPoints(*this));
+}
+
+Eigen::Vector3d InstancedGeometry::GetMaxBound() const {
+    return ComputeMaxBound(ComputeInstanceBoxPoints(*this));
+}
+
+Eigen::Vector3d InstancedGeometry::GetCenter() const {
+    Eigen::Vector3d center(0, 0, 0);
+    if (IsEmpty()) {
+        return center;
+    }
+    const Eigen::Vector3d base_center = base_geometry_->GetCenter();
+    for (const auto &transformation : transforms_) {
+        center += transformation.block<3, 3>(0, 0) * base_center +
+                  transformation.block<3, 1>(0, 3);
+    }
+    return center / (double)transforms_.size();
+}
+
+AxisAlignedBoundingBox InstancedGeometry::GetAxisAlignedBoundingBox() const {
+    return AxisAlignedBoundingBox::CreateFromPoints(
+            ComputeInstanceBoxPoints(*this));
+}
+
+OrientedBoundingBox InstancedGeometry::GetOrientedBoundingBox() const {
+    return OrientedBoundingBox::CreateFromPoints(
+            ComputeInstanceBoxPoints(*this));
+}
+
+InstancedGeometry &InstancedGeometry::Transform(
+        const Eigen::Matrix4d &transformation) {
+    for (auto &instance_transformation : transforms_) {
+        instance_transformation = transformation * instance_transformation;
+    }
+    return *this;
+}
+
+InstancedGeometry &InstancedGeometry::Translate(
+        const Eigen::Vector3d &translation, bool relative) {
+    Eigen::Vector3d offset = translation;
+    if (!relative) {
+        offset -= GetCenter();
+    }
+    for (auto &transformation : transforms_) {
+        transformation.block<3, 1>(0, 3) += offset;
+    }
+    return *this;
+}
+
+InstancedGeometry &InstancedGeometry::Scale(const double scale, bool center) {
+    Eigen::Vector3d scale_center(0, 0, 0);
+    if (center && !IsEmpty()) {
+        scale_center = GetCenter();
+    }
+    Eigen::Matrix4d scaling = Eigen::Matrix4d::Identity();
+    scaling.block<3, 3>(0, 0) *= scale;
+    scaling.block<3, 1>(0, 3) = (1.0 - scale) * scale_center;
+    return Transform(scaling);
+}
+
+InstancedGeometry &InstancedGeometry::Rotate(const Eigen::Matrix3d &R,
+                                             bool center) {
+    Eigen::Vector3d rotation_center(0, 0, 0);
+    if (center && !IsEmpty()) {
+        rotation_center = GetCenter();
+    }
+    Eigen::Matrix4d rotation = Eigen::Matrix4d::Identity();
+    rotation.block<3, 3>(0, 0) = R;
+    rotation.block<3, 1>(0, 3) = rotation_center - R * rotation_center;
+    return Transform(rotation);
+}
+
+bool InstancedGeometry::HasValidBaseGeometry() const {
+    return base_geometry_ &&
+           (base_geometry_->GetGeometryType() ==
+                    Geometry::GeometryType::TriangleMesh ||
+            base_geometry_->GetGeometryType() ==
+                    Geometry::GeometryType::LineSet);
+}
+
+InstancedGeometry &InstancedGeometry::AddInstance(
+        const Eigen::Matrix4d &transformation) {
+    transforms_.push_back(transformation);
+    if (!colors_.empty()) {
+        // Colors must cover every instance, see HasColors().
+        colors_.resize(transforms_.size(), Eigen::Vector3d::Ones());
+    }
+    return *this;
+}
+
+InstancedGeometry &InstancedGeometry::AddInstance(
+        const Eigen::Matrix4d &transformation, const Eigen::Vector3d &color) {
+    transforms_.push_back(transformation);
+    colors_.resize(transforms_.size() - 1, Eigen::Vector3d::Ones());
+    colors_.push_back(color);
+    return *this;
+}
+
+}  // namespace geometry
+}  // namespace open3d
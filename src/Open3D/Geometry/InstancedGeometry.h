@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry3D.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+namespace geometry {
+
+class OrientedBoundingBox;
+class AxisAlignedBoundingBox;
+
+/// \class InstancedGeometry
+///
+/// \brief Many copies of one TriangleMesh or LineSet, each with its own rigid
+/// (or similarity) transform and color.
+///
+/// The base geometry is shared and not modified. The visualizer uploads it
+/// once and draws all instances with a single instanced draw call, which is
+/// much cheaper than adding every copy as a separate geometry.
+class InstancedGeometry : public Geometry3D {
+public:
+    InstancedGeometry()
+        : Geometry3D(Geometry::GeometryType::InstancedGeometry) {}
+    /// \param base_geometry The TriangleMesh or LineSet drawn for every
+    /// instance.
+    InstancedGeometry(std::shared_ptr<const Geometry3D> base_geometry)
+        : Geometry3D(Geometry::GeometryType::InstancedGeometry),
+          base_geometry_(base_geometry) {}
+    ~InstancedGeometry() override {}
+
+public:
+    InstancedGeometry &Clear() override;
+    bool IsEmpty() const override;
+    Eigen::Vector3d GetMinBound() const override;
+    Eigen::Vector3d GetMaxBound() const override;
+    Eigen::Vector3d GetCenter() const override;
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const override;
+    OrientedBoundingBox GetOrientedBoundingBox() const override;
+    InstancedGeometry &Transform(
+            const Eigen::Matrix4d &transformation) override;
+    InstancedGeometry &Translate(const Eigen::Vector3d &translation,
+                                 bool relative = true) override;
+    InstancedGeometry &Scale(const double scale, bool center = true) override;
+    InstancedGeometry &Rotate(const Eigen::Matrix3d &R,
+                              bool center = true) override;
+
+    /// Returns true if the base geometry is a TriangleMesh or a LineSet.
+    bool HasValidBaseGeometry() const;
+
+    bool HasInstances() const { return transforms_.size() > 0; }
+
+    bool HasColors() const {
+        return HasInstances() && colors_.size() == transforms_.size();
+    }
+
+    /// Appends an instance placed by \p transformation.
+    InstancedGeometry &AddInstance(const Eigen::Matrix4d &transformation);
+    /// Appends an instance placed by \p transformation with color \p color.
+    InstancedGeometry &AddInstance(const Eigen::Matrix4d &transformation,
+                                   const Eigen::Vector3d &color);
+
+    /// Assigns each instance the same color \p color.
+    InstancedGeometry &PaintUniformColor(const Eigen::Vector3d &color) {
+        ResizeAndPaintUniformColor(colors_, transforms_.size(), color);
+        return *this;
+    }
+
+public:
+    /// The geometry drawn for every instance, a TriangleMesh or LineSet.
+    std::shared_ptr<const Geometry3D> base_geometry_;
+    /// Transformation from base geometry to world coordinates per instance.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transforms_;
+    /// Instance colors. If empty, the colors of the base geometry are used.
+    std::vector<Eigen::Vector3d> colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -31,14 +31,145 @@
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 
+#include <algorithm>
 #include <flann/flann.hpp>
+#include <type_traits>
 
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
+
+namespace {
+
+/// Query in the scalar type of the index. Queries that already have that
+/// type are used in place, others are converted.
+template <typename Scalar,
+          typename T,
+          bool same = std::is_same<Scalar, typename T::Scalar>::value>
+class FlannQuery {
+public:
+    explicit FlannQuery(const T &query) : data_((Scalar *)query.data()) {}
+    Scalar *data_;
+};
+
+template <typename Scalar, typename T>
+class FlannQuery<Scalar, T, false> {
+public:
+    explicit FlannQuery(const T &query)
+        : query_(query.template cast<Scalar>()), data_(query_.data()) {}
+    Eigen::Matrix<Scalar, T::RowsAtCompileTime, 1> query_;
+    Scalar *data_;
+};
+
+/// Output buffer for squared distances. A double-precision index writes
+/// into \p distance2 directly, a single-precision index into a per-thread
+/// buffer that is copied afterwards.
+template <typename Scalar>
+class FlannDistances {
+public:
+    FlannDistances(std::vector<double> &distance2, int size)
+        : distance2_(distance2) {
+        buffer_.resize(size);
+    }
+    Scalar *data() { return buffer_.data(); }
+    void CopyTo(int k) {
+        std::copy(buffer_.begin(), buffer_.begin() + k, distance2_.begin());
+    }
+
+private:
+    std::vector<double> &distance2_;
+    static thread_local std::vector<Scalar> buffer_;
+};
+
+template <typename Scalar>
+thread_local std::vector<Scalar> FlannDistances<Scalar>::buffer_;
+
+template <>
+class FlannDistances<double> {
+public:
+    FlannDistances(std::vector<double> &distance2, int size)
+        : distance2_(distance2) {}
+    double *data() { return distance2_.data(); }
+    void CopyTo(int k) {}
+
+private:
+    std::vector<double> &distance2_;
+};
+
+template <typename Scalar, typename T>
+int SearchKNNT(flann::Index<flann::L2<Scalar>> &index,
+               size_t dimension,
+               const T &query,
+               int knn,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) {
+    FlannQuery<Scalar, T> query_data(query);
+    flann::Matrix<Scalar> query_flann(query_data.data_, 1, dimension);
+    indices.resize(knn);
+    distance2.resize(knn);
+    FlannDistances<Scalar> dists(distance2, knn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
+    flann::Matrix<Scalar> dists_flann(dists.data(), query_flann.rows, knn);
+    int k = index.knnSearch(query_flann, indices_flann, dists_flann, knn,
+                            flann::SearchParams(-1, 0.0));
+    dists.CopyTo(k);
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
+template <typename Scalar, typename T>
+int SearchRadiusT(flann::Index<flann::L2<Scalar>> &index,
+                  size_t dimension,
+                  const T &query,
+                  double radius,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) {
+    FlannQuery<Scalar, T> query_data(query);
+    flann::Matrix<Scalar> query_flann(query_data.data_, 1, dimension);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = -1;
+    std::vector<std::vector<int>> indices_vec(1);
+    std::vector<std::vector<Scalar>> dists_vec(1);
+    int k = index.radiusSearch(query_flann, indices_vec, dists_vec,
+                               float(radius * radius), param);
+    indices = indices_vec[0];
+    distance2.assign(dists_vec[0].begin(), dists_vec[0].end());
+    return k;
+}
+
+template <typename Scalar, typename T>
+int SearchHybridT(flann::Index<flann::L2<Scalar>> &index,
+                  size_t dimension,
+                  const T &query,
+                  double radius,
+                  int max_nn,
+                  std::vector<int> &indices,
+                  std::vector<double> &distance2) {
+    FlannQuery<Scalar, T> query_data(query);
+    flann::Matrix<Scalar> query_flann(query_data.data_, 1, dimension);
+    flann::SearchParams param(-1, 0.0);
+    param.max_neighbors = max_nn;
+    indices.resize(max_nn);
+    distance2.resize(max_nn);
+    FlannDistances<Scalar> dists(distance2, max_nn);
+    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
+    flann::Matrix<Scalar> dists_flann(dists.data(), query_flann.rows, max_nn);
+    int k = index.radiusSearch(query_flann, indices_flann, dists_flann,
+                               float(radius * radius), param);
+    dists.CopyTo(k);
+    indices.resize(k);
+    distance2.resize(k);
+    return k;
+}
+
+}  // unnamed namespace
+
 namespace geometry {
 
 KDTreeFlann::KDTreeFlann() {}
@@ -71,6 +202,16 @@ bool KDTreeFlann::SetGeometry(const Geometry &geometry) {
                     (const double *)((const TriangleMesh &)geometry)
                             .vertices_.data(),
                     3, ((const TriangleMesh &)geometry).vertices_.size()));
+        case Geometry::GeometryType::PointCloudF:
+            return SetRawData(Eigen::Map<const Eigen::MatrixXf>(
+                    (const float *)((const PointCloudF &)geometry)
+                            .points_.data(),
+                    3, ((const PointCloudF &)geometry).points_.size()));
+        case Geometry::GeometryType::TriangleMeshF:
+            return SetRawData(Eigen::Map<const Eigen::MatrixXf>(
+                    (const float *)((const TriangleMeshF &)geometry)
+                            .vertices_.data(),
+                    3, ((const TriangleMeshF &)geometry).vertices_.size()));
         case Geometry::GeometryType::Image:
         case Geometry::GeometryType::Unspecified:
         default:
@@ -116,20 +257,16 @@ int KDTreeFlann::SearchKNN(const T &query,
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if ((data_.empty() && data_float_.empty()) || dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_ || knn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    indices.resize(knn);
-    distance2.resize(knn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, knn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows, knn);
-    int k = flann_index_->knnSearch(query_flann, indices_flann, dists_flann,
-                                    knn, flann::SearchParams(-1, 0.0));
-    indices.resize(k);
-    distance2.resize(k);
-    return k;
+    if (flann_index_float_) {
+        return SearchKNNT(*flann_index_float_, dimension_, query, knn,
+                          indices, distance2);
+    }
+    return SearchKNNT(*flann_index_, dimension_, query, knn, indices,
+                      distance2);
 }
 
 template <typename T>
@@ -141,20 +278,16 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if ((data_.empty() && data_float_.empty()) || dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = -1;
-    std::vector<std::vector<int>> indices_vec(1);
-    std::vector<std::vector<double>> dists_vec(1);
-    int k = flann_index_->radiusSearch(query_flann, indices_vec, dists_vec,
-                                       float(radius * radius), param);
-    indices = indices_vec[0];
-    distance2 = dists_vec[0];
-    return k;
+    if (flann_index_float_) {
+        return SearchRadiusT(*flann_index_float_, dimension_, query, radius,
+                             indices, distance2);
+    }
+    return SearchRadiusT(*flann_index_, dimension_, query, radius, indices,
+                         distance2);
 }
 
 template <typename T>
@@ -167,23 +300,16 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if ((data_.empty() && data_float_.empty()) || dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_ || max_nn < 0) {
         return -1;
     }
-    flann::Matrix<double> query_flann((double *)query.data(), 1, dimension_);
-    flann::SearchParams param(-1, 0.0);
-    param.max_neighbors = max_nn;
-    indices.resize(max_nn);
-    distance2.resize(max_nn);
-    flann::Matrix<int> indices_flann(indices.data(), query_flann.rows, max_nn);
-    flann::Matrix<double> dists_flann(distance2.data(), query_flann.rows,
-                                      max_nn);
-    int k = flann_index_->radiusSearch(query_flann, indices_flann, dists_flann,
-                                       float(radius * radius), param);
-    indices.resize(k);
-    distance2.resize(k);
-    return k;
+    if (flann_index_float_) {
+        return SearchHybridT(*flann_index_float_, dimension_, query, radius,
+                             max_nn, indices, distance2);
+    }
+    return SearchHybridT(*flann_index_, dimension_, query, radius, max_nn,
+                         indices, distance2);
 }
 
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
@@ -201,6 +327,30 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     flann_index_.reset(new flann::Index<flann::L2<double>>(
             *flann_dataset_, flann::KDTreeSingleIndexParams(15)));
     flann_index_->buildIndex();
+    data_float_.clear();
+    flann_dataset_float_.reset();
+    flann_index_float_.reset();
+    return true;
+}
+
+bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXf> &data) {
+    dimension_ = data.rows();
+    dataset_size_ = data.cols();
+    if (dimension_ == 0 || dataset_size_ == 0) {
+        utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
+        return false;
+    }
+    data_float_.resize(dataset_size_ * dimension_);
+    memcpy(data_float_.data(), data.data(),
+           dataset_size_ * dimension_ * sizeof(float));
+    flann_dataset_float_.reset(new flann::Matrix<float>(
+            (float *)data_float_.data(), dataset_size_, dimension_));
+    flann_index_float_.reset(new flann::Index<flann::L2<float>>(
+            *flann_dataset_float_, flann::KDTreeSingleIndexParams(15)));
+    flann_index_float_->buildIndex();
+    data_.clear();
+    flann_dataset_.reset();
+    flann_index_.reset();
     return true;
 }
 
@@ -248,6 +398,28 @@ template int KDTreeFlann::SearchHybrid<Eigen::VectorXd>(
         std::vector<int> &indices,
         std::vector<double> &distance2) const;
 
+template int KDTreeFlann::Search<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        const KDTreeSearchParam &param,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchKNN<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        int knn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchRadius<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        double radius,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+template int KDTreeFlann::SearchHybrid<Eigen::Vector3f>(
+        const Eigen::Vector3f &query,
+        double radius,
+        int max_nn,
+        std::vector<int> &indices,
+        std::vector<double> &distance2) const;
+
 }  // namespace geometry
 }  // namespace open3d
 
@@ -88,11 +88,17 @@ public:
 
 private:
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
+    /// Builds a single-precision index, used for PointCloudF and
+    /// TriangleMeshF. Queries of either precision are converted to float.
+    bool SetRawData(const Eigen::Map<const Eigen::MatrixXf> &data);
 
 protected:
     std::vector<double> data_;
     std::unique_ptr<flann::Matrix<double>> flann_dataset_;
     std::unique_ptr<flann::Index<flann::L2<double>>> flann_index_;
+    std::vector<float> data_float_;
+    std::unique_ptr<flann::Matrix<float>> flann_dataset_float_;
+    std::unique_ptr<flann::Index<flann::L2<float>>> flann_index_float_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
@@ -31,6 +31,8 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TetraMesh.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -62,20 +64,42 @@ std::shared_ptr<LineSet> LineSet::CreateFromTriangleMesh(
     auto line_set = std::make_shared<LineSet>();
     line_set->points_ = mesh.vertices_;
 
-    std::unordered_set<Eigen::Vector2i,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            inserted_edges;
-    auto InsertEdge = [&](int vidx0, int vidx1) {
-        Eigen::Vector2i edge(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
-        if (inserted_edges.count(edge) == 0) {
-            inserted_edges.insert(edge);
-            line_set->lines_.push_back(Eigen::Vector2i(vidx0, vidx1));
+    // Every triangle edge is keyed by its sorted vertex pair and tagged with
+    // its position in the triangle list. After sorting, the first entry of
+    // each key is the first occurrence of the edge, so the lines keep the
+    // order and orientation in which they appear in the mesh.
+    const int num_edges = int(mesh.triangles_.size() * 3);
+    std::vector<std::pair<uint64_t, int>> edges(num_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_edges; i++) {
+        const auto &triangle = mesh.triangles_[i / 3];
+        uint32_t vidx0 = uint32_t(triangle(i % 3));
+        uint32_t vidx1 = uint32_t(triangle((i + 1) % 3));
+        uint64_t key = (uint64_t(std::min(vidx0, vidx1)) << 32) |
+                       uint64_t(std::max(vidx0, vidx1));
+        edges[i] = std::make_pair(key, i);
+    }
+    utility::ParallelSort(edges);
+
+    std::vector<int> first_edges;
+    for (size_t i = 0; i < edges.size(); i++) {
+        if (i == 0 || edges[i].first != edges[i - 1].first) {
+            first_edges.push_back(edges[i].second);
         }
-    };
-    for (const auto &triangle : mesh.triangles_) {
-        InsertEdge(triangle(0), triangle(1));
-        InsertEdge(triangle(1), triangle(2));
-        InsertEdge(triangle(2), triangle(0));
+    }
+    utility::ParallelSort(first_edges);
+
+    line_set->lines_.resize(first_edges.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(first_edges.size()); i++) {
+        int edge = first_edges[i];
+        const auto &triangle = mesh.triangles_[edge / 3];
+        line_set->lines_[i] =
+                Eigen::Vector2i(triangle(edge % 3), triangle((edge + 1) % 3));
     }
 
     return line_set;
@@ -35,6 +35,7 @@
 
 #include "Open3D/Geometry/Geometry3D.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/VectorKernels.h"
 
 namespace open3d {
 namespace geometry {
@@ -95,12 +96,8 @@ public:
     }
 
     MeshBase &NormalizeNormals() {
-        for (size_t i = 0; i < vertex_normals_.size(); i++) {
-            vertex_normals_[i].normalize();
-            if (std::isnan(vertex_normals_[i](0))) {
-                vertex_normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-            }
-        }
+        utility::NormalizeVectors(vertex_normals_,
+                                  Eigen::Vector3d(0.0, 0.0, 1.0));
         return *this;
     }
 
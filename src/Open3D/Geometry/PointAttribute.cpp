@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointAttribute.h"
+
+#include <cstring>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+PointAttribute::PointAttribute(Dtype dtype, int dimension, size_t size)
+    : dtype_(dtype), dimension_(dimension) {
+    if (dimension <= 0) {
+        utility::LogError("[PointAttribute] dimension must be positive.");
+    }
+    Resize(size);
+}
+
+size_t PointAttribute::SizeOfDtype(Dtype dtype) {
+    switch (dtype) {
+        case Dtype::UInt8:
+            return 1;
+        case Dtype::Int32:
+        case Dtype::Float32:
+            return 4;
+        case Dtype::Int64:
+        case Dtype::Float64:
+            return 8;
+    }
+    return 0;
+}
+
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<uint8_t>() {
+    return Dtype::UInt8;
+}
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<int32_t>() {
+    return Dtype::Int32;
+}
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<int64_t>() {
+    return Dtype::Int64;
+}
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<float>() {
+    return Dtype::Float32;
+}
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<double>() {
+    return Dtype::Float64;
+}
+
+size_t PointAttribute::GetSize() const {
+    return data_.size() / GetRowByteSize();
+}
+
+void PointAttribute::Resize(size_t size) {
+    data_.resize(size * GetRowByteSize(), 0);
+}
+
+template <typename T>
+T *PointAttribute::GetDataPtr() {
+    if (DtypeOf<T>() != dtype_) {
+        utility::LogError("[PointAttribute] Dtype mismatch.");
+    }
+    return reinterpret_cast<T *>(data_.data());
+}
+
+template <typename T>
+const T *PointAttribute::GetDataPtr() const {
+    if (DtypeOf<T>() != dtype_) {
+        utility::LogError("[PointAttribute] Dtype mismatch.");
+    }
+    return reinterpret_cast<const T *>(data_.data());
+}
+
+PointAttribute PointAttribute::Select(
+        const std::vector<size_t> &indices) const {
+    PointAttribute output(dtype_, dimension_, indices.size());
+    size_t row_bytes = GetRowByteSize();
+    for (size_t i = 0; i < indices.size(); i++) {
+        std::memcpy(output.data_.data() + i * row_bytes,
+                    data_.data() + indices[i] * row_bytes, row_bytes);
+    }
+    return output;
+}
+
+void PointAttribute::SelectInPlace(const std::vector<size_t> &indices) {
+    size_t row_bytes = GetRowByteSize();
+    for (size_t i = 0; i < indices.size(); i++) {
+        if (indices[i] != i) {
+            std::memcpy(data_.data() + i * row_bytes,
+                        data_.data() + indices[i] * row_bytes, row_bytes);
+        }
+    }
+    data_.resize(indices.size() * row_bytes);
+}
+
+bool PointAttribute::Append(const PointAttribute &other) {
+    if (other.dtype_ != dtype_ || other.dimension_ != dimension_) {
+        return false;
+    }
+    size_t other_bytes = other.data_.size();
+    size_t old_bytes = data_.size();
+    data_.resize(old_bytes + other_bytes);
+    // Resizing moves the source too if a column is appended to itself.
+    const uint8_t *source =
+            (&other == this) ? data_.data() : other.data_.data();
+    std::memcpy(data_.data() + old_bytes, source, other_bytes);
+    return true;
+}
+
+template uint8_t *PointAttribute::GetDataPtr<uint8_t>();
+template int32_t *PointAttribute::GetDataPtr<int32_t>();
+template int64_t *PointAttribute::GetDataPtr<int64_t>();
+template float *PointAttribute::GetDataPtr<float>();
+template double *PointAttribute::GetDataPtr<double>();
+template const uint8_t *PointAttribute::GetDataPtr<uint8_t>() const;
+template const int32_t *PointAttribute::GetDataPtr<int32_t>() const;
+template const int64_t *PointAttribute::GetDataPtr<int64_t>() const;
+template const float *PointAttribute::GetDataPtr<float>() const;
+template const double *PointAttribute::GetDataPtr<double>() const;
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class PointAttribute
+///
+/// \brief Column of per-point values, e.g. intensity, timestamps or labels.
+///
+/// Every point owns \p dimension consecutive values of type \p dtype. The
+/// values of all points are stored contiguously in row-major order, so the
+/// column can be handed to NumPy without copying.
+class PointAttribute {
+public:
+    enum class Dtype {
+        UInt8 = 0,
+        Int32 = 1,
+        Int64 = 2,
+        Float32 = 3,
+        Float64 = 4,
+    };
+
+public:
+    PointAttribute() {}
+    PointAttribute(Dtype dtype, int dimension, size_t size = 0);
+
+public:
+    /// Returns the size of one value of type \p dtype in bytes.
+    static size_t SizeOfDtype(Dtype dtype);
+    /// Returns the Dtype of a C++ scalar type. Only defined for the types
+    /// listed in Dtype.
+    template <typename T>
+    static Dtype DtypeOf();
+
+    Dtype GetDtype() const { return dtype_; }
+    int GetDimension() const { return dimension_; }
+    /// Number of points.
+    size_t GetSize() const;
+    /// Size of the values of one point in bytes.
+    size_t GetRowByteSize() const {
+        return SizeOfDtype(dtype_) * size_t(dimension_);
+    }
+    bool IsEmpty() const { return data_.empty(); }
+
+    /// Resizes to \p size points. New values are zero.
+    void Resize(size_t size);
+    void Clear() { data_.clear(); }
+
+    void *GetData() { return data_.data(); }
+    const void *GetData() const { return data_.data(); }
+    /// Typed access to the values; calls LogError if \p T does not match the
+    /// Dtype of the column.
+    template <typename T>
+    T *GetDataPtr();
+    template <typename T>
+    const T *GetDataPtr() const;
+
+    /// Returns the rows with indices in \p indices, in that order.
+    PointAttribute Select(const std::vector<size_t> &indices) const;
+    /// Keeps the rows with indices in \p indices, in that order. Indices
+    /// must be increasing.
+    void SelectInPlace(const std::vector<size_t> &indices);
+    /// Appends the rows of \p other. Returns false if the dtype or dimension
+    /// differ.
+    bool Append(const PointAttribute &other);
+
+private:
+    Dtype dtype_ = Dtype::Float64;
+    int dimension_ = 1;
+    std::vector<uint8_t> data_;
+};
+
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<uint8_t>();
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<int32_t>();
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<int64_t>();
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<float>();
+template <>
+PointAttribute::Dtype PointAttribute::DtypeOf<double>();
+
+}  // namespace geometry
+}  // namespace open3d
@@ -42,6 +42,7 @@ PointCloud &PointCloud::Clear() {
     points_.clear();
     normals_.clear();
     colors_.clear();
+    attributes_.clear();
     return *this;
 }
 
@@ -109,6 +110,25 @@ PointCloud &PointCloud::operator+=(const PointCloud &cloud) {
     } else {
         colors_.clear();
     }
+    // Keep only the attributes both clouds have with the same layout.
+    for (auto it = attributes_.begin(); it != attributes_.end();) {
+        auto other = cloud.attributes_.find(it->first);
+        if (HasPoints() && HasAttribute(it->first) &&
+            other != cloud.attributes_.end() &&
+            cloud.HasAttribute(it->first) &&
+            it->second.Append(other->second)) {
+            ++it;
+        } else {
+            it = attributes_.erase(it);
+        }
+    }
+    if (!HasPoints()) {
+        for (const auto &attribute : cloud.attributes_) {
+            if (cloud.HasAttribute(attribute.first)) {
+                attributes_[attribute.first] = attribute.second;
+            }
+        }
+    }
     points_.resize(new_vert_num);
     for (size_t i = 0; i < add_vert_num; i++)
         points_[old_vert_num + i] = cloud.points_[i];
@@ -147,6 +167,8 @@ PointCloud &PointCloud::RemoveNoneFinitePoints(bool remove_nan,
     bool has_normal = HasNormals();
     bool has_color = HasColors();
     size_t old_point_num = points_.size();
+    bool has_attribute = !attributes_.empty();
+    std::vector<size_t> kept_indices;
     size_t k = 0;                                 // new index
     for (size_t i = 0; i < old_point_num; i++) {  // old index
         bool is_nan = remove_nan &&
@@ -159,9 +181,18 @@ PointCloud &PointCloud::RemoveNoneFinitePoints(bool remove_nan,
             points_[k] = points_[i];
             if (has_normal) normals_[k] = normals_[i];
             if (has_color) colors_[k] = colors_[i];
+            if (has_attribute) kept_indices.push_back(i);
             k++;
         }
     }
+    for (auto it = attributes_.begin(); it != attributes_.end();) {
+        if (it->second.GetSize() == old_point_num) {
+            it->second.SelectInPlace(kept_indices);
+            ++it;
+        } else {
+            it = attributes_.erase(it);
+        }
+    }
     points_.resize(k);
     if (has_normal) normals_.resize(k);
     if (has_color) colors_.resize(k);
@@ -173,39 +204,7 @@ PointCloud &PointCloud::RemoveNoneFinitePoints(bool remove_nan,
 
 std::tuple<Eigen::Vector3d, Eigen::Matrix3d>
 PointCloud::ComputeMeanAndCovariance() const {
-    if (IsEmpty()) {
-        return std::make_tuple(Eigen::Vector3d::Zero(),
-                               Eigen::Matrix3d::Identity());
-    }
-    Eigen::Matrix<double, 9, 1> cumulants;
-    cumulants.setZero();
-    for (const auto &point : points_) {
-        cumulants(0) += point(0);
-        cumulants(1) += point(1);
-        cumulants(2) += point(2);
-        cumulants(3) += point(0) * point(0);
-        cumulants(4) += point(0) * point(1);
-        cumulants(5) += point(0) * point(2);
-        cumulants(6) += point(1) * point(1);
-        cumulants(7) += point(1) * point(2);
-        cumulants(8) += point(2) * point(2);
-    }
-    cumulants /= (double)points_.size();
-    Eigen::Vector3d mean;
-    Eigen::Matrix3d covariance;
-    mean(0) = cumulants(0);
-    mean(1) = cumulants(1);
-    mean(2) = cumulants(2);
-    covariance(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
-    covariance(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
-    covariance(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
-    covariance(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
-    covariance(1, 0) = covariance(0, 1);
-    covariance(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
-    covariance(2, 0) = covariance(0, 2);
-    covariance(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
-    covariance(2, 1) = covariance(1, 2);
-    return std::make_tuple(mean, covariance);
+    return utility::ComputeMeanAndCovariance(points_);
 }
 
 std::vector<double> PointCloud::ComputeMahalanobisDistance() const {
@@ -312,5 +311,42 @@ PointCloud::HiddenPointRemoval(const Eigen::Vector3d &camera_location,
     return std::make_tuple(visible_mesh, pt_map);
 }
 
+bool PointCloud::HasAttribute(const std::string &name) const {
+    auto it = attributes_.find(name);
+    return it != attributes_.end() && points_.size() > 0 &&
+           it->second.GetSize() == points_.size();
+}
+
+PointAttribute &PointCloud::AddAttribute(const std::string &name,
+                                         PointAttribute::Dtype dtype,
+                                         int dimension) {
+    if (dimension <= 0) {
+        utility::LogError("[AddAttribute] Invalid dimension {:d}.", dimension);
+    }
+    PointAttribute &attribute = attributes_[name];
+    attribute = PointAttribute(dtype, dimension, points_.size());
+    return attribute;
+}
+
+PointAttribute &PointCloud::GetAttribute(const std::string &name) {
+    auto it = attributes_.find(name);
+    if (it == attributes_.end()) {
+        utility::LogError("[GetAttribute] Attribute {} does not exist.", name);
+    }
+    return it->second;
+}
+
+const PointAttribute &PointCloud::GetAttribute(const std::string &name) const {
+    auto it = attributes_.find(name);
+    if (it == attributes_.end()) {
+        utility::LogError("[GetAttribute] Attribute {} does not exist.", name);
+    }
+    return it->second;
+}
+
+bool PointCloud::RemoveAttribute(const std::string &name) {
+    return attributes_.erase(name) > 0;
+}
+
 }  // namespace geometry
 }  // namespace open3d
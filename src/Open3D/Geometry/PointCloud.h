@@ -27,12 +27,16 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <map>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
 #include "Open3D/Geometry/Geometry3D.h"
 #include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointAttribute.h"
+#include "Open3D/Utility/VectorKernels.h"
 
 namespace open3d {
 
@@ -40,6 +44,11 @@ namespace camera {
 class PinholeCameraIntrinsic;
 }
 
+namespace utility {
+class Arena;
+class ProgressToken;
+}
+
 namespace geometry {
 
 class Image;
@@ -82,9 +91,7 @@ public:
     }
 
     PointCloud &NormalizeNormals() {
-        for (size_t i = 0; i < normals_.size(); i++) {
-            normals_[i].normalize();
-        }
+        utility::NormalizeVectors(normals_);
         return *this;
     }
 
@@ -94,6 +101,20 @@ public:
         return *this;
     }
 
+    /// Returns true if the attribute \p name exists and has one row per
+    /// point.
+    bool HasAttribute(const std::string &name) const;
+    /// Adds the zero-filled attribute \p name with one row of \p dimension
+    /// values per point, replacing any attribute with the same name.
+    PointAttribute &AddAttribute(const std::string &name,
+                                 PointAttribute::Dtype dtype,
+                                 int dimension = 1);
+    /// Returns the attribute \p name. Calls LogError if it does not exist.
+    PointAttribute &GetAttribute(const std::string &name);
+    const PointAttribute &GetAttribute(const std::string &name) const;
+    /// Removes the attribute \p name. Returns false if it does not exist.
+    bool RemoveAttribute(const std::string &name);
+
     /// Remove all points fromt he point cloud that have a nan entry, or
     /// infinite entries.
     /// Also removes the corresponding normals and color entries.
@@ -109,8 +130,17 @@ public:
     /// Function to downsample \param input pointcloud into output pointcloud
     /// with a voxel \param voxel_size defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud. Normals and colors are
-    /// averaged if they exist.
+    /// averaged if they exist; named attributes take the values of the first
+    /// point in each voxel.
     std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
+    /// Same as above, but writes into \p output and keeps the capacity of its
+    /// attributes. Reusing \p output across frames avoids reallocating the
+    /// output attributes. \p output must not be this point cloud. If \p arena
+    /// is given, it is reset and holds the voxel map, so that reusing it too
+    /// avoids allocating the map every frame.
+    PointCloud &VoxelDownSample(double voxel_size,
+                                PointCloud &output,
+                                utility::Arena *arena = nullptr) const;
 
     /// Function to downsample using VoxelDownSample, but specialized for
     /// Surface convolution project. Experimental function.
@@ -207,9 +237,14 @@ public:
     /// in Large Spatial Databases with Noise", 1996
     /// Returns a vector of point labels, -1 indicates noise according to
     /// the algorithm.
-    std::vector<int> ClusterDBSCAN(double eps,
-                                   size_t min_points,
-                                   bool print_progress = false) const;
+    /// \param progress Optional token receiving progress; when given,
+    /// \p print_progress is ignored. Returns an empty vector if the token is
+    /// cancelled.
+    std::vector<int> ClusterDBSCAN(
+            double eps,
+            size_t min_points,
+            bool print_progress = false,
+            utility::ProgressToken *progress = nullptr) const;
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
@@ -239,6 +274,15 @@ public:
             double depth_scale = 1000.0,
             double depth_trunc = 1000.0,
             int stride = 1);
+    /// Same as above for a float depth image, but writes into \p output and
+    /// keeps the capacity of its attributes. Returns false if the image format
+    /// is not supported.
+    static bool CreateFromDepthImage(
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            int stride,
+            PointCloud &output);
 
     /// Factory function to create a pointcloud from an RGB-D image and a camera
     /// model (PointCloudFactory.cpp)
@@ -247,6 +291,13 @@ public:
             const RGBDImage &image,
             const camera::PinholeCameraIntrinsic &intrinsic,
             const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity());
+    /// Same as above, but writes into \p output and keeps the capacity of its
+    /// attributes. Returns false if the image format is not supported.
+    static bool CreateFromRGBDImage(
+            const RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            PointCloud &output);
 
     /// Function to create a PointCloud from a VoxelGrid.
     /// It transforms the voxel centers to 3D points using the original point
@@ -258,6 +309,9 @@ public:
     std::vector<Eigen::Vector3d> points_;
     std::vector<Eigen::Vector3d> normals_;
     std::vector<Eigen::Vector3d> colors_;
+    /// Named per-point attributes such as intensity or labels. Filters and
+    /// down samplers carry over every attribute that has one row per point.
+    std::map<std::string, PointAttribute> attributes_;
 };
 
 }  // namespace geometry
@@ -27,48 +27,77 @@
 #include "Open3D/Geometry/PointCloud.h"
 
 #include <Eigen/Dense>
+#include <memory>
 #include <unordered_set>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Utility/Console.h"
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Progress.h"
 
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
+namespace {
+
+const int kProgressBatchSize = 64;
+
+}  // unnamed namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(
+        double eps,
+        size_t min_points,
+        bool print_progress,
+        utility::ProgressToken *progress) const {
+    // Precomputing the neighbours and clustering count one unit per point.
+    std::unique_ptr<utility::ProgressToken> console_progress;
+    if (progress == nullptr && print_progress) {
+        console_progress.reset(new utility::ProgressToken(
+                utility::CreateConsoleProgressCallback("Cluster DBSCAN")));
+        progress = console_progress.get();
+    }
+    if (progress != nullptr) {
+        progress->Reset(2 * int64_t(points_.size()));
+    }
+
     KDTreeFlann kdtree(*this);
 
     // precompute all neighbours
     utility::LogDebug("Precompute Neighbours");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute Neighbours", print_progress);
     std::vector<std::vector<int>> nbs(points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
+    utility::ParallelForRange(0, int(points_.size()), [&](int begin, int end) {
         std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { ++progress_bar; }
+        // Progress is published in batches to keep the shared counter out of
+        // the inner loop.
+        int pending = 0;
+        for (int idx = begin; idx < end; ++idx) {
+            kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+            if (progress != nullptr && ++pending == kProgressBatchSize) {
+                if (!progress->Add(pending)) {
+                    return;
+                }
+                pending = 0;
+            }
+        }
+        if (progress != nullptr && pending > 0) {
+            progress->Add(pending);
+        }
+    });
+    if (progress != nullptr && progress->IsCancelled()) {
+        utility::LogDebug("[ClusterDBSCAN] Cancelled.");
+        return std::vector<int>();
     }
     utility::LogDebug("Done Precompute Neighbours");
 
     // set all labels to undefined (-2)
     utility::LogDebug("Compute Clusters");
-    progress_bar.reset(points_.size(), "Clustering", print_progress);
     std::vector<int> labels(points_.size(), -2);
     int cluster_label = 0;
     for (size_t idx = 0; idx < points_.size(); ++idx) {
+        if (progress != nullptr && !progress->Add()) {
+            utility::LogDebug("[ClusterDBSCAN] Cancelled.");
+            return std::vector<int>();
+        }
         if (labels[idx] != -2) {  // label is not undefined
             continue;
         }
@@ -84,7 +113,6 @@ std::vector<int> PointCloud::ClusterDBSCAN(double eps,
         nbs_visited.insert(int(idx));
 
         labels[idx] = cluster_label;
-        ++progress_bar;
         while (!nbs_next.empty()) {
             int nb = *nbs_next.begin();
             nbs_next.erase(nbs_next.begin());
@@ -92,13 +120,11 @@ std::vector<int> PointCloud::ClusterDBSCAN(double eps,
 
             if (labels[nb] == -1) {  // noise label
                 labels[nb] = cluster_label;
-                ++progress_bar;
             }
             if (labels[nb] != -2) {  // not undefined label
                 continue;
             }
             labels[nb] = cluster_label;
-            ++progress_bar;
 
             if (nbs[nb].size() >= min_points) {
                 for (int qnb : nbs[nb]) {
@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloudF.h"
+
+#include <cmath>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+namespace geometry {
+
+PointCloudF::PointCloudF(const PointCloud &cloud)
+    : Geometry3D(Geometry::GeometryType::PointCloudF) {
+    utility::CastVectors(cloud.points_, points_);
+    utility::CastVectors(cloud.normals_, normals_);
+    utility::CastVectors(cloud.colors_, colors_);
+}
+
+PointCloudF &PointCloudF::Clear() {
+    points_.clear();
+    normals_.clear();
+    colors_.clear();
+    return *this;
+}
+
+bool PointCloudF::IsEmpty() const { return !HasPoints(); }
+
+Eigen::Vector3d PointCloudF::GetMinBound() const {
+    return ComputeMinBound(points_);
+}
+
+Eigen::Vector3d PointCloudF::GetMaxBound() const {
+    return ComputeMaxBound(points_);
+}
+
+Eigen::Vector3d PointCloudF::GetCenter() const {
+    return ComputeCenter(points_);
+}
+
+AxisAlignedBoundingBox PointCloudF::GetAxisAlignedBoundingBox() const {
+    return AxisAlignedBoundingBox(GetMinBound(), GetMaxBound());
+}
+
+OrientedBoundingBox PointCloudF::GetOrientedBoundingBox() const {
+    std::vector<Eigen::Vector3d> points;
+    utility::CastVectors(points_, points);
+    return OrientedBoundingBox::CreateFromPoints(points);
+}
+
+PointCloudF &PointCloudF::Transform(const Eigen::Matrix4d &transformation) {
+    TransformPoints(transformation, points_);
+    TransformNormals(transformation, normals_);
+    return *this;
+}
+
+PointCloudF &PointCloudF::Translate(const Eigen::Vector3d &translation,
+                                    bool relative) {
+    TranslatePoints(translation, points_, relative);
+    return *this;
+}
+
+PointCloudF &PointCloudF::Scale(const double scale, bool center) {
+    ScalePoints(scale, points_, center);
+    return *this;
+}
+
+PointCloudF &PointCloudF::Rotate(const Eigen::Matrix3d &R, bool center) {
+    RotatePoints(R, points_, center);
+    RotateNormals(R, normals_, center);
+    return *this;
+}
+
+PointCloudF &PointCloudF::operator+=(const PointCloudF &cloud) {
+    // Element-wise copies keep adding a point cloud to itself safe.
+    if (cloud.IsEmpty()) return (*this);
+    size_t old_vert_num = points_.size();
+    size_t add_vert_num = cloud.points_.size();
+    size_t new_vert_num = old_vert_num + add_vert_num;
+    if ((!HasPoints() || HasNormals()) && cloud.HasNormals()) {
+        normals_.resize(new_vert_num);
+        for (size_t i = 0; i < add_vert_num; i++)
+            normals_[old_vert_num + i] = cloud.normals_[i];
+    } else {
+        normals_.clear();
+    }
+    if ((!HasPoints() || HasColors()) && cloud.HasColors()) {
+        colors_.resize(new_vert_num);
+        for (size_t i = 0; i < add_vert_num; i++)
+            colors_[old_vert_num + i] = cloud.colors_[i];
+    } else {
+        colors_.clear();
+    }
+    points_.resize(new_vert_num);
+    for (size_t i = 0; i < add_vert_num; i++)
+        points_[old_vert_num + i] = cloud.points_[i];
+    return (*this);
+}
+
+PointCloudF PointCloudF::operator+(const PointCloudF &cloud) const {
+    return (PointCloudF(*this) += cloud);
+}
+
+std::shared_ptr<PointCloud> PointCloudF::ToPointCloud() const {
+    auto output = std::make_shared<PointCloud>();
+    utility::CastVectors(points_, output->points_);
+    utility::CastVectors(normals_, output->normals_);
+    utility::CastVectors(colors_, output->colors_);
+    return output;
+}
+
+PointCloudF &PointCloudF::RemoveNoneFinitePoints(bool remove_nan,
+                                                 bool remove_infinite) {
+    bool has_normal = HasNormals();
+    bool has_color = HasColors();
+    size_t old_point_num = points_.size();
+    size_t k = 0;
+    for (size_t i = 0; i < old_point_num; i++) {
+        bool is_nan = remove_nan && points_[i].hasNaN();
+        bool is_infinite = remove_infinite && (std::isinf(points_[i](0)) ||
+                                               std::isinf(points_[i](1)) ||
+                                               std::isinf(points_[i](2)));
+        if (!is_nan && !is_infinite) {
+            points_[k] = points_[i];
+            if (has_normal) normals_[k] = normals_[i];
+            if (has_color) colors_[k] = colors_[i];
+            k++;
+        }
+    }
+    points_.resize(k);
+    if (has_normal) normals_.resize(k);
+    if (has_color) colors_.resize(k);
+    utility::LogDebug(
+            "[RemoveNoneFinitePoints] {:d} nan points have been removed.",
+            (int)(old_point_num - k));
+    return *this;
+}
+
+}  // namespace geometry
+}  // namespace open3d
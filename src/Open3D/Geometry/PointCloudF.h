@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry3D.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Utility/VectorKernels.h"
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraIntrinsic;
+}
+
+namespace utility {
+class Arena;
+}
+
+namespace geometry {
+
+class Image;
+class PointCloud;
+class RGBDImage;
+
+/// \class PointCloudF
+///
+/// \brief Point cloud with single-precision attributes.
+///
+/// Stores points, normals and colors as Eigen::Vector3f and therefore uses
+/// half the memory of PointCloud, which is enough for sensor data. Kernels
+/// accumulate in double precision. Convert with PointCloudF(const PointCloud &)
+/// and ToPointCloud() for algorithms that only exist for PointCloud.
+class PointCloudF : public Geometry3D {
+public:
+    PointCloudF() : Geometry3D(Geometry::GeometryType::PointCloudF) {}
+    PointCloudF(const std::vector<Eigen::Vector3f> &points)
+        : Geometry3D(Geometry::GeometryType::PointCloudF), points_(points) {}
+    /// Converts \p cloud to single precision.
+    explicit PointCloudF(const PointCloud &cloud);
+    ~PointCloudF() override {}
+
+public:
+    PointCloudF &Clear() override;
+    bool IsEmpty() const override;
+    Eigen::Vector3d GetMinBound() const override;
+    Eigen::Vector3d GetMaxBound() const override;
+    Eigen::Vector3d GetCenter() const override;
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const override;
+    OrientedBoundingBox GetOrientedBoundingBox() const override;
+    PointCloudF &Transform(const Eigen::Matrix4d &transformation) override;
+    PointCloudF &Translate(const Eigen::Vector3d &translation,
+                           bool relative = true) override;
+    PointCloudF &Scale(const double scale, bool center = true) override;
+    PointCloudF &Rotate(const Eigen::Matrix3d &R, bool center = true) override;
+
+    PointCloudF &operator+=(const PointCloudF &cloud);
+    PointCloudF operator+(const PointCloudF &cloud) const;
+
+    bool HasPoints() const { return points_.size() > 0; }
+
+    bool HasNormals() const {
+        return points_.size() > 0 && normals_.size() == points_.size();
+    }
+
+    bool HasColors() const {
+        return points_.size() > 0 && colors_.size() == points_.size();
+    }
+
+    PointCloudF &NormalizeNormals() {
+        utility::NormalizeVectors(normals_);
+        return *this;
+    }
+
+    /// Assigns each point in the PointCloudF the same color \p color.
+    PointCloudF &PaintUniformColor(const Eigen::Vector3d &color) {
+        ResizeAndPaintUniformColor(colors_, points_.size(), color);
+        return *this;
+    }
+
+    /// Converts the point cloud to double precision.
+    std::shared_ptr<PointCloud> ToPointCloud() const;
+
+    /// Removes all points that have a nan or infinite entry, together with
+    /// their normals and colors.
+    PointCloudF &RemoveNoneFinitePoints(bool remove_nan = true,
+                                        bool remove_infinite = true);
+
+    /// Selects the points with indices in \p indices, or all other points if
+    /// \p invert is true.
+    std::shared_ptr<PointCloudF> SelectDownSample(
+            const std::vector<size_t> &indices, bool invert = false) const;
+
+    /// Same as PointCloud::VoxelDownSample.
+    std::shared_ptr<PointCloudF> VoxelDownSample(double voxel_size) const;
+    /// Same as PointCloud::VoxelDownSample with an output point cloud whose
+    /// capacity is reused and an optional scratch \p arena. \p output must not
+    /// be this point cloud.
+    PointCloudF &VoxelDownSample(double voxel_size,
+                                 PointCloudF &output,
+                                 utility::Arena *arena = nullptr) const;
+
+    /// Keeps every \p every_k_points-th point.
+    std::shared_ptr<PointCloudF> UniformDownSample(
+            size_t every_k_points) const;
+
+    /// Same as PointCloud::EstimateNormals. The search runs on a
+    /// single-precision KDTreeFlann index.
+    bool EstimateNormals(
+            const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
+            bool fast_normal_computation = true);
+
+    /// Same as PointCloud::CreateFromDepthImage.
+    static std::shared_ptr<PointCloudF> CreateFromDepthImage(
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            int stride = 1);
+    /// Same as PointCloud::CreateFromDepthImage for a float depth image,
+    /// writing into \p output. Returns false if the image format is not
+    /// supported.
+    static bool CreateFromDepthImage(
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            int stride,
+            PointCloudF &output);
+
+    /// Same as PointCloud::CreateFromRGBDImage.
+    static std::shared_ptr<PointCloudF> CreateFromRGBDImage(
+            const RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity());
+    /// Same as above, writing into \p output. Returns false if the image
+    /// format is not supported.
+    static bool CreateFromRGBDImage(
+            const RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            PointCloudF &output);
+
+public:
+    std::vector<Eigen::Vector3f> points_;
+    std::vector<Eigen::Vector3f> normals_;
+    std::vector<Eigen::Vector3f> colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
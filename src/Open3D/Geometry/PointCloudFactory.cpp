@@ -29,9 +29,11 @@
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -49,17 +51,22 @@ int CountValidDepthPixels(const Image &depth, int stride) {
     return num_valid_pixels;
 }
 
-std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
+/// \p pointcloud is a PointCloud or a PointCloudF.
+template <typename CloudT>
+void CreatePointCloudFromFloatDepthImage(
         const Image &depth,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
-        int stride) {
-    auto pointcloud = std::make_shared<PointCloud>();
+        int stride,
+        CloudT &pointcloud) {
+    typedef typename decltype(pointcloud.points_)::value_type::Scalar Scalar;
     Eigen::Matrix4d camera_pose = extrinsic.inverse();
     auto focal_length = intrinsic.GetFocalLength();
     auto principal_point = intrinsic.GetPrincipalPoint();
     int num_valid_pixels = CountValidDepthPixels(depth, stride);
-    pointcloud->points_.resize(num_valid_pixels);
+    pointcloud.points_.resize(num_valid_pixels);
+    pointcloud.normals_.clear();
+    pointcloud.colors_.clear();
     int cnt = 0;
     for (int i = 0; i < depth.height_; i += stride) {
         for (int j = 0; j < depth.width_; j += stride) {
@@ -71,26 +78,28 @@ std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
                         (i - principal_point.second) * z / focal_length.second;
                 Eigen::Vector4d point =
                         camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
+                pointcloud.points_[cnt++] =
+                        point.block<3, 1>(0, 0).template cast<Scalar>();
             }
         }
     }
-    return pointcloud;
 }
 
-template <typename TC, int NC>
-std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
+template <typename TC, int NC, typename CloudT>
+void CreatePointCloudFromRGBDImageT(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic) {
-    auto pointcloud = std::make_shared<PointCloud>();
+        const Eigen::Matrix4d &extrinsic,
+        CloudT &pointcloud) {
+    typedef typename decltype(pointcloud.points_)::value_type::Scalar Scalar;
     Eigen::Matrix4d camera_pose = extrinsic.inverse();
     auto focal_length = intrinsic.GetFocalLength();
     auto principal_point = intrinsic.GetPrincipalPoint();
     double scale = (sizeof(TC) == 1) ? 255.0 : 1.0;
     int num_valid_pixels = CountValidDepthPixels(image.depth_, 1);
-    pointcloud->points_.resize(num_valid_pixels);
-    pointcloud->colors_.resize(num_valid_pixels);
+    pointcloud.points_.resize(num_valid_pixels);
+    pointcloud.normals_.clear();
+    pointcloud.colors_.resize(num_valid_pixels);
     int cnt = 0;
     for (int i = 0; i < image.depth_.height_; i++) {
         float *p = (float *)(image.depth_.data_.data() +
@@ -105,61 +114,123 @@ std::shared_ptr<PointCloud> CreatePointCloudFromRGBDImageT(
                         (i - principal_point.second) * z / focal_length.second;
                 Eigen::Vector4d point =
                         camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt] = point.block<3, 1>(0, 0);
-                pointcloud->colors_[cnt++] =
-                        Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
-                        scale;
+                pointcloud.points_[cnt] =
+                        point.block<3, 1>(0, 0).template cast<Scalar>();
+                pointcloud.colors_[cnt++] =
+                        (Eigen::Vector3d(pc[0], pc[(NC - 1) / 2], pc[NC - 1]) /
+                         scale)
+                                .template cast<Scalar>();
             }
         }
     }
-    return pointcloud;
 }
 
-}  // unnamed namespace
-
-namespace geometry {
-std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
+template <typename CloudT>
+bool CreatePointCloudFromDepthImage(
         const Image &depth,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
-        double depth_scale /* = 1000.0*/,
-        double depth_trunc /* = 1000.0*/,
-        int stride /* = 1*/) {
+        const Eigen::Matrix4d &extrinsic,
+        double depth_scale,
+        double depth_trunc,
+        int stride,
+        CloudT &pointcloud) {
     if (depth.num_of_channels_ == 1) {
         if (depth.bytes_per_channel_ == 2) {
             auto float_depth =
                     depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(*float_depth, intrinsic,
-                                                       extrinsic, stride);
+            CreatePointCloudFromFloatDepthImage(*float_depth, intrinsic,
+                                                extrinsic, stride, pointcloud);
+            return true;
         } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(depth, intrinsic,
-                                                       extrinsic, stride);
+            CreatePointCloudFromFloatDepthImage(depth, intrinsic, extrinsic,
+                                                stride, pointcloud);
+            return true;
         }
     }
-    utility::LogError(
-            "[CreatePointCloudFromDepthImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
+    return false;
 }
 
-std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
+template <typename CloudT>
+bool CreatePointCloudFromRGBDImage(
         const RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/) {
+        const Eigen::Matrix4d &extrinsic,
+        CloudT &pointcloud) {
     if (image.depth_.num_of_channels_ == 1 &&
         image.depth_.bytes_per_channel_ == 4) {
         if (image.color_.bytes_per_channel_ == 1 &&
             image.color_.num_of_channels_ == 3) {
-            return CreatePointCloudFromRGBDImageT<uint8_t, 3>(image, intrinsic,
-                                                              extrinsic);
+            CreatePointCloudFromRGBDImageT<uint8_t, 3>(image, intrinsic,
+                                                       extrinsic, pointcloud);
+            return true;
         } else if (image.color_.bytes_per_channel_ == 4 &&
                    image.color_.num_of_channels_ == 1) {
-            return CreatePointCloudFromRGBDImageT<float, 1>(image, intrinsic,
-                                                            extrinsic);
+            CreatePointCloudFromRGBDImageT<float, 1>(image, intrinsic,
+                                                     extrinsic, pointcloud);
+            return true;
         }
     }
-    utility::LogError(
-            "[CreatePointCloudFromRGBDImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
+    return false;
+}
+
+}  // unnamed namespace
+
+namespace geometry {
+std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/) {
+    OPEN3D_TRACE_ZONE("PointCloud::CreateFromDepthImage");
+    auto pointcloud = std::make_shared<PointCloud>();
+    if (!CreatePointCloudFromDepthImage(depth, intrinsic, extrinsic,
+                                        depth_scale, depth_trunc, stride,
+                                        *pointcloud)) {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
+    }
+    return pointcloud;
+}
+
+bool PointCloud::CreateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        int stride,
+        PointCloud &output) {
+    OPEN3D_TRACE_ZONE("PointCloud::CreateFromDepthImage");
+    if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4) {
+        utility::LogWarning(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
+        return false;
+    }
+    CreatePointCloudFromFloatDepthImage(depth, intrinsic, extrinsic, stride,
+                                        output);
+    output.attributes_.clear();
+    return true;
+}
+
+std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/) {
+    auto pointcloud = std::make_shared<PointCloud>();
+    if (!CreateFromRGBDImage(image, intrinsic, extrinsic, *pointcloud)) {
+        utility::LogError(
+                "[CreatePointCloudFromRGBDImage] Unsupported image format.");
+    }
+    return pointcloud;
+}
+
+bool PointCloud::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        PointCloud &output) {
+    output.attributes_.clear();
+    return CreatePointCloudFromRGBDImage(image, intrinsic, extrinsic, output);
 }
 
 std::shared_ptr<PointCloud> PointCloud::CreateFromVoxelGrid(
@@ -183,5 +254,60 @@ std::shared_ptr<PointCloud> PointCloud::CreateFromVoxelGrid(
     return output;
 }
 
+std::shared_ptr<PointCloudF> PointCloudF::CreateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/) {
+    OPEN3D_TRACE_ZONE("PointCloudF::CreateFromDepthImage");
+    auto pointcloud = std::make_shared<PointCloudF>();
+    if (!CreatePointCloudFromDepthImage(depth, intrinsic, extrinsic,
+                                        depth_scale, depth_trunc, stride,
+                                        *pointcloud)) {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
+    }
+    return pointcloud;
+}
+
+bool PointCloudF::CreateFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        int stride,
+        PointCloudF &output) {
+    OPEN3D_TRACE_ZONE("PointCloudF::CreateFromDepthImage");
+    if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4) {
+        utility::LogWarning(
+                "[CreatePointCloudFromDepthImage] Unsupported image format.");
+        return false;
+    }
+    CreatePointCloudFromFloatDepthImage(depth, intrinsic, extrinsic, stride,
+                                        output);
+    return true;
+}
+
+std::shared_ptr<PointCloudF> PointCloudF::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/) {
+    auto pointcloud = std::make_shared<PointCloudF>();
+    if (!CreateFromRGBDImage(image, intrinsic, extrinsic, *pointcloud)) {
+        utility::LogError(
+                "[CreatePointCloudFromRGBDImage] Unsupported image format.");
+    }
+    return pointcloud;
+}
+
+bool PointCloudF::CreateFromRGBDImage(
+        const RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        PointCloudF &output) {
+    return CreatePointCloudFromRGBDImage(image, intrinsic, extrinsic, output);
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,350 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/SparseVoxelGrid.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelCarving.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Key of the points that are not voxelized. It is larger than any packed
+// key, so these points sort to the end.
+const uint64_t kInvalidKey = std::numeric_limits<uint64_t>::max();
+
+SparseVoxelGrid::Color QuantizeColor(const Eigen::Vector3d &color) {
+    Eigen::Vector3d scaled =
+            (color.cwiseMax(0.0).cwiseMin(1.0) * 255.0).array().round();
+    return scaled.cast<uint8_t>();
+}
+
+// Removes the voxels whose keep flag is false, keeping the key order.
+void EraseCarvedVoxels(SparseVoxelGrid &voxel_grid,
+                       const std::vector<char> &keep) {
+    const bool has_colors = voxel_grid.HasColors();
+    size_t num_kept = 0;
+    for (size_t i = 0; i < keep.size(); i++) {
+        if (keep[i]) {
+            voxel_grid.keys_[num_kept] = voxel_grid.keys_[i];
+            if (has_colors) {
+                voxel_grid.colors_[num_kept] = voxel_grid.colors_[i];
+            }
+            num_kept++;
+        }
+    }
+    voxel_grid.keys_.resize(num_kept);
+    if (has_colors) {
+        voxel_grid.colors_.resize(num_kept);
+    }
+}
+
+void CarveDepthMapViews(
+        SparseVoxelGrid &voxel_grid,
+        const voxel_carving::ImagePtrs &depth_maps,
+        const voxel_carving::CameraParametersPtrs &camera_parameters) {
+    std::vector<char> keep = voxel_carving::CarveDepthMapViews(
+            voxel_grid.GetNumVoxels(),
+            [&voxel_grid](size_t i) { return voxel_grid.GetGridIndex(i); },
+            voxel_grid.voxel_size_, voxel_grid.origin_, depth_maps,
+            camera_parameters);
+    EraseCarvedVoxels(voxel_grid, keep);
+}
+
+void CarveSilhouetteViews(
+        SparseVoxelGrid &voxel_grid,
+        const voxel_carving::ImagePtrs &silhouette_masks,
+        const voxel_carving::CameraParametersPtrs &camera_parameters) {
+    std::vector<char> keep = voxel_carving::CarveSilhouetteViews(
+            voxel_grid.GetNumVoxels(),
+            [&voxel_grid](size_t i) { return voxel_grid.GetGridIndex(i); },
+            voxel_grid.voxel_size_, voxel_grid.origin_, silhouette_masks,
+            camera_parameters);
+    EraseCarvedVoxels(voxel_grid, keep);
+}
+
+}  // unnamed namespace
+
+const int SparseVoxelGrid::kKeyBits;
+const int SparseVoxelGrid::kMinIndex;
+const int SparseVoxelGrid::kMaxIndex;
+
+SparseVoxelGrid &SparseVoxelGrid::Clear() {
+    voxel_size_ = 0.0;
+    origin_ = Eigen::Vector3d::Zero();
+    keys_.clear();
+    colors_.clear();
+    return *this;
+}
+
+Eigen::Vector3d SparseVoxelGrid::GetMinBound() const {
+    if (!HasVoxels()) {
+        return origin_;
+    }
+    Eigen::Array3i min_grid_index = UnpackKey(keys_[0]);
+    for (uint64_t key : keys_) {
+        min_grid_index = min_grid_index.min(UnpackKey(key).array());
+    }
+    return min_grid_index.cast<double>() * voxel_size_ + origin_.array();
+}
+
+Eigen::Vector3d SparseVoxelGrid::GetMaxBound() const {
+    if (!HasVoxels()) {
+        return origin_;
+    }
+    Eigen::Array3i max_grid_index = UnpackKey(keys_[0]);
+    for (uint64_t key : keys_) {
+        max_grid_index = max_grid_index.max(UnpackKey(key).array());
+    }
+    return (max_grid_index.cast<double>() + 1) * voxel_size_ +
+           origin_.array();
+}
+
+Eigen::Vector3i SparseVoxelGrid::GetVoxel(const Eigen::Vector3d &point) const {
+    Eigen::Vector3d voxel_f = (point - origin_) / voxel_size_;
+    return (Eigen::floor(voxel_f.array())).cast<int>();
+}
+
+int64_t SparseVoxelGrid::Find(const Eigen::Vector3i &grid_index) const {
+    if (!IsPackable(grid_index)) {
+        return -1;
+    }
+    const uint64_t key = PackKey(grid_index);
+    auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+    if (it == keys_.end() || *it != key) {
+        return -1;
+    }
+    return int64_t(it - keys_.begin());
+}
+
+std::vector<bool> SparseVoxelGrid::CheckIfIncluded(
+        const std::vector<Eigen::Vector3d> &queries) const {
+    // std::vector<bool> packs bits and cannot be written concurrently.
+    std::vector<char> included(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(queries.size()); i++) {
+        included[i] = Contains(GetVoxel(queries[i])) ? 1 : 0;
+    }
+    return std::vector<bool>(included.begin(), included.end());
+}
+
+SparseVoxelGrid &SparseVoxelGrid::CarveDepthMap(
+        const Image &depth_map,
+        const camera::PinholeCameraParameters &camera_parameter) {
+    CarveDepthMapViews(*this, {&depth_map}, {&camera_parameter});
+    return *this;
+}
+
+SparseVoxelGrid &SparseVoxelGrid::CarveSilhouette(
+        const Image &silhouette_mask,
+        const camera::PinholeCameraParameters &camera_parameter) {
+    CarveSilhouetteViews(*this, {&silhouette_mask}, {&camera_parameter});
+    return *this;
+}
+
+SparseVoxelGrid &SparseVoxelGrid::CarveDepthMaps(
+        const std::vector<Image> &depth_maps,
+        const std::vector<camera::PinholeCameraParameters> &camera_parameters) {
+    CarveDepthMapViews(*this, voxel_carving::GetPointers(depth_maps),
+                       voxel_carving::GetPointers(camera_parameters));
+    return *this;
+}
+
+SparseVoxelGrid &SparseVoxelGrid::CarveSilhouettes(
+        const std::vector<Image> &silhouette_masks,
+        const std::vector<camera::PinholeCameraParameters> &camera_parameters) {
+    CarveSilhouetteViews(*this, voxel_carving::GetPointers(silhouette_masks),
+                         voxel_carving::GetPointers(camera_parameters));
+    return *this;
+}
+
+std::shared_ptr<VoxelGrid> SparseVoxelGrid::ToVoxelGrid() const {
+    auto output = std::make_shared<VoxelGrid>();
+    output->voxel_size_ = voxel_size_;
+    output->origin_ = origin_;
+    output->voxels_.reserve(keys_.size());
+    const bool has_colors = HasColors();
+    for (size_t i = 0; i < keys_.size(); i++) {
+        if (has_colors) {
+            output->AddVoxel(Voxel(GetGridIndex(i), GetColor(i)));
+        } else {
+            output->AddVoxel(Voxel(GetGridIndex(i)));
+        }
+    }
+    return output;
+}
+
+std::shared_ptr<SparseVoxelGrid> SparseVoxelGrid::CreateFromVoxelGrid(
+        const VoxelGrid &voxel_grid) {
+    auto output = std::make_shared<SparseVoxelGrid>();
+    output->voxel_size_ = voxel_grid.voxel_size_;
+    output->origin_ = voxel_grid.origin_;
+    std::vector<std::pair<uint64_t, Color>> voxels;
+    voxels.reserve(voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        const Voxel &voxel = it.second;
+        if (!IsPackable(voxel.grid_index_)) {
+            continue;
+        }
+        voxels.push_back(std::make_pair(PackKey(voxel.grid_index_),
+                                        QuantizeColor(voxel.color_)));
+    }
+    if (voxels.size() < voxel_grid.voxels_.size()) {
+        utility::LogWarning(
+                "[CreateFromVoxelGrid] {:d} voxels are out of range and are "
+                "skipped.",
+                (int)(voxel_grid.voxels_.size() - voxels.size()));
+    }
+    utility::ParallelSort(voxels, [](const std::pair<uint64_t, Color> &a,
+                                     const std::pair<uint64_t, Color> &b) {
+        return a.first < b.first;
+    });
+    output->keys_.resize(voxels.size());
+    for (size_t i = 0; i < voxels.size(); i++) {
+        output->keys_[i] = voxels[i].first;
+    }
+    // VoxelGrid::HasColors() is always true, with (0, 0, 0) as the default
+    // color, so a grid whose voxels all have the default color is treated as
+    // uncolored. Converting it back gives the same voxels.
+    bool has_colors = false;
+    for (size_t i = 0; i < voxels.size() && !has_colors; i++) {
+        has_colors = voxels[i].second != Color::Zero();
+    }
+    if (voxel_grid.HasColors() && has_colors) {
+        output->colors_.resize(voxels.size());
+        for (size_t i = 0; i < voxels.size(); i++) {
+            output->colors_[i] = voxels[i].second;
+        }
+    }
+    return output;
+}
+
+std::shared_ptr<SparseVoxelGrid>
+SparseVoxelGrid::CreateFromPointCloudWithinBounds(
+        const PointCloud &input,
+        double voxel_size,
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3d &max_bound) {
+    auto output = std::make_shared<SparseVoxelGrid>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[SparseVoxelGrid] voxel_size <= 0.");
+    }
+    if (voxel_size * kMaxIndex < (max_bound - min_bound).maxCoeff()) {
+        utility::LogError("[SparseVoxelGrid] voxel_size is too small.");
+    }
+    output->voxel_size_ = voxel_size;
+    output->origin_ = min_bound;
+
+    // Sort the points by the key of their voxel, so that every voxel is a
+    // contiguous run of points.
+    const int num_points = int(input.points_.size());
+    std::vector<std::pair<uint64_t, int>> keyed_points(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        const Eigen::Vector3d &point = input.points_[i];
+        uint64_t key = kInvalidKey;
+        if ((point.array() >= min_bound.array()).all() &&
+            (point.array() <= max_bound.array()).all()) {
+            key = PackKey(output->GetVoxel(point));
+        }
+        keyed_points[i] = std::make_pair(key, i);
+    }
+    utility::ParallelSort(keyed_points);
+    while (!keyed_points.empty() && keyed_points.back().first == kInvalidKey) {
+        keyed_points.pop_back();
+    }
+
+    std::vector<size_t> run_begins;
+    for (size_t i = 0; i < keyed_points.size(); i++) {
+        if (i == 0 || keyed_points[i].first != keyed_points[i - 1].first) {
+            run_begins.push_back(i);
+        }
+    }
+    const int num_voxels = int(run_begins.size());
+    run_begins.push_back(keyed_points.size());
+
+    const bool has_colors = input.HasColors();
+    output->keys_.resize(num_voxels);
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < num_voxels; v++) {
+        output->keys_[v] = keyed_points[run_begins[v]].first;
+        if (has_colors) {
+            Eigen::Vector3d color = Eigen::Vector3d::Zero();
+            for (size_t k = run_begins[v]; k < run_begins[v + 1]; k++) {
+                color += input.colors_[keyed_points[k].second];
+            }
+            color /= double(run_begins[v + 1] - run_begins[v]);
+            output->colors_[v] = QuantizeColor(color);
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud is voxelized from {:d} points to {:d} voxels.",
+            num_points, num_voxels);
+    return output;
+}
+
+std::shared_ptr<SparseVoxelGrid> SparseVoxelGrid::CreateFromPointCloud(
+        const PointCloud &input, double voxel_size) {
+    Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d min_bound = input.GetMinBound() - voxel_size3 * 0.5;
+    Eigen::Vector3d max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
+    return CreateFromPointCloudWithinBounds(input, voxel_size, min_bound,
+                                            max_bound);
+}
+
+uint64_t SparseVoxelGrid::PackKey(const Eigen::Vector3i &grid_index) {
+    const uint64_t x = uint64_t(grid_index(0) - kMinIndex);
+    const uint64_t y = uint64_t(grid_index(1) - kMinIndex);
+    const uint64_t z = uint64_t(grid_index(2) - kMinIndex);
+    return (x << (2 * kKeyBits)) | (y << kKeyBits) | z;
+}
+
+Eigen::Vector3i SparseVoxelGrid::UnpackKey(uint64_t key) {
+    const uint64_t mask = (uint64_t(1) << kKeyBits) - 1;
+    return Eigen::Vector3i(int((key >> (2 * kKeyBits)) & mask) + kMinIndex,
+                           int((key >> kKeyBits) & mask) + kMinIndex,
+                           int(key & mask) + kMinIndex);
+}
+
+}  // namespace geometry
+}  // namespace open3d
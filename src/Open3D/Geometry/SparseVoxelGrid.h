@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+
+namespace camera {
+class PinholeCameraParameters;
+}
+
+namespace geometry {
+
+class Image;
+class PointCloud;
+class VoxelGrid;
+
+/// \class SparseVoxelGrid
+///
+/// \brief Compact storage for large sparse voxel grids.
+///
+/// The grid indices are packed into 64-bit keys (21 bits per axis) and kept
+/// in a sorted array, with the colors stored separately as 8-bit values. A
+/// voxel takes 11 bytes instead of the hash map node of VoxelGrid, and
+/// membership queries are binary searches. Inclusion tests and carving work
+/// on the compact store; the grid is converted to and from VoxelGrid for the
+/// rest of the VoxelGrid API.
+class SparseVoxelGrid {
+public:
+    typedef Eigen::Matrix<uint8_t, 3, 1> Color;
+
+    /// Number of bits per axis in a packed key.
+    static const int kKeyBits = 21;
+    /// Grid indices along each axis must be in [kMinIndex, kMaxIndex].
+    static const int kMinIndex = -(1 << (kKeyBits - 1));
+    static const int kMaxIndex = (1 << (kKeyBits - 1)) - 1;
+
+public:
+    SparseVoxelGrid() {}
+    ~SparseVoxelGrid() {}
+
+public:
+    SparseVoxelGrid &Clear();
+    bool IsEmpty() const { return !HasVoxels(); }
+    bool HasVoxels() const { return keys_.size() > 0; }
+    bool HasColors() const { return colors_.size() == keys_.size(); }
+    size_t GetNumVoxels() const { return keys_.size(); }
+
+    Eigen::Vector3d GetMinBound() const;
+    Eigen::Vector3d GetMaxBound() const;
+
+    /// Grid index of the voxel containing \p point, as in VoxelGrid.
+    Eigen::Vector3i GetVoxel(const Eigen::Vector3d &point) const;
+    /// Grid index of the i-th voxel in key order.
+    Eigen::Vector3i GetGridIndex(size_t i) const { return UnpackKey(keys_[i]); }
+    /// Color of the i-th voxel in key order, in [0, 1].
+    Eigen::Vector3d GetColor(size_t i) const {
+        return colors_[i].cast<double>() / 255.0;
+    }
+
+    /// Position of the voxel in key order, or -1 if it is not in the grid.
+    int64_t Find(const Eigen::Vector3i &grid_index) const;
+    bool Contains(const Eigen::Vector3i &grid_index) const {
+        return Find(grid_index) >= 0;
+    }
+
+    /// Element-wise check if a query in the list is included in the grid,
+    /// as VoxelGrid::CheckIfIncluded.
+    std::vector<bool> CheckIfIncluded(
+            const std::vector<Eigen::Vector3d> &queries) const;
+
+    /// Carves the grid with a depth map or silhouette mask per view, as the
+    /// VoxelGrid functions of the same names. The kept voxels are compacted
+    /// in place.
+    SparseVoxelGrid &CarveDepthMap(
+            const Image &depth_map,
+            const camera::PinholeCameraParameters &camera_parameter);
+    SparseVoxelGrid &CarveSilhouette(
+            const Image &silhouette_mask,
+            const camera::PinholeCameraParameters &camera_parameter);
+    SparseVoxelGrid &CarveDepthMaps(
+            const std::vector<Image> &depth_maps,
+            const std::vector<camera::PinholeCameraParameters>
+                    &camera_parameters);
+    SparseVoxelGrid &CarveSilhouettes(
+            const std::vector<Image> &silhouette_masks,
+            const std::vector<camera::PinholeCameraParameters>
+                    &camera_parameters);
+
+    /// Converts to a VoxelGrid with the same origin, voxel size and voxels.
+    std::shared_ptr<VoxelGrid> ToVoxelGrid() const;
+
+    /// Creates a SparseVoxelGrid holding the voxels of \p voxel_grid. Voxels
+    /// outside the range of the packed keys are skipped with a warning.
+    static std::shared_ptr<SparseVoxelGrid> CreateFromVoxelGrid(
+            const VoxelGrid &voxel_grid);
+
+    /// Creates a SparseVoxelGrid from a PointCloud, like
+    /// VoxelGrid::CreateFromPointCloud. The points are keyed and sorted in
+    /// parallel, and each run of equal keys is reduced to one voxel with the
+    /// average color of its points.
+    static std::shared_ptr<SparseVoxelGrid> CreateFromPointCloud(
+            const PointCloud &input, double voxel_size);
+
+    /// Same as CreateFromPointCloud, with the bounds of the grid defined by
+    /// the given parameters. Points outside the bounds are skipped.
+    static std::shared_ptr<SparseVoxelGrid> CreateFromPointCloudWithinBounds(
+            const PointCloud &input,
+            double voxel_size,
+            const Eigen::Vector3d &min_bound,
+            const Eigen::Vector3d &max_bound);
+
+    /// Packs a grid index into a key. The order of the keys is the
+    /// lexicographic order of (x, y, z).
+    static uint64_t PackKey(const Eigen::Vector3i &grid_index);
+    static Eigen::Vector3i UnpackKey(uint64_t key);
+    static bool IsPackable(const Eigen::Vector3i &grid_index) {
+        return (grid_index.array() >= kMinIndex).all() &&
+               (grid_index.array() <= kMaxIndex).all();
+    }
+
+public:
+    double voxel_size_ = 0.0;
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    /// Sorted packed grid indices.
+    std::vector<uint64_t> keys_;
+    /// Colors of the voxels in the order of keys_. Empty if the grid has no
+    /// colors.
+    std::vector<Color> colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -29,6 +29,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Progress.h"
 
 #include <Eigen/Dense>
 
@@ -159,8 +160,8 @@ BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
 
 class BallPivoting {
 public:
-    BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+    BallPivoting(const PointCloud& pcd, utility::ProgressToken* progress)
+        : has_normals_(pcd.HasNormals()), kdtree_(pcd), progress_(progress) {
         mesh_ = std::make_shared<TriangleMesh>();
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
@@ -473,6 +474,9 @@ public:
     void ExpandTriangulation(double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
         while (!edge_front_.empty()) {
+            if (IsCancelled()) {
+                return;
+            }
             BallPivotingEdgePtr edge = edge_front_.front();
             edge_front_.pop_front();
             if (edge->type_ != BallPivotingEdge::Front) {
@@ -653,8 +657,12 @@ public:
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
+    /// Returns the number of vertices visited before a cancellation.
+    size_t FindSeedTriangle(double radius) {
         for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
+            if (progress_ != nullptr && !progress_->Add()) {
+                return vidx;
+            }
             utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
                               radius, vidx);
             if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
@@ -663,6 +671,11 @@ public:
                 }
             }
         }
+        return vertices.size();
+    }
+
+    bool IsCancelled() const {
+        return progress_ != nullptr && progress_->IsCancelled();
     }
 
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
@@ -671,6 +684,10 @@ public:
         }
 
         mesh_->triangles_.clear();
+        // Every radius accounts for one unit per vertex.
+        if (progress_ != nullptr) {
+            progress_->Reset(int64_t(radii.size() * vertices.size()));
+        }
 
         for (double radius : radii) {
             utility::LogDebug("[Run] ################################");
@@ -724,11 +741,19 @@ public:
             }
 
             // do the reconstruction
+            size_t num_visited = 0;
             if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
+                num_visited = FindSeedTriangle(radius);
             } else {
                 ExpandTriangulation(radius);
             }
+            if (IsCancelled()) {
+                utility::LogDebug("[Run] Cancelled.");
+                return std::make_shared<TriangleMesh>();
+            }
+            if (progress_ != nullptr) {
+                progress_->Add(int64_t(vertices.size() - num_visited));
+            }
 
             utility::LogDebug("[Run] mesh_ has {:d} triangles",
                               mesh_->triangles_.size());
@@ -744,11 +769,14 @@ private:
     std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
     std::shared_ptr<TriangleMesh> mesh_;
+    utility::ProgressToken* progress_;
 };
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
-    BallPivoting bp(pcd);
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        utility::ProgressToken* progress) {
+    BallPivoting bp(pcd, progress);
     return bp.Run(radii);
 }
 
@@ -27,6 +27,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Progress.h"
 
 #include <Eigen/Dense>
 #include <cfloat>
@@ -58,6 +59,8 @@ static const int WEIGHT_DEGREE = 2;
 static const int NORMAL_DEGREE = 2;
 // The default finite-element degree
 static const int DEFAULT_FEM_DEGREE = 1;
+// Number of reconstruction stages reported to a ProgressToken
+static const int NUM_PROGRESS_STAGES = 9;
 // The default finite-element boundary type
 static const BoundaryType DEFAULT_FEM_BOUNDARY = BOUNDARY_NEUMANN;
 // The dimension of the system
@@ -400,14 +403,36 @@ void ExtractMesh(
     delete mesh;
 }
 
+// Initializes the PoissonRecon thread pool for its lifetime. The pool is
+// terminated even if the reconstruction throws, e.g. from a progress callback.
+class ThreadPoolScope {
+public:
+    ThreadPoolScope() {
+#ifdef _OPENMP
+        ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                         std::thread::hardware_concurrency());
+#else
+        ThreadPool::Init(
+                (ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                std::thread::hardware_concurrency());
+#endif
+    }
+    ~ThreadPoolScope() { ThreadPool::Terminate(); }
+    ThreadPoolScope(ThreadPoolScope const&) = delete;
+    void operator=(ThreadPoolScope const&) = delete;
+};
+
+// Returns false if the reconstruction was cancelled. The PoissonRecon solver
+// cannot be interrupted, so cancellation is checked between stages.
 template <class Real, typename... SampleData, unsigned int... FEMSigs>
-void Execute(const open3d::geometry::PointCloud& pcd,
+bool Execute(const open3d::geometry::PointCloud& pcd,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
              std::vector<double>& out_densities,
              int depth,
              size_t width,
              float scale,
              bool linear_fit,
+             utility::ProgressToken* progress,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -451,6 +476,19 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     DensityEstimator* density = NULL;
     SparseNodeData<Point<Real, Dim>, NormalSigs>* normalInfo = NULL;
     Real targetValue = (Real)0.5;
+    InterpolationInfo* iInfo = NULL;
+
+    // Marks a stage as done; on cancellation frees the intermediate data.
+    auto StageDone = [&]() {
+        if (progress == nullptr || progress->Add()) {
+            return true;
+        }
+        if (iInfo) delete iInfo, iInfo = NULL;
+        if (normalInfo) delete normalInfo, normalInfo = NULL;
+        if (density) delete density, density = NULL;
+        utility::LogDebug("[CreateFromPointCloudPoisson] Cancelled.");
+        return false;
+    };
 
     // Read in the samples (and color data)
     {
@@ -502,6 +540,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         utility::LogDebug("Input Points / Samples: {} / {}", pointCount,
                           samples.size());
     }
+    if (!StageDone()) return false;
 
     int kernelDepth = depth - 2;
     if (kernelDepth < 0) {
@@ -513,7 +552,6 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     DenseNodeData<Real, Sigs> solution;
     {
         DenseNodeData<Real, Sigs> constraints;
-        InterpolationInfo* iInfo = NULL;
         int solveDepth = depth;
 
         tree.resetNodeIndices();
@@ -525,6 +563,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     samples, kernelDepth, samples_per_node, 1);
             profiler.dumpOutput("#   Got kernel density:");
         }
+        if (!StageDone()) return false;
 
         // Transform the Hermite samples into a vector field
         {
@@ -578,6 +617,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             utility::LogDebug("Point weight / Estimated Area: {:e} / {:e}",
                               pointWeightSum, pointCount * pointWeightSum);
         }
+        if (!StageDone()) return false;
 
         // Trim the tree and prepare for multigrid
         {
@@ -592,6 +632,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     normalInfo, density);
             profiler.dumpOutput("#       Finalized tree:");
         }
+        if (!StageDone()) return false;
 
         // Add the FEM constraints
         {
@@ -620,6 +661,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
         // Free up the normal info
         delete normalInfo, normalInfo = NULL;
+        if (!StageDone()) return false;
 
         // Add the interpolation constraints
         if (point_weight > 0) {
@@ -649,6 +691,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             tree.addInterpolationConstraints(constraints, solveDepth, *iInfo);
             profiler.dumpOutput("#Set point constraints:");
         }
+        if (!StageDone()) return false;
 
         utility::LogDebug(
                 "Leaf Nodes / Active Nodes / Ghost Nodes: {} / {} / {}",
@@ -678,6 +721,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             if (iInfo) delete iInfo, iInfo = NULL;
         }
     }
+    if (!StageDone()) return false;
 
     {
         profiler.start();
@@ -705,6 +749,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         utility::LogDebug("Iso-Value: {:e} = {:e} / {:e}", isoValue, valueSum,
                           weightSum);
     }
+    if (!StageDone()) return false;
 
     auto SetVertex = [](Open3DVertex<Real>& v, Point<Real, Dim> p, Real w,
                         Open3DData d) {
@@ -721,6 +766,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     if (density) delete density, density = NULL;
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
+    return StageDone();
 }
 
 }  // namespace poisson
@@ -730,7 +776,8 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           size_t depth,
                                           size_t width,
                                           float scale,
-                                          bool linear_fit) {
+                                          bool linear_fit,
+                                          utility::ProgressToken* progress) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -741,20 +788,23 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
         utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
     }
 
-#ifdef _OPENMP
-    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
-                     std::thread::hardware_concurrency());
-#else
-    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
-                     std::thread::hardware_concurrency());
-#endif
-
+    if (progress != nullptr) {
+        progress->Reset(poisson::NUM_PROGRESS_STAGES);
+    }
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, depth, width, scale,
-                            linear_fit, FEMSigs());
+    bool completed;
+    {
+        poisson::ThreadPoolScope thread_pool;
+        completed = poisson::Execute<float>(pcd, mesh, densities, depth, width,
+                                            scale, linear_fit, progress,
+                                            FEMSigs());
+    }
 
-    ThreadPool::Terminate();
+    if (!completed) {
+        return std::make_tuple(std::make_shared<TriangleMesh>(),
+                               std::vector<double>());
+    }
 
     return std::make_tuple(mesh, densities);
 }
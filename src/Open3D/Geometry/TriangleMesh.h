@@ -38,6 +38,11 @@
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
+
+namespace utility {
+class ProgressToken;
+}
+
 namespace geometry {
 
 class PointCloud;
@@ -84,12 +89,8 @@ public:
 
     TriangleMesh &NormalizeNormals() {
         MeshBase::NormalizeNormals();
-        for (size_t i = 0; i < triangle_normals_.size(); i++) {
-            triangle_normals_[i].normalize();
-            if (std::isnan(triangle_normals_[i](0))) {
-                triangle_normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-            }
-        }
+        utility::NormalizeVectors(triangle_normals_,
+                                  Eigen::Vector3d(0.0, 0.0, 1.0));
         return *this;
     }
 
@@ -441,9 +442,12 @@ public:
     /// Parallel Ball Pivoting Algorithm", 2014. The surface reconstruction is
     /// done by rolling a ball with a given radius (cf. \param radii) over the
     /// point cloud, whenever the ball touches three points a triangle is
-    /// created.
+    /// created. \param progress optionally receives progress; an empty mesh
+    /// is returned if it is cancelled.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            utility::ProgressToken *progress = nullptr);
 
     /// \brief Function that computes a triangle mesh from a oriented PointCloud
     /// pcd. This implements the Screened Poisson Reconstruction proposed in
@@ -464,6 +468,8 @@ public:
     /// diameter of the cube used for reconstruction and the diameter of the
     /// samples' bounding cube. \param linear_fit If true, the reconstructor use
     /// linear interpolation to estimate the positions of iso-vertices.
+    /// \param progress Optionally receives progress per reconstruction stage;
+    /// an empty mesh is returned if it is cancelled.
     /// \return The estimated TriangleMesh, and per vertex densitie values that
     /// can be used to to trim the mesh.
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -471,7 +477,8 @@ public:
                                 size_t depth = 8,
                                 size_t width = 0,
                                 float scale = 1.1f,
-                                bool linear_fit = false);
+                                bool linear_fit = false,
+                                utility::ProgressToken *progress = nullptr);
 
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \param radius defines the
@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMeshF.h"
+
+#include <cmath>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/VectorKernels.h"
+
+namespace open3d {
+namespace geometry {
+
+TriangleMeshF::TriangleMeshF(const TriangleMesh &mesh)
+    : Geometry3D(Geometry::GeometryType::TriangleMeshF),
+      triangles_(mesh.triangles_) {
+    utility::CastVectors(mesh.vertices_, vertices_);
+    utility::CastVectors(mesh.vertex_normals_, vertex_normals_);
+    utility::CastVectors(mesh.vertex_colors_, vertex_colors_);
+    utility::CastVectors(mesh.triangle_normals_, triangle_normals_);
+}
+
+TriangleMeshF &TriangleMeshF::Clear() {
+    vertices_.clear();
+    vertex_normals_.clear();
+    vertex_colors_.clear();
+    triangles_.clear();
+    triangle_normals_.clear();
+    return *this;
+}
+
+bool TriangleMeshF::IsEmpty() const { return !HasVertices(); }
+
+Eigen::Vector3d TriangleMeshF::GetMinBound() const {
+    return ComputeMinBound(vertices_);
+}
+
+Eigen::Vector3d TriangleMeshF::GetMaxBound() const {
+    return ComputeMaxBound(vertices_);
+}
+
+Eigen::Vector3d TriangleMeshF::GetCenter() const {
+    return ComputeCenter(vertices_);
+}
+
+AxisAlignedBoundingBox TriangleMeshF::GetAxisAlignedBoundingBox() const {
+    return AxisAlignedBoundingBox(GetMinBound(), GetMaxBound());
+}
+
+OrientedBoundingBox TriangleMeshF::GetOrientedBoundingBox() const {
+    std::vector<Eigen::Vector3d> vertices;
+    utility::CastVectors(vertices_, vertices);
+    return OrientedBoundingBox::CreateFromPoints(vertices);
+}
+
+TriangleMeshF &TriangleMeshF::Transform(
+        const Eigen::Matrix4d &transformation) {
+    TransformPoints(transformation, vertices_);
+    TransformNormals(transformation, vertex_normals_);
+    TransformNormals(transformation, triangle_normals_);
+    return *this;
+}
+
+TriangleMeshF &TriangleMeshF::Translate(const Eigen::Vector3d &translation,
+                                        bool relative) {
+    TranslatePoints(translation, vertices_, relative);
+    return *this;
+}
+
+TriangleMeshF &TriangleMeshF::Scale(const double scale, bool center) {
+    ScalePoints(scale, vertices_, center);
+    return *this;
+}
+
+TriangleMeshF &TriangleMeshF::Rotate(const Eigen::Matrix3d &R, bool center) {
+    RotatePoints(R, vertices_, center);
+    RotateNormals(R, vertex_normals_, center);
+    RotateNormals(R, triangle_normals_, center);
+    return *this;
+}
+
+TriangleMeshF &TriangleMeshF::operator+=(const TriangleMeshF &mesh) {
+    if (mesh.IsEmpty()) return (*this);
+    size_t old_vert_num = vertices_.size();
+    size_t add_vert_num = mesh.vertices_.size();
+    size_t new_vert_num = old_vert_num + add_vert_num;
+    size_t old_tri_num = triangles_.size();
+    size_t add_tri_num = mesh.triangles_.size();
+    size_t new_tri_num = old_tri_num + add_tri_num;
+    if ((!HasVertices() || HasVertexNormals()) && mesh.HasVertexNormals()) {
+        vertex_normals_.resize(new_vert_num);
+        for (size_t i = 0; i < add_vert_num; i++)
+            vertex_normals_[old_vert_num + i] = mesh.vertex_normals_[i];
+    } else {
+        vertex_normals_.clear();
+    }
+    if ((!HasVertices() || HasVertexColors()) && mesh.HasVertexColors()) {
+        vertex_colors_.resize(new_vert_num);
+        for (size_t i = 0; i < add_vert_num; i++)
+            vertex_colors_[old_vert_num + i] = mesh.vertex_colors_[i];
+    } else {
+        vertex_colors_.clear();
+    }
+    if ((!HasTriangles() || HasTriangleNormals()) &&
+        mesh.HasTriangleNormals()) {
+        triangle_normals_.resize(new_tri_num);
+        for (size_t i = 0; i < add_tri_num; i++)
+            triangle_normals_[old_tri_num + i] = mesh.triangle_normals_[i];
+    } else {
+        triangle_normals_.clear();
+    }
+    vertices_.resize(new_vert_num);
+    for (size_t i = 0; i < add_vert_num; i++)
+        vertices_[old_vert_num + i] = mesh.vertices_[i];
+    triangles_.resize(new_tri_num);
+    Eigen::Vector3i index_shift((int)old_vert_num, (int)old_vert_num,
+                                (int)old_vert_num);
+    for (size_t i = 0; i < add_tri_num; i++) {
+        triangles_[old_tri_num + i] = mesh.triangles_[i] + index_shift;
+    }
+    return (*this);
+}
+
+TriangleMeshF TriangleMeshF::operator+(const TriangleMeshF &mesh) const {
+    return (TriangleMeshF(*this) += mesh);
+}
+
+TriangleMeshF &TriangleMeshF::NormalizeNormals() {
+    utility::NormalizeVectors(vertex_normals_, Eigen::Vector3d(0.0, 0.0, 1.0));
+    utility::NormalizeVectors(triangle_normals_,
+                              Eigen::Vector3d(0.0, 0.0, 1.0));
+    return *this;
+}
+
+TriangleMeshF &TriangleMeshF::ComputeTriangleNormals(
+        bool normalized /* = true*/) {
+    triangle_normals_.resize(triangles_.size());
+    for (size_t i = 0; i < triangles_.size(); i++) {
+        auto &triangle = triangles_[i];
+        Eigen::Vector3f v01 = vertices_[triangle(1)] - vertices_[triangle(0)];
+        Eigen::Vector3f v02 = vertices_[triangle(2)] - vertices_[triangle(0)];
+        triangle_normals_[i] = v01.cross(v02);
+    }
+    if (normalized) {
+        NormalizeNormals();
+    }
+    return *this;
+}
+
+TriangleMeshF &TriangleMeshF::ComputeVertexNormals(
+        bool normalized /* = true*/) {
+    if (HasTriangleNormals() == false) {
+        ComputeTriangleNormals(false);
+    }
+    vertex_normals_.assign(vertices_.size(), Eigen::Vector3f::Zero());
+    for (size_t i = 0; i < triangles_.size(); i++) {
+        auto &triangle = triangles_[i];
+        vertex_normals_[triangle(0)] += triangle_normals_[i];
+        vertex_normals_[triangle(1)] += triangle_normals_[i];
+        vertex_normals_[triangle(2)] += triangle_normals_[i];
+    }
+    if (normalized) {
+        NormalizeNormals();
+    }
+    return *this;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMeshF::ToTriangleMesh() const {
+    auto output = std::make_shared<TriangleMesh>();
+    utility::CastVectors(vertices_, output->vertices_);
+    utility::CastVectors(vertex_normals_, output->vertex_normals_);
+    utility::CastVectors(vertex_colors_, output->vertex_colors_);
+    output->triangles_ = triangles_;
+    utility::CastVectors(triangle_normals_, output->triangle_normals_);
+    return output;
+}
+
+}  // namespace geometry
+}  // namespace open3d
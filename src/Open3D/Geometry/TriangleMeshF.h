@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/Geometry3D.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshF
+///
+/// \brief Triangle mesh with single-precision vertex attributes.
+///
+/// Holds vertices, normals and colors as Eigen::Vector3f, the layout the
+/// renderer uploads, at half the memory of TriangleMesh. Convert with
+/// TriangleMeshF(const TriangleMesh &) and ToTriangleMesh() for algorithms
+/// that only exist for TriangleMesh.
+class TriangleMeshF : public Geometry3D {
+public:
+    TriangleMeshF() : Geometry3D(Geometry::GeometryType::TriangleMeshF) {}
+    TriangleMeshF(const std::vector<Eigen::Vector3f> &vertices,
+                  const std::vector<Eigen::Vector3i> &triangles)
+        : Geometry3D(Geometry::GeometryType::TriangleMeshF),
+          vertices_(vertices),
+          triangles_(triangles) {}
+    /// Converts the vertex attributes and triangles of \p mesh. Uvs,
+    /// textures and adjacency lists are not kept.
+    explicit TriangleMeshF(const TriangleMesh &mesh);
+    ~TriangleMeshF() override {}
+
+public:
+    TriangleMeshF &Clear() override;
+    bool IsEmpty() const override;
+    Eigen::Vector3d GetMinBound() const override;
+    Eigen::Vector3d GetMaxBound() const override;
+    Eigen::Vector3d GetCenter() const override;
+    AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const override;
+    OrientedBoundingBox GetOrientedBoundingBox() const override;
+    TriangleMeshF &Transform(const Eigen::Matrix4d &transformation) override;
+    TriangleMeshF &Translate(const Eigen::Vector3d &translation,
+                             bool relative = true) override;
+    TriangleMeshF &Scale(const double scale, bool center = true) override;
+    TriangleMeshF &Rotate(const Eigen::Matrix3d &R,
+                          bool center = true) override;
+
+    TriangleMeshF &operator+=(const TriangleMeshF &mesh);
+    TriangleMeshF operator+(const TriangleMeshF &mesh) const;
+
+    bool HasVertices() const { return vertices_.size() > 0; }
+
+    bool HasTriangles() const {
+        return vertices_.size() > 0 && triangles_.size() > 0;
+    }
+
+    bool HasVertexNormals() const {
+        return vertices_.size() > 0 &&
+               vertex_normals_.size() == vertices_.size();
+    }
+
+    bool HasVertexColors() const {
+        return vertices_.size() > 0 &&
+               vertex_colors_.size() == vertices_.size();
+    }
+
+    bool HasTriangleNormals() const {
+        return HasTriangles() && triangles_.size() == triangle_normals_.size();
+    }
+
+    TriangleMeshF &NormalizeNormals();
+
+    /// Assigns each vertex the same color \p color.
+    TriangleMeshF &PaintUniformColor(const Eigen::Vector3d &color) {
+        ResizeAndPaintUniformColor(vertex_colors_, vertices_.size(), color);
+        return *this;
+    }
+
+    /// Same as TriangleMesh::ComputeTriangleNormals.
+    TriangleMeshF &ComputeTriangleNormals(bool normalized = true);
+    /// Same as TriangleMesh::ComputeVertexNormals.
+    TriangleMeshF &ComputeVertexNormals(bool normalized = true);
+
+    /// Converts the mesh to double precision.
+    std::shared_ptr<TriangleMesh> ToTriangleMesh() const;
+
+public:
+    std::vector<Eigen::Vector3f> vertices_;
+    std::vector<Eigen::Vector3f> vertex_normals_;
+    std::vector<Eigen::Vector3f> vertex_colors_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Eigen::Vector3f> triangle_normals_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
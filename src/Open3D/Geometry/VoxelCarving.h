@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <tuple>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+/// Voxel carving shared by VoxelGrid and SparseVoxelGrid. The voxels are
+/// given by their count and a functor returning the grid index of the i-th
+/// voxel, and the functions return a keep flag per voxel; the caller removes
+/// the carved voxels from its own storage.
+namespace voxel_carving {
+
+// The views are taken by pointer so that carving with a single view does not
+// copy its image into a vector.
+using CameraParametersPtrs =
+        std::vector<const camera::PinholeCameraParameters *>;
+using ImagePtrs = std::vector<const Image *>;
+
+/// Returns pointers to the elements of \p values.
+template <typename T>
+std::vector<const T *> GetPointers(const std::vector<T> &values) {
+    std::vector<const T *> pointers;
+    pointers.reserve(values.size());
+    for (const auto &value : values) {
+        pointers.push_back(&value);
+    }
+    return pointers;
+}
+
+/// A voxel is carved if keep_point(view, u, v, z) is false for all 8 boundary
+/// points in any of the views.
+template <typename GetGridIndexFunc, typename KeepPointFunc>
+std::vector<char> ComputeKeptVoxels(
+        size_t num_voxels,
+        const GetGridIndexFunc &get_grid_index,
+        double voxel_size,
+        const Eigen::Vector3d &origin,
+        const CameraParametersPtrs &camera_parameters,
+        const KeepPointFunc &keep_point) {
+    std::vector<char> keep(num_voxels, 1);
+    const size_t num_views = camera_parameters.size();
+    if (num_views == 0 || num_voxels == 0) {
+        return keep;
+    }
+
+    // Per view, the projection K * (R * x + t) of the voxel center is computed
+    // once, and the 8 boundary points are reached by adding the projections
+    // of the offsets from the center, which are the same for all voxels.
+    const double r = voxel_size / 2.0;
+    std::vector<Eigen::Matrix3d> KR(num_views);
+    std::vector<Eigen::Vector3d> Kt(num_views);
+    std::vector<std::vector<Eigen::Vector3d>> projected_offsets(num_views);
+    for (size_t view = 0; view < num_views; view++) {
+        const auto &parameter = *camera_parameters[view];
+        const Eigen::Matrix3d &intrinsic =
+                parameter.intrinsic_.intrinsic_matrix_;
+        KR[view] = intrinsic * parameter.extrinsic_.block<3, 3>(0, 0);
+        Kt[view] = intrinsic * parameter.extrinsic_.block<3, 1>(0, 3);
+        for (int k = 0; k < 8; k++) {
+            Eigen::Vector3d offset((k & 4) ? r : -r, (k & 2) ? r : -r,
+                                   (k & 1) ? r : -r);
+            projected_offsets[view].push_back(KR[view] * offset);
+        }
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int i = 0; i < int(num_voxels); i++) {
+        const Eigen::Vector3d center =
+                (get_grid_index(size_t(i)).template cast<double>() +
+                 Eigen::Vector3d(0.5, 0.5, 0.5)) *
+                        voxel_size +
+                origin;
+        for (size_t view = 0; view < num_views && keep[i]; view++) {
+            const Eigen::Vector3d uvz_center = KR[view] * center + Kt[view];
+            bool keep_in_view = false;
+            for (int k = 0; k < 8 && !keep_in_view; k++) {
+                const Eigen::Vector3d uvz =
+                        uvz_center + projected_offsets[view][k];
+                double z = uvz(2);
+                keep_in_view = keep_point(view, uvz(0) / z, uvz(1) / z, z);
+            }
+            keep[i] = keep_in_view ? 1 : 0;
+        }
+    }
+    return keep;
+}
+
+/// A voxel is kept if any of its boundary points projects to a valid pixel
+/// and is behind the depth of the depth map at that pixel.
+template <typename GetGridIndexFunc>
+std::vector<char> CarveDepthMapViews(
+        size_t num_voxels,
+        const GetGridIndexFunc &get_grid_index,
+        double voxel_size,
+        const Eigen::Vector3d &origin,
+        const ImagePtrs &depth_maps,
+        const CameraParametersPtrs &camera_parameters) {
+    if (depth_maps.size() != camera_parameters.size()) {
+        utility::LogError(
+                "[VoxelGrid] number of depth maps and camera parameters do "
+                "not match");
+    }
+    for (size_t i = 0; i < depth_maps.size(); i++) {
+        if (depth_maps[i]->height_ !=
+                    camera_parameters[i]->intrinsic_.height_ ||
+            depth_maps[i]->width_ != camera_parameters[i]->intrinsic_.width_) {
+            utility::LogError(
+                    "[VoxelGrid] provided depth_map dimensions are not "
+                    "compatible with the provided camera_parameters");
+        }
+    }
+    return ComputeKeptVoxels(
+            num_voxels, get_grid_index, voxel_size, origin, camera_parameters,
+            [&depth_maps](size_t view, double u, double v, double z) {
+                double d;
+                bool within_boundary;
+                std::tie(within_boundary, d) =
+                        depth_maps[view]->FloatValueAt(u, v);
+                return within_boundary && d > 0 && z >= d;
+            });
+}
+
+/// A voxel is kept if any of its boundary points projects to a valid pixel
+/// where the mask is set (>0).
+template <typename GetGridIndexFunc>
+std::vector<char> CarveSilhouetteViews(
+        size_t num_voxels,
+        const GetGridIndexFunc &get_grid_index,
+        double voxel_size,
+        const Eigen::Vector3d &origin,
+        const ImagePtrs &silhouette_masks,
+        const CameraParametersPtrs &camera_parameters) {
+    if (silhouette_masks.size() != camera_parameters.size()) {
+        utility::LogError(
+                "[VoxelGrid] number of silhouette masks and camera parameters "
+                "do not match");
+    }
+    for (size_t i = 0; i < silhouette_masks.size(); i++) {
+        if (silhouette_masks[i]->height_ !=
+                    camera_parameters[i]->intrinsic_.height_ ||
+            silhouette_masks[i]->width_ !=
+                    camera_parameters[i]->intrinsic_.width_) {
+            utility::LogError(
+                    "[VoxelGrid] provided silhouette_mask dimensions are not "
+                    "compatible with the provided camera_parameters");
+        }
+    }
+    return ComputeKeptVoxels(
+            num_voxels, get_grid_index, voxel_size, origin, camera_parameters,
+            [&silhouette_masks](size_t view, double u, double v, double z) {
+                double d;
+                bool within_boundary;
+                std::tie(within_boundary, d) =
+                        silhouette_masks[view]->FloatValueAt(u, v);
+                return within_boundary && d > 0;
+            });
+}
+
+}  // namespace voxel_carving
+}  // namespace geometry
+}  // namespace open3d
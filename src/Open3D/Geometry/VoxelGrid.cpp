@@ -33,6 +33,7 @@
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/VoxelCarving.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
 
@@ -212,15 +213,15 @@ void VoxelGrid::AddVoxel(const Voxel &voxel) {
 
 std::vector<bool> VoxelGrid::CheckIfIncluded(
         const std::vector<Eigen::Vector3d> &queries) {
-    std::vector<bool> output;
-    output.resize(queries.size());
-    size_t i = 0;
-    for (auto &query_double : queries) {
-        auto query = GetVoxel(query_double);
-        output[i] = voxels_.count(query) > 0;
-        i++;
+    // std::vector<bool> packs bits and cannot be written concurrently.
+    std::vector<char> included(queries.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(queries.size()); i++) {
+        included[i] = voxels_.count(GetVoxel(queries[i])) > 0 ? 1 : 0;
     }
-    return output;
+    return std::vector<bool>(included.begin(), included.end());
 }
 
 void VoxelGrid::CreateFromOctree(const Octree &octree) {
@@ -268,87 +269,85 @@ std::shared_ptr<geometry::Octree> VoxelGrid::ToOctree(
     return octree;
 }
 
-VoxelGrid &VoxelGrid::CarveDepthMap(
-        const Image &depth_map,
-        const camera::PinholeCameraParameters &camera_parameter) {
-    if (depth_map.height_ != camera_parameter.intrinsic_.height_ ||
-        depth_map.width_ != camera_parameter.intrinsic_.width_) {
-        utility::LogError(
-                "[VoxelGrid] provided depth_map dimensions are not compatible "
-                "with the provided camera_parameters");
-    }
+namespace {
 
-    auto rot = camera_parameter.extrinsic_.block<3, 3>(0, 0);
-    auto trans = camera_parameter.extrinsic_.block<3, 1>(0, 3);
-    auto intrinsic = camera_parameter.intrinsic_.intrinsic_matrix_;
-
-    // get for each voxel if it projects to a valid pixel and check if the voxel
-    // depth is behind the depth of the depth map at the projected pixel.
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
-        auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
-        for (auto &x : pts) {
-            auto x_trans = rot * x + trans;
-            auto uvz = intrinsic * x_trans;
-            double z = uvz(2);
-            double u = uvz(0) / z;
-            double v = uvz(1) / z;
-            double d;
-            bool within_boundary;
-            std::tie(within_boundary, d) = depth_map.FloatValueAt(u, v);
-            if (within_boundary && d > 0 && z >= d) {
-                carve = false;
-                break;
-            }
+// Erases the voxels whose keep flag is false.
+void EraseCarvedVoxels(VoxelGrid &voxel_grid,
+                       const std::vector<Eigen::Vector3i> &grid_indices,
+                       const std::vector<char> &keep) {
+    for (size_t i = 0; i < grid_indices.size(); i++) {
+        if (!keep[i]) {
+            voxel_grid.voxels_.erase(grid_indices[i]);
         }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
     }
+}
+
+// The hash map is not modified while the voxels are tested in parallel, so
+// the grid indices are collected first.
+std::vector<Eigen::Vector3i> GetGridIndices(const VoxelGrid &voxel_grid) {
+    std::vector<Eigen::Vector3i> grid_indices;
+    grid_indices.reserve(voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        grid_indices.push_back(it.first);
+    }
+    return grid_indices;
+}
+
+void CarveDepthMapViews(
+        VoxelGrid &voxel_grid,
+        const voxel_carving::ImagePtrs &depth_maps,
+        const voxel_carving::CameraParametersPtrs &camera_parameters) {
+    std::vector<Eigen::Vector3i> grid_indices = GetGridIndices(voxel_grid);
+    std::vector<char> keep = voxel_carving::CarveDepthMapViews(
+            grid_indices.size(),
+            [&grid_indices](size_t i) { return grid_indices[i]; },
+            voxel_grid.voxel_size_, voxel_grid.origin_, depth_maps,
+            camera_parameters);
+    EraseCarvedVoxels(voxel_grid, grid_indices, keep);
+}
+
+void CarveSilhouetteViews(
+        VoxelGrid &voxel_grid,
+        const voxel_carving::ImagePtrs &silhouette_masks,
+        const voxel_carving::CameraParametersPtrs &camera_parameters) {
+    std::vector<Eigen::Vector3i> grid_indices = GetGridIndices(voxel_grid);
+    std::vector<char> keep = voxel_carving::CarveSilhouetteViews(
+            grid_indices.size(),
+            [&grid_indices](size_t i) { return grid_indices[i]; },
+            voxel_grid.voxel_size_, voxel_grid.origin_, silhouette_masks,
+            camera_parameters);
+    EraseCarvedVoxels(voxel_grid, grid_indices, keep);
+}
+
+}  // unnamed namespace
+
+VoxelGrid &VoxelGrid::CarveDepthMap(
+        const Image &depth_map,
+        const camera::PinholeCameraParameters &camera_parameter) {
+    CarveDepthMapViews(*this, {&depth_map}, {&camera_parameter});
     return *this;
 }
 
 VoxelGrid &VoxelGrid::CarveSilhouette(
         const Image &silhouette_mask,
         const camera::PinholeCameraParameters &camera_parameter) {
-    if (silhouette_mask.height_ != camera_parameter.intrinsic_.height_ ||
-        silhouette_mask.width_ != camera_parameter.intrinsic_.width_) {
-        utility::LogError(
-                "[VoxelGrid] provided silhouette_mask dimensions are not "
-                "compatible with the provided camera_parameters");
-    }
+    CarveSilhouetteViews(*this, {&silhouette_mask}, {&camera_parameter});
+    return *this;
+}
 
-    auto rot = camera_parameter.extrinsic_.block<3, 3>(0, 0);
-    auto trans = camera_parameter.extrinsic_.block<3, 1>(0, 3);
-    auto intrinsic = camera_parameter.intrinsic_.intrinsic_matrix_;
-
-    // get for each voxel if it projects to a valid pixel and check if the pixel
-    // is set (>0).
-    for (auto it = voxels_.begin(); it != voxels_.end();) {
-        bool carve = true;
-        const geometry::Voxel &voxel = it->second;
-        auto pts = GetVoxelBoundingPoints(voxel.grid_index_);
-        for (auto &x : pts) {
-            auto x_trans = rot * x + trans;
-            auto uvz = intrinsic * x_trans;
-            double z = uvz(2);
-            double u = uvz(0) / z;
-            double v = uvz(1) / z;
-            double d;
-            bool within_boundary;
-            std::tie(within_boundary, d) = silhouette_mask.FloatValueAt(u, v);
-            if (within_boundary && d > 0) {
-                carve = false;
-                break;
-            }
-        }
-        if (carve)
-            it = voxels_.erase(it);
-        else
-            it++;
-    }
+VoxelGrid &VoxelGrid::CarveDepthMaps(
+        const std::vector<Image> &depth_maps,
+        const std::vector<camera::PinholeCameraParameters> &camera_parameters) {
+    CarveDepthMapViews(*this, voxel_carving::GetPointers(depth_maps),
+                       voxel_carving::GetPointers(camera_parameters));
+    return *this;
+}
+
+VoxelGrid &VoxelGrid::CarveSilhouettes(
+        const std::vector<Image> &silhouette_masks,
+        const std::vector<camera::PinholeCameraParameters> &camera_parameters) {
+    CarveSilhouetteViews(*this, voxel_carving::GetPointers(silhouette_masks),
+                         voxel_carving::GetPointers(camera_parameters));
     return *this;
 }
 
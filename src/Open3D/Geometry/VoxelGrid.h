@@ -132,6 +132,22 @@ public:
             const Image &silhouette_mask,
             const camera::PinholeCameraParameters &camera_parameter);
 
+    /// Carves the VoxelGrid with several depth maps, as calling CarveDepthMap
+    /// for every view. All views are tested in a single parallel pass over
+    /// the voxels.
+    VoxelGrid &CarveDepthMaps(
+            const std::vector<Image> &depth_maps,
+            const std::vector<camera::PinholeCameraParameters>
+                    &camera_parameters);
+
+    /// Carves the VoxelGrid with several silhouette masks, as calling
+    /// CarveSilhouette for every view. All views are tested in a single
+    /// parallel pass over the voxels.
+    VoxelGrid &CarveSilhouettes(
+            const std::vector<Image> &silhouette_masks,
+            const std::vector<camera::PinholeCameraParameters>
+                    &camera_parameters);
+
     void CreateFromOctree(const Octree &octree);
 
     std::shared_ptr<geometry::Octree> ToOctree(const size_t &max_depth) const;
@@ -163,18 +179,21 @@ public:
 
     // Creates a VoxelGrid from a given TriangleMesh. No color information is
     // converted. The bounds of the created VoxelGrid are computed from the
-    // TriangleMesh..
+    // TriangleMesh. If solid is true, the voxels inside the mesh are added as
+    // well; this requires a closed mesh.
     static std::shared_ptr<VoxelGrid> CreateFromTriangleMesh(
-            const TriangleMesh &input, double voxel_size);
+            const TriangleMesh &input, double voxel_size, bool solid = false);
 
     // Creates a VoxelGrid from a given TriangleMesh. No color information is
     // converted. The bounds of the created VoxelGrid are defined by the given
-    // parameters..
+    // parameters. If solid is true, the voxels inside the mesh are added as
+    // well; this requires a closed mesh.
     static std::shared_ptr<VoxelGrid> CreateFromTriangleMeshWithinBounds(
             const TriangleMesh &input,
             double voxel_size,
             const Eigen::Vector3d &min_bound,
-            const Eigen::Vector3d &max_bound);
+            const Eigen::Vector3d &max_bound,
+            bool solid = false);
 
 public:
     double voxel_size_ = 0.0;
@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <numeric>
+#include <tuple>
 #include <unordered_map>
 
 #include "Open3D/Geometry/IntersectionTest.h"
@@ -33,10 +35,257 @@
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+bool LessGridIndex(const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+    return std::tie(a(0), a(1), a(2)) < std::tie(b(0), b(1), b(2));
+}
+
+// Inclusive range of the voxel indices along one axis whose boxes may overlap
+// [lo, hi]. As in the rest of the triangle mesh voxelization, the voxel with
+// index i is the box of edge length voxel_size centered at
+// min_bound + i * voxel_size. Returns false if the range is empty.
+bool GetVoxelRange(double lo,
+                   double hi,
+                   double min_bound,
+                   double voxel_size,
+                   int num_voxels,
+                   int &begin,
+                   int &end) {
+    double begin_d = std::floor((lo - min_bound) / voxel_size - 0.5);
+    double end_d = std::floor((hi - min_bound) / voxel_size + 0.5);
+    begin_d = std::max(begin_d, 0.0);
+    end_d = std::min(end_d, double(num_voxels - 1));
+    if (begin_d > end_d) {
+        return false;
+    }
+    begin = int(begin_d);
+    end = int(end_d);
+    return true;
+}
+
+std::vector<Eigen::Vector3i> RasterizeTriangles(
+        const TriangleMesh &input,
+        double voxel_size,
+        const Eigen::Vector3d &min_bound,
+        const Eigen::Vector3i &num_voxels) {
+    const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
+                                        voxel_size / 2);
+    std::vector<Eigen::Vector3i> grid_indices;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<Eigen::Vector3i> grid_indices_private;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64) nowait
+#endif
+        for (int i = 0; i < int(input.triangles_.size()); i++) {
+            const Eigen::Vector3i &tria = input.triangles_[i];
+            const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
+            const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
+            const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
+            const Eigen::Vector3d tria_min = v0.cwiseMin(v1).cwiseMin(v2);
+            const Eigen::Vector3d tria_max = v0.cwiseMax(v1).cwiseMax(v2);
+            Eigen::Vector3i begin, end;
+            bool overlaps = true;
+            for (int axis = 0; axis < 3; axis++) {
+                overlaps &= GetVoxelRange(tria_min(axis), tria_max(axis),
+                                          min_bound(axis), voxel_size,
+                                          num_voxels(axis), begin(axis),
+                                          end(axis));
+            }
+            if (!overlaps) {
+                continue;
+            }
+            for (int widx = begin(0); widx <= end(0); widx++) {
+                for (int hidx = begin(1); hidx <= end(1); hidx++) {
+                    for (int didx = begin(2); didx <= end(2); didx++) {
+                        const Eigen::Vector3d box_center =
+                                min_bound +
+                                Eigen::Vector3d(widx, hidx, didx) * voxel_size;
+                        if (IntersectionTest::TriangleAABB(
+                                    box_center, box_half_size, v0, v1, v2)) {
+                            grid_indices_private.push_back(
+                                    Eigen::Vector3i(widx, hidx, didx));
+                        }
+                    }
+                }
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            grid_indices.insert(grid_indices.end(),
+                                grid_indices_private.begin(),
+                                grid_indices_private.end());
+#ifdef _OPENMP
+        }  //    omp critical
+    }      //    omp parallel
+#endif
+    return grid_indices;
+}
+
+// Whether the edge from a to b of a counter-clockwise triangle owns the
+// points lying exactly on it. The opposite edge of the neighboring triangle
+// never does, so shared edges and vertices are counted once.
+bool IsOwnedEdge(const Eigen::Vector2d &a, const Eigen::Vector2d &b) {
+    const Eigen::Vector2d d = b - a;
+    return d(1) > 0 || (d(1) == 0 && d(0) < 0);
+}
+
+// Signed area of (a, b, p). It is evaluated from the lexicographically
+// smaller endpoint, so that the two triangles sharing an edge get exactly
+// opposite values despite rounding.
+double EdgeFunction(const Eigen::Vector2d &a,
+                    const Eigen::Vector2d &b,
+                    const Eigen::Vector2d &p) {
+    if (std::tie(b(0), b(1)) < std::tie(a(0), a(1))) {
+        return -EdgeFunction(b, a, p);
+    }
+    return (b(0) - a(0)) * (p(1) - a(1)) - (b(1) - a(1)) * (p(0) - a(0));
+}
+
+// Voxels inside a closed mesh, found with the parity of the surface crossings
+// along scanlines in z through the voxel centers of every (w, h) column.
+std::vector<Eigen::Vector3i> FillInterior(const TriangleMesh &input,
+                                          double voxel_size,
+                                          const Eigen::Vector3d &min_bound,
+                                          const Eigen::Vector3i &num_voxels) {
+    // (column index w * num_h + h, z of the crossing)
+    std::vector<std::pair<int64_t, double>> crossings;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<std::pair<int64_t, double>> crossings_private;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64) nowait
+#endif
+        for (int i = 0; i < int(input.triangles_.size()); i++) {
+            const Eigen::Vector3i &tria = input.triangles_[i];
+            Eigen::Vector3d v[3] = {input.vertices_[tria(0)],
+                                    input.vertices_[tria(1)],
+                                    input.vertices_[tria(2)]};
+            Eigen::Vector2d p[3] = {v[0].head<2>(), v[1].head<2>(),
+                                    v[2].head<2>()};
+            double area = EdgeFunction(p[0], p[1], p[2]);
+            if (area == 0) {
+                // Triangles parallel to the scanlines are never crossed.
+                continue;
+            }
+            if (area < 0) {
+                std::swap(v[1], v[2]);
+                std::swap(p[1], p[2]);
+                area = -area;
+            }
+            const Eigen::Vector2d tria_min =
+                    p[0].cwiseMin(p[1]).cwiseMin(p[2]);
+            const Eigen::Vector2d tria_max =
+                    p[0].cwiseMax(p[1]).cwiseMax(p[2]);
+            int wbegin, wend, hbegin, hend;
+            if (!GetVoxelRange(tria_min(0), tria_max(0), min_bound(0),
+                               voxel_size, num_voxels(0), wbegin, wend) ||
+                !GetVoxelRange(tria_min(1), tria_max(1), min_bound(1),
+                               voxel_size, num_voxels(1), hbegin, hend)) {
+                continue;
+            }
+            for (int widx = wbegin; widx <= wend; widx++) {
+                for (int hidx = hbegin; hidx <= hend; hidx++) {
+                    const Eigen::Vector2d center =
+                            min_bound.head<2>() +
+                            Eigen::Vector2d(widx, hidx) * voxel_size;
+                    double weights[3];
+                    bool inside = true;
+                    for (int j = 0; j < 3 && inside; j++) {
+                        const Eigen::Vector2d &a = p[(j + 1) % 3];
+                        const Eigen::Vector2d &b = p[(j + 2) % 3];
+                        weights[j] = EdgeFunction(a, b, center);
+                        inside = weights[j] > 0 ||
+                                 (weights[j] == 0 && IsOwnedEdge(a, b));
+                    }
+                    if (!inside) {
+                        continue;
+                    }
+                    double z = (weights[0] * v[0](2) + weights[1] * v[1](2) +
+                                weights[2] * v[2](2)) /
+                               area;
+                    crossings_private.push_back(std::make_pair(
+                            int64_t(widx) * num_voxels(1) + hidx, z));
+                }
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            crossings.insert(crossings.end(), crossings_private.begin(),
+                             crossings_private.end());
+#ifdef _OPENMP
+        }  //    omp critical
+    }      //    omp parallel
+#endif
+    utility::ParallelSort(crossings);
+
+    std::vector<size_t> column_begins;
+    for (size_t i = 0; i < crossings.size(); i++) {
+        if (i == 0 || crossings[i].first != crossings[i - 1].first) {
+            column_begins.push_back(i);
+        }
+    }
+    column_begins.push_back(crossings.size());
+
+    std::vector<Eigen::Vector3i> grid_indices;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<Eigen::Vector3i> grid_indices_private;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64) nowait
+#endif
+        for (int c = 0; c < int(column_begins.size()) - 1; c++) {
+            const int64_t column = crossings[column_begins[c]].first;
+            const int widx = int(column / num_voxels(1));
+            const int hidx = int(column % num_voxels(1));
+            // Pairs of crossings enclose the interior. An unpaired last
+            // crossing means the mesh is not closed and is ignored.
+            for (size_t k = column_begins[c]; k + 1 < column_begins[c + 1];
+                 k += 2) {
+                double begin_d = std::ceil(
+                        (crossings[k].second - min_bound(2)) / voxel_size);
+                double end_d = std::floor(
+                        (crossings[k + 1].second - min_bound(2)) / voxel_size);
+                begin_d = std::max(begin_d, 0.0);
+                end_d = std::min(end_d, double(num_voxels(2) - 1));
+                for (int didx = int(begin_d); didx <= int(end_d); didx++) {
+                    grid_indices_private.push_back(
+                            Eigen::Vector3i(widx, hidx, didx));
+                }
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            grid_indices.insert(grid_indices.end(),
+                                grid_indices_private.begin(),
+                                grid_indices_private.end());
+#ifdef _OPENMP
+        }  //    omp critical
+    }      //    omp parallel
+#endif
+    return grid_indices;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateDense(const Eigen::Vector3d &origin,
                                                   double voxel_size,
                                                   double width,
@@ -118,7 +367,8 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
         const TriangleMesh &input,
         double voxel_size,
         const Eigen::Vector3d &min_bound,
-        const Eigen::Vector3d &max_bound) {
+        const Eigen::Vector3d &max_bound,
+        bool solid) {
     auto output = std::make_shared<VoxelGrid>();
     if (voxel_size <= 0.0) {
         utility::LogError("[CreateFromTriangleMesh] voxel_size <= 0.");
@@ -132,42 +382,46 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
     output->origin_ = min_bound;
 
     Eigen::Vector3d grid_size = max_bound - min_bound;
-    int num_w = int(std::round(grid_size(0) / voxel_size));
-    int num_h = int(std::round(grid_size(1) / voxel_size));
-    int num_d = int(std::round(grid_size(2) / voxel_size));
-    const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
-                                        voxel_size / 2);
-    for (int widx = 0; widx < num_w; widx++) {
-        for (int hidx = 0; hidx < num_h; hidx++) {
-            for (int didx = 0; didx < num_d; didx++) {
-                const Eigen::Vector3d box_center =
-                        min_bound +
-                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
-                for (const Eigen::Vector3i &tria : input.triangles_) {
-                    const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
-                    const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
-                    const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
-                    if (IntersectionTest::TriangleAABB(
-                                box_center, box_half_size, v0, v1, v2)) {
-                        Eigen::Vector3i grid_index(widx, hidx, didx);
-                        output->AddVoxel(geometry::Voxel(grid_index));
-                        break;
-                    }
-                }
-            }
-        }
+    const Eigen::Vector3i num_voxels(
+            int(std::round(grid_size(0) / voxel_size)),
+            int(std::round(grid_size(1) / voxel_size)),
+            int(std::round(grid_size(2) / voxel_size)));
+    if ((num_voxels.array() <= 0).any()) {
+        return output;
     }
 
+    // Every triangle is tested only against the voxels overlapped by its
+    // bounding box. Each thread collects the voxels it hits, and duplicates
+    // are removed after merging by sorting.
+    std::vector<Eigen::Vector3i> grid_indices =
+            RasterizeTriangles(input, voxel_size, min_bound, num_voxels);
+    if (solid) {
+        std::vector<Eigen::Vector3i> interior_indices =
+                FillInterior(input, voxel_size, min_bound, num_voxels);
+        grid_indices.insert(grid_indices.end(), interior_indices.begin(),
+                            interior_indices.end());
+    }
+    utility::ParallelSort(grid_indices, LessGridIndex);
+    grid_indices.erase(std::unique(grid_indices.begin(), grid_indices.end()),
+                       grid_indices.end());
+
+    output->voxels_.reserve(grid_indices.size());
+    for (const Eigen::Vector3i &grid_index : grid_indices) {
+        output->AddVoxel(geometry::Voxel(grid_index));
+    }
+    utility::LogDebug(
+            "TriangleMesh is voxelized from {:d} triangles to {:d} voxels.",
+            (int)input.triangles_.size(), (int)output->voxels_.size());
     return output;
 }
 
 std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMesh(
-        const TriangleMesh &input, double voxel_size) {
+        const TriangleMesh &input, double voxel_size, bool solid) {
     Eigen::Vector3d voxel_size3(voxel_size, voxel_size, voxel_size);
     Eigen::Vector3d min_bound = input.GetMinBound() - voxel_size3 * 0.5;
     Eigen::Vector3d max_bound = input.GetMaxBound() + voxel_size3 * 0.5;
     return CreateFromTriangleMeshWithinBounds(input, voxel_size, min_bound,
-                                              max_bound);
+                                              max_bound, solid);
 }
 
 }  // namespace geometry
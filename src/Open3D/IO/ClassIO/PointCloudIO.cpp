@@ -36,9 +36,11 @@ namespace open3d {
 namespace {
 using namespace io;
 
+// Plain function pointers select the geometry::PointCloud overloads of the
+// PLY functions.
 static const std::unordered_map<
         std::string,
-        std::function<bool(const std::string &, geometry::PointCloud &, bool)>>
+        bool (*)(const std::string &, geometry::PointCloud &, bool)>
         file_extension_to_pointcloud_read_function{
                 {"xyz", ReadPointCloudFromXYZ},
                 {"xyzn", ReadPointCloudFromXYZN},
@@ -49,11 +51,11 @@ static const std::unordered_map<
         };
 
 static const std::unordered_map<std::string,
-                                std::function<bool(const std::string &,
-                                                   const geometry::PointCloud &,
-                                                   const bool,
-                                                   const bool,
-                                                   const bool)>>
+                                bool (*)(const std::string &,
+                                         const geometry::PointCloud &,
+                                         const bool,
+                                         const bool,
+                                         const bool)>
         file_extension_to_pointcloud_write_function{
                 {"xyz", WritePointCloudToXYZ},
                 {"xyzn", WritePointCloudToXYZN},
@@ -136,5 +138,51 @@ bool WritePointCloud(const std::string &filename,
     return success;
 }
 
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloudF &pointcloud,
+                    const std::string &format,
+                    bool remove_nan_points,
+                    bool remove_infinite_points,
+                    bool print_progress) {
+    std::string filename_ext;
+    if (format == "auto") {
+        filename_ext =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    } else {
+        filename_ext = format;
+    }
+    bool success;
+    if (filename_ext == "ply") {
+        success = ReadPointCloudFromPLY(filename, pointcloud, print_progress);
+    } else {
+        geometry::PointCloud pointcloud_double;
+        success = ReadPointCloud(filename, pointcloud_double, format, false,
+                                 false, print_progress);
+        pointcloud = geometry::PointCloudF(pointcloud_double);
+    }
+    utility::LogDebug("Read geometry::PointCloudF: {:d} vertices.",
+                      (int)pointcloud.points_.size());
+    if (remove_nan_points || remove_infinite_points) {
+        pointcloud.RemoveNoneFinitePoints(remove_nan_points,
+                                          remove_infinite_points);
+    }
+    return success;
+}
+
+bool WritePointCloud(const std::string &filename,
+                     const geometry::PointCloudF &pointcloud,
+                     bool write_ascii /* = false*/,
+                     bool compressed /* = false*/,
+                     bool print_progress) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    if (filename_ext == "ply") {
+        return WritePointCloudToPLY(filename, pointcloud, write_ascii,
+                                    compressed, print_progress);
+    }
+    return WritePointCloud(filename, *pointcloud.ToPointCloud(), write_ascii,
+                           compressed, print_progress);
+}
+
 }  // namespace io
 }  // namespace open3d
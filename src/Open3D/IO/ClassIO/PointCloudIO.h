@@ -29,6 +29,7 @@
 #include <string>
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 
 namespace open3d {
 namespace io {
@@ -61,6 +62,22 @@ bool WritePointCloud(const std::string &filename,
                      bool compressed = false,
                      bool print_progress = false);
 
+/// Single-precision versions of ReadPointCloud and WritePointCloud. PLY files
+/// are read and written directly; other formats go through a temporary
+/// geometry::PointCloud.
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloudF &pointcloud,
+                    const std::string &format = "auto",
+                    bool remove_nan_points = true,
+                    bool remove_infinite_points = true,
+                    bool print_progress = false);
+
+bool WritePointCloud(const std::string &filename,
+                     const geometry::PointCloudF &pointcloud,
+                     bool write_ascii = false,
+                     bool compressed = false,
+                     bool print_progress = false);
+
 bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress = false);
@@ -95,12 +112,23 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress = false);
 
+bool ReadPointCloudFromPLY(const std::string &filename,
+                           geometry::PointCloudF &pointcloud,
+                           bool print_progress = false);
+
 bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           bool write_ascii = false,
                           bool compressed = false,
                           bool print_progress = false);
 
+/// Writes float coordinates and normals.
+bool WritePointCloudToPLY(const std::string &filename,
+                          const geometry::PointCloudF &pointcloud,
+                          bool write_ascii = false,
+                          bool compressed = false,
+                          bool print_progress = false);
+
 bool ReadPointCloudFromPCD(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress = false);
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <rply/rply.h>
+#include <type_traits>
 
 #include "Open3D/IO/ClassIO/LineSetIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
@@ -39,9 +40,11 @@ using namespace io;
 
 namespace ply_pointcloud_reader {
 
+/// \p CloudT is geometry::PointCloud or geometry::PointCloudF.
+template <typename CloudT>
 struct PLYReaderState {
     utility::ConsoleProgressBar *progress_bar;
-    geometry::PointCloud *pointcloud_ptr;
+    CloudT *pointcloud_ptr;
     long vertex_index;
     long vertex_num;
     long normal_index;
@@ -50,8 +53,9 @@ struct PLYReaderState {
     long color_num;
 };
 
+template <typename CloudT>
 int ReadVertexCallback(p_ply_argument argument) {
-    PLYReaderState *state_ptr;
+    PLYReaderState<CloudT> *state_ptr;
     long index;
     ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
                                &index);
@@ -68,8 +72,9 @@ int ReadVertexCallback(p_ply_argument argument) {
     return 1;
 }
 
+template <typename CloudT>
 int ReadNormalCallback(p_ply_argument argument) {
-    PLYReaderState *state_ptr;
+    PLYReaderState<CloudT> *state_ptr;
     long index;
     ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
                                &index);
@@ -85,8 +90,9 @@ int ReadNormalCallback(p_ply_argument argument) {
     return 1;
 }
 
+template <typename CloudT>
 int ReadColorCallback(p_ply_argument argument) {
-    PLYReaderState *state_ptr;
+    PLYReaderState<CloudT> *state_ptr;
     long index;
     ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
                                &index);
@@ -351,13 +357,10 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
-}  // unnamed namespace
-
-namespace io {
-
-bool ReadPointCloudFromPLY(const std::string &filename,
-                           geometry::PointCloud &pointcloud,
-                           bool print_progress) {
+template <typename CloudT>
+bool ReadPointCloudFromPLYT(const std::string &filename,
+                            CloudT &pointcloud,
+                            bool print_progress) {
     using namespace ply_pointcloud_reader;
 
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
@@ -372,22 +375,28 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         return false;
     }
 
-    PLYReaderState state;
+    PLYReaderState<CloudT> state;
     state.pointcloud_ptr = &pointcloud;
     state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
-                                       ReadVertexCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+                                       ReadVertexCallback<CloudT>, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback<CloudT>,
+                    &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback<CloudT>,
+                    &state, 2);
 
     state.normal_num = ply_set_read_cb(ply_file, "vertex", "nx",
-                                       ReadNormalCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback, &state, 2);
+                                       ReadNormalCallback<CloudT>, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "ny", ReadNormalCallback<CloudT>,
+                    &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "nz", ReadNormalCallback<CloudT>,
+                    &state, 2);
 
     state.color_num = ply_set_read_cb(ply_file, "vertex", "red",
-                                      ReadColorCallback, &state, 0);
-    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback, &state, 1);
-    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback, &state, 2);
+                                      ReadColorCallback<CloudT>, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "green", ReadColorCallback<CloudT>,
+                    &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "blue", ReadColorCallback<CloudT>,
+                    &state, 2);
 
     if (state.vertex_num <= 0) {
         utility::LogWarning("Read PLY failed: number of vertex <= 0.");
@@ -420,11 +429,17 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     return true;
 }
 
-bool WritePointCloudToPLY(const std::string &filename,
-                          const geometry::PointCloud &pointcloud,
-                          bool write_ascii /* = false*/,
-                          bool compressed /* = false*/,
-                          bool print_progress) {
+/// Coordinates and normals are written as float or double properties,
+/// matching the precision of \p pointcloud.
+template <typename CloudT>
+bool WritePointCloudToPLYT(const std::string &filename,
+                           const CloudT &pointcloud,
+                           bool write_ascii,
+                           bool compressed,
+                           bool print_progress) {
+    typedef typename decltype(pointcloud.points_)::value_type::Scalar Scalar;
+    const e_ply_type type =
+            std::is_same<Scalar, float>::value ? PLY_FLOAT : PLY_DOUBLE;
     if (pointcloud.IsEmpty()) {
         utility::LogWarning("Write PLY failed: point cloud has 0 points.");
         return false;
@@ -441,13 +456,13 @@ bool WritePointCloudToPLY(const std::string &filename,
     ply_add_comment(ply_file, "Created by Open3D");
     ply_add_element(ply_file, "vertex",
                     static_cast<long>(pointcloud.points_.size()));
-    ply_add_property(ply_file, "x", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "y", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-    ply_add_property(ply_file, "z", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+    ply_add_property(ply_file, "x", type, type, type);
+    ply_add_property(ply_file, "y", type, type, type);
+    ply_add_property(ply_file, "z", type, type, type);
     if (pointcloud.HasNormals()) {
-        ply_add_property(ply_file, "nx", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "ny", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
-        ply_add_property(ply_file, "nz", PLY_DOUBLE, PLY_DOUBLE, PLY_DOUBLE);
+        ply_add_property(ply_file, "nx", type, type, type);
+        ply_add_property(ply_file, "ny", type, type, type);
+        ply_add_property(ply_file, "nz", type, type, type);
     }
     if (pointcloud.HasColors()) {
         ply_add_property(ply_file, "red", PLY_UCHAR, PLY_UCHAR, PLY_UCHAR);
@@ -466,18 +481,21 @@ bool WritePointCloudToPLY(const std::string &filename,
 
     bool printed_color_warning = false;
     for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const Eigen::Vector3d &point = pointcloud.points_[i];
+        const Eigen::Vector3d point =
+                pointcloud.points_[i].template cast<double>();
         ply_write(ply_file, point(0));
         ply_write(ply_file, point(1));
         ply_write(ply_file, point(2));
         if (pointcloud.HasNormals()) {
-            const Eigen::Vector3d &normal = pointcloud.normals_[i];
+            const Eigen::Vector3d normal =
+                    pointcloud.normals_[i].template cast<double>();
             ply_write(ply_file, normal(0));
             ply_write(ply_file, normal(1));
             ply_write(ply_file, normal(2));
         }
         if (pointcloud.HasColors()) {
-            const Eigen::Vector3d &color = pointcloud.colors_[i];
+            const Eigen::Vector3d color =
+                    pointcloud.colors_[i].template cast<double>();
             if (!printed_color_warning &&
                 (color(0) < 0 || color(0) > 1 || color(1) < 0 || color(1) > 1 ||
                  color(2) < 0 || color(2) > 1)) {
@@ -499,6 +517,40 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPointCloudFromPLY(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress) {
+    return ReadPointCloudFromPLYT(filename, pointcloud, print_progress);
+}
+
+bool ReadPointCloudFromPLY(const std::string &filename,
+                           geometry::PointCloudF &pointcloud,
+                           bool print_progress) {
+    return ReadPointCloudFromPLYT(filename, pointcloud, print_progress);
+}
+
+bool WritePointCloudToPLY(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToPLYT(filename, pointcloud, write_ascii, compressed,
+                                 print_progress);
+}
+
+bool WritePointCloudToPLY(const std::string &filename,
+                          const geometry::PointCloudF &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToPLYT(filename, pointcloud, write_ascii, compressed,
+                                 print_progress);
+}
+
 bool ReadTriangleMeshFromPLY(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
@@ -0,0 +1,391 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/MarchingCubes.h"
+
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+
+#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace integration {
+
+namespace {
+
+/// The edge (v, axis) of the grid is shared by the cubes v - start, where
+/// start is the first corner of the edge in each cube. Both are listed per
+/// axis so that an edge can be checked from the voxel owning it.
+class EdgeUsers {
+public:
+    EdgeUsers() {
+        int count[3] = {0, 0, 0};
+        for (int i = 0; i < 12; i++) {
+            int axis = edge_shift[i](3);
+            cube_offsets_[axis][count[axis]] = -edge_shift[i].head<3>();
+            edges_[axis][count[axis]] = i;
+            count[axis]++;
+        }
+    }
+
+public:
+    Eigen::Vector3i cube_offsets_[3][4];
+    int edges_[3][4];
+};
+
+/// Per block results of the classification pass.
+class BlockCubes {
+public:
+    /// Marching cubes case of every cube, 0 if the cube has no surface.
+    std::vector<uint8_t> cube_indices_;
+    /// Bit 3 * voxel + axis is set if the edge (voxel, axis) has a vertex.
+    std::vector<uint64_t> edge_bits_;
+    /// Number of set bits before each word of edge_bits_.
+    std::vector<int> edge_ranks_;
+    int num_vertices_ = 0;
+    int num_triangles_ = 0;
+};
+
+class BlockGrid {
+public:
+    BlockGrid(const std::vector<TSDFVoxelBlock> &blocks, int block_resolution)
+        : blocks_(blocks),
+          resolution_(block_resolution),
+          neighbors_(blocks.size() * 27, -1) {
+        std::unordered_map<Eigen::Vector3i, int,
+                           utility::hash_eigen::hash<Eigen::Vector3i>>
+                block_map;
+        for (size_t i = 0; i < blocks.size(); i++) {
+            block_map[blocks[i].index_] = int(i);
+        }
+        utility::ParallelFor(0, int(blocks.size()), [&](int b) {
+            for (int k = 0; k < 27; k++) {
+                Eigen::Vector3i index = blocks_[b].index_ +
+                                        Eigen::Vector3i(k / 9 - 1,
+                                                        k / 3 % 3 - 1,
+                                                        k % 3 - 1);
+                auto itr = block_map.find(index);
+                if (itr != block_map.end()) {
+                    neighbors_[b * 27 + k] = itr->second;
+                }
+            }
+        });
+    }
+
+public:
+    int Linear(const Eigen::Vector3i &local) const {
+        return (local(0) * resolution_ + local(1)) * resolution_ + local(2);
+    }
+
+    /// Maps \p local, which may lie up to one block outside block \p b, to
+    /// the block holding it and the index inside that block. Returns -1 if
+    /// there is no such block.
+    int Resolve(int b, Eigen::Vector3i &local) const {
+        int k = 13;
+        const int weights[3] = {9, 3, 1};
+        for (int i = 0; i < 3; i++) {
+            if (local(i) < 0) {
+                local(i) += resolution_;
+                k -= weights[i];
+            } else if (local(i) >= resolution_) {
+                local(i) -= resolution_;
+                k += weights[i];
+            }
+        }
+        return neighbors_[b * 27 + k];
+    }
+
+    const geometry::TSDFVoxel *GetVoxel(int b, Eigen::Vector3i local) const {
+        int nb = Resolve(b, local);
+        if (nb < 0) {
+            return nullptr;
+        }
+        const TSDFVoxelBlock &block = blocks_[nb];
+        if (local(0) >= block.size_(0) || local(1) >= block.size_(1) ||
+            local(2) >= block.size_(2)) {
+            return nullptr;
+        }
+        return block.voxels_ + local(0) * block.stride_x_ +
+               local(1) * block.stride_y_ + local(2);
+    }
+
+public:
+    const std::vector<TSDFVoxelBlock> &blocks_;
+    int resolution_;
+    /// Neighbors of block b at offset (dx, dy, dz) are stored at
+    /// b * 27 + (dx + 1) * 9 + (dy + 1) * 3 + (dz + 1), -1 if missing.
+    std::vector<int> neighbors_;
+};
+
+int CountBits(uint64_t word) { return int(std::bitset<64>(word).count()); }
+
+int EdgeRank(const BlockCubes &cubes, int bit) {
+    uint64_t below = (uint64_t(1) << (bit & 63)) - 1;
+    return cubes.edge_ranks_[bit >> 6] +
+           CountBits(cubes.edge_bits_[bit >> 6] & below);
+}
+
+/// First pass: computes the case of every cube of block \p b.
+void ClassifyCubes(const BlockGrid &grid, int b, BlockCubes &cubes) {
+    const TSDFVoxelBlock &block = grid.blocks_[b];
+    const int resolution = grid.resolution_;
+    cubes.cube_indices_.assign(resolution * resolution * resolution, 0);
+    for (int x = 0; x < block.size_(0); x++) {
+        for (int y = 0; y < block.size_(1); y++) {
+            for (int z = 0; z < block.size_(2); z++) {
+                Eigen::Vector3i idx0(x, y, z);
+                bool inside = x + 1 < block.size_(0) &&
+                              y + 1 < block.size_(1) &&
+                              z + 1 < block.size_(2);
+                int cube_index = 0;
+                for (int i = 0; i < 8; i++) {
+                    Eigen::Vector3i idx1 = idx0 + shift[i];
+                    const geometry::TSDFVoxel *voxel =
+                            inside ? block.voxels_ +
+                                             idx1(0) * block.stride_x_ +
+                                             idx1(1) * block.stride_y_ +
+                                             idx1(2)
+                                   : grid.GetVoxel(b, idx1);
+                    if (voxel == nullptr || voxel->weight_ == 0.0f) {
+                        cube_index = 0;
+                        break;
+                    }
+                    if (voxel->tsdf_ < 0.0f) {
+                        cube_index |= (1 << i);
+                    }
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                cubes.cube_indices_[grid.Linear(idx0)] = uint8_t(cube_index);
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    cubes.num_triangles_++;
+                }
+            }
+        }
+    }
+}
+
+/// Second pass: marks the edges owned by block \p b that carry a vertex,
+/// reading the cube cases of the neighbors that share them.
+void MarkEdges(const BlockGrid &grid,
+               const std::vector<BlockCubes> &all_cubes,
+               const EdgeUsers &users,
+               int b,
+               BlockCubes &cubes) {
+    const TSDFVoxelBlock &block = grid.blocks_[b];
+    const int resolution = grid.resolution_;
+    const int num_bits = 3 * resolution * resolution * resolution;
+    cubes.edge_bits_.assign((num_bits + 63) / 64, 0);
+    for (int x = 0; x < block.size_(0); x++) {
+        for (int y = 0; y < block.size_(1); y++) {
+            for (int z = 0; z < block.size_(2); z++) {
+                Eigen::Vector3i idx0(x, y, z);
+                for (int axis = 0; axis < 3; axis++) {
+                    for (int k = 0; k < 4; k++) {
+                        Eigen::Vector3i local =
+                                idx0 + users.cube_offsets_[axis][k];
+                        int nb = grid.Resolve(b, local);
+                        if (nb < 0) {
+                            continue;
+                        }
+                        int cube_index =
+                                all_cubes[nb].cube_indices_[grid.Linear(local)];
+                        if (edge_table[cube_index] &
+                            (1 << users.edges_[axis][k])) {
+                            int bit = 3 * grid.Linear(idx0) + axis;
+                            cubes.edge_bits_[bit >> 6] |= uint64_t(1)
+                                                          << (bit & 63);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    cubes.edge_ranks_.resize(cubes.edge_bits_.size());
+    int rank = 0;
+    for (size_t i = 0; i < cubes.edge_bits_.size(); i++) {
+        cubes.edge_ranks_[i] = rank;
+        rank += CountBits(cubes.edge_bits_[i]);
+    }
+    cubes.num_vertices_ = rank;
+}
+
+/// Shared by TriangleMesh and TriangleMeshF. Vertices are computed in double
+/// precision and converted when they are stored.
+template <typename MeshT>
+void ExtractTriangleMeshFromVoxelBlocksT(
+        const std::vector<TSDFVoxelBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        const Eigen::Vector3d &origin,
+        TSDFVolumeColorType color_type,
+        MeshT *mesh) {
+    typedef typename decltype(mesh->vertices_)::value_type::Scalar Scalar;
+    // implementation of marching cubes, based on
+    // http://paulbourke.net/geometry/polygonise/
+    const int num_blocks = int(blocks.size());
+    const int resolution = block_resolution;
+    const BlockGrid grid(blocks, block_resolution);
+    const EdgeUsers users;
+    std::vector<BlockCubes> all_cubes(num_blocks);
+    utility::ParallelFor(0, num_blocks,
+                         [&](int b) { ClassifyCubes(grid, b, all_cubes[b]); });
+    utility::ParallelFor(0, num_blocks, [&](int b) {
+        MarkEdges(grid, all_cubes, users, b, all_cubes[b]);
+    });
+
+    // Block b writes its vertices and triangles from these offsets on.
+    std::vector<int> vertex_offsets(num_blocks + 1, 0);
+    std::vector<int> triangle_offsets(num_blocks + 1, 0);
+    for (int b = 0; b < num_blocks; b++) {
+        vertex_offsets[b + 1] = vertex_offsets[b] + all_cubes[b].num_vertices_;
+        triangle_offsets[b + 1] =
+                triangle_offsets[b] + all_cubes[b].num_triangles_;
+    }
+    mesh->vertices_.resize(vertex_offsets[num_blocks]);
+    if (color_type != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.resize(vertex_offsets[num_blocks]);
+    }
+    mesh->triangles_.resize(triangle_offsets[num_blocks]);
+
+    const double half_voxel_length = voxel_length * 0.5;
+    auto get_color = [color_type](const geometry::TSDFVoxel &voxel) {
+        if (color_type == TSDFVolumeColorType::RGB8) {
+            return Eigen::Vector3d(voxel.color_.cast<double>() / 255.0);
+        }
+        return Eigen::Vector3d(voxel.color_.cast<double>());
+    };
+    utility::ParallelFor(0, num_blocks, [&](int b) {
+        const TSDFVoxelBlock &block = blocks[b];
+        const BlockCubes &cubes = all_cubes[b];
+        int vertex_index = vertex_offsets[b];
+        for (size_t word = 0; word < cubes.edge_bits_.size(); word++) {
+            uint64_t bits = cubes.edge_bits_[word];
+            for (int j = 0; bits != 0; j++, bits >>= 1) {
+                if (!(bits & 1)) {
+                    continue;
+                }
+                int bit = int(word) * 64 + j;
+                int voxel = bit / 3;
+                int axis = bit % 3;
+                Eigen::Vector3i idx0(voxel / (resolution * resolution),
+                                     voxel / resolution % resolution,
+                                     voxel % resolution);
+                Eigen::Vector3i idx1 = idx0;
+                idx1(axis) += 1;
+                const geometry::TSDFVoxel &voxel0 = *grid.GetVoxel(b, idx0);
+                const geometry::TSDFVoxel &voxel1 = *grid.GetVoxel(b, idx1);
+                Eigen::Vector3i edge_index =
+                        block.index_ * resolution + idx0;
+                Eigen::Vector3d pt(
+                        half_voxel_length + voxel_length * edge_index(0),
+                        half_voxel_length + voxel_length * edge_index(1),
+                        half_voxel_length + voxel_length * edge_index(2));
+                double f0 = std::abs((double)voxel0.tsdf_);
+                double f1 = std::abs((double)voxel1.tsdf_);
+                pt(axis) += f0 * voxel_length / (f0 + f1);
+                mesh->vertices_[vertex_index] =
+                        (pt + origin).template cast<Scalar>();
+                if (color_type != TSDFVolumeColorType::NoColor) {
+                    mesh->vertex_colors_[vertex_index] =
+                            ((f1 * get_color(voxel0) + f0 * get_color(voxel1)) /
+                             (f0 + f1))
+                                    .template cast<Scalar>();
+                }
+                vertex_index++;
+            }
+        }
+
+        // Stitch triangles to the vertices of this block and of the blocks
+        // owning the far edges of the boundary cubes.
+        int triangle_index = triangle_offsets[b];
+        int edge_to_index[12];
+        for (int x = 0; x < block.size_(0); x++) {
+            for (int y = 0; y < block.size_(1); y++) {
+                for (int z = 0; z < block.size_(2); z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    int cube_index = cubes.cube_indices_[grid.Linear(idx0)];
+                    if (cube_index == 0) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (!(edge_table[cube_index] & (1 << i))) {
+                            continue;
+                        }
+                        Eigen::Vector3i local =
+                                idx0 + edge_shift[i].head<3>();
+                        int nb = grid.Resolve(b, local);
+                        edge_to_index[i] =
+                                vertex_offsets[nb] +
+                                EdgeRank(all_cubes[nb],
+                                         3 * grid.Linear(local) +
+                                                 edge_shift[i](3));
+                    }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        mesh->triangles_[triangle_index++] = Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMeshFromVoxelBlocks(
+        const std::vector<TSDFVoxelBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        const Eigen::Vector3d &origin,
+        TSDFVolumeColorType color_type) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    ExtractTriangleMeshFromVoxelBlocksT(blocks, block_resolution, voxel_length,
+                                        origin, color_type, mesh.get());
+    return mesh;
+}
+
+std::shared_ptr<geometry::TriangleMeshF> ExtractTriangleMeshFFromVoxelBlocks(
+        const std::vector<TSDFVoxelBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        const Eigen::Vector3d &origin,
+        TSDFVolumeColorType color_type) {
+    auto mesh = std::make_shared<geometry::TriangleMeshF>();
+    ExtractTriangleMeshFromVoxelBlocksT(blocks, block_resolution, voxel_length,
+                                        origin, color_type, mesh.get());
+    return mesh;
+}
+
+}  // namespace integration
+}  // namespace open3d
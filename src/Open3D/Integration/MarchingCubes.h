@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+
+namespace open3d {
+namespace integration {
+
+/// View of one block of a block-structured TSDF voxel grid. Voxel (x, y, z)
+/// of the block has the grid index index_ * block_resolution + (x, y, z) and
+/// is stored at voxels_[x * stride_x_ + y * stride_y_ + z].
+class TSDFVoxelBlock {
+public:
+    Eigen::Vector3i index_;
+    const geometry::TSDFVoxel *voxels_;
+    int stride_x_;
+    int stride_y_;
+    /// Number of voxels along each axis, at most the block resolution.
+    Eigen::Vector3i size_;
+};
+
+/// Function to extract a triangle mesh from a grid of voxel blocks with
+/// marching cubes. Voxel (x, y, z) of the grid is centered at origin +
+/// ((x, y, z) + 0.5) * voxel_length. Blocks are processed in parallel in two
+/// passes that first classify the cubes and then emit vertices and triangles
+/// at offsets given by prefix sums, so the output only depends on the order
+/// of \p blocks and not on the number of threads.
+std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMeshFromVoxelBlocks(
+        const std::vector<TSDFVoxelBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        const Eigen::Vector3d &origin,
+        TSDFVolumeColorType color_type);
+
+/// Same as ExtractTriangleMeshFromVoxelBlocks with a single-precision mesh.
+std::shared_ptr<geometry::TriangleMeshF> ExtractTriangleMeshFFromVoxelBlocks(
+        const std::vector<TSDFVoxelBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        const Eigen::Vector3d &origin,
+        TSDFVolumeColorType color_type);
+
+}  // namespace integration
+}  // namespace open3d
@@ -26,16 +26,61 @@
 
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
+#include <algorithm>
+#include <atomic>
+#include <tuple>
 #include <unordered_set>
+#include <utility>
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Integration/MarchingCubes.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// Returns the resident volume units of \p volume as voxel blocks. Hash map
+/// order is arbitrary; the blocks are sorted so that meshes are reproducible.
+std::vector<TSDFVoxelBlock> GetSortedVoxelBlocks(
+        const ScalableTSDFVolume &volume) {
+    const int resolution = volume.volume_unit_resolution_;
+    std::vector<TSDFVoxelBlock> blocks;
+    blocks.reserve(volume.volume_units_.size());
+    for (const auto &unit : volume.volume_units_) {
+        if (unit.second.volume_) {
+            TSDFVoxelBlock block;
+            block.index_ = unit.second.index_;
+            block.voxels_ = unit.second.volume_->voxels_.data();
+            block.stride_x_ = resolution * resolution;
+            block.stride_y_ = resolution;
+            block.size_ = Eigen::Vector3i::Constant(resolution);
+            blocks.push_back(block);
+        }
+    }
+    std::sort(blocks.begin(), blocks.end(),
+              [](const TSDFVoxelBlock &a, const TSDFVoxelBlock &b) {
+                  return std::make_tuple(a.index_(0), a.index_(1),
+                                         a.index_(2)) <
+                         std::make_tuple(b.index_(0), b.index_(1),
+                                         b.index_(2));
+              });
+    return blocks;
+}
+
+size_t CreateSpillId() {
+    static std::atomic<size_t> next_spill_id(0);
+    return next_spill_id++;
+}
+
+}  // unnamed namespace
+
 ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
                                        double sdf_trunc,
                                        TSDFVolumeColorType color_type,
@@ -44,16 +89,81 @@ ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
     : TSDFVolume(voxel_length, sdf_trunc, color_type),
       volume_unit_resolution_(volume_unit_resolution),
       volume_unit_length_(voxel_length * volume_unit_resolution),
-      depth_sampling_stride_(depth_sampling_stride) {}
+      depth_sampling_stride_(depth_sampling_stride),
+      spill_id_(CreateSpillId()) {}
+
+ScalableTSDFVolume::ScalableTSDFVolume(const ScalableTSDFVolume &other)
+    : TSDFVolume(other),
+      volume_unit_resolution_(other.volume_unit_resolution_),
+      volume_unit_length_(other.volume_unit_length_),
+      depth_sampling_stride_(other.depth_sampling_stride_),
+      volume_units_(other.volume_units_),
+      memory_budget_(other.memory_budget_),
+      eviction_policy_(other.eviction_policy_),
+      spill_directory_(other.spill_directory_),
+      spill_id_(CreateSpillId()),
+      frame_index_(other.frame_index_),
+      last_camera_center_(other.last_camera_center_) {
+    for (auto &unit : volume_units_) {
+        if (unit.second.volume_) {
+            unit.second.volume_ = std::make_shared<UniformTSDFVolume>(
+                    *unit.second.volume_);
+        }
+    }
+    for (const auto &index : other.spilled_volume_units_) {
+        auto &unit = volume_units_[index];
+        unit.volume_.reset(new UniformTSDFVolume(
+                volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
+                color_type_, index.cast<double>() * volume_unit_length_));
+        unit.index_ = index;
+        if (!other.LoadSpilledVolumeUnit(unit)) {
+            utility::LogWarning(
+                    "[ScalableTSDFVolume] Failed to load spilled volume unit "
+                    "({}, {}, {}).",
+                    index(0), index(1), index(2));
+        }
+    }
+}
 
-ScalableTSDFVolume::~ScalableTSDFVolume() {}
+ScalableTSDFVolume &ScalableTSDFVolume::operator=(
+        const ScalableTSDFVolume &other) {
+    if (this != &other) {
+        // The copy takes over the previous content and removes its spill
+        // files when it is destroyed.
+        ScalableTSDFVolume copy(other);
+        TSDFVolume::operator=(copy);
+        Swap(copy);
+    }
+    return *this;
+}
+
+ScalableTSDFVolume::~ScalableTSDFVolume() { RemoveSpilledVolumeUnits(); }
 
-void ScalableTSDFVolume::Reset() { volume_units_.clear(); }
+void ScalableTSDFVolume::Swap(ScalableTSDFVolume &other) {
+    std::swap(volume_unit_resolution_, other.volume_unit_resolution_);
+    std::swap(volume_unit_length_, other.volume_unit_length_);
+    std::swap(depth_sampling_stride_, other.depth_sampling_stride_);
+    volume_units_.swap(other.volume_units_);
+    std::swap(memory_budget_, other.memory_budget_);
+    std::swap(eviction_policy_, other.eviction_policy_);
+    spill_directory_.swap(other.spill_directory_);
+    spilled_volume_units_.swap(other.spilled_volume_units_);
+    std::swap(spill_id_, other.spill_id_);
+    std::swap(frame_index_, other.frame_index_);
+    std::swap(last_camera_center_, other.last_camera_center_);
+}
+
+void ScalableTSDFVolume::Reset() {
+    volume_units_.clear();
+    RemoveSpilledVolumeUnits();
+    frame_index_ = 0;
+}
 
 void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::Integrate");
     if ((image.depth_.num_of_channels_ != 1) ||
         (image.depth_.bytes_per_channel_ != 4) ||
         (image.depth_.width_ != intrinsic.width_) ||
@@ -73,40 +183,51 @@ void ScalableTSDFVolume::Integrate(
         utility::LogError(
                 "[ScalableTSDFVolume::Integrate] Unsupported image format.");
     }
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
-    auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
-            image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
-            depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
-                    }
-                }
-            }
-        }
+    std::vector<Eigen::Vector3i> touched_volume_units =
+            ComputeTouchedVolumeUnits(image.depth_, intrinsic, extrinsic);
+    // Units are opened serially since opening modifies volume_units_; the
+    // integration itself runs over all of them at once.
+    frame_index_++;
+    last_camera_center_ = extrinsic.inverse().block<3, 1>(0, 3);
+    std::vector<UniformTSDFVolume *> volumes(touched_volume_units.size());
+    for (size_t i = 0; i < touched_volume_units.size(); i++) {
+        volumes[i] = OpenVolumeUnit(touched_volume_units[i]).get();
+        volume_units_[touched_volume_units[i]].last_integrated_frame_ =
+                frame_index_;
+    }
+    UniformTSDFVolume::IntegrateVolumes(
+            volumes, image, intrinsic, extrinsic,
+            GetDepthToCameraDistanceMultiplier(intrinsic));
+    if (memory_budget_ > 0 && GetMemoryUsage() > memory_budget_) {
+        // Evicting to 90% of the budget leaves room for the units opened by
+        // the next frames, so that a volume at its budget does not sort all
+        // units for eviction every frame.
+        EvictVolumeUnits(memory_budget_ / 10 * 9 / GetVolumeUnitMemory());
     }
+    OPEN3D_TRACE_COUNTER_ADD("ScalableTSDFVolume::IntegratedVolumeUnits",
+                             int64_t(touched_volume_units.size()));
+    OPEN3D_TRACE_HISTOGRAM_RECORD("ScalableTSDFVolume::TouchedVolumeUnits",
+                                  double(touched_volume_units.size()));
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::ExtractPointCloud");
     auto pointcloud = std::make_shared<geometry::PointCloud>();
+    ExtractPointCloudT(*pointcloud);
+    return pointcloud;
+}
+
+std::shared_ptr<geometry::PointCloudF>
+ScalableTSDFVolume::ExtractPointCloudF() {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::ExtractPointCloudF");
+    auto pointcloud = std::make_shared<geometry::PointCloudF>();
+    ExtractPointCloudT(*pointcloud);
+    return pointcloud;
+}
+
+template <typename PointCloudT>
+void ScalableTSDFVolume::ExtractPointCloudT(PointCloudT &pointcloud) {
+    typedef typename decltype(pointcloud.points_)::value_type::Scalar Scalar;
     double half_voxel_length = voxel_length_ * 0.5;
     float w0, w1, f0, f1;
     Eigen::Vector3f c0, c1;
@@ -179,23 +300,27 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                     Eigen::Vector3d p = p0;
                                     p(i) = (p0(i) * r1 + p1(i) * r0) /
                                            (r0 + r1);
-                                    pointcloud->points_.push_back(p);
+                                    pointcloud.points_.push_back(
+                                            p.template cast<Scalar>());
                                     if (color_type_ ==
                                         TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
+                                        pointcloud.colors_.push_back(
                                                 ((c0 * r1 + c1 * r0) /
                                                  (r0 + r1) / 255.0f)
-                                                        .cast<double>());
+                                                        .template cast<
+                                                                Scalar>());
                                     } else if (color_type_ ==
                                                TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
+                                        pointcloud.colors_.push_back(
                                                 ((c0 * r1 + c1 * r0) /
                                                  (r0 + r1))
-                                                        .cast<double>());
+                                                        .template cast<
+                                                                Scalar>());
                                     }
                                     // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+                                    pointcloud.normals_.push_back(
+                                            GetNormalAt(p)
+                                                    .template cast<Scalar>());
                                 }
                             }
                         }
@@ -204,157 +329,22 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
             }
         }
     }
-    return pointcloud;
 }
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
-                            }
-                        }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
-                        }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
-                        }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
-                        }
-                    }
-                }
-            }
-        }
-    }
-    return mesh;
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::ExtractTriangleMesh");
+    return ExtractTriangleMeshFromVoxelBlocks(
+            GetSortedVoxelBlocks(*this), volume_unit_resolution_,
+            voxel_length_, Eigen::Vector3d::Zero(), color_type_);
+}
+
+std::shared_ptr<geometry::TriangleMeshF>
+ScalableTSDFVolume::ExtractTriangleMeshF() {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::ExtractTriangleMeshF");
+    return ExtractTriangleMeshFFromVoxelBlocks(
+            GetSortedVoxelBlocks(*this), volume_unit_resolution_,
+            voxel_length_, Eigen::Vector3d::Zero(), color_type_);
 }
 
 std::shared_ptr<geometry::PointCloud>
@@ -369,6 +359,146 @@ ScalableTSDFVolume::ExtractVoxelPointCloud() {
     return voxel;
 }
 
+std::shared_ptr<TSDFRaycastResult> ScalableTSDFVolume::RaycastImpl(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_min,
+        double depth_max) const {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::Raycast");
+    // Rays skip whole volume units that have not been allocated.
+    return UniformTSDFVolume::RaycastVolumes(
+            [this](const Eigen::Vector3i &index) -> const UniformTSDFVolume * {
+                auto unit_itr = volume_units_.find(index);
+                if (unit_itr == volume_units_.end()) {
+                    return nullptr;
+                }
+                return unit_itr->second.volume_.get();
+            },
+            Eigen::Vector3d::Zero(), volume_unit_length_, color_type_,
+            intrinsic, extrinsic, depth_min, depth_max);
+}
+
+size_t ScalableTSDFVolume::PruneVolumeUnits(double min_weight) {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::PruneVolumeUnits");
+    std::vector<VolumeUnit *> units;
+    units.reserve(volume_units_.size());
+    for (auto &unit : volume_units_) {
+        units.push_back(&unit.second);
+    }
+    std::vector<uint8_t> prune(units.size(), 0);
+    utility::ParallelFor(0, int(units.size()), [&](int i) {
+        if (!units[i]->volume_) {
+            prune[i] = 1;
+            return;
+        }
+        float max_weight = 0.0f;
+        for (const auto &voxel : units[i]->volume_->voxels_) {
+            max_weight = std::max(max_weight, voxel.weight_);
+        }
+        prune[i] = max_weight < min_weight ? 1 : 0;
+    });
+    size_t num_pruned = 0;
+    for (size_t i = 0; i < units.size(); i++) {
+        if (prune[i]) {
+            // Copy the key, the erase destroys the unit holding it.
+            Eigen::Vector3i index = units[i]->index_;
+            volume_units_.erase(index);
+            num_pruned++;
+        }
+    }
+    return num_pruned;
+}
+
+size_t ScalableTSDFVolume::EvictVolumeUnits(size_t max_volume_units) {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::EvictVolumeUnits");
+    if (volume_units_.size() <= max_volume_units) {
+        return 0;
+    }
+    // Candidates sorted from the first to the last to evict, with the index
+    // as tie breaker so that the order does not depend on the hash map.
+    std::vector<std::tuple<double, int, int, int>> candidates;
+    for (const auto &unit : volume_units_) {
+        if (unit.second.last_integrated_frame_ == frame_index_) {
+            continue;
+        }
+        const Eigen::Vector3i &index = unit.first;
+        double priority;
+        if (eviction_policy_ == VolumeUnitEvictionPolicy::LeastRecentlyUsed) {
+            priority = double(unit.second.last_integrated_frame_);
+        } else {
+            Eigen::Vector3d center = (index.cast<double>() +
+                                      Eigen::Vector3d::Constant(0.5)) *
+                                     volume_unit_length_;
+            priority = -(center - last_camera_center_).norm();
+        }
+        candidates.emplace_back(priority, index(0), index(1), index(2));
+    }
+    std::sort(candidates.begin(), candidates.end());
+    size_t num_evicted = 0;
+    for (const auto &candidate : candidates) {
+        if (volume_units_.size() <= max_volume_units) {
+            break;
+        }
+        Eigen::Vector3i index(std::get<1>(candidate), std::get<2>(candidate),
+                              std::get<3>(candidate));
+        auto unit_itr = volume_units_.find(index);
+        const auto &volume = unit_itr->second.volume_;
+        const bool is_empty =
+                !volume ||
+                std::all_of(volume->voxels_.begin(), volume->voxels_.end(),
+                            [](const geometry::TSDFVoxel &voxel) {
+                                return voxel.weight_ == 0.0f;
+                            });
+        if (!spill_directory_.empty() && !is_empty) {
+            if (!SpillVolumeUnit(unit_itr->second)) {
+                // Keep the unit resident rather than lose its voxels.
+                utility::LogWarning(
+                        "[ScalableTSDFVolume] Failed to spill volume unit "
+                        "({}, {}, {}) to {}.",
+                        index(0), index(1), index(2), spill_directory_);
+                utility::filesystem::RemoveFile(GetSpillFilename(index));
+                continue;
+            }
+            spilled_volume_units_.insert(index);
+        }
+        volume_units_.erase(unit_itr);
+        num_evicted++;
+    }
+    OPEN3D_TRACE_COUNTER_ADD("ScalableTSDFVolume::EvictedVolumeUnits",
+                             int64_t(num_evicted));
+    return num_evicted;
+}
+
+bool ScalableTSDFVolume::RestoreSpilledVolumeUnits() {
+    OPEN3D_TRACE_ZONE("ScalableTSDFVolume::RestoreSpilledVolumeUnits");
+    std::vector<Eigen::Vector3i> indices(spilled_volume_units_.begin(),
+                                         spilled_volume_units_.end());
+    bool success = true;
+    for (const auto &index : indices) {
+        auto &unit = volume_units_[index];
+        if (!unit.volume_) {
+            unit.volume_.reset(new UniformTSDFVolume(
+                    volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
+                    color_type_, index.cast<double>() * volume_unit_length_));
+            unit.index_ = index;
+        }
+        if (!LoadSpilledVolumeUnit(unit)) {
+            utility::LogWarning(
+                    "[ScalableTSDFVolume] Failed to load spilled volume unit "
+                    "({}, {}, {}).",
+                    index(0), index(1), index(2));
+            success = false;
+        }
+        utility::filesystem::RemoveFile(GetSpillFilename(index));
+        spilled_volume_units_.erase(index);
+    }
+    return success;
+}
+
+size_t ScalableTSDFVolume::GetMemoryUsage() const {
+    return volume_units_.size() * GetVolumeUnitMemory();
+}
+
 std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
     auto &unit = volume_units_[index];
@@ -377,10 +507,84 @@ std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
                 volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
                 color_type_, index.cast<double>() * volume_unit_length_));
         unit.index_ = index;
+        if (spilled_volume_units_.erase(index) > 0) {
+            if (!LoadSpilledVolumeUnit(unit)) {
+                utility::LogWarning(
+                        "[ScalableTSDFVolume] Failed to load spilled volume "
+                        "unit ({}, {}, {}).",
+                        index(0), index(1), index(2));
+            }
+            utility::filesystem::RemoveFile(GetSpillFilename(index));
+        }
     }
     return unit.volume_;
 }
 
+std::vector<Eigen::Vector3i> ScalableTSDFVolume::ComputeTouchedVolumeUnits(
+        const geometry::Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) const {
+    typedef std::vector<Eigen::Vector3i> Indices;
+    const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+    const Eigen::Matrix3d R = camera_pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = camera_pose.block<3, 1>(0, 3);
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    const int stride = depth_sampling_stride_;
+    const Eigen::Vector3d trunc(sdf_trunc_, sdf_trunc_, sdf_trunc_);
+    const int num_rows = (depth.height_ + stride - 1) / stride;
+    // Neighbouring samples mostly touch the same units, so every chunk of
+    // rows removes its own duplicates before the chunks are merged.
+    Indices indices = utility::ParallelReduce(
+            0, num_rows, Indices(),
+            [&](int begin, int end, Indices &partial) {
+                std::unordered_set<Eigen::Vector3i,
+                                   utility::hash_eigen::hash<Eigen::Vector3i>>
+                        seen;
+                for (int row = begin; row < end; row++) {
+                    int v = row * stride;
+                    for (int u = 0; u < depth.width_; u += stride) {
+                        float d = *depth.PointerAt<float>(u, v);
+                        if (!(d > 0.0f)) {
+                            continue;
+                        }
+                        Eigen::Vector3d point =
+                                R * Eigen::Vector3d((u - cx) * d / fx,
+                                                    (v - cy) * d / fy, d) +
+                                t;
+                        Eigen::Vector3i min_bound =
+                                LocateVolumeUnit(point - trunc);
+                        Eigen::Vector3i max_bound =
+                                LocateVolumeUnit(point + trunc);
+                        for (int x = min_bound(0); x <= max_bound(0); x++) {
+                            for (int y = min_bound(1); y <= max_bound(1);
+                                 y++) {
+                                for (int z = min_bound(2); z <= max_bound(2);
+                                     z++) {
+                                    Eigen::Vector3i loc(x, y, z);
+                                    if (seen.insert(loc).second) {
+                                        partial.push_back(loc);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            },
+            [](Indices &result, const Indices &partial) {
+                result.insert(result.end(), partial.begin(), partial.end());
+            });
+    std::sort(indices.begin(), indices.end(),
+              [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                  return std::make_tuple(a(0), a(1), a(2)) <
+                         std::make_tuple(b(0), b(1), b(2));
+              });
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    return indices;
+}
+
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -444,5 +648,78 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                    r(1) * ((1 - r(2)) * f[2] + r(2) * f[6]));
 }
 
+size_t ScalableTSDFVolume::GetVolumeUnitMemory() const {
+    size_t num_voxels = size_t(volume_unit_resolution_) *
+                        volume_unit_resolution_ * volume_unit_resolution_;
+    return sizeof(VolumeUnit) + sizeof(UniformTSDFVolume) +
+           num_voxels * sizeof(geometry::TSDFVoxel);
+}
+
+void ScalableTSDFVolume::RemoveSpilledVolumeUnits() {
+    for (const auto &index : spilled_volume_units_) {
+        utility::filesystem::RemoveFile(GetSpillFilename(index));
+    }
+    spilled_volume_units_.clear();
+}
+
+std::string ScalableTSDFVolume::GetSpillFilename(
+        const Eigen::Vector3i &index) const {
+    return utility::filesystem::GetRegularizedDirectoryName(spill_directory_) +
+           "volume_unit_" + std::to_string(spill_id_) + "_" +
+           std::to_string(index(0)) + "_" + std::to_string(index(1)) + "_" +
+           std::to_string(index(2)) + ".bin";
+}
+
+bool ScalableTSDFVolume::SpillVolumeUnit(const VolumeUnit &unit) const {
+    FILE *file =
+            utility::filesystem::FOpen(GetSpillFilename(unit.index_), "wb");
+    if (file == NULL) {
+        return false;
+    }
+    const auto &voxels = unit.volume_->voxels_;
+    int32_t resolution = unit.volume_->resolution_;
+    uint64_t last_integrated_frame = unit.last_integrated_frame_;
+    bool success = fwrite(&resolution, sizeof(resolution), 1, file) == 1 &&
+                   fwrite(&last_integrated_frame,
+                          sizeof(last_integrated_frame), 1, file) == 1;
+    for (size_t i = 0; success && i < voxels.size(); i++) {
+        float values[2] = {voxels[i].tsdf_, voxels[i].weight_};
+        success = fwrite(values, sizeof(float), 2, file) == 2 &&
+                  fwrite(voxels[i].color_.data(), sizeof(double), 3, file) == 3;
+    }
+    fclose(file);
+    return success;
+}
+
+bool ScalableTSDFVolume::LoadSpilledVolumeUnit(VolumeUnit &unit) const {
+    FILE *file =
+            utility::filesystem::FOpen(GetSpillFilename(unit.index_), "rb");
+    if (file == NULL) {
+        return false;
+    }
+    auto &voxels = unit.volume_->voxels_;
+    int32_t resolution = 0;
+    uint64_t last_integrated_frame = 0;
+    bool success = fread(&resolution, sizeof(resolution), 1, file) == 1 &&
+                   resolution == unit.volume_->resolution_ &&
+                   fread(&last_integrated_frame,
+                         sizeof(last_integrated_frame), 1, file) == 1;
+    for (size_t i = 0; success && i < voxels.size(); i++) {
+        float values[2];
+        success = fread(values, sizeof(float), 2, file) == 2 &&
+                  fread(voxels[i].color_.data(), sizeof(double), 3, file) == 3;
+        voxels[i].tsdf_ = values[0];
+        voxels[i].weight_ = values[1];
+    }
+    fclose(file);
+    if (success) {
+        unit.last_integrated_frame_ = size_t(last_integrated_frame);
+    } else {
+        // Leave the unit unobserved rather than partially loaded.
+        std::fill(voxels.begin(), voxels.end(), geometry::TSDFVoxel());
+    }
+    return success;
+}
+
 }  // namespace integration
 }  // namespace open3d
@@ -27,7 +27,10 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "Open3D/Integration/TSDFVolume.h"
 #include "Open3D/Utility/Helper.h"
@@ -37,6 +40,14 @@ namespace integration {
 
 class UniformTSDFVolume;
 
+/// Order in which ScalableTSDFVolume evicts volume units.
+enum class VolumeUnitEvictionPolicy {
+    /// Evict the units integrated the longest time ago first.
+    LeastRecentlyUsed = 0,
+    /// Evict the units farthest from the last integrated camera first.
+    FarthestFromCamera = 1,
+};
+
 /// Class that implements a more memory efficient data structure for volumetric
 /// integration
 /// This implementation is based on the following repository:
@@ -59,11 +70,13 @@ class ScalableTSDFVolume : public TSDFVolume {
 public:
     struct VolumeUnit {
     public:
-        VolumeUnit() : volume_(NULL) {}
+        VolumeUnit() : volume_(NULL), last_integrated_frame_(0) {}
 
     public:
         std::shared_ptr<UniformTSDFVolume> volume_;
         Eigen::Vector3i index_;
+        /// Number of the last frame integrated into the unit.
+        size_t last_integrated_frame_;
     };
 
 public:
@@ -72,6 +85,12 @@ public:
                        TSDFVolumeColorType color_type,
                        int volume_unit_resolution = 16,
                        int depth_sampling_stride = 4);
+    /// Deep copy. The spilled volume units of \p other are loaded into the
+    /// copy, which spills to files of its own.
+    ScalableTSDFVolume(const ScalableTSDFVolume &other);
+    /// Deep copy as above. The spill files of the previous content are
+    /// removed.
+    ScalableTSDFVolume &operator=(const ScalableTSDFVolume &other);
     ~ScalableTSDFVolume() override;
 
 public:
@@ -81,8 +100,25 @@ public:
                    const Eigen::Matrix4d &extrinsic) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+    std::shared_ptr<geometry::PointCloudF> ExtractPointCloudF() override;
+    std::shared_ptr<geometry::TriangleMeshF> ExtractTriangleMeshF() override;
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud();
 
+    /// Removes the volume units in which no voxel reached \p min_weight, such
+    /// as units opened for noisy far-range depth. Returns the number of
+    /// removed units.
+    size_t PruneVolumeUnits(double min_weight);
+    /// Evicts volume units in the order of eviction_policy_ until at most
+    /// \p max_volume_units remain. Units integrated in the last frame, and
+    /// units that fail to spill to spill_directory_, are kept. Returns the
+    /// number of evicted units.
+    size_t EvictVolumeUnits(size_t max_volume_units);
+    /// Loads all spilled volume units back into memory, e.g. before
+    /// extracting the whole model. Returns false if a unit failed to load.
+    bool RestoreSpilledVolumeUnits();
+    /// Returns the approximate memory held by resident volume units in bytes.
+    size_t GetMemoryUsage() const;
+
 public:
     int volume_unit_resolution_;
     double volume_unit_length_;
@@ -96,8 +132,31 @@ public:
                        utility::hash_eigen::hash<Eigen::Vector3i>>
             volume_units_;
 
+    /// Memory budget of resident volume units in bytes, 0 for no limit.
+    /// Once the budget is exceeded, Integrate evicts volume units until they
+    /// use at most 90% of it.
+    size_t memory_budget_ = 0;
+    VolumeUnitEvictionPolicy eviction_policy_ =
+            VolumeUnitEvictionPolicy::LeastRecentlyUsed;
+    /// Directory evicted volume units are written to. Spilled units are
+    /// reloaded when a frame touches them again. Evicted units without any
+    /// integrated voxel, or all evicted units if the directory is empty, are
+    /// discarded. Spill files are removed on Reset() and destruction.
+    std::string spill_directory_;
+    /// Indices of the volume units currently spilled to spill_directory_.
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            spilled_volume_units_;
+
+protected:
+    std::shared_ptr<TSDFRaycastResult> RaycastImpl(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min,
+            double depth_max) const override;
+
 private:
-    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
+    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) const {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
                                (int)std::floor(point(1) / volume_unit_length_),
                                (int)std::floor(point(2) / volume_unit_length_));
@@ -106,9 +165,40 @@ private:
     std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
             const Eigen::Vector3i &index);
 
+    /// Returns the sorted indices of all volume units within sdf_trunc_ of
+    /// the depth samples taken every depth_sampling_stride_ pixels.
+    std::vector<Eigen::Vector3i> ComputeTouchedVolumeUnits(
+            const geometry::Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic) const;
+
+    /// Shared by ExtractPointCloud and ExtractPointCloudF.
+    template <typename PointCloudT>
+    void ExtractPointCloudT(PointCloudT &pointcloud);
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
+
+    /// Swaps the members declared by ScalableTSDFVolume with \p other.
+    void Swap(ScalableTSDFVolume &other);
+
+    size_t GetVolumeUnitMemory() const;
+    std::string GetSpillFilename(const Eigen::Vector3i &index) const;
+    /// Deletes the files of all spilled volume units.
+    void RemoveSpilledVolumeUnits();
+    /// Writes the voxels and last integrated frame of \p unit to its spill
+    /// file.
+    bool SpillVolumeUnit(const VolumeUnit &unit) const;
+    /// Reads the spill file of \p unit into its allocated volume.
+    bool LoadSpilledVolumeUnit(VolumeUnit &unit) const;
+
+private:
+    /// Distinguishes the spill files of volumes sharing spill_directory_.
+    size_t spill_id_;
+    /// Number of frames integrated since the last Reset.
+    size_t frame_index_ = 0;
+    Eigen::Vector3d last_camera_center_ = Eigen::Vector3d::Zero();
 };
 
 }  // namespace integration
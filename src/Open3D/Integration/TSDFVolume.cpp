@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFVolume.h"
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace integration {
+
+std::shared_ptr<geometry::PointCloudF> TSDFVolume::ExtractPointCloudF() {
+    return std::make_shared<geometry::PointCloudF>(*ExtractPointCloud());
+}
+
+std::shared_ptr<geometry::TriangleMeshF> TSDFVolume::ExtractTriangleMeshF() {
+    return std::make_shared<geometry::TriangleMeshF>(*ExtractTriangleMesh());
+}
+
+std::shared_ptr<TSDFRaycastResult> TSDFVolume::RaycastImpl(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_min,
+        double depth_max) const {
+    utility::LogWarning(
+            "[TSDFVolume::Raycast] This volume does not support raycasting.");
+    return nullptr;
+}
+
+const geometry::Image &TSDFVolume::GetDepthToCameraDistanceMultiplier(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    if (!depth_to_camera_distance_multiplier_ ||
+        cached_intrinsic_.width_ != intrinsic.width_ ||
+        cached_intrinsic_.height_ != intrinsic.height_ ||
+        cached_intrinsic_.intrinsic_matrix_ != intrinsic.intrinsic_matrix_) {
+        depth_to_camera_distance_multiplier_ = geometry::Image::
+                CreateDepthToCameraDistanceMultiplierFloatImage(intrinsic);
+        cached_intrinsic_ = intrinsic;
+    }
+    return *depth_to_camera_distance_multiplier_;
+}
+
+}  // namespace integration
+}  // namespace open3d
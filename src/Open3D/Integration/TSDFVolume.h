@@ -26,10 +26,14 @@
 
 #pragma once
 
+#include <memory>
+
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 
 namespace open3d {
 namespace integration {
@@ -40,6 +44,20 @@ enum class TSDFVolumeColorType {
     Gray32 = 2,
 };
 
+/// Images rendered by raycasting a TSDFVolume from a pinhole camera. Pixels
+/// whose ray does not hit the surface are zero in every image.
+class TSDFRaycastResult {
+public:
+    /// Float depth along the camera z axis.
+    geometry::Image depth_;
+    /// 3-channel float surface points in world coordinates.
+    geometry::Image vertex_map_;
+    /// 3-channel float unit surface normals in world coordinates.
+    geometry::Image normal_map_;
+    /// 3-channel float colors in [0, 1]. Empty if the volume has no color.
+    geometry::Image color_;
+};
+
 /// Interface class of the Truncated Signed Distance Function (TSDF) volume
 /// This volume is usually used to integrate surface data (e.g., a series of
 /// RGB-D images) into a Mesh or PointCloud. The basic technique is presented in
@@ -73,10 +91,47 @@ public:
     /// (https://en.wikipedia.org/wiki/Marching_cubes)
     virtual std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() = 0;
 
+    /// Same as ExtractPointCloud with single-precision output. The default
+    /// implementation converts the output of ExtractPointCloud.
+    virtual std::shared_ptr<geometry::PointCloudF> ExtractPointCloudF();
+
+    /// Same as ExtractTriangleMesh with single-precision output. The default
+    /// implementation converts the output of ExtractTriangleMesh.
+    virtual std::shared_ptr<geometry::TriangleMeshF> ExtractTriangleMeshF();
+
+    /// Function to render the zero crossing of the TSDF seen by a camera.
+    /// Rays are marched between \p depth_min and \p depth_max. Returns
+    /// nullptr if the volume does not support raycasting.
+    std::shared_ptr<TSDFRaycastResult> Raycast(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min = 0.1,
+            double depth_max = 3.0) const {
+        return RaycastImpl(intrinsic, extrinsic, depth_min, depth_max);
+    }
+
 public:
     double voxel_length_;
     double sdf_trunc_;
     TSDFVolumeColorType color_type_;
+
+protected:
+    /// Implements Raycast. The default implementation warns that the volume
+    /// does not support raycasting and returns nullptr.
+    virtual std::shared_ptr<TSDFRaycastResult> RaycastImpl(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min,
+            double depth_max) const;
+
+    /// Returns the depth to camera distance multipliers of \p intrinsic. The
+    /// table is cached and only rebuilt when the intrinsic changes.
+    const geometry::Image &GetDepthToCameraDistanceMultiplier(
+            const camera::PinholeCameraIntrinsic &intrinsic);
+
+private:
+    camera::PinholeCameraIntrinsic cached_intrinsic_;
+    std::shared_ptr<geometry::Image> depth_to_camera_distance_multiplier_;
 };
 
 }  // namespace integration
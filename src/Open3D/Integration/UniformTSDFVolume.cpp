@@ -26,17 +26,422 @@
 
 #include "Open3D/Integration/UniformTSDFVolume.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <thread>
 #include <unordered_map>
 
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Integration/MarchingCubes.h"
 #include "Open3D/Integration/MarchingCubesConst.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// Number of voxels of a column that are projected at once.
+const int kProjectionBatchSize = 16;
+
+/// Integrates one RGB-D frame into voxel columns. Holds the per-frame
+/// constants shared by all columns.
+class ColumnIntegrator {
+public:
+    ColumnIntegrator(const UniformTSDFVolume &volume,
+                     const geometry::RGBDImage &image,
+                     const camera::PinholeCameraIntrinsic &intrinsic,
+                     const Eigen::Matrix4d &extrinsic,
+                     const geometry::Image &depth_to_camera_distance_multiplier)
+        : image_(image),
+          depth_to_camera_distance_multiplier_(
+                  depth_to_camera_distance_multiplier),
+          color_type_(volume.color_type_),
+          resolution_(volume.resolution_),
+          fx_(static_cast<float>(intrinsic.GetFocalLength().first)),
+          fy_(static_cast<float>(intrinsic.GetFocalLength().second)),
+          cx_(static_cast<float>(intrinsic.GetPrincipalPoint().first)),
+          cy_(static_cast<float>(intrinsic.GetPrincipalPoint().second)),
+          extrinsic_(extrinsic.cast<float>()),
+          voxel_length_(static_cast<float>(volume.voxel_length_)),
+          sdf_trunc_(static_cast<float>(volume.sdf_trunc_)),
+          sdf_trunc_inv_(1.0f / sdf_trunc_),
+          safe_width_(intrinsic.width_ - 0.0001f),
+          safe_height_(intrinsic.height_ - 0.0001f) {
+        // Camera space step between two voxels along z.
+        step_ = extrinsic_.block<3, 1>(0, 2) * voxel_length_;
+    }
+
+public:
+    /// Integrates the voxels (x, y, 0) to (x, y, resolution - 1) of
+    /// \p volume.
+    void Integrate(UniformTSDFVolume &volume, int x, int y) const {
+        const float half_voxel_length = voxel_length_ * 0.5f;
+        Eigen::Vector4f pt_3d_homo(
+                float(half_voxel_length + voxel_length_ * x +
+                      volume.origin_(0)),
+                float(half_voxel_length + voxel_length_ * y +
+                      volume.origin_(1)),
+                float(half_voxel_length + volume.origin_(2)), 1.f);
+        Eigen::Vector4f pt_camera = extrinsic_ * pt_3d_homo;
+        float cam_z[kProjectionBatchSize];
+        float u_f[kProjectionBatchSize];
+        float v_f[kProjectionBatchSize];
+        for (int z0 = 0; z0 < resolution_; z0 += kProjectionBatchSize) {
+            int count = std::min(kProjectionBatchSize, resolution_ - z0);
+            // Branch-free projection of a batch of voxels, which the compiler
+            // can vectorize.
+            for (int k = 0; k < count; k++) {
+                float dz = float(z0 + k);
+                float px = pt_camera(0) + dz * step_(0);
+                float py = pt_camera(1) + dz * step_(1);
+                float pz = pt_camera(2) + dz * step_(2);
+                float inv_z = 1.0f / pz;
+                cam_z[k] = pz;
+                u_f[k] = px * fx_ * inv_z + cx_ + 0.5f;
+                v_f[k] = py * fy_ * inv_z + cy_ + 0.5f;
+            }
+            for (int k = 0; k < count; k++) {
+                // Skip if negative depth after projection
+                if (cam_z[k] <= 0) {
+                    continue;
+                }
+                // Skip if x-y coordinate not in range
+                if (!(u_f[k] >= 0.0001f && u_f[k] < safe_width_ &&
+                      v_f[k] >= 0.0001f && v_f[k] < safe_height_)) {
+                    continue;
+                }
+                // Skip if negative depth in depth image
+                int u = (int)u_f[k];
+                int v = (int)v_f[k];
+                float d = *image_.depth_.PointerAt<float>(u, v);
+                if (!(d > 0.0f)) {
+                    continue;
+                }
+                float sdf = (d - cam_z[k]) *
+                            (*depth_to_camera_distance_multiplier_
+                                      .PointerAt<float>(u, v));
+                if (sdf > -sdf_trunc_) {
+                    UpdateVoxel(volume.voxels_[volume.IndexOf(x, y, z0 + k)],
+                                sdf, u, v);
+                }
+            }
+        }
+    }
+
+private:
+    void UpdateVoxel(geometry::TSDFVoxel &voxel,
+                     float sdf,
+                     int u,
+                     int v) const {
+        float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_);
+        voxel.tsdf_ =
+                (voxel.tsdf_ * voxel.weight_ + tsdf) / (voxel.weight_ + 1.0f);
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            const uint8_t *rgb = image_.color_.PointerAt<uint8_t>(u, v, 0);
+            Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
+            voxel.color_ = (voxel.color_ * voxel.weight_ + rgb_f) /
+                           (voxel.weight_ + 1.0f);
+        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+            const float *intensity = image_.color_.PointerAt<float>(u, v, 0);
+            voxel.color_ =
+                    (voxel.color_.array() * voxel.weight_ + (*intensity)) /
+                    (voxel.weight_ + 1.0f);
+        }
+        voxel.weight_ += 1.0f;
+    }
+
+private:
+    const geometry::RGBDImage &image_;
+    const geometry::Image &depth_to_camera_distance_multiplier_;
+    TSDFVolumeColorType color_type_;
+    int resolution_;
+    float fx_;
+    float fy_;
+    float cx_;
+    float cy_;
+    Eigen::Matrix4f extrinsic_;
+    Eigen::Vector3f step_;
+    float voxel_length_;
+    float sdf_trunc_;
+    float sdf_trunc_inv_;
+    float safe_width_;
+    float safe_height_;
+};
+
+/// Side length in voxels of the blocks meshed by one task.
+const int kMarchingCubesBlockResolution = 16;
+
+/// Splits \p volume into blocks that are meshed in parallel.
+std::vector<TSDFVoxelBlock> SplitIntoVoxelBlocks(
+        const UniformTSDFVolume &volume) {
+    const int resolution = volume.resolution_;
+    const int num_blocks = (resolution + kMarchingCubesBlockResolution - 1) /
+                           kMarchingCubesBlockResolution;
+    std::vector<TSDFVoxelBlock> blocks;
+    blocks.reserve(num_blocks * num_blocks * num_blocks);
+    for (int x = 0; x < num_blocks; x++) {
+        for (int y = 0; y < num_blocks; y++) {
+            for (int z = 0; z < num_blocks; z++) {
+                TSDFVoxelBlock block;
+                block.index_ = Eigen::Vector3i(x, y, z);
+                Eigen::Vector3i idx0 =
+                        block.index_ * kMarchingCubesBlockResolution;
+                block.voxels_ = volume.voxels_.data() + volume.IndexOf(idx0);
+                block.stride_x_ = resolution * resolution;
+                block.stride_y_ = resolution;
+                for (int i = 0; i < 3; i++) {
+                    block.size_(i) = std::min(kMarchingCubesBlockResolution,
+                                              resolution - idx0(i));
+                }
+                blocks.push_back(block);
+            }
+        }
+    }
+    return blocks;
+}
+
+/// Side length in pixels of the square image tiles rendered by one task.
+const int kRaycastTileSize = 16;
+
+/// Marches camera rays through a grid of volumes. Lookups are cached, so
+/// consecutive samples falling into the same volumes cost no lookup.
+class RayMarcher {
+public:
+    RayMarcher(const UniformTSDFVolume::VolumeLookup &lookup,
+               const Eigen::Vector3d &grid_origin,
+               double volume_length,
+               TSDFVolumeColorType color_type)
+        : lookup_(lookup),
+          grid_origin_(grid_origin),
+          volume_length_(volume_length),
+          color_type_(color_type) {}
+
+public:
+    /// Marches the ray origin + t * direction for t in [t_min, t_max] and
+    /// returns true at the first zero crossing from outside to inside.
+    bool March(const Eigen::Vector3d &origin,
+               const Eigen::Vector3d &direction,
+               double t_min,
+               double t_max,
+               double &t_hit,
+               Eigen::Vector3d &normal,
+               Eigen::Vector3d &color) {
+        const double direction_norm = direction.norm();
+        double t = t_min;
+        double t_prev = t;
+        double tsdf_prev = 0.0;
+        bool prev_valid = false;
+        while (t <= t_max) {
+            Eigen::Vector3d p = origin + t * direction;
+            Eigen::Vector3i cell = LocateCell(p);
+            const UniformTSDFVolume *volume = GetVolume(cell);
+            if (volume == nullptr) {
+                // Skip the empty cell as a whole.
+                t = std::max(t, ExitCell(cell, origin, direction)) +
+                    volume_length_ * 1e-5;
+                prev_valid = false;
+                continue;
+            }
+            const double voxel_length = volume->voxel_length_;
+            double tsdf;
+            if (!GetTSDFAt(p, tsdf)) {
+                t += voxel_length / direction_norm;
+                prev_valid = false;
+                continue;
+            }
+            if (prev_valid && tsdf_prev > 0.0 && tsdf <= 0.0) {
+                t_hit = t_prev + (t - t_prev) * tsdf_prev / (tsdf_prev - tsdf);
+                Eigen::Vector3d p_hit = origin + t_hit * direction;
+                return GetNormalAt(p_hit, voxel_length, normal) &&
+                       GetColorAt(p_hit, color);
+            }
+            if (prev_valid && tsdf_prev < 0.0 && tsdf > 0.0) {
+                // Leaving the surface from behind.
+                return false;
+            }
+            t_prev = t;
+            tsdf_prev = tsdf;
+            prev_valid = true;
+            double step = std::max(voxel_length,
+                                   0.8 * std::abs(tsdf) * volume->sdf_trunc_);
+            t += step / direction_norm;
+        }
+        return false;
+    }
+
+private:
+    Eigen::Vector3i LocateCell(const Eigen::Vector3d &p) const {
+        Eigen::Vector3d q = (p - grid_origin_) / volume_length_;
+        return Eigen::Vector3i((int)std::floor(q(0)), (int)std::floor(q(1)),
+                               (int)std::floor(q(2)));
+    }
+
+    /// Returns the ray parameter at which the ray leaves \p cell.
+    double ExitCell(const Eigen::Vector3i &cell,
+                    const Eigen::Vector3d &origin,
+                    const Eigen::Vector3d &direction) const {
+        double t_exit = std::numeric_limits<double>::max();
+        for (int i = 0; i < 3; i++) {
+            if (direction(i) == 0.0) {
+                continue;
+            }
+            double boundary =
+                    grid_origin_(i) +
+                    (cell(i) + (direction(i) > 0.0 ? 1 : 0)) * volume_length_;
+            t_exit = std::min(t_exit, (boundary - origin(i)) / direction(i));
+        }
+        return t_exit;
+    }
+
+    /// Two-entry cache in front of the lookup: one entry usually holds the
+    /// volume the ray is in, the other a neighbor touched by interpolation.
+    const UniformTSDFVolume *GetVolume(const Eigen::Vector3i &cell) {
+        for (int i = 0; i < 2; i++) {
+            if (cache_valid_[i] && cache_cell_[i] == cell) {
+                cache_next_ = 1 - i;
+                return cache_volume_[i];
+            }
+        }
+        int slot = cache_next_;
+        cache_cell_[slot] = cell;
+        cache_volume_[slot] = lookup_(cell);
+        cache_valid_[slot] = true;
+        cache_next_ = 1 - slot;
+        return cache_volume_[slot];
+    }
+
+    /// Collects the 8 voxels around \p p. Returns false if any of them is
+    /// missing or has not been observed.
+    bool GatherVoxels(const Eigen::Vector3d &p,
+                      const geometry::TSDFVoxel *voxels[8],
+                      Eigen::Vector3d &r) {
+        const Eigen::Vector3i cell = LocateCell(p);
+        const UniformTSDFVolume *volume = GetVolume(cell);
+        if (volume == nullptr) {
+            return false;
+        }
+        const int resolution = volume->resolution_;
+        Eigen::Vector3d p_grid =
+                (p - volume->origin_) / volume->voxel_length_ -
+                Eigen::Vector3d(0.5, 0.5, 0.5);
+        Eigen::Vector3i idx0((int)std::floor(p_grid(0)),
+                             (int)std::floor(p_grid(1)),
+                             (int)std::floor(p_grid(2)));
+        r = p_grid - idx0.cast<double>();
+        if (idx0.minCoeff() >= 0 && idx0.maxCoeff() < resolution - 1) {
+            for (int i = 0; i < 8; i++) {
+                voxels[i] =
+                        &volume->voxels_[volume->IndexOf(idx0 + shift[i])];
+                if (voxels[i]->weight_ == 0.0f) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        // The cube straddles volumes; locate the neighbors through the grid.
+        for (int i = 0; i < 8; i++) {
+            Eigen::Vector3i idx1 = idx0 + shift[i];
+            Eigen::Vector3i cell1 = cell;
+            for (int j = 0; j < 3; j++) {
+                if (idx1(j) < 0) {
+                    idx1(j) += resolution;
+                    cell1(j) -= 1;
+                } else if (idx1(j) >= resolution) {
+                    idx1(j) -= resolution;
+                    cell1(j) += 1;
+                }
+            }
+            const UniformTSDFVolume *volume1 = GetVolume(cell1);
+            if (volume1 == nullptr) {
+                return false;
+            }
+            voxels[i] = &volume1->voxels_[volume1->IndexOf(idx1)];
+            if (voxels[i]->weight_ == 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static double TrilinearWeight(const Eigen::Vector3d &r, int i) {
+        return (shift[i](0) ? r(0) : 1.0 - r(0)) *
+               (shift[i](1) ? r(1) : 1.0 - r(1)) *
+               (shift[i](2) ? r(2) : 1.0 - r(2));
+    }
+
+    bool GetTSDFAt(const Eigen::Vector3d &p, double &tsdf) {
+        const geometry::TSDFVoxel *voxels[8];
+        Eigen::Vector3d r;
+        if (!GatherVoxels(p, voxels, r)) {
+            return false;
+        }
+        tsdf = 0.0;
+        for (int i = 0; i < 8; i++) {
+            tsdf += TrilinearWeight(r, i) * voxels[i]->tsdf_;
+        }
+        return true;
+    }
+
+    bool GetNormalAt(const Eigen::Vector3d &p,
+                     double voxel_length,
+                     Eigen::Vector3d &normal) {
+        const double half_gap = 0.99 * voxel_length;
+        for (int i = 0; i < 3; i++) {
+            Eigen::Vector3d p0 = p;
+            p0(i) -= half_gap;
+            Eigen::Vector3d p1 = p;
+            p1(i) += half_gap;
+            double tsdf0, tsdf1;
+            if (!GetTSDFAt(p0, tsdf0) || !GetTSDFAt(p1, tsdf1)) {
+                return false;
+            }
+            normal(i) = tsdf1 - tsdf0;
+        }
+        double norm = normal.norm();
+        if (norm == 0.0) {
+            return false;
+        }
+        normal /= norm;
+        return true;
+    }
+
+    bool GetColorAt(const Eigen::Vector3d &p, Eigen::Vector3d &color) {
+        color.setZero();
+        if (color_type_ == TSDFVolumeColorType::NoColor) {
+            return true;
+        }
+        const geometry::TSDFVoxel *voxels[8];
+        Eigen::Vector3d r;
+        if (!GatherVoxels(p, voxels, r)) {
+            return false;
+        }
+        for (int i = 0; i < 8; i++) {
+            color += TrilinearWeight(r, i) * voxels[i]->color_;
+        }
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            color /= 255.0;
+        }
+        return true;
+    }
+
+private:
+    const UniformTSDFVolume::VolumeLookup &lookup_;
+    Eigen::Vector3d grid_origin_;
+    double volume_length_;
+    TSDFVolumeColorType color_type_;
+    Eigen::Vector3i cache_cell_[2];
+    const UniformTSDFVolume *cache_volume_[2] = {nullptr, nullptr};
+    bool cache_valid_[2] = {false, false};
+    int cache_next_ = 0;
+};
+
+}  // unnamed namespace
+
 UniformTSDFVolume::UniformTSDFVolume(
         double length,
         int resolution,
@@ -59,6 +464,7 @@ void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic) {
+    OPEN3D_TRACE_ZONE("UniformTSDFVolume::Integrate");
     // This function goes through the voxels, and scan convert the relative
     // depth/color value into the voxel.
     // The following implementation is a highly optimized version.
@@ -81,15 +487,26 @@ void UniformTSDFVolume::Integrate(
         utility::LogError(
                 "[UniformTSDFVolume::Integrate] Unsupported image format.");
     }
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
-    IntegrateWithDepthToCameraDistanceMultiplier(image, intrinsic, extrinsic,
-                                                 *depth2cameradistance);
+    IntegrateWithDepthToCameraDistanceMultiplier(
+            image, intrinsic, extrinsic,
+            GetDepthToCameraDistanceMultiplier(intrinsic));
 }
 
 std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
     auto pointcloud = std::make_shared<geometry::PointCloud>();
+    ExtractPointCloudT(*pointcloud);
+    return pointcloud;
+}
+
+std::shared_ptr<geometry::PointCloudF> UniformTSDFVolume::ExtractPointCloudF() {
+    auto pointcloud = std::make_shared<geometry::PointCloudF>();
+    ExtractPointCloudT(*pointcloud);
+    return pointcloud;
+}
+
+template <typename PointCloudT>
+void UniformTSDFVolume::ExtractPointCloudT(PointCloudT &pointcloud) {
+    typedef typename decltype(pointcloud.points_)::value_type::Scalar Scalar;
     double half_voxel_length = voxel_length_ * 0.5;
     for (int x = 1; x < resolution_ - 1; x++) {
         for (int y = 1; y < resolution_ - 1; y++) {
@@ -121,113 +538,44 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                             float r1 = std::fabs(f1);
                             Eigen::Vector3d p = p0;
                             p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
-                            pointcloud->points_.push_back(p + origin_);
+                            pointcloud.points_.push_back(
+                                    (p + origin_).template cast<Scalar>());
                             if (color_type_ == TSDFVolumeColorType::RGB8) {
-                                pointcloud->colors_.push_back(
+                                pointcloud.colors_.push_back(
                                         ((c0 * r1 + c1 * r0) / (r0 + r1) /
                                          255.0f)
-                                                .cast<double>());
+                                                .template cast<Scalar>());
                             } else if (color_type_ ==
                                        TSDFVolumeColorType::Gray32) {
-                                pointcloud->colors_.push_back(
+                                pointcloud.colors_.push_back(
                                         ((c0 * r1 + c1 * r0) / (r0 + r1))
-                                                .cast<double>());
+                                                .template cast<Scalar>());
                             }
                             // has_normal
-                            pointcloud->normals_.push_back(GetNormalAt(p));
+                            pointcloud.normals_.push_back(
+                                    GetNormalAt(p).template cast<Scalar>());
                         }
                     }
                 }
             }
         }
     }
-    return pointcloud;
 }
 
 std::shared_ptr<geometry::TriangleMesh>
 UniformTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    // Map of "edge_index = (x, y, z, 0) + edge_shift" to "global vertex index"
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (int x = 0; x < resolution_ - 1; x++) {
-        for (int y = 0; y < resolution_ - 1; y++) {
-            for (int z = 0; z < resolution_ - 1; z++) {
-                int cube_index = 0;
-                float f[8];
-                Eigen::Vector3d c[8];
-                for (int i = 0; i < 8; i++) {
-                    Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
-
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
-                        cube_index = 0;
-                        break;
-                    } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
-                        if (f[i] < 0.0f) {
-                            cube_index |= (1 << i);
-                        }
-                        if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
-                        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
-                        }
-                    }
-                }
-                if (cube_index == 0 || cube_index == 255) {
-                    continue;
-                }
-                for (int i = 0; i < 12; i++) {
-                    if (edge_table[cube_index] & (1 << i)) {
-                        Eigen::Vector4i edge_index =
-                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
-                        if (edgeindex_to_vertexindex.find(edge_index) ==
-                            edgeindex_to_vertexindex.end()) {
-                            edge_to_index[i] = (int)mesh->vertices_.size();
-                            edgeindex_to_vertexindex[edge_index] =
-                                    (int)mesh->vertices_.size();
-                            Eigen::Vector3d pt(
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(0),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(1),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(2));
-                            double f0 = std::abs((double)f[edge_to_vert[i][0]]);
-                            double f1 = std::abs((double)f[edge_to_vert[i][1]]);
-                            pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
-                            mesh->vertices_.push_back(pt + origin_);
-                            if (color_type_ != TSDFVolumeColorType::NoColor) {
-                                const auto &c0 = c[edge_to_vert[i][0]];
-                                const auto &c1 = c[edge_to_vert[i][1]];
-                                mesh->vertex_colors_.push_back(
-                                        (f1 * c0 + f0 * c1) / (f0 + f1));
-                            }
-                        } else {
-                            edge_to_index[i] =
-                                    edgeindex_to_vertexindex.find(edge_index)
-                                            ->second;
-                        }
-                    }
-                }
-                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
-                    mesh->triangles_.push_back(Eigen::Vector3i(
-                            edge_to_index[tri_table[cube_index][i]],
-                            edge_to_index[tri_table[cube_index][i + 2]],
-                            edge_to_index[tri_table[cube_index][i + 1]]));
-                }
-            }
-        }
-    }
-    return mesh;
+    OPEN3D_TRACE_ZONE("UniformTSDFVolume::ExtractTriangleMesh");
+    return ExtractTriangleMeshFromVoxelBlocks(
+            SplitIntoVoxelBlocks(*this), kMarchingCubesBlockResolution,
+            voxel_length_, origin_, color_type_);
+}
+
+std::shared_ptr<geometry::TriangleMeshF>
+UniformTSDFVolume::ExtractTriangleMeshF() {
+    OPEN3D_TRACE_ZONE("UniformTSDFVolume::ExtractTriangleMeshF");
+    return ExtractTriangleMeshFFromVoxelBlocks(
+            SplitIntoVoxelBlocks(*this), kMarchingCubesBlockResolution,
+            voxel_length_, origin_, color_type_);
 }
 
 std::shared_ptr<geometry::PointCloud>
@@ -286,93 +634,115 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_to_camera_distance_multiplier) {
-    const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
-    const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
-    const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
-    const float cy = static_cast<float>(intrinsic.GetPrincipalPoint().second);
-    const Eigen::Matrix4f extrinsic_f = extrinsic.cast<float>();
-    const float voxel_length_f = static_cast<float>(voxel_length_);
-    const float half_voxel_length_f = voxel_length_f * 0.5f;
-    const float sdf_trunc_f = static_cast<float>(sdf_trunc_);
-    const float sdf_trunc_inv_f = 1.0f / sdf_trunc_f;
-    const Eigen::Matrix4f extrinsic_scaled_f = extrinsic_f * voxel_length_f;
-    const float safe_width_f = intrinsic.width_ - 0.0001f;
-    const float safe_height_f = intrinsic.height_ - 0.0001f;
-
-#ifdef _OPENMP
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
-                                             voxel_length_f * x + origin_(0)),
-                                       float(half_voxel_length_f +
-                                             voxel_length_f * y + origin_(1)),
-                                       float(half_voxel_length_f + origin_(2)),
-                                       1.f);
-            Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
-            for (int z = 0; z < resolution_; z++,
-                     pt_camera(0) += extrinsic_scaled_f(0, 2),
-                     pt_camera(1) += extrinsic_scaled_f(1, 2),
-                     pt_camera(2) += extrinsic_scaled_f(2, 2)) {
-                // Skip if negative depth after projection
-                if (pt_camera(2) <= 0) {
-                    continue;
-                }
-                // Skip if x-y coordinate not in range
-                float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
-                float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
-                if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
-                      v_f < safe_height_f)) {
+    OPEN3D_TRACE_ZONE(
+            "UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier");
+    IntegrateVolumes({this}, image, intrinsic, extrinsic,
+                     depth_to_camera_distance_multiplier);
+}
+
+void UniformTSDFVolume::IntegrateVolumes(
+        const std::vector<UniformTSDFVolume *> &volumes,
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier) {
+    if (volumes.empty()) {
+        return;
+    }
+    const ColumnIntegrator integrator(*volumes[0], image, intrinsic, extrinsic,
+                                      depth_to_camera_distance_multiplier);
+    const int resolution = volumes[0]->resolution_;
+    const int columns_per_volume = resolution * resolution;
+    // Every (volume, x, y) column is one work item, so all volumes are
+    // integrated in a single parallel loop.
+    utility::ParallelFor(0, int(volumes.size()) * columns_per_volume,
+                         [&](int item) {
+                             int xy = item % columns_per_volume;
+                             integrator.Integrate(
+                                     *volumes[item / columns_per_volume],
+                                     xy / resolution, xy % resolution);
+                         });
+}
+
+std::shared_ptr<TSDFRaycastResult> UniformTSDFVolume::RaycastImpl(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_min,
+        double depth_max) const {
+    OPEN3D_TRACE_ZONE("UniformTSDFVolume::Raycast");
+    return RaycastVolumes(
+            [this](const Eigen::Vector3i &index) -> const UniformTSDFVolume * {
+                return index.isZero() ? this : nullptr;
+            },
+            origin_, length_, color_type_, intrinsic, extrinsic, depth_min,
+            depth_max);
+}
+
+std::shared_ptr<TSDFRaycastResult> UniformTSDFVolume::RaycastVolumes(
+        const VolumeLookup &lookup,
+        const Eigen::Vector3d &grid_origin,
+        double volume_length,
+        TSDFVolumeColorType color_type,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_min,
+        double depth_max) {
+    auto result = std::make_shared<TSDFRaycastResult>();
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    result->depth_.Prepare(width, height, 1, 4);
+    result->vertex_map_.Prepare(width, height, 3, 4);
+    result->normal_map_.Prepare(width, height, 3, 4);
+    if (color_type != TSDFVolumeColorType::NoColor) {
+        result->color_.Prepare(width, height, 3, 4);
+    }
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    const Eigen::Matrix4d pose = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+
+    const int tiles_x = (width + kRaycastTileSize - 1) / kRaycastTileSize;
+    const int tiles_y = (height + kRaycastTileSize - 1) / kRaycastTileSize;
+    utility::ParallelFor(0, tiles_x * tiles_y, [&](int tile) {
+        RayMarcher marcher(lookup, grid_origin, volume_length, color_type);
+        const int u0 = (tile % tiles_x) * kRaycastTileSize;
+        const int v0 = (tile / tiles_x) * kRaycastTileSize;
+        const int u1 = std::min(u0 + kRaycastTileSize, width);
+        const int v1 = std::min(v0 + kRaycastTileSize, height);
+        for (int v = v0; v < v1; v++) {
+            for (int u = u0; u < u1; u++) {
+                // Rays are parameterized by their depth along the camera z
+                // axis.
+                Eigen::Vector3d direction =
+                        rotation * Eigen::Vector3d((u - cx) / fx,
+                                                   (v - cy) / fy, 1.0);
+                double t;
+                Eigen::Vector3d normal, color;
+                if (!marcher.March(origin, direction, depth_min, depth_max, t,
+                                   normal, color)) {
                     continue;
                 }
-                // Skip if negative depth in depth image
-                int u = (int)u_f;
-                int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
-                if (d <= 0.0f) {
-                    continue;
+                Eigen::Vector3d vertex = origin + t * direction;
+                *result->depth_.PointerAt<float>(u, v) = float(t);
+                for (int c = 0; c < 3; c++) {
+                    *result->vertex_map_.PointerAt<float>(u, v, c) =
+                            float(vertex(c));
+                    *result->normal_map_.PointerAt<float>(u, v, c) =
+                            float(normal(c));
                 }
-
-                int v_ind = IndexOf(x, y, z);
-                float sdf =
-                        (d - pt_camera(2)) *
-                        (*depth_to_camera_distance_multiplier.PointerAt<float>(
-                                u, v));
-                if (sdf > -sdf_trunc_f) {
-                    // integrate
-                    float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
-                    if (color_type_ == TSDFVolumeColorType::RGB8) {
-                        const uint8_t *rgb =
-                                image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                if (color_type != TSDFVolumeColorType::NoColor) {
+                    for (int c = 0; c < 3; c++) {
+                        *result->color_.PointerAt<float>(u, v, c) =
+                                float(color(c));
                     }
-                    voxels_[v_ind].weight_ += 1.0f;
                 }
             }
         }
-    }
+    });
+    return result;
 }
 
 Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/TSDFVolume.h"
 
@@ -66,6 +68,8 @@ public:
                    const Eigen::Matrix4d &extrinsic) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+    std::shared_ptr<geometry::PointCloudF> ExtractPointCloudF() override;
+    std::shared_ptr<geometry::TriangleMeshF> ExtractTriangleMeshF() override;
 
     /// Debug function to extract the voxel data into a VoxelGrid
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud() const;
@@ -79,6 +83,35 @@ public:
             const Eigen::Matrix4d &extrinsic,
             const geometry::Image &depth_to_camera_distance_multiplier);
 
+    /// Integrates \p image into all \p volumes in one parallel sweep over
+    /// the voxel columns of every volume. The volumes must share resolution,
+    /// voxel length, truncation distance and color type.
+    static void IntegrateVolumes(
+            const std::vector<UniformTSDFVolume *> &volumes,
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier);
+
+    /// Returns the volume of the grid cell \p index, or nullptr if the cell
+    /// is empty.
+    typedef std::function<const UniformTSDFVolume *(const Eigen::Vector3i &)>
+            VolumeLookup;
+
+    /// Raycasts a grid of volumes of length \p volume_length, where the
+    /// volume of cell (x, y, z) starts at grid_origin + (x, y, z) *
+    /// volume_length. Empty cells are skipped without sampling and every ray
+    /// caches its last lookup. Image tiles are rendered in parallel.
+    static std::shared_ptr<TSDFRaycastResult> RaycastVolumes(
+            const VolumeLookup &lookup,
+            const Eigen::Vector3d &grid_origin,
+            double volume_length,
+            TSDFVolumeColorType color_type,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min,
+            double depth_max);
+
     inline int IndexOf(int x, int y, int z) const {
         return x * resolution_ * resolution_ + y * resolution_ + z;
     }
@@ -94,7 +127,18 @@ public:
     int resolution_;
     int voxel_num_;
 
+protected:
+    std::shared_ptr<TSDFRaycastResult> RaycastImpl(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min,
+            double depth_max) const override;
+
 private:
+    /// Shared by ExtractPointCloud and ExtractPointCloudF.
+    template <typename PointCloudT>
+    void ExtractPointCloudT(PointCloudT &pointcloud);
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
@@ -32,7 +32,9 @@
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
 #include "Open3D/Utility/Timer.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -247,6 +249,7 @@ Eigen::Matrix6d CreateInformationMatrix(
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
         const OdometryOption &option) {
+    OPEN3D_TRACE_ZONE("CreateInformationMatrix");
     auto correspondence =
             ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
                                   extrinsic, depth_s, depth_t, option);
@@ -257,45 +260,40 @@ Eigen::Matrix6d CreateInformationMatrix(
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int row = 0; row < int(correspondence->size()); row++) {
-            int u_t = (*correspondence)[row](2);
-            int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { GTG += GTG_private; }
-#ifdef _OPENMP
-    }
-#endif
+    Eigen::Matrix6d GTG = utility::ParallelReduce(
+            0, int(correspondence->size()), Eigen::Matrix6d::Zero().eval(),
+            [&](int begin, int end, Eigen::Matrix6d &GTG_private) {
+                Eigen::Vector6d G_r_private;
+                for (int row = begin; row < end; row++) {
+                    int u_t = (*correspondence)[row](2);
+                    int v_t = (*correspondence)[row](3);
+                    double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
+                    double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
+                    double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+                    G_r_private.setZero();
+                    G_r_private(1) = z;
+                    G_r_private(2) = -y;
+                    G_r_private(3) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = -z;
+                    G_r_private(2) = x;
+                    G_r_private(4) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = y;
+                    G_r_private(1) = -x;
+                    G_r_private(5) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                }
+            },
+            [](Eigen::Matrix6d &GTG, const Eigen::Matrix6d &GTG_private) {
+                GTG += GTG_private;
+            });
+    GTG += Eigen::Matrix6d::Identity();
     return GTG;
 }
 
@@ -375,6 +373,7 @@ InitializeRGBDOdometry(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &odo_init,
         const OdometryOption &option) {
+    OPEN3D_TRACE_ZONE("InitializeRGBDOdometry");
     auto source_gray =
             source.color_.Filter(geometry::Image::FilterType::Gaussian3);
     auto target_gray =
@@ -408,9 +407,12 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
+    OPEN3D_TRACE_ZONE("ComputeRGBDOdometry::DoSingleIteration");
     auto correspondence = ComputeCorrespondence(
             intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
     int corresps_count = (int)correspondence->size();
+    OPEN3D_TRACE_HISTOGRAM_RECORD("ComputeRGBDOdometry::Correspondences",
+                                  double(corresps_count));
 
     auto f_lambda =
             [&](int i,
@@ -448,6 +450,7 @@ std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
+    OPEN3D_TRACE_ZONE("ComputeRGBDOdometry::ComputeMultiscale");
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
@@ -512,6 +515,7 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const RGBDOdometryJacobian &jacobian_method
         /*=RGBDOdometryJacobianFromHybridTerm*/,
         const OdometryOption &option /*= OdometryOption()*/) {
+    OPEN3D_TRACE_ZONE("ComputeRGBDOdometry");
     if (!CheckRGBDImagePair(source, target)) {
         utility::LogWarning(
                 "[RGBDOdometry] Two RGBD pairs should be same in size.");
@@ -36,12 +36,17 @@
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/InstancedGeometry.h"
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointAttribute.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/SparseVoxelGrid.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/IO/ClassIO/FeatureIO.h"
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
@@ -52,11 +57,13 @@
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
+#include "Open3D/Integration/MarchingCubes.h"
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 #include "Open3D/Integration/TSDFVolume.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
 #include "Open3D/Odometry/Odometry.h"
 #include "Open3D/Open3DConfig.h"
+#include "Open3D/Reconstruction/ReconstructionPipeline.h"
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Registration/Registration.h"
 #include "Open3D/Registration/TransformationEstimation.h"
@@ -64,10 +71,16 @@
 #include "Open3D/Utility/Eigen.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Memory.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Progress.h"
 #include "Open3D/Utility/Timer.h"
+#include "Open3D/Utility/Trace.h"
+#include "Open3D/Utility/VectorKernels.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
 #include "Open3D/Visualization/Utility/SelectionPolygon.h"
 #include "Open3D/Visualization/Utility/SelectionPolygonVolume.h"
+#include "Open3D/Visualization/Visualizer/BatchRenderer.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
 #include "Open3D/Visualization/Visualizer/ViewControlWithCustomAnimation.h"
 #include "Open3D/Visualization/Visualizer/ViewControlWithEditing.h"
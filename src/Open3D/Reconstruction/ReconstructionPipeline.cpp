@@ -0,0 +1,738 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Reconstruction/ReconstructionPipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/KDTreeSearchParam.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Odometry/Odometry.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Progress.h"
+#include "Open3D/Utility/Trace.h"
+
+namespace open3d {
+namespace reconstruction {
+
+namespace {
+
+/// ICP iterations at voxel_size, voxel_size / 2 and voxel_size / 4.
+const int kICPIterations[] = {50, 30, 14};
+const int kNumICPScales = 3;
+/// Distance of TSDF truncation in meters.
+const double kSDFTrunc = 0.04;
+
+/// Decoded images of one frame.
+struct FrameImages {
+    geometry::Image color_;
+    geometry::Image depth_;
+};
+
+/// Thread-safe LRU cache of decoded frames. Images are decoded outside the
+/// lock, so misses on different frames do not serialize.
+class FrameCache {
+public:
+    FrameCache(const std::vector<std::string> &color_files,
+               const std::vector<std::string> &depth_files,
+               size_t capacity)
+        : color_files_(color_files),
+          depth_files_(depth_files),
+          capacity_(capacity) {}
+
+public:
+    /// Returns nullptr if an image cannot be read.
+    std::shared_ptr<const FrameImages> GetFrame(int frame) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = frames_.find(frame);
+            if (it != frames_.end()) {
+                lru_.splice(lru_.begin(), lru_, it->second.second);
+                return it->second.first;
+            }
+        }
+        OPEN3D_TRACE_COUNTER_ADD("RunReconstructionPipeline::DecodedFrames",
+                                 1);
+        auto images = std::make_shared<FrameImages>();
+        if (!io::ReadImage(color_files_[frame], images->color_) ||
+            !io::ReadImage(depth_files_[frame], images->depth_)) {
+            utility::LogWarning(
+                    "[RunReconstructionPipeline] Failed to read frame {:d}.",
+                    frame);
+            return nullptr;
+        }
+        if (capacity_ == 0) {
+            return images;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = frames_.find(frame);
+        if (it != frames_.end()) {
+            // Another task decoded the frame in the meantime.
+            return it->second.first;
+        }
+        lru_.push_front(frame);
+        frames_[frame] = std::make_pair(images, lru_.begin());
+        if (frames_.size() > capacity_) {
+            frames_.erase(lru_.back());
+            lru_.pop_back();
+        }
+        return images;
+    }
+
+private:
+    const std::vector<std::string> &color_files_;
+    const std::vector<std::string> &depth_files_;
+    size_t capacity_;
+    std::mutex mutex_;
+    /// Frame indices, most recently used first.
+    std::list<int> lru_;
+    std::unordered_map<int,
+                       std::pair<std::shared_ptr<const FrameImages>,
+                                 std::list<int>::iterator>>
+            frames_;
+};
+
+/// Relative transformation of a frame or fragment pair.
+struct PairRegistration {
+    int source_ = 0;
+    int target_ = 0;
+    bool success_ = false;
+    Eigen::Matrix4d_u transformation_ = Eigen::Matrix4d::Identity();
+    Eigen::Matrix6d_u information_ = Eigen::Matrix6d::Identity();
+};
+
+/// Intermediate state of one fragment.
+struct Fragment {
+    /// Frame range [begin_, end_).
+    int begin_ = 0;
+    int end_ = 0;
+    /// Odometry of frame pairs (i, i + 1).
+    std::vector<PairRegistration> odometry_;
+    /// RGB-D registrations of keyframe pairs.
+    std::vector<PairRegistration> loop_closures_;
+    /// Number of unfinished odometry or loop closure tasks.
+    std::atomic<int> pending_;
+    registration::PoseGraph pose_graph_;
+    std::shared_ptr<geometry::PointCloud> point_cloud_;
+    /// Point cloud down-sampled at voxel_size / 2^i, with normals.
+    std::vector<std::shared_ptr<geometry::PointCloud>> down_sampled_;
+    /// FPFH features of down_sampled_[0].
+    std::shared_ptr<registration::Feature> feature_;
+};
+
+/// Builds the scene pose graph from fragment pair registrations sorted by
+/// source and target, as update_posegrph_for_scene in the Python system.
+registration::PoseGraph CreateScenePoseGraph(
+        const std::vector<PairRegistration> &pairs) {
+    registration::PoseGraph pose_graph;
+    Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+    pose_graph.nodes_.push_back(registration::PoseGraphNode(odometry));
+    for (const auto &pair : pairs) {
+        if (!pair.success_) {
+            continue;
+        }
+        bool uncertain = pair.target_ != pair.source_ + 1;
+        if (!uncertain) {
+            odometry = pair.transformation_ * odometry;
+            pose_graph.nodes_.push_back(
+                    registration::PoseGraphNode(odometry.inverse()));
+        }
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                pair.source_, pair.target_, pair.transformation_,
+                pair.information_, uncertain));
+    }
+    return pose_graph;
+}
+
+void OptimizePoseGraph(registration::PoseGraph &pose_graph,
+                       double max_correspondence_distance,
+                       double preference_loop_closure) {
+    if (pose_graph.edges_.empty()) {
+        return;
+    }
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(max_correspondence_distance,
+                                                   0.25,
+                                                   preference_loop_closure, 0));
+}
+
+/// Runs the stages of the pipeline. Tasks of all stages share one TaskGroup;
+/// each task caps its own threads to one, since tasks are the unit of
+/// parallelism.
+class ReconstructionPipeline {
+public:
+    ReconstructionPipeline(const std::vector<std::string> &color_files,
+                           const std::vector<std::string> &depth_files,
+                           const camera::PinholeCameraIntrinsic &intrinsic,
+                           const ReconstructionOption &option,
+                           utility::ProgressToken *progress)
+        : intrinsic_(intrinsic),
+          option_(option),
+          progress_(progress),
+          cache_(color_files,
+                 depth_files,
+                 size_t(std::max(0, option.max_cached_frames_))),
+          num_frames_(int(color_files.size())),
+          failed_(false) {}
+
+public:
+    std::shared_ptr<ReconstructionResult> Run();
+
+private:
+    bool IsStopped() const {
+        return failed_.load() ||
+               (progress_ != nullptr && progress_->IsCancelled());
+    }
+    void AddProgress(int64_t count) {
+        if (progress_ != nullptr) {
+            progress_->Add(count);
+        }
+    }
+    std::shared_ptr<geometry::RGBDImage> ReadRGBDImage(
+            int frame, bool convert_rgb_to_intensity);
+
+    // Fragment stage.
+    void StartFragment(int fragment_id);
+    void StartLoopClosures(int fragment_id);
+    void RegisterFrames(PairRegistration &pair);
+    void FinishFragment(int fragment_id);
+    /// Optimizes and integrates the fragment and prepares its registration
+    /// data. Returns false if a frame cannot be read.
+    bool BuildFragment(int fragment_id);
+    void OnFragmentDone(int fragment_id);
+
+    // Fragment registration and refinement.
+    void RegisterFragments(PairRegistration &pair);
+    PairRegistration RefineRegistration(const PairRegistration &pair,
+                                        int num_scales) const;
+
+    // Scene integration.
+    bool IntegrateScene(ReconstructionResult &result);
+
+private:
+    const camera::PinholeCameraIntrinsic &intrinsic_;
+    const ReconstructionOption &option_;
+    utility::ProgressToken *progress_;
+    FrameCache cache_;
+    int num_frames_;
+    std::atomic<bool> failed_;
+    utility::TaskGroup tasks_;
+    std::vector<std::unique_ptr<Fragment>> fragments_;
+    /// Registrations of all fragment pairs (s, t), s < t, sorted.
+    std::vector<PairRegistration> fragment_pairs_;
+    std::mutex done_mutex_;
+    std::vector<bool> fragment_done_;
+};
+
+std::shared_ptr<geometry::RGBDImage> ReconstructionPipeline::ReadRGBDImage(
+        int frame, bool convert_rgb_to_intensity) {
+    auto images = cache_.GetFrame(frame);
+    if (images == nullptr) {
+        failed_ = true;
+        return nullptr;
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            images->color_, images->depth_, option_.depth_scale_,
+            option_.max_depth_, convert_rgb_to_intensity);
+}
+
+void ReconstructionPipeline::StartFragment(int fragment_id) {
+    Fragment &fragment = *fragments_[fragment_id];
+    int num_odometry = fragment.end_ - fragment.begin_ - 1;
+    if (num_odometry == 0) {
+        StartLoopClosures(fragment_id);
+        return;
+    }
+    fragment.odometry_.resize(num_odometry);
+    fragment.pending_ = num_odometry;
+    for (int i = 0; i < num_odometry; i++) {
+        fragment.odometry_[i].source_ = fragment.begin_ + i;
+        fragment.odometry_[i].target_ = fragment.begin_ + i + 1;
+        tasks_.Run([this, fragment_id, i]() {
+            Fragment &fragment = *fragments_[fragment_id];
+            RegisterFrames(fragment.odometry_[i]);
+            if (--fragment.pending_ == 0) {
+                StartLoopClosures(fragment_id);
+            }
+        });
+    }
+}
+
+void ReconstructionPipeline::StartLoopClosures(int fragment_id) {
+    if (IsStopped()) {
+        return;
+    }
+    Fragment &fragment = *fragments_[fragment_id];
+    // Without OpenCV's five-point pose estimation, keyframe pairs are
+    // initialized from the chained odometry.
+    std::vector<Eigen::Matrix4d_u> poses(1, Eigen::Matrix4d::Identity());
+    for (const auto &odometry : fragment.odometry_) {
+        poses.push_back(poses.back() *
+                        Eigen::Matrix4d(odometry.transformation_.inverse()));
+    }
+    int stride = std::max(1, option_.n_keyframes_per_n_frame_);
+    for (int s = fragment.begin_; s < fragment.end_; s++) {
+        for (int t = s + 1; t < fragment.end_; t++) {
+            if (s % stride == 0 && t % stride == 0) {
+                PairRegistration pair;
+                pair.source_ = s;
+                pair.target_ = t;
+                pair.transformation_ = poses[t - fragment.begin_].inverse() *
+                                       poses[s - fragment.begin_];
+                fragment.loop_closures_.push_back(pair);
+            }
+        }
+    }
+    int num_loop_closures = int(fragment.loop_closures_.size());
+    if (num_loop_closures == 0) {
+        tasks_.Run([this, fragment_id]() { FinishFragment(fragment_id); });
+        return;
+    }
+    fragment.pending_ = num_loop_closures;
+    for (int i = 0; i < num_loop_closures; i++) {
+        tasks_.Run([this, fragment_id, i]() {
+            Fragment &fragment = *fragments_[fragment_id];
+            RegisterFrames(fragment.loop_closures_[i]);
+            if (--fragment.pending_ == 0) {
+                FinishFragment(fragment_id);
+            }
+        });
+    }
+}
+
+void ReconstructionPipeline::RegisterFrames(PairRegistration &pair) {
+    OPEN3D_TRACE_ZONE("RunReconstructionPipeline::RegisterFrames");
+    if (IsStopped()) {
+        return;
+    }
+    utility::ScopedMaxThreads single_thread(1);
+    auto source = ReadRGBDImage(pair.source_, true);
+    auto target = ReadRGBDImage(pair.target_, true);
+    if (source == nullptr || target == nullptr) {
+        return;
+    }
+    odometry::OdometryOption odometry_option;
+    odometry_option.max_depth_diff_ = option_.max_depth_diff_;
+    Eigen::Matrix4d transformation;
+    Eigen::Matrix6d information;
+    std::tie(pair.success_, transformation, information) =
+            odometry::ComputeRGBDOdometry(
+                    *source, *target, intrinsic_, pair.transformation_,
+                    odometry::RGBDOdometryJacobianFromHybridTerm(),
+                    odometry_option);
+    pair.transformation_ = transformation;
+    pair.information_ = information;
+}
+
+void ReconstructionPipeline::FinishFragment(int fragment_id) {
+    OPEN3D_TRACE_ZONE("RunReconstructionPipeline::FinishFragment");
+    if (IsStopped()) {
+        return;
+    }
+    // The thread cap must be lifted before OnFragmentDone, otherwise Run
+    // executes the fragment pair tasks inline on this thread.
+    {
+        utility::ScopedMaxThreads single_thread(1);
+        if (!BuildFragment(fragment_id)) {
+            return;
+        }
+    }
+    OnFragmentDone(fragment_id);
+}
+
+bool ReconstructionPipeline::BuildFragment(int fragment_id) {
+    Fragment &fragment = *fragments_[fragment_id];
+
+    // Pose graph, in the edge order of make_posegraph_for_fragment.
+    int stride = std::max(1, option_.n_keyframes_per_n_frame_);
+    registration::PoseGraph &pose_graph = fragment.pose_graph_;
+    Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+    pose_graph.nodes_.push_back(registration::PoseGraphNode(odometry));
+    size_t loop_closure_index = 0;
+    for (int s = fragment.begin_; s < fragment.end_; s++) {
+        for (int t = s + 1; t < fragment.end_; t++) {
+            if (t == s + 1) {
+                const auto &pair = fragment.odometry_[s - fragment.begin_];
+                odometry = pair.transformation_ * odometry;
+                pose_graph.nodes_.push_back(
+                        registration::PoseGraphNode(odometry.inverse()));
+                pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                        s - fragment.begin_, t - fragment.begin_,
+                        pair.transformation_, pair.information_, false));
+            }
+            if (s % stride == 0 && t % stride == 0) {
+                const auto &pair =
+                        fragment.loop_closures_[loop_closure_index++];
+                if (pair.success_) {
+                    pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                            s - fragment.begin_, t - fragment.begin_,
+                            pair.transformation_, pair.information_, true));
+                }
+            }
+        }
+    }
+    fragment.odometry_.clear();
+    fragment.loop_closures_.clear();
+    OptimizePoseGraph(pose_graph, option_.max_depth_diff_,
+                      option_.preference_loop_closure_odometry_);
+
+    // The fragment volume only lives for the duration of this task.
+    {
+        integration::ScalableTSDFVolume volume(
+                option_.tsdf_cubic_size_ / 512.0, kSDFTrunc,
+                integration::TSDFVolumeColorType::RGB8);
+        for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+            auto rgbd = ReadRGBDImage(fragment.begin_ + int(i), false);
+            if (rgbd == nullptr) {
+                return false;
+            }
+            volume.Integrate(*rgbd, intrinsic_,
+                             pose_graph.nodes_[i].pose_.inverse());
+            AddProgress(1);
+        }
+        auto mesh = volume.ExtractTriangleMesh();
+        fragment.point_cloud_ = std::make_shared<geometry::PointCloud>();
+        fragment.point_cloud_->points_ = std::move(mesh->vertices_);
+        fragment.point_cloud_->colors_ = std::move(mesh->vertex_colors_);
+    }
+
+    // Down-sampled clouds and features are computed once per fragment and
+    // shared by all of its pairs.
+    double voxel_size = option_.voxel_size_;
+    for (int i = 0; i < kNumICPScales; i++) {
+        auto down_sampled = fragment.point_cloud_->VoxelDownSample(voxel_size);
+        if (i == 0 ||
+            option_.icp_method_ != ReconstructionICPMethod::PointToPoint) {
+            down_sampled->EstimateNormals(
+                    geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+        }
+        fragment.down_sampled_.push_back(down_sampled);
+        voxel_size /= 2.0;
+    }
+    fragment.feature_ = registration::ComputeFPFHFeature(
+            *fragment.down_sampled_[0],
+            geometry::KDTreeSearchParamHybrid(option_.voxel_size_ * 5.0, 100));
+    return true;
+}
+
+void ReconstructionPipeline::OnFragmentDone(int fragment_id) {
+    int num_fragments = int(fragments_.size());
+    std::vector<int> ready_pairs;
+    {
+        std::lock_guard<std::mutex> lock(done_mutex_);
+        fragment_done_[fragment_id] = true;
+        for (int other = 0; other < num_fragments; other++) {
+            if (other == fragment_id || !fragment_done_[other]) {
+                continue;
+            }
+            int s = std::min(fragment_id, other);
+            int t = std::max(fragment_id, other);
+            // Index of (s, t) in the sorted list of pairs.
+            ready_pairs.push_back(s * num_fragments - s * (s + 1) / 2 + t - s -
+                                  1);
+        }
+    }
+    // Run may execute tasks inline, so it is not called under the lock.
+    for (int pair_index : ready_pairs) {
+        tasks_.Run([this, pair_index]() {
+            RegisterFragments(fragment_pairs_[pair_index]);
+        });
+    }
+}
+
+void ReconstructionPipeline::RegisterFragments(PairRegistration &pair) {
+    OPEN3D_TRACE_ZONE("RunReconstructionPipeline::RegisterFragments");
+    if (IsStopped()) {
+        return;
+    }
+    utility::ScopedMaxThreads single_thread(1);
+    if (pair.target_ == pair.source_ + 1) {
+        // Initialize adjacent fragments with the fragment odometry.
+        const auto &nodes = fragments_[pair.source_]->pose_graph_.nodes_;
+        pair.transformation_ = nodes.back().pose_.inverse();
+        pair = RefineRegistration(pair, 1);
+        pair.success_ = true;
+        AddProgress(1);
+        return;
+    }
+
+    const Fragment &source = *fragments_[pair.source_];
+    const Fragment &target = *fragments_[pair.target_];
+    const geometry::PointCloud &source_down = *source.down_sampled_[0];
+    const geometry::PointCloud &target_down = *target.down_sampled_[0];
+    double distance_threshold = option_.voxel_size_ * 1.4;
+    registration::RegistrationResult result;
+    if (option_.global_registration_ ==
+        ReconstructionGlobalRegistration::FGR) {
+        result = registration::FastGlobalRegistration(
+                source_down, target_down, *source.feature_, *target.feature_,
+                registration::FastGlobalRegistrationOption(
+                        1.4, false, true, distance_threshold));
+    } else {
+        registration::CorrespondenceCheckerBasedOnEdgeLength edge_length(0.9);
+        registration::CorrespondenceCheckerBasedOnDistance distance(
+                distance_threshold);
+        result = registration::RegistrationRANSACBasedOnFeatureMatching(
+                source_down, target_down, *source.feature_, *target.feature_,
+                distance_threshold,
+                registration::TransformationEstimationPointToPoint(false), 4,
+                {edge_length, distance},
+                registration::RANSACConvergenceCriteria(4000000, 500));
+    }
+    pair.success_ = false;
+    if (result.transformation_.trace() != 4.0) {
+        Eigen::Matrix6d information =
+                registration::GetInformationMatrixFromPointClouds(
+                        source_down, target_down, distance_threshold,
+                        result.transformation_);
+        size_t num_points = std::min(source_down.points_.size(),
+                                     target_down.points_.size());
+        if (num_points > 0 && information(5, 5) / num_points >= 0.3) {
+            pair.success_ = true;
+            pair.transformation_ = result.transformation_;
+            pair.information_ = information;
+        }
+    }
+    AddProgress(1);
+}
+
+PairRegistration ReconstructionPipeline::RefineRegistration(
+        const PairRegistration &pair, int num_scales) const {
+    OPEN3D_TRACE_ZONE("RunReconstructionPipeline::RefineRegistration");
+    const Fragment &source = *fragments_[pair.source_];
+    const Fragment &target = *fragments_[pair.target_];
+    PairRegistration refined = pair;
+    double voxel_size = option_.voxel_size_;
+    for (int i = 0; i < num_scales; i++) {
+        const geometry::PointCloud &source_down = *source.down_sampled_[i];
+        const geometry::PointCloud &target_down = *target.down_sampled_[i];
+        registration::ICPConvergenceCriteria criteria(1e-6, 1e-6,
+                                                      kICPIterations[i]);
+        registration::RegistrationResult result;
+        switch (option_.icp_method_) {
+            case ReconstructionICPMethod::PointToPoint:
+                result = registration::RegistrationICP(
+                        source_down, target_down, option_.voxel_size_ * 1.4,
+                        refined.transformation_,
+                        registration::TransformationEstimationPointToPoint(),
+                        criteria);
+                break;
+            case ReconstructionICPMethod::PointToPlane:
+                result = registration::RegistrationICP(
+                        source_down, target_down, option_.voxel_size_ * 1.4,
+                        refined.transformation_,
+                        registration::TransformationEstimationPointToPlane(),
+                        criteria);
+                break;
+            case ReconstructionICPMethod::Color:
+                result = registration::RegistrationColoredICP(
+                        source_down, target_down, voxel_size,
+                        refined.transformation_, criteria);
+                break;
+        }
+        refined.transformation_ = result.transformation_;
+        if (i == num_scales - 1) {
+            refined.information_ =
+                    registration::GetInformationMatrixFromPointClouds(
+                            source_down, target_down, voxel_size * 1.4,
+                            result.transformation_);
+        }
+        voxel_size /= 2.0;
+    }
+    return refined;
+}
+
+bool ReconstructionPipeline::IntegrateScene(ReconstructionResult &result) {
+    OPEN3D_TRACE_ZONE("RunReconstructionPipeline::IntegrateScene");
+    integration::ScalableTSDFVolume volume(
+            option_.tsdf_cubic_size_ / 512.0, kSDFTrunc,
+            integration::TSDFVolumeColorType::RGB8);
+    volume.memory_budget_ = option_.scene_memory_budget_;
+    volume.spill_directory_ = option_.spill_directory_;
+
+    std::vector<Eigen::Matrix4d_u> poses;
+    for (size_t f = 0; f < fragments_.size(); f++) {
+        const Eigen::Matrix4d fragment_pose =
+                result.scene_pose_graph_.nodes_[f].pose_;
+        for (const auto &node : fragments_[f]->pose_graph_.nodes_) {
+            poses.push_back(fragment_pose * node.pose_);
+        }
+    }
+
+    // Frames are decoded in parallel batches ahead of the serial integration,
+    // which is itself parallel.
+    int batch_size = 2 * utility::GetMaxThreads();
+    std::vector<std::shared_ptr<geometry::RGBDImage>> batch(batch_size);
+    for (int begin = 0; begin < num_frames_; begin += batch_size) {
+        int end = std::min(begin + batch_size, num_frames_);
+        utility::ParallelFor(begin, end, [&](int frame) {
+            batch[frame - begin] = ReadRGBDImage(frame, false);
+        });
+        for (int frame = begin; frame < end; frame++) {
+            if (IsStopped()) {
+                return false;
+            }
+            Eigen::Matrix4d extrinsic = poses[frame].inverse();
+            volume.Integrate(*batch[frame - begin], intrinsic_, extrinsic);
+            batch[frame - begin].reset();
+
+            camera::PinholeCameraParameters parameters;
+            parameters.intrinsic_ = intrinsic_;
+            parameters.extrinsic_ = extrinsic;
+            result.trajectory_.parameters_.push_back(parameters);
+            AddProgress(1);
+        }
+    }
+    if (!volume.spill_directory_.empty() &&
+        !volume.RestoreSpilledVolumeUnits()) {
+        utility::LogWarning(
+                "[RunReconstructionPipeline] Failed to restore spilled volume "
+                "units.");
+    }
+    result.mesh_ = volume.ExtractTriangleMesh();
+    result.mesh_->ComputeVertexNormals();
+    return true;
+}
+
+std::shared_ptr<ReconstructionResult> ReconstructionPipeline::Run() {
+    int n_frames_per_fragment = std::max(1, option_.n_frames_per_fragment_);
+    int num_fragments =
+            (num_frames_ + n_frames_per_fragment - 1) / n_frames_per_fragment;
+    int num_pairs = num_fragments * (num_fragments - 1) / 2;
+    if (progress_ != nullptr) {
+        progress_->Reset(2 * int64_t(num_frames_) + 2 * int64_t(num_pairs));
+    }
+    for (int f = 0; f < num_fragments; f++) {
+        fragments_.emplace_back(new Fragment());
+        fragments_[f]->begin_ = f * n_frames_per_fragment;
+        fragments_[f]->end_ =
+                std::min(num_frames_, (f + 1) * n_frames_per_fragment);
+        fragments_[f]->pending_ = 0;
+        for (int t = f + 1; t < num_fragments; t++) {
+            PairRegistration pair;
+            pair.source_ = f;
+            pair.target_ = t;
+            fragment_pairs_.push_back(pair);
+        }
+    }
+    fragment_done_.resize(num_fragments, false);
+
+    // Fragments and fragment pairs.
+    for (int f = 0; f < num_fragments; f++) {
+        tasks_.Run([this, f]() { StartFragment(f); });
+    }
+    tasks_.Wait();
+    if (IsStopped()) {
+        return nullptr;
+    }
+    auto result = std::make_shared<ReconstructionResult>();
+    registration::PoseGraph scene_pose_graph =
+            CreateScenePoseGraph(fragment_pairs_);
+    OptimizePoseGraph(scene_pose_graph, option_.voxel_size_ * 1.4,
+                      option_.preference_loop_closure_registration_);
+
+    // Refinement of the edges kept by the optimization.
+    std::vector<PairRegistration> refined_pairs;
+    for (const auto &edge : scene_pose_graph.edges_) {
+        PairRegistration pair;
+        pair.source_ = edge.source_node_id_;
+        pair.target_ = edge.target_node_id_;
+        pair.success_ = true;
+        pair.transformation_ = edge.transformation_;
+        refined_pairs.push_back(pair);
+    }
+    utility::ParallelFor(0, int(refined_pairs.size()), [&](int i) {
+        if (IsStopped()) {
+            return;
+        }
+        utility::ScopedMaxThreads single_thread(1);
+        refined_pairs[i] = RefineRegistration(refined_pairs[i], kNumICPScales);
+        AddProgress(1);
+    });
+    if (IsStopped()) {
+        return nullptr;
+    }
+    AddProgress(num_pairs - int64_t(refined_pairs.size()));
+    result->scene_pose_graph_ = CreateScenePoseGraph(refined_pairs);
+    OptimizePoseGraph(result->scene_pose_graph_, option_.voxel_size_ * 1.4,
+                      option_.preference_loop_closure_registration_);
+
+    if (!IntegrateScene(*result)) {
+        return nullptr;
+    }
+    for (auto &fragment : fragments_) {
+        result->fragment_pose_graphs_.push_back(
+                std::move(fragment->pose_graph_));
+        result->fragment_point_clouds_.push_back(fragment->point_cloud_);
+    }
+    return result;
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<ReconstructionResult> RunReconstructionPipeline(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const ReconstructionOption &option /* = ReconstructionOption()*/,
+        utility::ProgressToken *progress /* = nullptr*/) {
+    OPEN3D_TRACE_ZONE("RunReconstructionPipeline");
+    if (color_files.empty() || color_files.size() != depth_files.size()) {
+        utility::LogWarning(
+                "[RunReconstructionPipeline] Expected the same non-zero "
+                "number of color and depth images.");
+        return nullptr;
+    }
+    ReconstructionPipeline pipeline(color_files, depth_files, intrinsic,
+                                    option, progress);
+    auto result = pipeline.Run();
+    if (result == nullptr && progress != nullptr && progress->IsCancelled()) {
+        utility::LogDebug("[RunReconstructionPipeline] Cancelled.");
+    }
+    return result;
+}
+
+}  // namespace reconstruction
+}  // namespace open3d
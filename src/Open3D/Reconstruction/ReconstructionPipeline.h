@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Registration/PoseGraph.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+class TriangleMesh;
+}  // namespace geometry
+
+namespace utility {
+class ProgressToken;
+}
+
+namespace reconstruction {
+
+/// Local registration used between fragments.
+enum class ReconstructionICPMethod {
+    PointToPoint = 0,
+    PointToPlane = 1,
+    Color = 2,
+};
+
+/// Global registration used for non-adjacent fragments.
+enum class ReconstructionGlobalRegistration {
+    RANSAC = 0,
+    FGR = 1,
+};
+
+/// \class ReconstructionOption
+///
+/// \brief Options of RunReconstructionPipeline. The defaults match the Python
+/// reconstruction system in examples/Python/ReconstructionSystem.
+class ReconstructionOption {
+public:
+    ReconstructionOption(
+            // Attention: when you update the defaults, update the docstrings in
+            // Python/reconstruction/reconstruction.cpp
+            int n_frames_per_fragment = 100,
+            int n_keyframes_per_n_frame = 5,
+            double depth_scale = 1000.0,
+            double max_depth = 3.0,
+            double max_depth_diff = 0.07,
+            double voxel_size = 0.05,
+            double tsdf_cubic_size = 3.0,
+            double preference_loop_closure_odometry = 0.1,
+            double preference_loop_closure_registration = 5.0,
+            ReconstructionICPMethod icp_method = ReconstructionICPMethod::Color,
+            ReconstructionGlobalRegistration global_registration =
+                    ReconstructionGlobalRegistration::RANSAC,
+            int max_cached_frames = 256,
+            size_t scene_memory_budget = 0,
+            const std::string &spill_directory = "")
+        : n_frames_per_fragment_(n_frames_per_fragment),
+          n_keyframes_per_n_frame_(n_keyframes_per_n_frame),
+          depth_scale_(depth_scale),
+          max_depth_(max_depth),
+          max_depth_diff_(max_depth_diff),
+          voxel_size_(voxel_size),
+          tsdf_cubic_size_(tsdf_cubic_size),
+          preference_loop_closure_odometry_(preference_loop_closure_odometry),
+          preference_loop_closure_registration_(
+                  preference_loop_closure_registration),
+          icp_method_(icp_method),
+          global_registration_(global_registration),
+          max_cached_frames_(max_cached_frames),
+          scene_memory_budget_(scene_memory_budget),
+          spill_directory_(spill_directory) {}
+    ~ReconstructionOption() {}
+
+public:
+    /// Number of consecutive frames fused into one fragment.
+    int n_frames_per_fragment_;
+    /// Every n-th frame of a fragment is a keyframe; keyframe pairs are
+    /// matched for loop closure.
+    int n_keyframes_per_n_frame_;
+    double depth_scale_;
+    /// Depth values beyond max_depth_ (in meters) are discarded.
+    double max_depth_;
+    /// Maximum depth difference of corresponding pixels in RGB-D odometry.
+    double max_depth_diff_;
+    /// Voxel size of the down-sampled fragments used for registration.
+    double voxel_size_;
+    /// Side length of the space covered by 512 TSDF voxels.
+    double tsdf_cubic_size_;
+    double preference_loop_closure_odometry_;
+    double preference_loop_closure_registration_;
+    ReconstructionICPMethod icp_method_;
+    ReconstructionGlobalRegistration global_registration_;
+    /// Number of decoded frames kept in memory and shared by all stages, 0
+    /// disables the cache.
+    int max_cached_frames_;
+    /// Memory budget of the scene TSDF volume in bytes, 0 for no limit. See
+    /// ScalableTSDFVolume::memory_budget_.
+    size_t scene_memory_budget_;
+    /// Directory the scene TSDF volume spills evicted units to. Without it,
+    /// evicted units are lost.
+    std::string spill_directory_;
+};
+
+/// \class ReconstructionResult
+///
+/// \brief Output of RunReconstructionPipeline.
+class ReconstructionResult {
+public:
+    ReconstructionResult() {}
+    ~ReconstructionResult() {}
+
+public:
+    /// Optimized pose graph of every fragment. Node i holds the pose of
+    /// frame i of the fragment relative to its first frame.
+    std::vector<registration::PoseGraph> fragment_pose_graphs_;
+    /// Point cloud of every fragment in its own coordinate frame.
+    std::vector<std::shared_ptr<geometry::PointCloud>> fragment_point_clouds_;
+    /// Refined and optimized pose graph of the fragments.
+    registration::PoseGraph scene_pose_graph_;
+    /// Intrinsic and world-to-camera extrinsic of every frame.
+    camera::PinholeCameraTrajectory trajectory_;
+    std::shared_ptr<geometry::TriangleMesh> mesh_;
+};
+
+/// Reconstructs a scene from an RGB-D sequence, following the stages of the
+/// Python reconstruction system: fragment odometry and integration, fragment
+/// registration, registration refinement and scene integration.
+///
+/// The stages run as one task graph: every odometry pair, fragment and
+/// fragment pair is a task that starts as soon as its inputs are ready.
+/// Decoded frames are shared through a bounded cache; fragments keep only
+/// their point cloud and the down-sampled clouds and features needed for
+/// registration. Returns nullptr if a frame cannot be read or \p progress is
+/// cancelled.
+std::shared_ptr<ReconstructionResult> RunReconstructionPipeline(
+        const std::vector<std::string> &color_files,
+        const std::vector<std::string> &depth_files,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const ReconstructionOption &option = ReconstructionOption(),
+        utility::ProgressToken *progress = nullptr);
+
+}  // namespace reconstruction
+}  // namespace open3d
@@ -34,6 +34,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -255,6 +256,7 @@ RegistrationResult RegistrationColoredICP(
         const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
         const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
         double lambda_geometric /* = 0.968*/) {
+    OPEN3D_TRACE_ZONE("RegistrationColoredICP");
     auto target_c = InitializePointCloudForColoredICP(
             target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
     return RegistrationICP(
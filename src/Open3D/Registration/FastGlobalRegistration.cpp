@@ -34,6 +34,7 @@
 #include "Open3D/Registration/Registration.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -342,6 +343,7 @@ RegistrationResult FastGlobalRegistration(
         const Feature& target_feature,
         const FastGlobalRegistrationOption& option /* =
         FastGlobalRegistrationOption()*/) {
+    OPEN3D_TRACE_ZONE("FastGlobalRegistration");
     std::vector<geometry::PointCloud> point_cloud_vec;
     geometry::PointCloud source_orig = source;
     geometry::PointCloud target_orig = target;
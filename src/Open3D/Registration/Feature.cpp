@@ -31,6 +31,8 @@
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -77,10 +79,7 @@ std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    utility::ParallelFor(0, (int)input.points_.size(), [&](int i) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
         std::vector<int> indices;
@@ -107,7 +106,7 @@ std::shared_ptr<Feature> ComputeSPFHFeature(
                 feature->data_(h_index + 22, i) += hist_incr;
             }
         }
-    }
+    });
     return feature;
 }
 
@@ -118,6 +117,7 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    OPEN3D_TRACE_ZONE("ComputeFPFHFeature");
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
     if (input.HasNormals() == false) {
@@ -127,10 +127,7 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     }
     geometry::KDTreeFlann kdtree(input);
     auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    utility::ParallelFor(0, (int)input.points_.size(), [&](int i) {
         const auto &point = input.points_[i];
         std::vector<int> indices;
         std::vector<double> distance2;
@@ -158,7 +155,7 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 feature->data_(j, i) += spfh->data_(j, i);
             }
         }
-    }
+    });
     return feature;
 }
 
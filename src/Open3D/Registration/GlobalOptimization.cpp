@@ -36,7 +36,9 @@
 #include "Open3D/Registration/PoseGraph.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Progress.h"
 #include "Open3D/Utility/Timer.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
@@ -329,6 +331,41 @@ bool CheckMaxIteration(int iteration,
     return false;
 }
 
+/// Resets a ProgressToken to \p max_iteration units, advances it by one unit
+/// per iteration and makes up for the skipped iterations when the
+/// optimization converges early.
+class IterationProgress {
+public:
+    IterationProgress(utility::ProgressToken *progress, int max_iteration)
+        : progress_(progress), max_iteration_(max_iteration), reported_(0) {
+        if (progress_ != nullptr) {
+            progress_->Reset(max_iteration_);
+        }
+    }
+    ~IterationProgress() {
+        if (progress_ != nullptr && reported_ < max_iteration_) {
+            progress_->Add(max_iteration_ - reported_);
+        }
+    }
+
+    /// Returns false if the optimization has been cancelled.
+    bool Next() {
+        if (progress_ == nullptr) {
+            return true;
+        }
+        if (reported_ < max_iteration_) {
+            reported_++;
+            progress_->Add();
+        }
+        return !progress_->IsCancelled();
+    }
+
+private:
+    utility::ProgressToken *progress_;
+    int max_iteration_;
+    int reported_;
+};
+
 bool CheckMaxIterationLM(
         int iteration, const GlobalOptimizationConvergenceCriteria &criteria) {
     if (iteration >= criteria.max_iteration_lm_) {
@@ -460,6 +497,39 @@ bool ValidatePoseGraph(const PoseGraph &pose_graph) {
     return true;
 }
 
+/// Runs \p method on \p pose_graph as one of the passes of
+/// GlobalOptimization. The method resets the token it is given, so it reports
+/// to a token of its own, which forwards the progress and the cancellation of
+/// \p progress.
+void OptimizePass(const GlobalOptimizationMethod &method,
+                  PoseGraph &pose_graph,
+                  const GlobalOptimizationConvergenceCriteria &criteria,
+                  const GlobalOptimizationOption &option,
+                  utility::ProgressToken *progress) {
+    if (progress == nullptr) {
+        method.OptimizePoseGraph(pose_graph, criteria, option);
+        return;
+    }
+    const int64_t begin = progress->GetCompleted();
+    const int64_t units = criteria.max_iteration_;
+    utility::ProgressToken *pass = nullptr;
+    utility::ProgressToken pass_progress(
+            [&](double fraction) {
+                int64_t completed = begin + int64_t(fraction * units);
+                progress->Add(completed - progress->GetCompleted());
+                if (progress->IsCancelled()) {
+                    pass->Cancel();
+                }
+            },
+            0.0);
+    pass = &pass_progress;
+    if (progress->IsCancelled()) {
+        pass_progress.Cancel();
+    }
+    method.OptimizePoseGraphWithProgress(pose_graph, criteria, option,
+                                        &pass_progress);
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -491,6 +561,16 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
         const GlobalOptimizationOption &option) const {
+    OptimizePoseGraphImpl(pose_graph, criteria, option, nullptr);
+}
+
+void GlobalOptimizationGaussNewton::OptimizePoseGraphImpl(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option,
+        utility::ProgressToken *progress) const {
+    OPEN3D_TRACE_ZONE("GlobalOptimizationGaussNewton::OptimizePoseGraph");
+    IterationProgress iteration_progress(progress, criteria.max_iteration_);
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
@@ -526,6 +606,10 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     timer_overall.Start();
     int iter;
     for (iter = 0; !stop; iter++) {
+        if (!iteration_progress.Next()) {
+            utility::LogDebug("[GlobalOptimizationGaussNewton] Cancelled.");
+            break;
+        }
         utility::Timer timer_iter;
         timer_iter.Start();
 
@@ -583,6 +667,17 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
         const GlobalOptimizationOption &option) const {
+    OptimizePoseGraphImpl(pose_graph, criteria, option, nullptr);
+}
+
+void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraphImpl(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option,
+        utility::ProgressToken *progress) const {
+    OPEN3D_TRACE_ZONE(
+            "GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph");
+    IterationProgress iteration_progress(progress, criteria.max_iteration_);
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
@@ -625,6 +720,10 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     utility::Timer timer_overall;
     timer_overall.Start();
     for (int iter = 0; !stop; iter++) {
+        if (!iteration_progress.Next()) {
+            utility::LogDebug("[GlobalOptimizationLM] Cancelled.");
+            break;
+        }
         utility::Timer timer_iter;
         timer_iter.Start();
         int lm_count = 0;
@@ -702,14 +801,28 @@ void GlobalOptimization(PoseGraph &pose_graph,
                         const GlobalOptimizationConvergenceCriteria &criteria
                         /* = GlobalOptimizationConvergenceCriteria() */,
                         const GlobalOptimizationOption &option
-                        /* = GlobalOptimizationOption() */) {
+                        /* = GlobalOptimizationOption() */,
+                        utility::ProgressToken *progress /* = nullptr*/) {
+    OPEN3D_TRACE_ZONE("GlobalOptimization");
     if (!ValidatePoseGraph(pose_graph)) return;
+    if (progress != nullptr) {
+        progress->Reset(2 * int64_t(criteria.max_iteration_));
+    }
+    auto is_cancelled = [progress]() {
+        if (progress != nullptr && progress->IsCancelled()) {
+            utility::LogDebug("[GlobalOptimization] Cancelled.");
+            return true;
+        }
+        return false;
+    };
     std::shared_ptr<PoseGraph> pose_graph_pre = std::make_shared<PoseGraph>();
     *pose_graph_pre = pose_graph;
-    method.OptimizePoseGraph(*pose_graph_pre, criteria, option);
+    OptimizePass(method, *pose_graph_pre, criteria, option, progress);
+    if (is_cancelled()) return;
     auto pose_graph_pre_pruned =
             CreatePoseGraphWithoutInvalidEdges(*pose_graph_pre, option);
-    method.OptimizePoseGraph(*pose_graph_pre_pruned, criteria, option);
+    OptimizePass(method, *pose_graph_pre_pruned, criteria, option, progress);
+    if (is_cancelled()) return;
     auto pose_graph_pre_pruned_2 =
             CreatePoseGraphWithoutInvalidEdges(*pose_graph_pre_pruned, option);
     CompensateReferencePoseGraphNode(*pose_graph_pre_pruned_2, pose_graph,
@@ -48,13 +48,17 @@ class PoseGraph;
 ///    M. Lourakis,
 ///    SBA: A Software Package for Generic Sparse Bundle Adjustment,
 ///    Transactions on Mathematical Software, 2009
+///
+/// \p progress covers both optimization passes. If it is cancelled,
+/// \p pose_graph is left unchanged.
 void GlobalOptimization(
         PoseGraph &pose_graph,
         const GlobalOptimizationMethod &method =
                 GlobalOptimizationLevenbergMarquardt(),
         const GlobalOptimizationConvergenceCriteria &criteria =
                 GlobalOptimizationConvergenceCriteria(),
-        const GlobalOptimizationOption &option = GlobalOptimizationOption());
+        const GlobalOptimizationOption &option = GlobalOptimizationOption(),
+        utility::ProgressToken *progress = nullptr);
 
 /// Function to prune out uncertain edges having
 /// confidence_ < .edge_prune_threshold_
@@ -29,6 +29,11 @@
 #include <memory>
 
 namespace open3d {
+
+namespace utility {
+class ProgressToken;
+}
+
 namespace registration {
 
 class PoseGraph;
@@ -49,6 +54,28 @@ public:
             PoseGraph &pose_graph,
             const GlobalOptimizationConvergenceCriteria &criteria,
             const GlobalOptimizationOption &option) const = 0;
+
+    /// Same as OptimizePoseGraph, reporting to \p progress if it is given.
+    /// The built-in methods reset it to criteria.max_iteration_ units, advance
+    /// it by one unit per iteration and stop early if it is cancelled; other
+    /// methods ignore it unless they override OptimizePoseGraphImpl.
+    void OptimizePoseGraphWithProgress(
+            PoseGraph &pose_graph,
+            const GlobalOptimizationConvergenceCriteria &criteria,
+            const GlobalOptimizationOption &option,
+            utility::ProgressToken *progress = nullptr) const {
+        OptimizePoseGraphImpl(pose_graph, criteria, option, progress);
+    }
+
+protected:
+    /// \param progress May be null.
+    virtual void OptimizePoseGraphImpl(
+            PoseGraph &pose_graph,
+            const GlobalOptimizationConvergenceCriteria &criteria,
+            const GlobalOptimizationOption &option,
+            utility::ProgressToken *progress) const {
+        OptimizePoseGraph(pose_graph, criteria, option);
+    }
 };
 
 class GlobalOptimizationGaussNewton : public GlobalOptimizationMethod {
@@ -61,6 +88,13 @@ public:
             PoseGraph &pose_graph,
             const GlobalOptimizationConvergenceCriteria &criteria,
             const GlobalOptimizationOption &option) const override;
+
+protected:
+    void OptimizePoseGraphImpl(
+            PoseGraph &pose_graph,
+            const GlobalOptimizationConvergenceCriteria &criteria,
+            const GlobalOptimizationOption &option,
+            utility::ProgressToken *progress) const override;
 };
 
 class GlobalOptimizationLevenbergMarquardt : public GlobalOptimizationMethod {
@@ -73,6 +107,13 @@ public:
             PoseGraph &pose_graph,
             const GlobalOptimizationConvergenceCriteria &criteria,
             const GlobalOptimizationOption &option) const override;
+
+protected:
+    void OptimizePoseGraphImpl(
+            PoseGraph &pose_graph,
+            const GlobalOptimizationConvergenceCriteria &criteria,
+            const GlobalOptimizationOption &option,
+            utility::ProgressToken *progress) const override;
 };
 
 }  // namespace registration
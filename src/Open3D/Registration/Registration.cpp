@@ -31,17 +31,21 @@
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Registration/Feature.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
+#include "Open3D/Utility/Trace.h"
 
 namespace open3d {
 
 namespace {
 using namespace registration;
 
+template <typename PointCloudT>
 RegistrationResult GetRegistrationResultAndCorrespondences(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
+        const PointCloudT &source,
+        const PointCloudT &target,
         const geometry::KDTreeFlann &target_kdtree,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
@@ -50,41 +54,33 @@ RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    double error2 = 0.0;
-
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
-        }
-#ifdef _OPENMP
-    }
-#endif
+    // Partial correspondences are concatenated in source order, so the result
+    // does not depend on the number of threads.
+    typedef std::pair<CorrespondenceSet, double> CorrespondencesAndError;
+    CorrespondencesAndError correspondences = utility::ParallelReduce(
+            0, (int)source.points_.size(), CorrespondencesAndError({}, 0.0),
+            [&](int begin, int end, CorrespondencesAndError &partial) {
+                std::vector<int> indices(1);
+                std::vector<double> dists(1);
+                for (int i = begin; i < end; i++) {
+                    const auto &point = source.points_[i];
+                    if (target_kdtree.SearchHybrid(
+                                point, max_correspondence_distance, 1, indices,
+                                dists) > 0) {
+                        partial.second += dists[0];
+                        partial.first.push_back(
+                                Eigen::Vector2i(i, indices[0]));
+                    }
+                }
+            },
+            [](CorrespondencesAndError &result,
+               const CorrespondencesAndError &partial) {
+                result.first.insert(result.first.end(), partial.first.begin(),
+                                    partial.first.end());
+                result.second += partial.second;
+            });
+    result.correspondence_set_ = std::move(correspondences.first);
+    double error2 = correspondences.second;
 
     if (result.correspondence_set_.empty()) {
         result.fitness_ = 0.0;
@@ -126,18 +122,15 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
-}  // unnamed namespace
-
-namespace registration {
-RegistrationResult EvaluateRegistration(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
+template <typename PointCloudT>
+RegistrationResult EvaluateRegistrationT(
+        const PointCloudT &source,
+        const PointCloudT &target,
         double max_correspondence_distance,
-        const Eigen::Matrix4d
-                &transformation /* = Eigen::Matrix4d::Identity()*/) {
+        const Eigen::Matrix4d &transformation) {
     geometry::KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
+    PointCloudT pcd = source;
     if (transformation.isIdentity() == false) {
         pcd.Transform(transformation);
     }
@@ -145,15 +138,18 @@ RegistrationResult EvaluateRegistration(
             pcd, target, kdtree, max_correspondence_distance, transformation);
 }
 
-RegistrationResult RegistrationICP(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
+/// ICP on PointCloud or PointCloudF. \p compute_transformation estimates the
+/// update from the transformed source and the correspondences.
+template <typename PointCloudT, typename ComputeTransformation>
+RegistrationResult RegistrationICPT(
+        const PointCloudT &source,
+        const PointCloudT &target,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        const ICPConvergenceCriteria
-                &criteria /* = ICPConvergenceCriteria()*/) {
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ComputeTransformation &compute_transformation,
+        const ICPConvergenceCriteria &criteria) {
+    OPEN3D_TRACE_ZONE("RegistrationICP");
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
@@ -171,7 +167,7 @@ RegistrationResult RegistrationICP(
     Eigen::Matrix4d transformation = init;
     geometry::KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-    geometry::PointCloud pcd = source;
+    PointCloudT pcd = source;
     if (init.isIdentity() == false) {
         pcd.Transform(init);
     }
@@ -179,10 +175,11 @@ RegistrationResult RegistrationICP(
     result = GetRegistrationResultAndCorrespondences(
             pcd, target, kdtree, max_correspondence_distance, transformation);
     for (int i = 0; i < criteria.max_iteration_; i++) {
+        OPEN3D_TRACE_COUNTER_ADD("RegistrationICP::Iterations", 1);
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
                           result.fitness_, result.inlier_rmse_);
-        Eigen::Matrix4d update = estimation.ComputeTransformation(
-                pcd, target, result.correspondence_set_);
+        Eigen::Matrix4d update =
+                compute_transformation(pcd, result.correspondence_set_);
         transformation = update * transformation;
         pcd.Transform(update);
         RegistrationResult backup = result;
@@ -199,6 +196,81 @@ RegistrationResult RegistrationICP(
     return result;
 }
 
+}  // unnamed namespace
+
+namespace registration {
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d
+                &transformation /* = Eigen::Matrix4d::Identity()*/) {
+    return EvaluateRegistrationT(source, target, max_correspondence_distance,
+                                 transformation);
+}
+
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d
+                &transformation /* = Eigen::Matrix4d::Identity()*/) {
+    return EvaluateRegistrationT(source, target, max_correspondence_distance,
+                                 transformation);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    return RegistrationICPT(
+            source, target, max_correspondence_distance, init, estimation,
+            [&](const geometry::PointCloud &pcd,
+                const CorrespondenceSet &corres) {
+                return estimation.ComputeTransformation(pcd, target, corres);
+            },
+            criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    auto point_to_point =
+            dynamic_cast<const TransformationEstimationPointToPoint *>(
+                    &estimation);
+    auto point_to_plane =
+            dynamic_cast<const TransformationEstimationPointToPlane *>(
+                    &estimation);
+    if (point_to_point == nullptr && point_to_plane == nullptr) {
+        utility::LogError(
+                "Single-precision ICP only supports "
+                "TransformationEstimationPointToPoint and "
+                "TransformationEstimationPointToPlane.");
+    }
+    return RegistrationICPT(
+            source, target, max_correspondence_distance, init, estimation,
+            [&](const geometry::PointCloudF &pcd,
+                const CorrespondenceSet &corres) {
+                return point_to_point != nullptr
+                               ? point_to_point->ComputeTransformation(
+                                         pcd, target, corres)
+                               : point_to_plane->ComputeTransformation(
+                                         pcd, target, corres);
+            },
+            criteria);
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -254,6 +326,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
+    OPEN3D_TRACE_ZONE("RegistrationRANSACBasedOnFeatureMatching");
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -391,44 +464,39 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
-            double x = target.points_[t](0);
-            double y = target.points_[t](1);
-            double z = target.points_[t](2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        { GTG += GTG_private; }
-#ifdef _OPENMP
-    }
-#endif
+    Eigen::Matrix6d GTG = utility::ParallelReduce(
+            0, int(result.correspondence_set_.size()),
+            Eigen::Matrix6d::Zero().eval(),
+            [&](int begin, int end, Eigen::Matrix6d &GTG_private) {
+                Eigen::Vector6d G_r_private;
+                for (int c = begin; c < end; c++) {
+                    int t = result.correspondence_set_[c](1);
+                    double x = target.points_[t](0);
+                    double y = target.points_[t](1);
+                    double z = target.points_[t](2);
+                    G_r_private.setZero();
+                    G_r_private(1) = z;
+                    G_r_private(2) = -y;
+                    G_r_private(3) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = -z;
+                    G_r_private(2) = x;
+                    G_r_private(4) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = y;
+                    G_r_private(1) = -x;
+                    G_r_private(5) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                }
+            },
+            [](Eigen::Matrix6d &GTG, const Eigen::Matrix6d &GTG_private) {
+                GTG += GTG_private;
+            });
     return GTG;
 }
 
@@ -38,6 +38,7 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
+class PointCloudF;
 }
 
 namespace registration {
@@ -113,6 +114,24 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// Single-precision variants of the functions above. Points stay in float,
+/// the transformations are estimated in double precision. ICP supports
+/// TransformationEstimationPointToPoint and
+/// TransformationEstimationPointToPlane.
+RegistrationResult EvaluateRegistration(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation = Eigen::Matrix4d::Identity());
+RegistrationResult RegistrationICP(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// Function for global RANSAC registration based on a given set of
 /// correspondences
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
@@ -29,63 +29,80 @@
 #include <Eigen/Geometry>
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
-namespace registration {
 
-double TransformationEstimationPointToPoint::ComputeRMSE(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
+namespace {
+using namespace registration;
+
+// The kernels are shared by PointCloud and PointCloudF. Points are converted
+// to double precision one at a time.
+
+template <typename PointCloudT>
+double ComputePointToPointRMSE(const PointCloudT &source,
+                               const PointCloudT &target,
+                               const CorrespondenceSet &corres) {
     if (corres.empty()) return 0.0;
     double err = 0.0;
     for (const auto &c : corres) {
-        err += (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        err += (source.points_[c[0]].template cast<double>() -
+                target.points_[c[1]].template cast<double>())
+                       .squaredNorm();
     }
     return std::sqrt(err / (double)corres.size());
 }
 
-Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
+template <typename PointCloudT>
+Eigen::Matrix4d ComputePointToPointTransformation(
+        const PointCloudT &source,
+        const PointCloudT &target,
+        const CorrespondenceSet &corres,
+        bool with_scaling) {
     if (corres.empty()) return Eigen::Matrix4d::Identity();
     Eigen::MatrixXd source_mat(3, corres.size());
     Eigen::MatrixXd target_mat(3, corres.size());
     for (size_t i = 0; i < corres.size(); i++) {
-        source_mat.block<3, 1>(0, i) = source.points_[corres[i][0]];
-        target_mat.block<3, 1>(0, i) = target.points_[corres[i][1]];
+        source_mat.block<3, 1>(0, i) =
+                source.points_[corres[i][0]].template cast<double>();
+        target_mat.block<3, 1>(0, i) =
+                target.points_[corres[i][1]].template cast<double>();
     }
-    return Eigen::umeyama(source_mat, target_mat, with_scaling_);
+    return Eigen::umeyama(source_mat, target_mat, with_scaling);
 }
 
-double TransformationEstimationPointToPlane::ComputeRMSE(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
+template <typename PointCloudT>
+double ComputePointToPlaneRMSE(const PointCloudT &source,
+                               const PointCloudT &target,
+                               const CorrespondenceSet &corres) {
     if (corres.empty() || target.HasNormals() == false) return 0.0;
     double err = 0.0, r;
     for (const auto &c : corres) {
-        r = (source.points_[c[0]] - target.points_[c[1]])
-                    .dot(target.normals_[c[1]]);
+        r = (source.points_[c[0]].template cast<double>() -
+             target.points_[c[1]].template cast<double>())
+                    .dot(target.normals_[c[1]].template cast<double>());
         err += r * r;
     }
     return std::sqrt(err / (double)corres.size());
 }
 
-Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
+template <typename PointCloudT>
+Eigen::Matrix4d ComputePointToPlaneTransformation(
+        const PointCloudT &source,
+        const PointCloudT &target,
+        const CorrespondenceSet &corres) {
     if (corres.empty() || target.HasNormals() == false)
         return Eigen::Matrix4d::Identity();
 
     auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
                                              double &r) {
-        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
-        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
-        const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
+        const Eigen::Vector3d vs =
+                source.points_[corres[i][0]].template cast<double>();
+        const Eigen::Vector3d vt =
+                target.points_[corres[i][1]].template cast<double>();
+        const Eigen::Vector3d nt =
+                target.normals_[corres[i][1]].template cast<double>();
         r = (vs - vt).dot(nt);
         J_r.block<3, 1>(0, 0) = vs.cross(nt);
         J_r.block<3, 1>(3, 0) = nt;
@@ -106,5 +123,67 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     return is_success ? extrinsic : Eigen::Matrix4d::Identity();
 }
 
+}  // unnamed namespace
+
+namespace registration {
+
+double TransformationEstimationPointToPoint::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPointRMSE(source, target, corres);
+}
+
+Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPointTransformation(source, target, corres,
+                                             with_scaling_);
+}
+
+double TransformationEstimationPointToPoint::ComputeRMSE(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPointRMSE(source, target, corres);
+}
+
+Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPointTransformation(source, target, corres,
+                                             with_scaling_);
+}
+
+double TransformationEstimationPointToPlane::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPlaneRMSE(source, target, corres);
+}
+
+Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPlaneTransformation(source, target, corres);
+}
+
+double TransformationEstimationPointToPlane::ComputeRMSE(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPlaneRMSE(source, target, corres);
+}
+
+Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
+        const geometry::PointCloudF &source,
+        const geometry::PointCloudF &target,
+        const CorrespondenceSet &corres) const {
+    return ComputePointToPlaneTransformation(source, target, corres);
+}
+
 }  // namespace registration
 }  // namespace open3d
@@ -35,6 +35,7 @@ namespace open3d {
 
 namespace geometry {
 class PointCloud;
+class PointCloudF;
 }
 
 namespace registration {
@@ -87,6 +88,14 @@ public:
             const geometry::PointCloud &source,
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
+    /// Single-precision variants, accumulated in double precision.
+    double ComputeRMSE(const geometry::PointCloudF &source,
+                       const geometry::PointCloudF &target,
+                       const CorrespondenceSet &corres) const;
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloudF &source,
+            const geometry::PointCloudF &target,
+            const CorrespondenceSet &corres) const;
 
 public:
     bool with_scaling_ = false;
@@ -114,6 +123,14 @@ public:
             const geometry::PointCloud &source,
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
+    /// Single-precision variants, accumulated in double precision.
+    double ComputeRMSE(const geometry::PointCloudF &source,
+                       const geometry::PointCloudF &target,
+                       const CorrespondenceSet &corres) const;
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloudF &source,
+            const geometry::PointCloudF &target,
+            const CorrespondenceSet &corres) const;
 
 private:
     const TransformationEstimationType type_ =
@@ -30,6 +30,7 @@
 #include <Eigen/Sparse>
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace utility {
@@ -165,52 +166,56 @@ SolveJacobianSystemAndObtainExtrinsicMatrixArray(const Eigen::MatrixXd &JTJ,
     }
 }
 
+namespace {
+
+/// Partial sums of J^T J, J^T r and r^2 over a range of residuals.
+template <typename MatType, typename VecType>
+struct JTJandJTrSum {
+    JTJandJTrSum() : r2_sum_(0.0) {
+        JTJ_.setZero();
+        JTr_.setZero();
+    }
+
+    void Add(const JTJandJTrSum &other) {
+        JTJ_ += other.JTJ_;
+        JTr_ += other.JTr_;
+        r2_sum_ += other.r2_sum_;
+    }
+
+    MatType JTJ_;
+    VecType JTr_;
+    double r2_sum_;
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+}  // unnamed namespace
+
 template <typename MatType, typename VecType>
 std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         std::function<void(int, VecType &, double &)> f,
         int iteration_num,
         bool verbose /*=true*/) {
-    MatType JTJ;
-    VecType JTr;
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        MatType JTJ_private;
-        VecType JTr_private;
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
-        VecType J_r;
-        double r;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < iteration_num; i++) {
-            f(i, J_r, r);
-            JTJ_private.noalias() += J_r * J_r.transpose();
-            JTr_private.noalias() += J_r * r;
-            r2_sum_private += r * r;
-        }
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-#ifdef _OPENMP
-        }
-    }
-#endif
+    typedef JTJandJTrSum<MatType, VecType> Sum;
+    Sum sum = ParallelReduce(
+            0, iteration_num, Sum(),
+            [&](int begin, int end, Sum &partial) {
+                VecType J_r;
+                double r;
+                for (int i = begin; i < end; i++) {
+                    f(i, J_r, r);
+                    partial.JTJ_.noalias() += J_r * J_r.transpose();
+                    partial.JTr_.noalias() += J_r * r;
+                    partial.r2_sum_ += r * r;
+                }
+            },
+            [](Sum &result, const Sum &partial) { result.Add(partial); });
     if (verbose) {
         LogDebug("Residual : {:.2e} (# of elements : {:d})",
-                 r2_sum / (double)iteration_num, iteration_num);
+                 sum.r2_sum_ / (double)iteration_num, iteration_num);
     }
-    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+    return std::make_tuple(std::move(sum.JTJ_), std::move(sum.JTr_),
+                           sum.r2_sum_);
 }
 
 template <typename MatType, typename VecType>
@@ -221,49 +226,28 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
                      std::vector<double> &)> f,
         int iteration_num,
         bool verbose /*=true*/) {
-    MatType JTJ;
-    VecType JTr;
-    double r2_sum = 0.0;
-    JTJ.setZero();
-    JTr.setZero();
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        MatType JTJ_private;
-        VecType JTr_private;
-        double r2_sum_private = 0.0;
-        JTJ_private.setZero();
-        JTr_private.setZero();
-        std::vector<double> r;
-        std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int i = 0; i < iteration_num; i++) {
-            f(i, J_r, r);
-            for (int j = 0; j < (int)r.size(); j++) {
-                JTJ_private.noalias() += J_r[j] * J_r[j].transpose();
-                JTr_private.noalias() += J_r[j] * r[j];
-                r2_sum_private += r[j] * r[j];
-            }
-        }
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-#ifdef _OPENMP
-        }
-    }
-#endif
+    typedef JTJandJTrSum<MatType, VecType> Sum;
+    Sum sum = ParallelReduce(
+            0, iteration_num, Sum(),
+            [&](int begin, int end, Sum &partial) {
+                std::vector<double> r;
+                std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
+                for (int i = begin; i < end; i++) {
+                    f(i, J_r, r);
+                    for (int j = 0; j < (int)r.size(); j++) {
+                        partial.JTJ_.noalias() += J_r[j] * J_r[j].transpose();
+                        partial.JTr_.noalias() += J_r[j] * r[j];
+                        partial.r2_sum_ += r[j] * r[j];
+                    }
+                }
+            },
+            [](Sum &result, const Sum &partial) { result.Add(partial); });
     if (verbose) {
         LogDebug("Residual : {:.2e} (# of elements : {:d})",
-                 r2_sum / (double)iteration_num, iteration_num);
+                 sum.r2_sum_ / (double)iteration_num, iteration_num);
     }
-    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+    return std::make_tuple(std::move(sum.JTJ_), std::move(sum.JTr_),
+                           sum.r2_sum_);
 }
 
 // clang-format off
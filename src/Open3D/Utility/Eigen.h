@@ -113,6 +113,16 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Copies \p input into \p output, converting the scalar type of every
+/// element, e.g. from Eigen::Vector3d to Eigen::Vector3f.
+template <typename To, typename From>
+void CastVectors(const std::vector<From> &input, std::vector<To> &output) {
+    output.resize(input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        output[i] = input[i].template cast<typename To::Scalar>();
+    }
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
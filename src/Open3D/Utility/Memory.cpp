@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Memory.h"
+
+#include <algorithm>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+const int MemoryTracker::kMaxCategories;
+
+MemoryTracker &MemoryTracker::GetInstance() {
+    static MemoryTracker instance;
+    return instance;
+}
+
+MemoryTracker::MemoryTracker() {
+    for (int i = 0; i < kMaxCategories; i++) {
+        counters_[i].live_bytes_.store(0);
+        counters_[i].peak_bytes_.store(0);
+        counters_[i].num_allocations_.store(0);
+    }
+}
+
+int MemoryTracker::GetCategory(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(names_.begin(), names_.end(), name);
+    if (it != names_.end()) {
+        return int(it - names_.begin());
+    }
+    if (int(names_.size()) >= kMaxCategories) {
+        utility::LogError(
+                "[MemoryTracker] Cannot register more than {:d} categories.",
+                kMaxCategories);
+    }
+    names_.push_back(name);
+    return int(names_.size()) - 1;
+}
+
+void MemoryTracker::RecordAllocation(int category, size_t bytes) {
+    Counters &counters = counters_[category];
+    int64_t live = counters.live_bytes_.fetch_add(int64_t(bytes),
+                                                  std::memory_order_relaxed) +
+                   int64_t(bytes);
+    int64_t peak = counters.peak_bytes_.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !counters.peak_bytes_.compare_exchange_weak(
+                   peak, live, std::memory_order_relaxed)) {
+    }
+    counters.num_allocations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::RecordDeallocation(int category, size_t bytes) {
+    counters_[category].live_bytes_.fetch_sub(int64_t(bytes),
+                                              std::memory_order_relaxed);
+}
+
+MemoryStatistics MemoryTracker::GetStatistics(int category) const {
+    MemoryStatistics statistics;
+    statistics.category_ = names_[category];
+    const Counters &counters = counters_[category];
+    statistics.live_bytes_ =
+            counters.live_bytes_.load(std::memory_order_relaxed);
+    statistics.peak_bytes_ =
+            counters.peak_bytes_.load(std::memory_order_relaxed);
+    statistics.num_allocations_ =
+            counters.num_allocations_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+MemoryStatistics MemoryTracker::GetStatistics(const std::string &name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(names_.begin(), names_.end(), name);
+    if (it == names_.end()) {
+        MemoryStatistics statistics;
+        statistics.category_ = name;
+        return statistics;
+    }
+    return GetStatistics(int(it - names_.begin()));
+}
+
+std::vector<MemoryStatistics> MemoryTracker::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<MemoryStatistics> statistics;
+    for (int i = 0; i < int(names_.size()); i++) {
+        statistics.push_back(GetStatistics(i));
+    }
+    return statistics;
+}
+
+void MemoryTracker::ResetPeaks() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < int(names_.size()); i++) {
+        counters_[i].peak_bytes_.store(
+                counters_[i].live_bytes_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    }
+}
+
+void MemoryTracker::PrintSummary() const {
+    for (const auto &statistics : GetStatistics()) {
+        utility::LogInfo(
+                "{:<32} live {:10.3f} MB, peak {:10.3f} MB, {:d} allocations",
+                statistics.category_, statistics.live_bytes_ / 1048576.0,
+                statistics.peak_bytes_ / 1048576.0,
+                statistics.num_allocations_);
+    }
+}
+
+Arena::Arena(size_t block_size /* = 1 << 16*/,
+             const std::string &category /* = "Arena"*/)
+    : block_size_(std::max(block_size, size_t(64))),
+      category_(MemoryTracker::GetInstance().GetCategory(category)),
+      offset_(0),
+      used_bytes_(0),
+      capacity_(0) {}
+
+Arena::~Arena() { FreeBlocks(); }
+
+void *Arena::Allocate(size_t bytes,
+                      size_t alignment /* = alignof(std::max_align_t)*/) {
+    if (!blocks_.empty()) {
+        const Block &block = blocks_.back();
+        uintptr_t address = uintptr_t(block.data_) + offset_;
+        size_t padding = (alignment - address % alignment) % alignment;
+        if (offset_ + padding + bytes <= block.size_) {
+            offset_ += padding + bytes;
+            used_bytes_ += bytes;
+            return block.data_ + offset_ - bytes;
+        }
+    }
+    AddBlock(std::max(block_size_, bytes + alignment));
+    return Allocate(bytes, alignment);
+}
+
+void Arena::Reset() {
+    if (blocks_.size() > 1) {
+        // Merge the blocks so the next run fits into a single one.
+        size_t capacity = capacity_;
+        FreeBlocks();
+        AddBlock(capacity);
+    }
+    offset_ = 0;
+    used_bytes_ = 0;
+}
+
+void Arena::AddBlock(size_t size) {
+    Block block;
+    block.data_ = static_cast<char *>(::operator new(size));
+    block.size_ = size;
+    blocks_.push_back(block);
+    offset_ = 0;
+    capacity_ += size;
+    MemoryTracker::GetInstance().RecordAllocation(category_, size);
+}
+
+void Arena::FreeBlocks() {
+    for (const Block &block : blocks_) {
+        ::operator delete(block.data_);
+        MemoryTracker::GetInstance().RecordDeallocation(category_,
+                                                        block.size_);
+    }
+    blocks_.clear();
+    offset_ = 0;
+    capacity_ = 0;
+}
+
+}  // namespace utility
+}  // namespace open3d
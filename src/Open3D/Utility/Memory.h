@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// Live and peak bytes of one allocation category.
+struct MemoryStatistics {
+    std::string category_;
+    int64_t live_bytes_ = 0;
+    int64_t peak_bytes_ = 0;
+    /// Number of allocations since the tracker was created.
+    int64_t num_allocations_ = 0;
+};
+
+/// \class MemoryTracker
+///
+/// \brief Process-wide accounting of the memory reserved by Arena, grouped
+/// by named category.
+///
+/// Categories are registered once and then updated with relaxed atomics, so
+/// recording is cheap enough for allocation-heavy code.
+class MemoryTracker {
+public:
+    static const int kMaxCategories = 64;
+
+public:
+    static MemoryTracker &GetInstance();
+    MemoryTracker(MemoryTracker const &) = delete;
+    void operator=(MemoryTracker const &) = delete;
+
+public:
+    /// Returns the id of the category called \p name, registering it if
+    /// needed.
+    int GetCategory(const std::string &name);
+    void RecordAllocation(int category, size_t bytes);
+    void RecordDeallocation(int category, size_t bytes);
+
+    /// Returns the statistics of the category called \p name; all counts are
+    /// zero if it has never been used.
+    MemoryStatistics GetStatistics(const std::string &name) const;
+    /// Returns the statistics of all registered categories.
+    std::vector<MemoryStatistics> GetStatistics() const;
+    /// Sets the peak of every category to its current live bytes.
+    void ResetPeaks();
+    /// Prints the statistics of all categories with LogInfo.
+    void PrintSummary() const;
+
+private:
+    MemoryTracker();
+    MemoryStatistics GetStatistics(int category) const;
+
+private:
+    struct Counters {
+        std::atomic<int64_t> live_bytes_;
+        std::atomic<int64_t> peak_bytes_;
+        std::atomic<int64_t> num_allocations_;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<std::string> names_;
+    Counters counters_[kMaxCategories];
+};
+
+/// \class Arena
+///
+/// \brief Bump allocator for short-lived scratch data, e.g. per frame.
+///
+/// Individual allocations are never freed; Reset() releases all of them at
+/// once and keeps the memory. After a Reset() the blocks are merged into one
+/// that holds the previous peak, so a workload that repeats with the same
+/// size stops allocating from the heap after its first run.
+class Arena {
+public:
+    explicit Arena(size_t block_size = 1 << 16,
+                   const std::string &category = "Arena");
+    ~Arena();
+    Arena(Arena const &) = delete;
+    void operator=(Arena const &) = delete;
+
+public:
+    void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+    void Reset();
+    /// Bytes handed out since the last Reset().
+    size_t GetUsedBytes() const { return used_bytes_; }
+    /// Bytes currently reserved from the heap.
+    size_t GetCapacity() const { return capacity_; }
+    size_t GetNumBlocks() const { return blocks_.size(); }
+
+private:
+    void AddBlock(size_t size);
+    void FreeBlocks();
+
+private:
+    struct Block {
+        char *data_;
+        size_t size_;
+    };
+
+    size_t block_size_;
+    int category_;
+    std::vector<Block> blocks_;
+    size_t offset_;
+    size_t used_bytes_;
+    size_t capacity_;
+};
+
+/// \class ArenaAllocator
+///
+/// \brief Standard allocator drawing from an Arena. Deallocation is a no-op;
+/// the memory is reclaimed by Arena::Reset(), which must only be called once
+/// the containers using the arena are destroyed.
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+public:
+    explicit ArenaAllocator(Arena &arena) : arena_(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other)
+        : arena_(&other.GetArena()) {}
+
+public:
+    T *allocate(size_t n) {
+        return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *, size_t) {}
+    Arena &GetArena() const { return *arena_; }
+
+private:
+    Arena *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+    return &a.GetArena() == &b.GetArena();
+}
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+    return !(a == b);
+}
+
+}  // namespace utility
+}  // namespace open3d
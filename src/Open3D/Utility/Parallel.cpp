@@ -0,0 +1,416 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+std::atomic<int> g_max_threads(0);
+std::atomic<int> g_backend(int(ParallelBackend::ThreadPool));
+/// Index of the pool worker running on this thread, -1 for other threads.
+thread_local int g_worker_index = -1;
+/// Per-thread cap set by ScopedMaxThreads, 0 if unset.
+thread_local int g_thread_limit = 0;
+
+int GetHardwareConcurrency() {
+    return std::max(1, int(std::thread::hardware_concurrency()));
+}
+
+/// Returns the OpenMP thread count of the calling thread, or 0 without
+/// OpenMP.
+int GetOpenMPThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 0;
+#endif
+}
+
+/// The OpenMP thread count when Open3D is loaded, which honours
+/// OMP_NUM_THREADS, or 0 without OpenMP. It is recorded at static
+/// initialization so that it does not depend on when Open3D first changes
+/// the OpenMP setting.
+const int g_default_openmp_threads = GetOpenMPThreads();
+
+int GetDefaultOpenMPThreads() { return g_default_openmp_threads; }
+
+void SetOpenMPThreads(int num_threads) {
+#ifdef _OPENMP
+    omp_set_num_threads(num_threads);
+#else
+    (void)num_threads;
+#endif
+}
+
+/// Work-stealing pool. Every worker owns a deque; it pops its own tasks from
+/// the back and steals from the front of the other deques when idle.
+class ThreadPool {
+public:
+    /// The pool is created on first use with enough workers for the larger
+    /// of the hardware concurrency and the SetMaxThreads value at that time.
+    static ThreadPool &GetInstance() {
+        static ThreadPool pool(
+                std::max(GetHardwareConcurrency(), g_max_threads.load()) - 1);
+        return pool;
+    }
+
+    explicit ThreadPool(int num_workers) : pending_(0), stop_(false) {
+        for (int i = 0; i < std::max(1, num_workers); i++) {
+            queues_.emplace_back(new WorkerQueue);
+        }
+        for (int i = 0; i < num_workers; i++) {
+            workers_.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    int GetNumWorkers() const { return int(workers_.size()); }
+
+    void Submit(std::function<void()> task) {
+        int index = g_worker_index;
+        if (index < 0) {
+            index = int(next_queue_.fetch_add(1) % queues_.size());
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex_);
+            queues_[index]->tasks_.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            pending_++;
+        }
+        sleep_cv_.notify_one();
+    }
+
+    /// Runs one queued task on the calling thread, if there is any.
+    bool TryRunPendingTask() {
+        std::function<void()> task;
+        if (!PopTask(g_worker_index, task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    /// Runs queued tasks on the calling thread until \p done returns true,
+    /// and sleeps while there is nothing to run. Whoever makes \p done true
+    /// must call NotifyDone() afterwards.
+    template <typename Predicate>
+    void HelpUntil(const Predicate &done) {
+        while (!done()) {
+            if (TryRunPendingTask()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [&]() { return done() || pending_ > 0; });
+        }
+    }
+
+    /// Wakes the threads sleeping in HelpUntil().
+    void NotifyDone() {
+        // Taking the lock orders the change of the predicate before the
+        // sleeping threads check it again.
+        { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+        sleep_cv_.notify_all();
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex_;
+        std::deque<std::function<void()>> tasks_;
+    };
+
+    bool PopTask(int index, std::function<void()> &task) {
+        if (index >= 0) {
+            WorkerQueue &queue = *queues_[index];
+            std::lock_guard<std::mutex> lock(queue.mutex_);
+            if (!queue.tasks_.empty()) {
+                task = std::move(queue.tasks_.back());
+                queue.tasks_.pop_back();
+                OnTaskTaken();
+                return true;
+            }
+        }
+        int num_queues = int(queues_.size());
+        int start = std::max(index, 0);
+        for (int i = 1; i <= num_queues; i++) {
+            WorkerQueue &queue = *queues_[(start + i) % num_queues];
+            std::lock_guard<std::mutex> lock(queue.mutex_);
+            if (!queue.tasks_.empty()) {
+                task = std::move(queue.tasks_.front());
+                queue.tasks_.pop_front();
+                OnTaskTaken();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void OnTaskTaken() {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        pending_--;
+    }
+
+    void WorkerLoop(int index) {
+        g_worker_index = index;
+        while (true) {
+            std::function<void()> task;
+            if (PopTask(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [this]() { return stop_ || pending_ > 0; });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<unsigned int> next_queue_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    int pending_;
+    bool stop_;
+};
+
+/// Stores the first exception thrown by any of a set of tasks.
+class ExceptionHolder {
+public:
+    void Capture() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!exception_) {
+            exception_ = std::current_exception();
+        }
+    }
+
+    void Rethrow() {
+        std::exception_ptr exception;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(exception, exception_);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::exception_ptr exception_;
+};
+
+}  // unnamed namespace
+
+void SetMaxThreads(int num_threads) {
+    g_max_threads.store(std::max(0, num_threads));
+    if (num_threads <= 0) {
+        // GetMaxThreads follows OpenMP again, from its default.
+        SetOpenMPThreads(GetDefaultOpenMPThreads());
+    }
+    SetOpenMPThreads(GetMaxThreads());
+}
+
+int GetMaxThreads() {
+    int max_threads = g_max_threads.load();
+    if (max_threads <= 0) {
+        // Without a value of its own, Open3D follows the OpenMP setting, so
+        // that OMP_NUM_THREADS also caps the thread pool loops.
+        max_threads = GetOpenMPThreads();
+    }
+    if (max_threads <= 0) {
+        max_threads = GetHardwareConcurrency();
+    }
+    if (g_thread_limit > 0) {
+        max_threads = std::min(max_threads, g_thread_limit);
+    }
+    return max_threads;
+}
+
+void SetParallelBackend(ParallelBackend backend) {
+    g_backend.store(int(backend));
+}
+
+ParallelBackend GetParallelBackend() {
+    return ParallelBackend(g_backend.load());
+}
+
+bool IsParallelWorkerThread() { return g_worker_index >= 0; }
+
+ScopedMaxThreads::ScopedMaxThreads(int num_threads)
+    : previous_limit_(g_thread_limit),
+      previous_openmp_threads_(GetOpenMPThreads()) {
+    g_thread_limit = std::max(1, num_threads);
+    SetOpenMPThreads(GetMaxThreads());
+}
+
+ScopedMaxThreads::~ScopedMaxThreads() {
+    g_thread_limit = previous_limit_;
+    if (previous_openmp_threads_ > 0) {
+        SetOpenMPThreads(previous_openmp_threads_);
+    }
+}
+
+void ParallelRun(int num_tasks,
+                 const std::function<void(int)> &task,
+                 int num_threads /* = 0*/) {
+    if (num_tasks <= 0) {
+        return;
+    }
+    int threads = GetParallelThreadCount(num_tasks, num_threads);
+    if (threads == 1 || IsParallelWorkerThread()) {
+        for (int i = 0; i < num_tasks; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    ExceptionHolder exception;
+#ifdef _OPENMP
+    if (GetParallelBackend() == ParallelBackend::OpenMP) {
+#pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+        for (int i = 0; i < num_tasks; i++) {
+            try {
+                task(i);
+            } catch (...) {
+                exception.Capture();
+            }
+        }
+        exception.Rethrow();
+        return;
+    }
+#endif
+
+    ThreadPool &pool = ThreadPool::GetInstance();
+    int num_helpers = std::min(threads - 1, pool.GetNumWorkers());
+    std::atomic<int> next_task(0);
+    std::atomic<int> num_finished_helpers(0);
+    auto run_tasks = [&]() {
+        int i;
+        while ((i = next_task.fetch_add(1)) < num_tasks) {
+            try {
+                task(i);
+            } catch (...) {
+                exception.Capture();
+            }
+        }
+    };
+    for (int i = 0; i < num_helpers; i++) {
+        pool.Submit([&]() {
+            run_tasks();
+            num_finished_helpers.fetch_add(1, std::memory_order_release);
+            pool.NotifyDone();
+        });
+    }
+    run_tasks();
+    // Helpers still queued behind other work are either picked up here or
+    // find no tasks left and finish immediately.
+    pool.HelpUntil([&]() {
+        return num_finished_helpers.load(std::memory_order_acquire) ==
+               num_helpers;
+    });
+    exception.Rethrow();
+}
+
+struct TaskGroup::State {
+    std::atomic<int> num_running{0};
+    ExceptionHolder exception;
+};
+
+TaskGroup::TaskGroup() : state_(std::make_shared<State>()) {}
+
+TaskGroup::~TaskGroup() {
+    try {
+        Wait();
+    } catch (...) {
+    }
+}
+
+void TaskGroup::Run(const std::function<void()> &task) {
+    ThreadPool &pool = ThreadPool::GetInstance();
+    std::shared_ptr<State> state = state_;
+    // The thread calling Wait() is one of the GetMaxThreads() threads, so
+    // at most GetMaxThreads() - 1 tasks of the group run on the pool.
+    int max_running = std::min(GetMaxThreads() - 1, pool.GetNumWorkers());
+    int running = state->num_running.load();
+    while (running < max_running &&
+           !state->num_running.compare_exchange_weak(running, running + 1)) {
+    }
+    if (running >= max_running) {
+        try {
+            task();
+        } catch (...) {
+            state->exception.Capture();
+        }
+        return;
+    }
+    pool.Submit([state, task]() {
+        try {
+            task();
+        } catch (...) {
+            state->exception.Capture();
+        }
+        state->num_running.fetch_sub(1, std::memory_order_release);
+        ThreadPool::GetInstance().NotifyDone();
+    });
+}
+
+void TaskGroup::Wait() {
+    ThreadPool::GetInstance().HelpUntil([this]() {
+        return state_->num_running.load(std::memory_order_acquire) == 0;
+    });
+    state_->exception.Rethrow();
+}
+
+}  // namespace utility
+}  // namespace open3d
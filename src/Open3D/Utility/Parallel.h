@@ -0,0 +1,247 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// Runtime used by ParallelRun, ParallelFor and ParallelReduce.
+enum class ParallelBackend {
+    /// Open3D's work-stealing thread pool.
+    ThreadPool = 0,
+    /// OpenMP parallel regions. Falls back to ThreadPool when Open3D is built
+    /// without OpenMP.
+    OpenMP = 1,
+};
+
+/// Sets the global number of threads used by parallel loops. The value is
+/// also forwarded to OpenMP for the calling thread. 0 restores the default,
+/// which is the OpenMP thread count (e.g. OMP_NUM_THREADS) when built with
+/// OpenMP and the hardware concurrency otherwise. The thread pool is sized on
+/// first use, so raising the value above the hardware concurrency only takes
+/// effect before that.
+void SetMaxThreads(int num_threads);
+/// Returns the number of threads available to parallel loops started by the
+/// calling thread, taking ScopedMaxThreads into account.
+int GetMaxThreads();
+void SetParallelBackend(ParallelBackend backend);
+ParallelBackend GetParallelBackend();
+/// Returns true if the calling thread is a worker of the thread pool.
+bool IsParallelWorkerThread();
+
+/// \class ScopedMaxThreads
+///
+/// \brief Caps the threads used by parallel loops started by the calling
+/// thread while the object is alive.
+///
+/// Use ScopedMaxThreads(1) to call Open3D from threads of another task system
+/// without oversubscribing the machine.
+class ScopedMaxThreads {
+public:
+    explicit ScopedMaxThreads(int num_threads);
+    ~ScopedMaxThreads();
+    ScopedMaxThreads(ScopedMaxThreads const &) = delete;
+    void operator=(ScopedMaxThreads const &) = delete;
+
+private:
+    int previous_limit_;
+    /// OpenMP thread count of the calling thread, restored on destruction.
+    int previous_openmp_threads_;
+};
+
+/// Runs task(i) for every i in [0, num_tasks) on up to \p num_threads
+/// threads, the calling thread included. \p num_threads <= 0 uses
+/// GetMaxThreads(). Calls made from a pool worker run serially. The first
+/// exception thrown by a task is rethrown once all tasks are done.
+void ParallelRun(int num_tasks,
+                 const std::function<void(int)> &task,
+                 int num_threads = 0);
+
+/// Returns the number of threads a parallel loop may use for \p num_items
+/// items when \p num_threads threads are requested.
+inline int GetParallelThreadCount(int num_items, int num_threads = 0) {
+    int max_threads = GetMaxThreads();
+    if (num_threads > 0) {
+        max_threads = std::min(max_threads, num_threads);
+    }
+    return std::max(1, std::min(max_threads, num_items));
+}
+
+/// Calls range_func(chunk_begin, chunk_end) over contiguous chunks covering
+/// [begin, end). Chunks are processed in parallel.
+template <typename RangeFunc>
+void ParallelForRange(int begin,
+                      int end,
+                      const RangeFunc &range_func,
+                      int num_threads = 0) {
+    int num_items = end - begin;
+    if (num_items <= 0) {
+        return;
+    }
+    int threads = GetParallelThreadCount(num_items, num_threads);
+    if (threads == 1 || IsParallelWorkerThread()) {
+        range_func(begin, end);
+        return;
+    }
+    // A few chunks per thread balance uneven work without dynamic splitting.
+    int num_chunks = std::min(num_items, threads * 4);
+    ParallelRun(num_chunks,
+                [&](int chunk) {
+                    int64_t n = num_items;
+                    range_func(begin + int(n * chunk / num_chunks),
+                               begin + int(n * (chunk + 1) / num_chunks));
+                },
+                threads);
+}
+
+/// Calls func(i) for every i in [begin, end) in parallel.
+template <typename Func>
+void ParallelFor(int begin, int end, const Func &func, int num_threads = 0) {
+    ParallelForRange(begin, end,
+                     [&](int chunk_begin, int chunk_end) {
+                         for (int i = chunk_begin; i < chunk_end; i++) {
+                             func(i);
+                         }
+                     },
+                     num_threads);
+}
+
+/// Parallel reduction over [begin, end). range_func(chunk_begin, chunk_end,
+/// partial) accumulates a chunk into \p partial, which starts as a copy of
+/// \p identity. reduce(result, partial) merges partials into the result in
+/// chunk order. The number of chunks grows with the thread count, so
+/// floating-point results can differ between thread counts.
+template <typename T, typename RangeFunc, typename ReduceFunc>
+T ParallelReduce(int begin,
+                 int end,
+                 const T &identity,
+                 const RangeFunc &range_func,
+                 const ReduceFunc &reduce,
+                 int num_threads = 0) {
+    T result = identity;
+    int num_items = end - begin;
+    if (num_items <= 0) {
+        return result;
+    }
+    int threads = GetParallelThreadCount(num_items, num_threads);
+    if (threads == 1 || IsParallelWorkerThread()) {
+        range_func(begin, end, result);
+        return result;
+    }
+    int num_chunks = std::min(num_items, threads * 4);
+    std::vector<T, Eigen::aligned_allocator<T>> partials(num_chunks, identity);
+    ParallelRun(num_chunks,
+                [&](int chunk) {
+                    int64_t n = num_items;
+                    range_func(begin + int(n * chunk / num_chunks),
+                               begin + int(n * (chunk + 1) / num_chunks),
+                               partials[chunk]);
+                },
+                threads);
+    for (const auto &partial : partials) {
+        reduce(result, partial);
+    }
+    return result;
+}
+
+/// Sorts \p data like std::sort. Chunks of at least 1024 elements, one per
+/// thread, are sorted in parallel and then merged pairwise.
+template <typename T, typename Compare = std::less<T>>
+void ParallelSort(std::vector<T> &data,
+                  Compare comp = Compare(),
+                  int num_threads = 0) {
+    int num_chunks = GetParallelThreadCount(
+            int(std::min(data.size() / 1024, size_t(1 << 20))), num_threads);
+    if (num_chunks == 1 || IsParallelWorkerThread()) {
+        std::sort(data.begin(), data.end(), comp);
+        return;
+    }
+    std::vector<size_t> bounds(num_chunks + 1);
+    for (int i = 0; i <= num_chunks; i++) {
+        bounds[i] = data.size() * i / num_chunks;
+    }
+    ParallelRun(num_chunks,
+                [&](int i) {
+                    std::sort(data.begin() + bounds[i],
+                              data.begin() + bounds[i + 1], comp);
+                },
+                num_chunks);
+    for (int width = 1; width < num_chunks; width *= 2) {
+        int num_merges = (num_chunks + 2 * width - 1) / (2 * width);
+        ParallelRun(num_merges,
+                    [&](int merge) {
+                        int i = merge * 2 * width;
+                        if (i + width < num_chunks) {
+                            int end = std::min(i + 2 * width, num_chunks);
+                            std::inplace_merge(data.begin() + bounds[i],
+                                               data.begin() + bounds[i + width],
+                                               data.begin() + bounds[end],
+                                               comp);
+                        }
+                    },
+                    num_chunks);
+    }
+}
+
+/// \class TaskGroup
+///
+/// \brief Group of tasks run asynchronously on the thread pool.
+///
+/// Wait() executes pending pool tasks while waiting, so task groups can be
+/// nested inside tasks, and sleeps while there are none. At most
+/// GetMaxThreads() - 1 tasks of a group run on the pool at a time; further
+/// tasks run inline in Run().
+class TaskGroup {
+public:
+    TaskGroup();
+    /// Waits for unfinished tasks; exceptions are dropped.
+    ~TaskGroup();
+    TaskGroup(TaskGroup const &) = delete;
+    void operator=(TaskGroup const &) = delete;
+
+public:
+    void Run(const std::function<void()> &task);
+    /// Blocks until all tasks are done and rethrows the first exception.
+    void Wait();
+
+public:
+    struct State;
+
+private:
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Progress.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+int64_t GetTimeInNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+/// Every stride the report interval is checked; this bounds the clock reads
+/// per run independently of the number of work units.
+const int64_t kReportChecksPerRun = 1000;
+
+}  // unnamed namespace
+
+ProgressToken::ProgressToken() : ProgressToken(Callback()) {}
+
+ProgressToken::ProgressToken(const Callback &callback,
+                             double report_interval_ms /* = 100.0*/)
+    : callback_(callback),
+      report_interval_ns_(int64_t(report_interval_ms * 1e6)),
+      completed_(0),
+      cancelled_(false),
+      reporting_(false),
+      last_report_ns_(0) {
+    Reset(0);
+}
+
+void ProgressToken::Reset(int64_t total) {
+    total_ = std::max(int64_t(0), total);
+    report_stride_ = std::max(int64_t(1), total_ / kReportChecksPerRun);
+    completed_.store(0);
+    last_report_ns_.store(GetTimeInNanoseconds());
+    last_reported_completed_ = -1;
+}
+
+double ProgressToken::GetFraction() const {
+    if (total_ <= 0) {
+        return 0.0;
+    }
+    return std::min(1.0, double(GetCompleted()) / double(total_));
+}
+
+void ProgressToken::Report(int64_t completed) {
+    bool is_final = completed >= total_;
+    if (!is_final) {
+        int64_t elapsed_ns = GetTimeInNanoseconds() -
+                             last_report_ns_.load(std::memory_order_relaxed);
+        if (elapsed_ns < report_interval_ns_) {
+            return;
+        }
+    }
+    // Intermediate reports are dropped while another one is running; the
+    // final report waits for its turn.
+    while (reporting_.exchange(true, std::memory_order_acquire)) {
+        if (!is_final) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    if (completed > last_reported_completed_) {
+        last_reported_completed_ = completed;
+        last_report_ns_.store(GetTimeInNanoseconds(),
+                              std::memory_order_relaxed);
+        try {
+            callback_(std::min(1.0, double(completed) / double(total_)));
+        } catch (...) {
+            // Otherwise the next final report would wait forever.
+            reporting_.store(false, std::memory_order_release);
+            throw;
+        }
+    }
+    reporting_.store(false, std::memory_order_release);
+}
+
+ProgressToken::Callback CreateConsoleProgressCallback(
+        const std::string &progress_info) {
+    const size_t resolution = 100;
+    auto progress_bar = std::make_shared<ConsoleProgressBar>(
+            resolution, progress_info, true);
+    auto shown = std::make_shared<size_t>(0);
+    return [progress_bar, shown, resolution](double fraction) {
+        size_t target = size_t(fraction * resolution);
+        for (; *shown < target; ++*shown) {
+            ++(*progress_bar);
+        }
+    };
+}
+
+}  // namespace utility
+}  // namespace open3d
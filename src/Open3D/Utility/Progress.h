@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// \class ProgressToken
+///
+/// \brief Shared between a caller and a long-running function to report
+/// progress and request cancellation.
+///
+/// Progress is counted with a relaxed atomic, so workers never block each
+/// other. The callback runs on whichever worker crosses a report boundary, at
+/// most once per report interval plus once on completion, and never
+/// concurrently with itself.
+class ProgressToken {
+public:
+    /// Called with the completed fraction in [0, 1].
+    typedef std::function<void(double)> Callback;
+
+public:
+    ProgressToken();
+    explicit ProgressToken(const Callback &callback,
+                           double report_interval_ms = 100.0);
+    ProgressToken(ProgressToken const &) = delete;
+    void operator=(ProgressToken const &) = delete;
+
+public:
+    /// Requests cancellation. Safe to call from any thread.
+    void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool IsCancelled() const {
+        return cancelled_.load(std::memory_order_relaxed);
+    }
+
+    /// Starts a run of \p total work units. Must not be called while workers
+    /// are adding progress.
+    void Reset(int64_t total);
+
+    /// Marks \p count more work units as done. Returns false once cancellation
+    /// has been requested.
+    bool Add(int64_t count = 1) {
+        int64_t previous =
+                completed_.fetch_add(count, std::memory_order_relaxed);
+        int64_t current = previous + count;
+        if (callback_ && total_ > 0 &&
+            (previous / report_stride_ != current / report_stride_ ||
+             (previous < total_ && current >= total_))) {
+            Report(current);
+        }
+        return !IsCancelled();
+    }
+
+    int64_t GetTotal() const { return total_; }
+    int64_t GetCompleted() const {
+        return completed_.load(std::memory_order_relaxed);
+    }
+    double GetFraction() const;
+
+private:
+    void Report(int64_t completed);
+
+private:
+    Callback callback_;
+    int64_t report_interval_ns_;
+    int64_t total_;
+    /// Number of units between two checks of the report interval.
+    int64_t report_stride_;
+    std::atomic<int64_t> completed_;
+    std::atomic<bool> cancelled_;
+    std::atomic<bool> reporting_;
+    std::atomic<int64_t> last_report_ns_;
+    /// Only accessed by the thread running the callback.
+    int64_t last_reported_completed_;
+};
+
+/// Returns a ProgressToken callback that draws a ConsoleProgressBar.
+ProgressToken::Callback CreateConsoleProgressCallback(
+        const std::string &progress_info);
+
+}  // namespace utility
+}  // namespace open3d
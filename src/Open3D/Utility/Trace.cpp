@@ -0,0 +1,428 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace utility {
+
+/// Single-producer event buffer owned by one thread. Events are written into
+/// a linked list of fixed-size blocks; a block's size is published with
+/// release semantics so readers never observe a partially written event.
+struct Tracer::ThreadBuffer {
+    struct Event {
+        const char *name_;
+        int64_t start_ns_;
+        int64_t duration_ns_;
+        int64_t self_ns_;
+        int depth_;
+    };
+
+    struct Block {
+        static const size_t kCapacity = 1024;
+        Block() : size_(0), next_(nullptr) {}
+        Event events_[kCapacity];
+        std::atomic<size_t> size_;
+        std::atomic<Block *> next_;
+    };
+
+    explicit ThreadBuffer(int thread_id)
+        : thread_id_(thread_id), head_(new Block), tail_(head_) {}
+
+    ~ThreadBuffer() {
+        DeleteBlocks(head_->next_.load());
+        delete head_;
+    }
+
+    void Append(const Event &event) {
+        size_t size = tail_->size_.load(std::memory_order_relaxed);
+        if (size == Block::kCapacity) {
+            Block *block = new Block;
+            tail_->next_.store(block, std::memory_order_release);
+            tail_ = block;
+            size = 0;
+        }
+        tail_->events_[size] = event;
+        tail_->size_.store(size + 1, std::memory_order_release);
+    }
+
+    template <typename Func>
+    void ForEach(Func func) const {
+        for (const Block *block = head_; block != nullptr;
+             block = block->next_.load(std::memory_order_acquire)) {
+            size_t size = block->size_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < size; i++) {
+                func(block->events_[i]);
+            }
+        }
+    }
+
+    void Reset() {
+        DeleteBlocks(head_->next_.load());
+        head_->next_.store(nullptr);
+        head_->size_.store(0);
+        tail_ = head_;
+    }
+
+    static void DeleteBlocks(Block *block) {
+        while (block != nullptr) {
+            Block *next = block->next_.load();
+            delete block;
+            block = next;
+        }
+    }
+
+    int thread_id_;
+    Block *head_;
+    /// Only accessed by the owning thread.
+    Block *tail_;
+};
+
+namespace {
+
+thread_local Tracer::ThreadBuffer *g_thread_buffer = nullptr;
+/// Time spent in finished child zones, one entry per open zone.
+thread_local std::vector<int64_t> g_child_time_stack;
+
+const std::chrono::steady_clock::time_point g_trace_epoch =
+        std::chrono::steady_clock::now();
+
+void AtomicAdd(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, current + value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+void AtomicMin(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (value < current &&
+           !target.compare_exchange_weak(current, value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+void AtomicMax(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (value > current &&
+           !target.compare_exchange_weak(current, value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+std::string EscapeJsonString(const std::string &str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += fmt::format("\\u{:04x}", int(c));
+        } else {
+            escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+}  // unnamed namespace
+
+const int TraceHistogram::kNumBuckets;
+
+TraceHistogram::TraceHistogram() { Reset(); }
+
+void TraceHistogram::Record(double value) {
+    int bucket = 0;
+    if (value >= 1.0) {
+        int exponent;
+        std::frexp(value, &exponent);
+        bucket = std::min(exponent, kNumBuckets - 1);
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    AtomicAdd(sum_, value);
+    AtomicMin(min_, value);
+    AtomicMax(max_, value);
+}
+
+void TraceHistogram::Reset() {
+    for (int i = 0; i < kNumBuckets; i++) {
+        buckets_[i].store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0.0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<double>::infinity(),
+               std::memory_order_relaxed);
+    max_.store(-std::numeric_limits<double>::infinity(),
+               std::memory_order_relaxed);
+}
+
+int64_t TraceHistogram::GetCount() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+double TraceHistogram::GetSum() const {
+    return sum_.load(std::memory_order_relaxed);
+}
+
+double TraceHistogram::GetMin() const {
+    return GetCount() == 0 ? 0.0 : min_.load(std::memory_order_relaxed);
+}
+
+double TraceHistogram::GetMax() const {
+    return GetCount() == 0 ? 0.0 : max_.load(std::memory_order_relaxed);
+}
+
+double TraceHistogram::GetMean() const {
+    int64_t count = GetCount();
+    return count == 0 ? 0.0 : GetSum() / double(count);
+}
+
+std::vector<int64_t> TraceHistogram::GetBuckets() const {
+    std::vector<int64_t> buckets(kNumBuckets);
+    for (int i = 0; i < kNumBuckets; i++) {
+        buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    return buckets;
+}
+
+Tracer::Tracer() : enabled_(false) {}
+
+Tracer::~Tracer() {}
+
+Tracer &Tracer::GetInstance() {
+    static Tracer instance;
+    return instance;
+}
+
+int64_t Tracer::GetTimeInNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - g_trace_epoch)
+            .count();
+}
+
+Tracer::ThreadBuffer &Tracer::GetThreadBuffer() {
+    if (g_thread_buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        thread_buffers_.emplace_back(
+                new ThreadBuffer(int(thread_buffers_.size())));
+        g_thread_buffer = thread_buffers_.back().get();
+    }
+    return *g_thread_buffer;
+}
+
+void Tracer::RecordZone(const char *name,
+                        int64_t start_ns,
+                        int64_t duration_ns,
+                        int64_t self_ns,
+                        int depth) {
+    GetThreadBuffer().Append({name, start_ns, duration_ns, self_ns, depth});
+}
+
+TraceCounter &Tracer::GetCounter(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &counter = counters_[name];
+    if (!counter) {
+        counter.reset(new TraceCounter);
+    }
+    return *counter;
+}
+
+TraceHistogram &Tracer::GetHistogram(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &histogram = histograms_[name];
+    if (!histogram) {
+        histogram.reset(new TraceHistogram);
+    }
+    return *histogram;
+}
+
+std::vector<TraceZoneStatistics> Tracer::GetZoneStatistics() const {
+    std::unordered_map<std::string, TraceZoneStatistics> zone_map;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &buffer : thread_buffers_) {
+            buffer->ForEach([&](const ThreadBuffer::Event &event) {
+                auto &stats = zone_map[event.name_];
+                double duration_ms = double(event.duration_ns_) * 1e-6;
+                stats.count_++;
+                stats.total_ms_ += duration_ms;
+                stats.self_ms_ += double(event.self_ns_) * 1e-6;
+                stats.max_ms_ = std::max(stats.max_ms_, duration_ms);
+            });
+        }
+    }
+    std::vector<TraceZoneStatistics> statistics;
+    statistics.reserve(zone_map.size());
+    for (auto &it : zone_map) {
+        it.second.name_ = it.first;
+        statistics.push_back(it.second);
+    }
+    std::sort(statistics.begin(), statistics.end(),
+              [](const TraceZoneStatistics &a, const TraceZoneStatistics &b) {
+                  return a.total_ms_ > b.total_ms_;
+              });
+    return statistics;
+}
+
+std::map<std::string, int64_t> Tracer::GetCounterValues() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, int64_t> values;
+    for (const auto &it : counters_) {
+        values[it.first] = it.second->GetValue();
+    }
+    return values;
+}
+
+std::string Tracer::ToChromeTraceJson() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto append_event = [&](const std::string &event) {
+        if (!first) {
+            json += ",\n";
+        }
+        json += event;
+        first = false;
+    };
+    int64_t last_ns = 0;
+    for (const auto &buffer : thread_buffers_) {
+        int tid = buffer->thread_id_;
+        append_event(fmt::format(
+                "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":{},\"args\":{{\"name\":\"Thread {}\"}}}}",
+                tid, tid));
+        buffer->ForEach([&](const ThreadBuffer::Event &event) {
+            append_event(fmt::format(
+                    "{{\"name\":\"{}\",\"cat\":\"open3d\",\"ph\":\"X\","
+                    "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{},"
+                    "\"args\":{{\"depth\":{},\"self_us\":{:.3f}}}}}",
+                    EscapeJsonString(event.name_),
+                    double(event.start_ns_) * 1e-3,
+                    double(event.duration_ns_) * 1e-3, tid, event.depth_,
+                    double(event.self_ns_) * 1e-3));
+            last_ns = std::max(last_ns, event.start_ns_ + event.duration_ns_);
+        });
+    }
+    // Counters only keep their running total, so they are emitted as a
+    // single sample at the end of the trace.
+    for (const auto &it : counters_) {
+        append_event(fmt::format(
+                "{{\"name\":\"{}\",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":0,"
+                "\"tid\":0,\"args\":{{\"value\":{}}}}}",
+                EscapeJsonString(it.first), double(last_ns) * 1e-3,
+                it.second->GetValue()));
+    }
+    json += "]}\n";
+    return json;
+}
+
+bool Tracer::WriteChromeTrace(const std::string &filename) const {
+    FILE *f = filesystem::FOpen(filename.c_str(), "w");
+    if (f == NULL) {
+        LogWarning("Write trace failed: unable to open file: {}", filename);
+        return false;
+    }
+    std::string json = ToChromeTraceJson();
+    bool success = fwrite(json.data(), 1, json.size(), f) == json.size();
+    fclose(f);
+    if (!success) {
+        LogWarning("Write trace failed: unable to write file: {}", filename);
+    }
+    return success;
+}
+
+void Tracer::PrintSummary() const {
+    std::vector<TraceZoneStatistics> statistics = GetZoneStatistics();
+    LogInfo("[Trace] {:d} zones", statistics.size());
+    for (const auto &stats : statistics) {
+        LogInfo("[Trace] {}: {:d} calls, total {:.2f} ms, self {:.2f} ms, "
+                "max {:.2f} ms",
+                stats.name_, stats.count_, stats.total_ms_, stats.self_ms_,
+                stats.max_ms_);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &it : counters_) {
+        LogInfo("[Trace] counter {}: {:d}", it.first, it.second->GetValue());
+    }
+    for (const auto &it : histograms_) {
+        const TraceHistogram &histogram = *it.second;
+        LogInfo("[Trace] histogram {}: {:d} samples, mean {:.3f}, "
+                "min {:.3f}, max {:.3f}",
+                it.first, histogram.GetCount(), histogram.GetMean(),
+                histogram.GetMin(), histogram.GetMax());
+    }
+}
+
+void Tracer::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &buffer : thread_buffers_) {
+        buffer->Reset();
+    }
+    for (auto &it : counters_) {
+        it.second->Reset();
+    }
+    for (auto &it : histograms_) {
+        it.second->Reset();
+    }
+}
+
+TraceZone::TraceZone(const char *name)
+    : name_(name),
+      start_ns_(0),
+      active_(Tracer::GetInstance().IsEnabled()) {
+    if (active_) {
+        g_child_time_stack.push_back(0);
+        start_ns_ = Tracer::GetTimeInNanoseconds();
+    }
+}
+
+TraceZone::~TraceZone() {
+    if (!active_) {
+        return;
+    }
+    int64_t duration_ns = Tracer::GetTimeInNanoseconds() - start_ns_;
+    int64_t self_ns = duration_ns - g_child_time_stack.back();
+    g_child_time_stack.pop_back();
+    if (!g_child_time_stack.empty()) {
+        g_child_time_stack.back() += duration_ns;
+    }
+    Tracer::GetInstance().RecordZone(name_, start_ns_, duration_ns, self_ns,
+                                     int(g_child_time_stack.size()));
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Tracing macros. They compile to nothing unless the library is built with
+/// OPEN3D_ENABLE_TRACING (CMake option ENABLE_TRACING). Zone and metric names
+/// must be string literals.
+#ifdef OPEN3D_ENABLE_TRACING
+#define OPEN3D_TRACE_CONCAT_IMPL(a, b) a##b
+#define OPEN3D_TRACE_CONCAT(a, b) OPEN3D_TRACE_CONCAT_IMPL(a, b)
+#define OPEN3D_TRACE_ZONE(name)                           \
+    ::open3d::utility::TraceZone OPEN3D_TRACE_CONCAT(     \
+            open3d_trace_zone_, __LINE__)(name)
+#define OPEN3D_TRACE_COUNTER_ADD(name, value)                               \
+    do {                                                                    \
+        static ::open3d::utility::TraceCounter &open3d_trace_counter =      \
+                ::open3d::utility::Tracer::GetInstance().GetCounter(name);  \
+        if (::open3d::utility::Tracer::GetInstance().IsEnabled()) {         \
+            open3d_trace_counter.Add(value);                                \
+        }                                                                   \
+    } while (0)
+#define OPEN3D_TRACE_HISTOGRAM_RECORD(name, value)                            \
+    do {                                                                      \
+        static ::open3d::utility::TraceHistogram &open3d_trace_histogram =    \
+                ::open3d::utility::Tracer::GetInstance().GetHistogram(name);  \
+        if (::open3d::utility::Tracer::GetInstance().IsEnabled()) {           \
+            open3d_trace_histogram.Record(value);                             \
+        }                                                                     \
+    } while (0)
+#else
+#define OPEN3D_TRACE_ZONE(name)
+#define OPEN3D_TRACE_COUNTER_ADD(name, value) \
+    do {                                      \
+    } while (0)
+#define OPEN3D_TRACE_HISTOGRAM_RECORD(name, value) \
+    do {                                           \
+    } while (0)
+#endif
+
+namespace open3d {
+namespace utility {
+
+/// \class TraceCounter
+///
+/// \brief Counter that can be incremented concurrently from any thread.
+class TraceCounter {
+public:
+    TraceCounter() : value_(0) {}
+
+public:
+    void Add(int64_t value) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+    int64_t GetValue() const { return value_.load(std::memory_order_relaxed); }
+    void Reset() { value_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_;
+};
+
+/// \class TraceHistogram
+///
+/// \brief Histogram of non-negative samples with power-of-two buckets.
+///
+/// Bucket 0 counts samples below 1, bucket i counts samples in
+/// [2^(i-1), 2^i). Samples are recorded without locking.
+class TraceHistogram {
+public:
+    static const int kNumBuckets = 64;
+
+public:
+    TraceHistogram();
+
+public:
+    void Record(double value);
+    void Reset();
+    int64_t GetCount() const;
+    double GetSum() const;
+    double GetMin() const;
+    double GetMax() const;
+    double GetMean() const;
+    /// Returns the sample count of every bucket.
+    std::vector<int64_t> GetBuckets() const;
+
+private:
+    std::atomic<int64_t> buckets_[kNumBuckets];
+    std::atomic<int64_t> count_;
+    std::atomic<double> sum_;
+    std::atomic<double> min_;
+    std::atomic<double> max_;
+};
+
+/// Aggregated timing of all recorded zones sharing the same name.
+struct TraceZoneStatistics {
+    std::string name_;
+    int64_t count_ = 0;
+    /// Wall-clock time including nested zones.
+    double total_ms_ = 0.0;
+    /// Wall-clock time excluding nested zones on the same thread.
+    double self_ms_ = 0.0;
+    double max_ms_ = 0.0;
+};
+
+/// \class Tracer
+///
+/// \brief Process-wide collector of zones, counters and histograms.
+///
+/// Every thread appends its zones to its own event buffer without locking;
+/// the buffers are only merged when statistics or traces are requested.
+/// Recording is off until SetEnabled(true) is called.
+class Tracer {
+public:
+    struct ThreadBuffer;
+
+public:
+    static Tracer &GetInstance();
+    /// Monotonic time in nanoseconds since the tracer was created.
+    static int64_t GetTimeInNanoseconds();
+
+    Tracer(Tracer const &) = delete;
+    void operator=(Tracer const &) = delete;
+    ~Tracer();
+
+public:
+    void SetEnabled(bool enabled) {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Appends a finished zone to the calling thread's buffer.
+    void RecordZone(const char *name,
+                    int64_t start_ns,
+                    int64_t duration_ns,
+                    int64_t self_ns,
+                    int depth);
+    /// Returns the counter registered under \p name, creating it if needed.
+    TraceCounter &GetCounter(const std::string &name);
+    /// Returns the histogram registered under \p name, creating it if needed.
+    TraceHistogram &GetHistogram(const std::string &name);
+
+    /// Returns per-name zone statistics sorted by decreasing total time.
+    std::vector<TraceZoneStatistics> GetZoneStatistics() const;
+    std::map<std::string, int64_t> GetCounterValues() const;
+    /// Serializes all zones and counters in the Chrome trace event format,
+    /// viewable in chrome://tracing or Perfetto.
+    std::string ToChromeTraceJson() const;
+    bool WriteChromeTrace(const std::string &filename) const;
+    /// Prints zone statistics, counters and histograms with LogInfo.
+    void PrintSummary() const;
+    /// Drops all recorded zones and resets counters and histograms. Must not
+    /// be called while other threads are inside a zone.
+    void Clear();
+
+private:
+    Tracer();
+    ThreadBuffer &GetThreadBuffer();
+
+private:
+    std::atomic<bool> enabled_;
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> thread_buffers_;
+    std::map<std::string, std::unique_ptr<TraceCounter>> counters_;
+    std::map<std::string, std::unique_ptr<TraceHistogram>> histograms_;
+};
+
+/// \class TraceZone
+///
+/// \brief Scoped zone; records its duration and nesting depth on destruction.
+class TraceZone {
+public:
+    explicit TraceZone(const char *name);
+    ~TraceZone();
+    TraceZone(TraceZone const &) = delete;
+    void operator=(TraceZone const &) = delete;
+
+private:
+    const char *name_;
+    int64_t start_ns_;
+    bool active_;
+};
+
+}  // namespace utility
+}  // namespace open3d
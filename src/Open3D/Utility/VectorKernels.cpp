@@ -0,0 +1,317 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/VectorKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Arrays shorter than this per thread are processed serially, where the
+/// cost of waking up the pool would exceed the work.
+const int kMinVectorsPerThread = 1 << 14;
+/// Number of vectors transformed at a time by the affine kernel.
+const int kTileSize = 64;
+
+template <typename Scalar>
+using Vector3 = Eigen::Matrix<Scalar, 3, 1>;
+template <typename Scalar>
+using Block = Eigen::Map<Eigen::Matrix<Scalar, 3, Eigen::Dynamic>>;
+template <typename Scalar>
+using ConstBlock = Eigen::Map<const Eigen::Matrix<Scalar, 3, Eigen::Dynamic>>;
+
+static_assert(sizeof(Vector3<double>) == 3 * sizeof(double),
+              "Eigen::Vector3d must be tightly packed.");
+static_assert(sizeof(Vector3<float>) == 3 * sizeof(float),
+              "Eigen::Vector3f must be tightly packed.");
+
+int GetKernelThreadCount(size_t size) {
+    return std::max(1, int(size / kMinVectorsPerThread));
+}
+
+}  // unnamed namespace
+
+template <typename Scalar>
+void AffineTransformVectors(const Eigen::Matrix3d &A,
+                            const Eigen::Vector3d &t,
+                            std::vector<Vector3<Scalar>> &vectors) {
+    const Eigen::Matrix<Scalar, 3, 3> A_s = A.template cast<Scalar>();
+    const Vector3<Scalar> t_s = t.template cast<Scalar>();
+    ParallelForRange(
+            0, int(vectors.size()),
+            [&](int begin, int end) {
+                // The product goes through a fixed-size tile because it must
+                // not alias the vectors it reads.
+                Eigen::Matrix<Scalar, 3, kTileSize> tile;
+                for (int i = begin; i < end; i += kTileSize) {
+                    int cols = std::min(kTileSize, end - i);
+                    Block<Scalar> block(vectors[i].data(), 3, cols);
+                    tile.leftCols(cols).noalias() = A_s * block;
+                    block = tile.leftCols(cols).colwise() + t_s;
+                }
+            },
+            GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+void TransformVectorsAroundCenter(const Eigen::Matrix3d &A,
+                                  const Eigen::Vector3d &center,
+                                  std::vector<Vector3<Scalar>> &vectors) {
+    const Eigen::Matrix<Scalar, 3, 3> A_s = A.template cast<Scalar>();
+    const Vector3<Scalar> center_s = center.template cast<Scalar>();
+    ParallelForRange(
+            0, int(vectors.size()),
+            [&](int begin, int end) {
+                Eigen::Matrix<Scalar, 3, kTileSize> tile;
+                for (int i = begin; i < end; i += kTileSize) {
+                    int cols = std::min(kTileSize, end - i);
+                    Block<Scalar> block(vectors[i].data(), 3, cols);
+                    block.colwise() -= center_s;
+                    tile.leftCols(cols).noalias() = A_s * block;
+                    block = tile.leftCols(cols).colwise() + center_s;
+                }
+            },
+            GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+void TranslateVectors(const Eigen::Vector3d &t,
+                      std::vector<Vector3<Scalar>> &vectors) {
+    const Vector3<Scalar> t_s = t.template cast<Scalar>();
+    ParallelForRange(0, int(vectors.size()),
+                     [&](int begin, int end) {
+                         Block<Scalar> block(vectors[begin].data(), 3,
+                                             end - begin);
+                         block.colwise() += t_s;
+                     },
+                     GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+void ScaleVectors(double scale,
+                  const Eigen::Vector3d &center,
+                  std::vector<Vector3<Scalar>> &vectors) {
+    const Scalar scale_s = Scalar(scale);
+    const Vector3<Scalar> center_s = center.template cast<Scalar>();
+    ParallelForRange(0, int(vectors.size()),
+                     [&](int begin, int end) {
+                         Block<Scalar> block(vectors[begin].data(), 3,
+                                             end - begin);
+                         block.colwise() -= center_s;
+                         block *= scale_s;
+                         block.colwise() += center_s;
+                     },
+                     GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+void TransformPoints(const Eigen::Matrix4d &transformation,
+                     std::vector<Vector3<Scalar>> &points) {
+    if (transformation.row(3) == Eigen::RowVector4d(0.0, 0.0, 0.0, 1.0)) {
+        AffineTransformVectors<Scalar>(transformation.block<3, 3>(0, 0),
+                                       transformation.block<3, 1>(0, 3),
+                                       points);
+        return;
+    }
+    ParallelForRange(
+            0, int(points.size()),
+            [&](int begin, int end) {
+                for (int i = begin; i < end; i++) {
+                    Eigen::Vector4d new_point =
+                            transformation *
+                            Eigen::Vector4d(points[i](0), points[i](1),
+                                            points[i](2), 1.0);
+                    points[i] = (new_point.head<3>() / new_point(3))
+                                        .template cast<Scalar>();
+                }
+            },
+            GetKernelThreadCount(points.size()));
+}
+
+template <typename Scalar>
+Eigen::Vector3d ComputeMinBound(const std::vector<Vector3<Scalar>> &vectors) {
+    if (vectors.empty()) {
+        return Eigen::Vector3d::Zero();
+    }
+    const Eigen::Vector3d first = vectors[0].template cast<double>();
+    return ParallelReduce(
+            0, int(vectors.size()), first,
+            [&](int begin, int end, Eigen::Vector3d &partial) {
+                ConstBlock<Scalar> block(vectors[begin].data(), 3, end - begin);
+                partial = partial.cwiseMin(
+                        block.rowwise().minCoeff().template cast<double>());
+            },
+            [](Eigen::Vector3d &result, const Eigen::Vector3d &partial) {
+                result = result.cwiseMin(partial);
+            },
+            GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+Eigen::Vector3d ComputeMaxBound(const std::vector<Vector3<Scalar>> &vectors) {
+    if (vectors.empty()) {
+        return Eigen::Vector3d::Zero();
+    }
+    const Eigen::Vector3d first = vectors[0].template cast<double>();
+    return ParallelReduce(
+            0, int(vectors.size()), first,
+            [&](int begin, int end, Eigen::Vector3d &partial) {
+                ConstBlock<Scalar> block(vectors[begin].data(), 3, end - begin);
+                partial = partial.cwiseMax(
+                        block.rowwise().maxCoeff().template cast<double>());
+            },
+            [](Eigen::Vector3d &result, const Eigen::Vector3d &partial) {
+                result = result.cwiseMax(partial);
+            },
+            GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+Eigen::Vector3d ComputeCentroid(const std::vector<Vector3<Scalar>> &vectors) {
+    if (vectors.empty()) {
+        return Eigen::Vector3d::Zero();
+    }
+    Eigen::Vector3d sum = ParallelReduce(
+            0, int(vectors.size()), Eigen::Vector3d(Eigen::Vector3d::Zero()),
+            [&](int begin, int end, Eigen::Vector3d &partial) {
+                ConstBlock<Scalar> block(vectors[begin].data(), 3, end - begin);
+                partial += block.template cast<double>().rowwise().sum();
+            },
+            [](Eigen::Vector3d &result, const Eigen::Vector3d &partial) {
+                result += partial;
+            },
+            GetKernelThreadCount(vectors.size()));
+    return sum / double(vectors.size());
+}
+
+template <typename Scalar>
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
+        const std::vector<Vector3<Scalar>> &vectors) {
+    if (vectors.empty()) {
+        return std::make_tuple(Eigen::Vector3d::Zero(),
+                               Eigen::Matrix3d::Identity());
+    }
+    // Columns 0 to 2 hold the sum of v * v^T, column 3 the sum of v.
+    typedef Eigen::Matrix<double, 3, 4> Moments;
+    Moments moments = ParallelReduce(
+            0, int(vectors.size()), Moments(Moments::Zero()),
+            [&](int begin, int end, Moments &partial) {
+                for (int i = begin; i < end; i++) {
+                    Eigen::Vector3d v = vectors[i].template cast<double>();
+                    partial.template leftCols<3>() += v * v.transpose();
+                    partial.col(3) += v;
+                }
+            },
+            [](Moments &result, const Moments &partial) { result += partial; },
+            GetKernelThreadCount(vectors.size()));
+    moments /= double(vectors.size());
+    Eigen::Vector3d mean = moments.col(3);
+    Eigen::Matrix3d covariance =
+            moments.template leftCols<3>() - mean * mean.transpose();
+    return std::make_tuple(mean, covariance);
+}
+
+template <typename Scalar>
+void NormalizeVectors(std::vector<Vector3<Scalar>> &vectors) {
+    ParallelForRange(0, int(vectors.size()),
+                     [&](int begin, int end) {
+                         for (int i = begin; i < end; i++) {
+                             vectors[i].normalize();
+                         }
+                     },
+                     GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+void NormalizeVectors(std::vector<Vector3<Scalar>> &vectors,
+                      const Eigen::Vector3d &fallback) {
+    const Vector3<Scalar> fallback_s = fallback.template cast<Scalar>();
+    ParallelForRange(0, int(vectors.size()),
+                     [&](int begin, int end) {
+                         for (int i = begin; i < end; i++) {
+                             vectors[i].normalize();
+                             if (std::isnan(vectors[i](0))) {
+                                 vectors[i] = fallback_s;
+                             }
+                         }
+                     },
+                     GetKernelThreadCount(vectors.size()));
+}
+
+template <typename Scalar>
+void FillVectors(std::vector<Vector3<Scalar>> &vectors,
+                 size_t size,
+                 const Eigen::Vector3d &value) {
+    const Vector3<Scalar> value_s = value.template cast<Scalar>();
+    vectors.resize(size);
+    ParallelForRange(0, int(size),
+                     [&](int begin, int end) {
+                         std::fill(vectors.begin() + begin,
+                                   vectors.begin() + end, value_s);
+                     },
+                     GetKernelThreadCount(size));
+}
+
+#define OPEN3D_INSTANTIATE_VECTOR_KERNELS(Scalar)                              \
+    template void AffineTransformVectors<Scalar>(                              \
+            const Eigen::Matrix3d &, const Eigen::Vector3d &,                  \
+            std::vector<Vector3<Scalar>> &);                                   \
+    template void TransformVectorsAroundCenter<Scalar>(                        \
+            const Eigen::Matrix3d &, const Eigen::Vector3d &,                  \
+            std::vector<Vector3<Scalar>> &);                                   \
+    template void TranslateVectors<Scalar>(const Eigen::Vector3d &,            \
+                                           std::vector<Vector3<Scalar>> &);    \
+    template void ScaleVectors<Scalar>(double, const Eigen::Vector3d &,        \
+                                       std::vector<Vector3<Scalar>> &);        \
+    template void TransformPoints<Scalar>(const Eigen::Matrix4d &,             \
+                                          std::vector<Vector3<Scalar>> &);     \
+    template Eigen::Vector3d ComputeMinBound<Scalar>(                          \
+            const std::vector<Vector3<Scalar>> &);                             \
+    template Eigen::Vector3d ComputeMaxBound<Scalar>(                          \
+            const std::vector<Vector3<Scalar>> &);                             \
+    template Eigen::Vector3d ComputeCentroid<Scalar>(                          \
+            const std::vector<Vector3<Scalar>> &);                             \
+    template std::tuple<Eigen::Vector3d, Eigen::Matrix3d>                      \
+    ComputeMeanAndCovariance<Scalar>(const std::vector<Vector3<Scalar>> &);    \
+    template void NormalizeVectors<Scalar>(std::vector<Vector3<Scalar>> &);    \
+    template void NormalizeVectors<Scalar>(std::vector<Vector3<Scalar>> &,     \
+                                           const Eigen::Vector3d &);           \
+    template void FillVectors<Scalar>(std::vector<Vector3<Scalar>> &, size_t, \
+                                      const Eigen::Vector3d &);
+
+OPEN3D_INSTANTIATE_VECTOR_KERNELS(double)
+OPEN3D_INSTANTIATE_VECTOR_KERNELS(float)
+
+#undef OPEN3D_INSTANTIATE_VECTOR_KERNELS
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <tuple>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// Bulk kernels over arrays of 3D vectors such as points, normals and colors.
+///
+/// Large arrays are split into contiguous chunks that run in parallel. Inside
+/// a chunk the vectors are viewed as a 3xN matrix so that Eigen can vectorize
+/// the arithmetic. The kernels are instantiated for Eigen::Vector3d and
+/// Eigen::Vector3f arrays.
+
+/// Replaces every vector v with A * v + t.
+template <typename Scalar>
+void AffineTransformVectors(const Eigen::Matrix3d &A,
+                            const Eigen::Vector3d &t,
+                            std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Replaces every vector v with A * (v - center) + center. Subtracting the
+/// center first keeps the precision of vectors far from the origin, which
+/// AffineTransformVectors(A, center - A * center) loses.
+template <typename Scalar>
+void TransformVectorsAroundCenter(
+        const Eigen::Matrix3d &A,
+        const Eigen::Vector3d &center,
+        std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Replaces every vector v with v + t. Unlike AffineTransformVectors with an
+/// identity matrix, non-finite coordinates do not leak into other coordinates.
+template <typename Scalar>
+void TranslateVectors(const Eigen::Vector3d &t,
+                      std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Replaces every vector v with (v - center) * scale + center, component-wise.
+template <typename Scalar>
+void ScaleVectors(double scale,
+                  const Eigen::Vector3d &center,
+                  std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Applies \p transformation to every point. Points are divided by the
+/// homogeneous coordinate unless the last row is (0, 0, 0, 1).
+template <typename Scalar>
+void TransformPoints(const Eigen::Matrix4d &transformation,
+                     std::vector<Eigen::Matrix<Scalar, 3, 1>> &points);
+
+/// Returns the component-wise minimum, or zero for an empty array.
+template <typename Scalar>
+Eigen::Vector3d ComputeMinBound(
+        const std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Returns the component-wise maximum, or zero for an empty array.
+template <typename Scalar>
+Eigen::Vector3d ComputeMaxBound(
+        const std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Returns the mean, or zero for an empty array. Sums are accumulated in
+/// double precision.
+template <typename Scalar>
+Eigen::Vector3d ComputeCentroid(
+        const std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Returns the mean and the covariance matrix. An empty array yields zero
+/// and the identity.
+template <typename Scalar>
+std::tuple<Eigen::Vector3d, Eigen::Matrix3d> ComputeMeanAndCovariance(
+        const std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Scales every vector to unit length. Zero vectors are left unchanged.
+template <typename Scalar>
+void NormalizeVectors(std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors);
+
+/// Same as above, but vectors that are NaN after normalization are replaced
+/// with \p fallback.
+template <typename Scalar>
+void NormalizeVectors(std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors,
+                      const Eigen::Vector3d &fallback);
+
+/// Resizes \p vectors to \p size and sets every vector to \p value.
+template <typename Scalar>
+void FillVectors(std::vector<Eigen::Matrix<Scalar, 3, 1>> &vectors,
+                 size_t size,
+                 const Eigen::Vector3d &value);
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,19 @@
+#version 330
+
+in vec3 vertex_position;
+in mat4 instance_transform;
+uniform mat4 MVP;
+
+out vec4 fragment_color;
+
+void main()
+{
+    float r, g, b, a;
+    float instance_index = float(gl_InstanceID);
+    gl_Position = MVP * instance_transform * vec4(vertex_position, 1);
+    r = floor(instance_index / 16777216.0) / 255.0;
+    g = mod(floor(instance_index / 65536.0), 256.0) / 255.0;
+    b = mod(floor(instance_index / 256.0), 256.0) / 255.0;
+    a = mod(instance_index, 256.0) / 255.0;
+    fragment_color = vec4(r, g, b, a);
+}
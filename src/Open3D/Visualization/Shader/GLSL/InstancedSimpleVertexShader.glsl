@@ -0,0 +1,16 @@
+#version 330
+
+in vec3 vertex_position;
+in vec3 vertex_color;
+in mat4 instance_transform;
+in vec3 instance_color;
+uniform mat4 MVP;
+uniform bool use_instance_color;
+
+out vec3 fragment_color;
+
+void main()
+{
+    gl_Position = MVP * instance_transform * vec4(vertex_position, 1);
+    fragment_color = use_instance_color ? instance_color : vertex_color;
+}
@@ -0,0 +1,21 @@
+#version 330
+
+in vec3 vertex_position;
+in float vertex_face;
+in vec3 voxel_origin;
+in float voxel_size;
+in vec3 voxel_color;
+in float voxel_face_mask;
+uniform mat4 MVP;
+
+out vec3 fragment_color;
+
+void main()
+{
+    // Faces hidden by a neighbouring voxel collapse to a degenerate point,
+    // which the rasterizer discards.
+    float visible = mod(floor(voxel_face_mask / exp2(vertex_face)), 2.0);
+    vec3 position = voxel_origin + vertex_position * voxel_size * visible;
+    gl_Position = MVP * vec4(position, 1);
+    fragment_color = voxel_color;
+}
@@ -27,9 +27,12 @@
 #include "Open3D/Visualization/Shader/GeometryRenderer.h"
 
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/InstancedGeometry.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 #include "Open3D/Visualization/Utility/PointCloudPicker.h"
 #include "Open3D/Visualization/Utility/SelectionPolygon.h"
 #include "Open3D/Visualization/Visualizer/RenderOptionWithEditing.h"
@@ -43,6 +46,37 @@ bool PointCloudRenderer::Render(const RenderOption &option,
                                 const ViewControl &view) {
     if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
     const auto &pointcloud = (const geometry::PointCloud &)(*geometry_ptr_);
+    if (is_streamed_) {
+        bool success = true;
+        // Normal colors are not lit, as with NormalShader.
+        if (pointcloud.HasNormals() &&
+            option.point_color_option_ !=
+                    RenderOption::PointColorOption::Normal) {
+            success &= phong_stream_shader_.Render(pointcloud, option, view);
+        } else {
+            success &= simple_stream_shader_.Render(pointcloud, option, view);
+        }
+        // Normal lines are not streamed; they are bound again after every
+        // append.
+        if (pointcloud.HasNormals() && option.point_show_normal_) {
+            success &=
+                    simpleblack_normal_shader_.Render(pointcloud, option, view);
+        }
+        return success;
+    }
+    if (option.point_budget_ > 0 &&
+        pointcloud.points_.size() > size_t(option.point_budget_)) {
+        // Shaded as without a budget, except that normals are not drawn. The
+        // hierarchy of the unused shader is released.
+        if (pointcloud.HasNormals() &&
+            option.point_color_option_ !=
+                    RenderOption::PointColorOption::Normal) {
+            simple_lod_shader_.InvalidateGeometry();
+            return phong_lod_shader_.Render(pointcloud, option, view);
+        }
+        phong_lod_shader_.InvalidateGeometry();
+        return simple_lod_shader_.Render(pointcloud, option, view);
+    }
     bool success = true;
     if (pointcloud.HasNormals()) {
         if (option.point_color_option_ ==
@@ -76,6 +110,63 @@ bool PointCloudRenderer::UpdateGeometry() {
     phong_point_shader_.InvalidateGeometry();
     normal_point_shader_.InvalidateGeometry();
     simpleblack_normal_shader_.InvalidateGeometry();
+    simple_lod_shader_.InvalidateGeometry();
+    phong_lod_shader_.InvalidateGeometry();
+    simple_stream_shader_.InvalidateGeometry();
+    phong_stream_shader_.InvalidateGeometry();
+    is_streamed_ = false;
+    return true;
+}
+
+bool PointCloudRenderer::UpdateGeometryAppended(int window_size) {
+    // The stream shaders upload the appended points when rendering. The other
+    // shaders are not used while streaming, except for the normal lines, so
+    // their buffers are released.
+    simple_point_shader_.InvalidateGeometry();
+    phong_point_shader_.InvalidateGeometry();
+    normal_point_shader_.InvalidateGeometry();
+    simpleblack_normal_shader_.InvalidateGeometry();
+    simple_lod_shader_.InvalidateGeometry();
+    phong_lod_shader_.InvalidateGeometry();
+    simple_stream_shader_.SetWindowSize(window_size);
+    phong_stream_shader_.SetWindowSize(window_size);
+    is_streamed_ = true;
+    return true;
+}
+
+bool PointCloudRenderer::IsRenderPending() const {
+    return is_visible_ && (simple_lod_shader_.IsStreaming() ||
+                           phong_lod_shader_.IsStreaming());
+}
+
+bool PointCloudFRenderer::Render(const RenderOption &option,
+                                 const ViewControl &view) {
+    if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
+    const auto &pointcloud = (const geometry::PointCloudF &)(*geometry_ptr_);
+    if (pointcloud.HasNormals()) {
+        if (option.point_color_option_ ==
+            RenderOption::PointColorOption::Normal) {
+            return normal_point_shader_.Render(pointcloud, option, view);
+        }
+        return phong_point_shader_.Render(pointcloud, option, view);
+    }
+    return simple_point_shader_.Render(pointcloud, option, view);
+}
+
+bool PointCloudFRenderer::AddGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    if (geometry_ptr->GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloudF) {
+        return false;
+    }
+    geometry_ptr_ = geometry_ptr;
+    return UpdateGeometry();
+}
+
+bool PointCloudFRenderer::UpdateGeometry() {
+    simple_point_shader_.InvalidateGeometry();
+    phong_point_shader_.InvalidateGeometry();
+    normal_point_shader_.InvalidateGeometry();
     return true;
 }
 
@@ -101,15 +192,72 @@ bool PointCloudPickingRenderer::UpdateGeometry() {
     return true;
 }
 
+bool InstancedGeometryRenderer::Render(const RenderOption &option,
+                                       const ViewControl &view) {
+    if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
+    const auto &instanced =
+            (const geometry::InstancedGeometry &)(*geometry_ptr_);
+    if (instanced.base_geometry_->GetGeometryType() ==
+        geometry::Geometry::GeometryType::TriangleMesh) {
+        const auto &mesh =
+                (const geometry::TriangleMesh &)(*instanced.base_geometry_);
+        if (mesh.HasTriangleNormals() && mesh.HasVertexNormals()) {
+            return phong_instanced_shader_.Render(instanced, option, view);
+        }
+    }
+    return simple_instanced_shader_.Render(instanced, option, view);
+}
+
+bool InstancedGeometryRenderer::AddGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    if (geometry_ptr->GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedGeometry) {
+        return false;
+    }
+    geometry_ptr_ = geometry_ptr;
+    return UpdateGeometry();
+}
+
+bool InstancedGeometryRenderer::UpdateGeometry() {
+    phong_instanced_shader_.InvalidateGeometry();
+    simple_instanced_shader_.InvalidateGeometry();
+    return true;
+}
+
+bool InstancedGeometryPickingRenderer::Render(const RenderOption &option,
+                                              const ViewControl &view) {
+    if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
+    return picking_shader_.Render(*geometry_ptr_, option, view);
+}
+
+bool InstancedGeometryPickingRenderer::AddGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    if (geometry_ptr->GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedGeometry) {
+        return false;
+    }
+    geometry_ptr_ = geometry_ptr;
+    return UpdateGeometry();
+}
+
+bool InstancedGeometryPickingRenderer::UpdateGeometry() {
+    picking_shader_.InvalidateGeometry();
+    return true;
+}
+
 bool VoxelGridRenderer::Render(const RenderOption &option,
                                const ViewControl &view) {
     if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
     if (option.mesh_show_wireframe_) {
-        return simple_shader_for_voxel_grid_line_.Render(*geometry_ptr_, option,
-                                                         view);
+        return voxel_shader_for_voxel_grid_line_.Render(*geometry_ptr_, option,
+                                                        view);
     } else {
-        return simple_shader_for_voxel_grid_face_.Render(*geometry_ptr_, option,
-                                                         view);
+        if (option.voxel_cull_hidden_faces_ != voxel_cull_hidden_faces_) {
+            voxel_shader_for_voxel_grid_face_.InvalidateGeometry();
+            voxel_cull_hidden_faces_ = option.voxel_cull_hidden_faces_;
+        }
+        return voxel_shader_for_voxel_grid_face_.Render(*geometry_ptr_, option,
+                                                        view);
     }
 }
 
@@ -124,8 +272,8 @@ bool VoxelGridRenderer::AddGeometry(
 }
 
 bool VoxelGridRenderer::UpdateGeometry() {
-    simple_shader_for_voxel_grid_line_.InvalidateGeometry();
-    simple_shader_for_voxel_grid_face_.InvalidateGeometry();
+    voxel_shader_for_voxel_grid_line_.InvalidateGeometry();
+    voxel_shader_for_voxel_grid_face_.InvalidateGeometry();
     return true;
 }
 
@@ -133,13 +281,13 @@ bool OctreeRenderer::Render(const RenderOption &option,
                             const ViewControl &view) {
     if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
     if (option.mesh_show_wireframe_) {
-        return simple_shader_for_octree_line_.Render(*geometry_ptr_, option,
-                                                     view);
-    } else {
-        bool rc = simple_shader_for_octree_face_.Render(*geometry_ptr_, option,
-                                                        view);
-        rc &= simple_shader_for_octree_line_.Render(*geometry_ptr_, option,
+        return voxel_shader_for_octree_line_.Render(*geometry_ptr_, option,
                                                     view);
+    } else {
+        bool rc = voxel_shader_for_octree_face_.Render(*geometry_ptr_, option,
+                                                       view);
+        rc &= voxel_shader_for_octree_line_.Render(*geometry_ptr_, option,
+                                                   view);
         return rc;
     }
 }
@@ -155,8 +303,8 @@ bool OctreeRenderer::AddGeometry(
 }
 
 bool OctreeRenderer::UpdateGeometry() {
-    simple_shader_for_octree_line_.InvalidateGeometry();
-    simple_shader_for_octree_face_.InvalidateGeometry();
+    voxel_shader_for_octree_line_.InvalidateGeometry();
+    voxel_shader_for_octree_face_.InvalidateGeometry();
     return true;
 }
 
@@ -298,6 +446,37 @@ bool TriangleMeshRenderer::UpdateGeometry() {
     return true;
 }
 
+bool TriangleMeshFRenderer::Render(const RenderOption &option,
+                                   const ViewControl &view) {
+    if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
+    const auto &mesh = (const geometry::TriangleMeshF &)(*geometry_ptr_);
+    if (mesh.HasTriangleNormals() && mesh.HasVertexNormals()) {
+        if (option.mesh_color_option_ ==
+            RenderOption::MeshColorOption::Normal) {
+            return normal_mesh_shader_.Render(mesh, option, view);
+        }
+        return phong_mesh_shader_.Render(mesh, option, view);
+    }
+    return simple_mesh_shader_.Render(mesh, option, view);
+}
+
+bool TriangleMeshFRenderer::AddGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    if (geometry_ptr->GetGeometryType() !=
+        geometry::Geometry::GeometryType::TriangleMeshF) {
+        return false;
+    }
+    geometry_ptr_ = geometry_ptr;
+    return UpdateGeometry();
+}
+
+bool TriangleMeshFRenderer::UpdateGeometry() {
+    simple_mesh_shader_.InvalidateGeometry();
+    phong_mesh_shader_.InvalidateGeometry();
+    normal_mesh_shader_.InvalidateGeometry();
+    return true;
+}
+
 bool ImageRenderer::Render(const RenderOption &option,
                            const ViewControl &view) {
     if (is_visible_ == false || geometry_ptr_->IsEmpty()) return true;
@@ -29,6 +29,8 @@
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Visualization/Shader/ImageMaskShader.h"
 #include "Open3D/Visualization/Shader/ImageShader.h"
+#include "Open3D/Visualization/Shader/InstancedShader.h"
+#include "Open3D/Visualization/Shader/LODShader.h"
 #include "Open3D/Visualization/Shader/NormalShader.h"
 #include "Open3D/Visualization/Shader/PhongShader.h"
 #include "Open3D/Visualization/Shader/PickingShader.h"
@@ -36,8 +38,10 @@
 #include "Open3D/Visualization/Shader/Simple2DShader.h"
 #include "Open3D/Visualization/Shader/SimpleBlackShader.h"
 #include "Open3D/Visualization/Shader/SimpleShader.h"
+#include "Open3D/Visualization/Shader/StreamShader.h"
 #include "Open3D/Visualization/Shader/TexturePhongShader.h"
 #include "Open3D/Visualization/Shader/TextureSimpleShader.h"
+#include "Open3D/Visualization/Shader/VoxelShader.h"
 
 namespace open3d {
 namespace visualization {
@@ -65,6 +69,15 @@ public:
     /// Programmer must call this function to notify a change of the geometry
     virtual bool UpdateGeometry() = 0;
 
+    /// Function to notify that elements have been appended to the geometry
+    /// since the last update, so that only those need to be uploaded.
+    /// If \p window_size is positive, only the window_size most recently
+    /// appended elements are drawn. Renderers that do not support appending
+    /// update the whole geometry.
+    virtual bool UpdateGeometryAppended(int window_size) {
+        return UpdateGeometry();
+    }
+
     bool HasGeometry() const { return bool(geometry_ptr_); }
     std::shared_ptr<const geometry::Geometry> GetGeometry() const {
         return geometry_ptr_;
@@ -78,6 +91,11 @@ public:
     bool IsVisible() const { return is_visible_; }
     void SetVisible(bool visible) { is_visible_ = visible; };
 
+    /// Function to check if the last Render() call left work pending, e.g.
+    /// level-of-detail chunks not yet uploaded, so that another frame should
+    /// be rendered even if nothing else changed.
+    virtual bool IsRenderPending() const { return false; }
+
 protected:
     std::shared_ptr<const geometry::Geometry> geometry_ptr_;
     bool is_visible_ = true;
@@ -92,12 +110,39 @@ public:
     bool AddGeometry(
             std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
     bool UpdateGeometry() override;
+    bool UpdateGeometryAppended(int window_size) override;
+    bool IsRenderPending() const override;
 
 protected:
     SimpleShaderForPointCloud simple_point_shader_;
     PhongShaderForPointCloud phong_point_shader_;
     NormalShaderForPointCloud normal_point_shader_;
     SimpleBlackShaderForPointCloudNormal simpleblack_normal_shader_;
+    SimpleShaderForPointCloudLOD simple_lod_shader_;
+    PhongShaderForPointCloudLOD phong_lod_shader_;
+    SimpleShaderForPointCloudStream simple_stream_shader_;
+    PhongShaderForPointCloudStream phong_stream_shader_;
+    /// Set once points are appended with UpdateGeometryAppended(), after
+    /// which the cloud is drawn with the stream shaders.
+    bool is_streamed_ = false;
+};
+
+/// Renders a PointCloudF. Single-precision clouds skip the LOD and stream
+/// paths of PointCloudRenderer and only use the point shaders.
+class PointCloudFRenderer : public GeometryRenderer {
+public:
+    ~PointCloudFRenderer() override {}
+
+public:
+    bool Render(const RenderOption &option, const ViewControl &view) override;
+    bool AddGeometry(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
+    bool UpdateGeometry() override;
+
+protected:
+    SimpleShaderForPointCloud simple_point_shader_;
+    PhongShaderForPointCloud phong_point_shader_;
+    NormalShaderForPointCloud normal_point_shader_;
 };
 
 class PointCloudPickingRenderer : public GeometryRenderer {
@@ -190,6 +235,53 @@ protected:
     SimpleBlackShaderForTriangleMeshWireFrame simpleblack_wireframe_shader_;
 };
 
+/// Renders a TriangleMeshF. Single-precision meshes carry no textures, so
+/// only the untextured mesh shaders are used.
+class TriangleMeshFRenderer : public GeometryRenderer {
+public:
+    ~TriangleMeshFRenderer() override {}
+
+public:
+    bool Render(const RenderOption &option, const ViewControl &view) override;
+    bool AddGeometry(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
+    bool UpdateGeometry() override;
+
+protected:
+    SimpleShaderForTriangleMesh simple_mesh_shader_;
+    PhongShaderForTriangleMesh phong_mesh_shader_;
+    NormalShaderForTriangleMesh normal_mesh_shader_;
+};
+
+class InstancedGeometryRenderer : public GeometryRenderer {
+public:
+    ~InstancedGeometryRenderer() override {}
+
+public:
+    bool Render(const RenderOption &option, const ViewControl &view) override;
+    bool AddGeometry(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
+    bool UpdateGeometry() override;
+
+protected:
+    PhongShaderForInstancedGeometry phong_instanced_shader_;
+    SimpleShaderForInstancedGeometry simple_instanced_shader_;
+};
+
+class InstancedGeometryPickingRenderer : public GeometryRenderer {
+public:
+    ~InstancedGeometryPickingRenderer() override {}
+
+public:
+    bool Render(const RenderOption &option, const ViewControl &view) override;
+    bool AddGeometry(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr) override;
+    bool UpdateGeometry() override;
+
+protected:
+    PickingShaderForInstancedGeometry picking_shader_;
+};
+
 class VoxelGridRenderer : public GeometryRenderer {
 public:
     ~VoxelGridRenderer() override {}
@@ -201,8 +293,11 @@ public:
     bool UpdateGeometry() override;
 
 protected:
-    SimpleShaderForVoxelGridLine simple_shader_for_voxel_grid_line_;
-    SimpleShaderForVoxelGridFace simple_shader_for_voxel_grid_face_;
+    VoxelShaderForVoxelGridLine voxel_shader_for_voxel_grid_line_;
+    VoxelShaderForVoxelGridFace voxel_shader_for_voxel_grid_face_;
+    /// RenderOption::voxel_cull_hidden_faces_ of the last rendered frame. The
+    /// faces are bound again when the option changes.
+    bool voxel_cull_hidden_faces_ = true;
 };
 
 class OctreeRenderer : public GeometryRenderer {
@@ -216,8 +311,8 @@ public:
     bool UpdateGeometry() override;
 
 protected:
-    SimpleShaderForOctreeLine simple_shader_for_octree_line_;
-    SimpleShaderForOctreeFace simple_shader_for_octree_face_;
+    VoxelShaderForOctreeLine voxel_shader_for_octree_line_;
+    VoxelShaderForOctreeFace voxel_shader_for_octree_face_;
 };
 
 class ImageRenderer : public GeometryRenderer {
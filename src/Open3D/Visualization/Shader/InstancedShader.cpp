@@ -0,0 +1,497 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Shader/InstancedShader.h"
+
+#include "Open3D/Geometry/InstancedGeometry.h"
+#include "Open3D/Geometry/LineSet.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Visualization/Shader/Shader.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+bool InstancedShader::BindGeometry(const geometry::Geometry &geometry,
+                                   const RenderOption &option,
+                                   const ViewControl &view) {
+    // If there is already geometry, we first unbind it.
+    // The instance buffers are rebuilt together with the base geometry. If
+    // only the instances change per frame, this could be replaced with buffer
+    // streaming of the instance buffers.
+    UnbindGeometry();
+
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedGeometry) {
+        PrintShaderWarning(
+                "Rendering type is not geometry::InstancedGeometry.");
+        return false;
+    }
+    const geometry::InstancedGeometry &instanced =
+            (const geometry::InstancedGeometry &)geometry;
+    if (instanced.IsEmpty()) {
+        PrintShaderWarning("Binding failed with empty instanced geometry.");
+        return false;
+    }
+
+    // Prepare data to be passed to GPU
+    std::vector<Eigen::Vector3f> points;
+    std::vector<Eigen::Vector3f> normals;
+    std::vector<Eigen::Vector3f> colors;
+    std::vector<GLuint> indices;
+    if (PrepareBinding(instanced, option, points, normals, colors, indices) ==
+        false) {
+        PrintShaderWarning("Binding failed when preparing data.");
+        return false;
+    }
+    std::vector<GLHelper::GLMatrix4f> transforms(instanced.transforms_.size());
+    for (size_t i = 0; i < instanced.transforms_.size(); i++) {
+        transforms[i] = instanced.transforms_[i].cast<GLfloat>();
+    }
+
+    // Create buffers and bind the geometry
+    glGenBuffers(1, &vertex_position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
+                 points.data(), GL_STATIC_DRAW);
+    has_vertex_normals_ = !normals.empty();
+    if (has_vertex_normals_) {
+        glGenBuffers(1, &vertex_normal_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
+        glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
+                     normals.data(), GL_STATIC_DRAW);
+    }
+    has_vertex_colors_ = !colors.empty();
+    if (has_vertex_colors_) {
+        glGenBuffers(1, &vertex_color_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+        glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
+                     colors.data(), GL_STATIC_DRAW);
+    }
+    BindElementBuffer(indices);
+    glGenBuffers(1, &instance_transform_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, instance_transform_buffer_);
+    glBufferData(GL_ARRAY_BUFFER,
+                 transforms.size() * sizeof(GLHelper::GLMatrix4f),
+                 transforms.data(), GL_STATIC_DRAW);
+    // Instance colors replace the vertex colors, so shaders that do not draw
+    // colors (such as the picking shader) skip them as well.
+    has_instance_colors_ = has_vertex_colors_ && instanced.HasColors();
+    if (has_instance_colors_) {
+        std::vector<Eigen::Vector3f> instance_colors(instanced.colors_.size());
+        for (size_t i = 0; i < instanced.colors_.size(); i++) {
+            instance_colors[i] = instanced.colors_[i].cast<float>();
+        }
+        glGenBuffers(1, &instance_color_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, instance_color_buffer_);
+        glBufferData(GL_ARRAY_BUFFER,
+                     instance_colors.size() * sizeof(Eigen::Vector3f),
+                     instance_colors.data(), GL_STATIC_DRAW);
+    }
+    instance_count_ = GLsizei(transforms.size());
+    bound_ = true;
+    return true;
+}
+
+void InstancedShader::UnbindGeometry() {
+    if (bound_) {
+        glDeleteBuffers(1, &vertex_position_buffer_);
+        if (has_vertex_normals_) {
+            glDeleteBuffers(1, &vertex_normal_buffer_);
+        }
+        if (has_vertex_colors_) {
+            glDeleteBuffers(1, &vertex_color_buffer_);
+        }
+        UnbindElementBuffer();
+        glDeleteBuffers(1, &instance_transform_buffer_);
+        if (has_instance_colors_) {
+            glDeleteBuffers(1, &instance_color_buffer_);
+        }
+        has_vertex_normals_ = false;
+        has_vertex_colors_ = false;
+        has_instance_colors_ = false;
+        instance_count_ = 0;
+        bound_ = false;
+    }
+}
+
+bool InstancedShader::PrepareBaseBinding(
+        const geometry::InstancedGeometry &instanced,
+        const RenderOption &option,
+        bool with_normals,
+        bool with_colors,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &normals,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    const geometry::Geometry &base = *instanced.base_geometry_;
+    if (base.GetGeometryType() == geometry::Geometry::GeometryType::LineSet) {
+        if (with_normals) {
+            PrintShaderWarning("Binding failed because lines have no normals.");
+            return false;
+        }
+        const geometry::LineSet &lineset = (const geometry::LineSet &)base;
+        points.resize(lineset.lines_.size() * 2);
+        if (with_colors) {
+            colors.resize(lineset.lines_.size() * 2);
+        }
+        for (size_t i = 0; i < lineset.lines_.size(); i++) {
+            const auto point_pair = lineset.GetLineCoordinate(i);
+            points[i * 2] = point_pair.first.cast<float>();
+            points[i * 2 + 1] = point_pair.second.cast<float>();
+            if (with_colors) {
+                Eigen::Vector3d color = lineset.HasColors()
+                                                ? lineset.colors_[i]
+                                                : Eigen::Vector3d::Zero();
+                colors[i * 2] = colors[i * 2 + 1] = color.cast<float>();
+            }
+        }
+        draw_arrays_mode_ = GL_LINES;
+        draw_arrays_size_ = GLsizei(points.size());
+        return true;
+    }
+
+    const geometry::TriangleMesh &mesh = (const geometry::TriangleMesh &)base;
+    if (mesh.HasTriangles() == false) {
+        PrintShaderWarning("Binding failed with empty triangle mesh.");
+        return false;
+    }
+    if (with_normals && (mesh.HasTriangleNormals() == false ||
+                         mesh.HasVertexNormals() == false)) {
+        PrintShaderWarning("Binding failed because mesh has no normals.");
+        PrintShaderWarning("Call ComputeVertexNormals() before binding.");
+        return false;
+    }
+    // Coordinate color maps are not meaningful in the frame of the base mesh,
+    // so the mesh is drawn with its vertex colors or the default color.
+    auto GetVertexColor = [&](size_t vi) -> Eigen::Vector3d {
+        if (option.mesh_color_option_ == RenderOption::MeshColorOption::Color &&
+            mesh.HasVertexColors()) {
+            return mesh.vertex_colors_[vi];
+        }
+        return option.default_mesh_color_;
+    };
+    if (with_normals &&
+        option.mesh_shade_option_ == RenderOption::MeshShadeOption::FlatShade) {
+        // Flat shading needs per-face normals, so the vertices are
+        // duplicated per triangle and drawn with glDrawArraysInstanced.
+        points.resize(mesh.triangles_.size() * 3);
+        normals.resize(mesh.triangles_.size() * 3);
+        if (with_colors) {
+            colors.resize(mesh.triangles_.size() * 3);
+        }
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            for (size_t j = 0; j < 3; j++) {
+                size_t idx = i * 3 + j;
+                size_t vi = triangle(j);
+                points[idx] = mesh.vertices_[vi].cast<float>();
+                normals[idx] = mesh.triangle_normals_[i].cast<float>();
+                if (with_colors) {
+                    colors[idx] = GetVertexColor(vi).cast<float>();
+                }
+            }
+        }
+    } else {
+        points.resize(mesh.vertices_.size());
+        if (with_normals) {
+            normals.resize(mesh.vertices_.size());
+        }
+        if (with_colors) {
+            colors.resize(mesh.vertices_.size());
+        }
+        for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+            points[i] = mesh.vertices_[i].cast<float>();
+            if (with_normals) {
+                normals[i] = mesh.vertex_normals_[i].cast<float>();
+            }
+            if (with_colors) {
+                colors[i] = GetVertexColor(i).cast<float>();
+            }
+        }
+        indices.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            indices[i * 3] = GLuint(triangle(0));
+            indices[i * 3 + 1] = GLuint(triangle(1));
+            indices[i * 3 + 2] = GLuint(triangle(2));
+        }
+    }
+    draw_arrays_mode_ = GL_TRIANGLES;
+    draw_arrays_size_ = GLsizei(points.size());
+    return true;
+}
+
+bool InstancedShader::PrepareBaseRendering(const geometry::Geometry &geometry,
+                                           const RenderOption &option) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::InstancedGeometry) {
+        PrintShaderWarning(
+                "Rendering type is not geometry::InstancedGeometry.");
+        return false;
+    }
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    if (draw_arrays_mode_ == GL_LINES) {
+        glLineWidth(GLfloat(option.line_width_));
+        return true;
+    }
+    if (option.mesh_show_back_face_) {
+        glDisable(GL_CULL_FACE);
+    } else {
+        glEnable(GL_CULL_FACE);
+    }
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    return true;
+}
+
+void InstancedShader::EnableVertexAttributes() {
+    glEnableVertexAttribArray(vertex_position_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    if (has_vertex_normals_) {
+        glEnableVertexAttribArray(vertex_normal_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
+        glVertexAttribPointer(vertex_normal_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    }
+    if (has_vertex_colors_) {
+        glEnableVertexAttribArray(vertex_color_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+        glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    }
+}
+
+void InstancedShader::DisableVertexAttributes() {
+    glDisableVertexAttribArray(vertex_position_);
+    if (has_vertex_normals_) {
+        glDisableVertexAttribArray(vertex_normal_);
+    }
+    if (has_vertex_colors_) {
+        glDisableVertexAttribArray(vertex_color_);
+    }
+}
+
+void InstancedShader::EnableInstanceAttributes() {
+    // A mat4 attribute occupies four consecutive locations, one per column.
+    glBindBuffer(GL_ARRAY_BUFFER, instance_transform_buffer_);
+    for (GLuint i = 0; i < 4; i++) {
+        glEnableVertexAttribArray(instance_transform_ + i);
+        glVertexAttribPointer(instance_transform_ + i, 4, GL_FLOAT, GL_FALSE,
+                              sizeof(GLHelper::GLMatrix4f),
+                              (const GLvoid *)(sizeof(GLfloat) * 4 * i));
+        glVertexAttribDivisor(instance_transform_ + i, 1);
+    }
+    if (has_instance_colors_) {
+        glEnableVertexAttribArray(instance_color_);
+        glBindBuffer(GL_ARRAY_BUFFER, instance_color_buffer_);
+        glVertexAttribPointer(instance_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        glVertexAttribDivisor(instance_color_, 1);
+    }
+}
+
+void InstancedShader::DisableInstanceAttributes() {
+    for (GLuint i = 0; i < 4; i++) {
+        glVertexAttribDivisor(instance_transform_ + i, 0);
+        glDisableVertexAttribArray(instance_transform_ + i);
+    }
+    if (has_instance_colors_) {
+        glVertexAttribDivisor(instance_color_, 0);
+        glDisableVertexAttribArray(instance_color_);
+    }
+}
+
+void InstancedShader::DrawInstances() {
+    if (element_buffer_bound_) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer_);
+        glDrawElementsInstanced(draw_arrays_mode_, draw_elements_size_,
+                                GL_UNSIGNED_INT, NULL, instance_count_);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    } else {
+        glDrawArraysInstanced(draw_arrays_mode_, 0, draw_arrays_size_,
+                              instance_count_);
+    }
+}
+
+bool PhongShaderForInstancedGeometry::Compile() {
+    if (CompileShaders(InstancedPhongVertexShader, NULL,
+                       PhongFragmentShader) == false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_normal_ = glGetAttribLocation(program_, "vertex_normal");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    instance_transform_ = glGetAttribLocation(program_, "instance_transform");
+    instance_color_ = glGetAttribLocation(program_, "instance_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    V_ = glGetUniformLocation(program_, "V");
+    M_ = glGetUniformLocation(program_, "M");
+    use_instance_color_ = glGetUniformLocation(program_, "use_instance_color");
+    lighting_.GetUniformLocations(program_);
+    return true;
+}
+
+void PhongShaderForInstancedGeometry::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool PhongShaderForInstancedGeometry::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareBaseRendering(geometry, option) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    lighting_.Update(view, option);
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glUniformMatrix4fv(V_, 1, GL_FALSE, view.GetViewMatrix().data());
+    glUniformMatrix4fv(M_, 1, GL_FALSE, view.GetModelMatrix().data());
+    glUniform1i(use_instance_color_, has_instance_colors_ ? 1 : 0);
+    lighting_.Upload();
+    EnableVertexAttributes();
+    EnableInstanceAttributes();
+    DrawInstances();
+    DisableInstanceAttributes();
+    DisableVertexAttributes();
+    return true;
+}
+
+bool PhongShaderForInstancedGeometry::PrepareBinding(
+        const geometry::InstancedGeometry &instanced,
+        const RenderOption &option,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &normals,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    return PrepareBaseBinding(instanced, option, true, true, points, normals,
+                              colors, indices);
+}
+
+bool SimpleShaderForInstancedGeometry::Compile() {
+    if (CompileShaders(InstancedSimpleVertexShader, NULL,
+                       SimpleFragmentShader) == false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    instance_transform_ = glGetAttribLocation(program_, "instance_transform");
+    instance_color_ = glGetAttribLocation(program_, "instance_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    use_instance_color_ = glGetUniformLocation(program_, "use_instance_color");
+    return true;
+}
+
+void SimpleShaderForInstancedGeometry::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool SimpleShaderForInstancedGeometry::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareBaseRendering(geometry, option) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glUniform1i(use_instance_color_, has_instance_colors_ ? 1 : 0);
+    EnableVertexAttributes();
+    EnableInstanceAttributes();
+    DrawInstances();
+    DisableInstanceAttributes();
+    DisableVertexAttributes();
+    return true;
+}
+
+bool SimpleShaderForInstancedGeometry::PrepareBinding(
+        const geometry::InstancedGeometry &instanced,
+        const RenderOption &option,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &normals,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    return PrepareBaseBinding(instanced, option, false, true, points, normals,
+                              colors, indices);
+}
+
+bool PickingShaderForInstancedGeometry::Compile() {
+    if (CompileShaders(InstancedPickingVertexShader, NULL,
+                       PickingFragmentShader) == false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    instance_transform_ = glGetAttribLocation(program_, "instance_transform");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void PickingShaderForInstancedGeometry::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool PickingShaderForInstancedGeometry::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareBaseRendering(geometry, option) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    EnableVertexAttributes();
+    EnableInstanceAttributes();
+    DrawInstances();
+    DisableInstanceAttributes();
+    DisableVertexAttributes();
+    return true;
+}
+
+bool PickingShaderForInstancedGeometry::PrepareBinding(
+        const geometry::InstancedGeometry &instanced,
+        const RenderOption &option,
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<Eigen::Vector3f> &normals,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    return PrepareBaseBinding(instanced, option, false, false, points, normals,
+                              colors, indices);
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
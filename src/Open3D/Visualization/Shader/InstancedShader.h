@@ -0,0 +1,188 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "Open3D/Visualization/Shader/PhongShader.h"
+#include "Open3D/Visualization/Shader/ShaderWrapper.h"
+
+namespace open3d {
+
+namespace geometry {
+class InstancedGeometry;
+}  // namespace geometry
+
+namespace visualization {
+
+namespace glsl {
+
+/// Base class of the shaders for geometry::InstancedGeometry.
+/// The base geometry is uploaded once, and the instance transforms and colors
+/// are uploaded as vertex attributes with a divisor of 1, so that all
+/// instances are drawn with a single glDrawArraysInstanced or
+/// glDrawElementsInstanced call.
+class InstancedShader : public ShaderWrapper {
+public:
+    ~InstancedShader() override {}
+
+protected:
+    InstancedShader(const std::string &name) : ShaderWrapper(name) {}
+
+protected:
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    virtual bool PrepareBinding(const geometry::InstancedGeometry &instanced,
+                                const RenderOption &option,
+                                std::vector<Eigen::Vector3f> &points,
+                                std::vector<Eigen::Vector3f> &normals,
+                                std::vector<Eigen::Vector3f> &colors,
+                                std::vector<GLuint> &indices) = 0;
+
+protected:
+    /// Fills the per-vertex data of the base geometry. Normals are only
+    /// filled if \p with_normals is true, colors only if \p with_colors is
+    /// true.
+    bool PrepareBaseBinding(const geometry::InstancedGeometry &instanced,
+                            const RenderOption &option,
+                            bool with_normals,
+                            bool with_colors,
+                            std::vector<Eigen::Vector3f> &points,
+                            std::vector<Eigen::Vector3f> &normals,
+                            std::vector<Eigen::Vector3f> &colors,
+                            std::vector<GLuint> &indices);
+    /// Sets the GL state for drawing the base geometry.
+    bool PrepareBaseRendering(const geometry::Geometry &geometry,
+                              const RenderOption &option);
+    void EnableVertexAttributes();
+    void DisableVertexAttributes();
+    /// The divisor is part of the VAO state shared with the other shaders, so
+    /// it is reset when the attributes are disabled.
+    void EnableInstanceAttributes();
+    void DisableInstanceAttributes();
+    void DrawInstances();
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_position_buffer_;
+    GLuint vertex_normal_;
+    GLuint vertex_normal_buffer_;
+    GLuint vertex_color_;
+    GLuint vertex_color_buffer_;
+    GLuint instance_transform_;
+    GLuint instance_transform_buffer_;
+    GLuint instance_color_;
+    GLuint instance_color_buffer_;
+    GLuint MVP_;
+    GLuint use_instance_color_;
+    bool has_vertex_normals_ = false;
+    bool has_vertex_colors_ = false;
+    bool has_instance_colors_ = false;
+    GLsizei instance_count_ = 0;
+};
+
+class PhongShaderForInstancedGeometry : public InstancedShader {
+public:
+    PhongShaderForInstancedGeometry()
+        : InstancedShader("PhongShaderForInstancedGeometry") {
+        Compile();
+    }
+    ~PhongShaderForInstancedGeometry() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    bool PrepareBinding(const geometry::InstancedGeometry &instanced,
+                        const RenderOption &option,
+                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &normals,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
+
+protected:
+    GLuint V_;
+    GLuint M_;
+    PhongLighting lighting_;
+};
+
+class SimpleShaderForInstancedGeometry : public InstancedShader {
+public:
+    SimpleShaderForInstancedGeometry()
+        : InstancedShader("SimpleShaderForInstancedGeometry") {
+        Compile();
+    }
+    ~SimpleShaderForInstancedGeometry() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    bool PrepareBinding(const geometry::InstancedGeometry &instanced,
+                        const RenderOption &option,
+                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &normals,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
+};
+
+/// Renders the instance index of every pixel, encoded as in PickingShader.
+class PickingShaderForInstancedGeometry : public InstancedShader {
+public:
+    PickingShaderForInstancedGeometry()
+        : InstancedShader("PickingShaderForInstancedGeometry") {
+        Compile();
+    }
+    ~PickingShaderForInstancedGeometry() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    bool PrepareBinding(const geometry::InstancedGeometry &instanced,
+                        const RenderOption &option,
+                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<Eigen::Vector3f> &normals,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
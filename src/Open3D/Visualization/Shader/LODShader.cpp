@@ -0,0 +1,523 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Shader/LODShader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Visualization/Shader/Shader.h"
+#include "Open3D/Visualization/Utility/ColorMap.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+namespace {
+
+// Nodes with at most this many points are not subdivided further.
+const int kLeafCapacity = 32768;
+// Every inner node keeps at most one point per cell of a grid with this
+// resolution along each axis.
+const int kNodeGridResolution = 32;
+const int kMaxDepth = 16;
+// Upper bound of points uploaded to the GPU per frame.
+const int kMaxUploadPointsPerFrame = 1 << 20;
+// Chunks are evicted once more than this multiple of the point budget is
+// resident on the GPU.
+const int kMaxResidentBudgetFactor = 4;
+
+}  // unnamed namespace
+
+bool LODShader::BindGeometry(const geometry::Geometry &geometry,
+                             const RenderOption &option,
+                             const ViewControl &view) {
+    UnbindGeometry();
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    if (pointcloud.HasPoints() == false) {
+        PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+    if (with_normals_ && pointcloud.HasNormals() == false) {
+        PrintShaderWarning("Binding failed with pointcloud with no normals.");
+        return false;
+    }
+
+    // Only the hierarchy is built here, chunk buffers are uploaded on demand
+    // in RenderGeometry().
+    const int num_points = int(pointcloud.points_.size());
+    point_order_.resize(num_points);
+    for (int i = 0; i < num_points; i++) {
+        point_order_[i] = i;
+    }
+    point_order_buffer_.resize(num_points);
+    const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+    const Eigen::Vector3d max_bound = pointcloud.GetMaxBound();
+    Node root;
+    root.center_ = ((min_bound + max_bound) * 0.5).cast<float>();
+    root.half_size_ = float((max_bound - min_bound).maxCoeff() * 0.5) *
+                              (1.0f + 1e-4f) +
+                      1e-6f;
+    nodes_.push_back(root);
+    BuildNode(0, 0, num_points, 0, pointcloud.points_);
+    point_order_buffer_.clear();
+    point_order_buffer_.shrink_to_fit();
+
+    resident_points_ = 0;
+    frame_index_ = 0;
+    color_option_ = int(option.point_color_option_);
+    bound_ = true;
+    return true;
+}
+
+void LODShader::BuildNode(int node_index,
+                          int begin,
+                          int end,
+                          int depth,
+                          const std::vector<Eigen::Vector3d> &points) {
+    nodes_[node_index].begin_ = begin;
+    nodes_[node_index].end_ = end;
+    std::fill(nodes_[node_index].children_, nodes_[node_index].children_ + 8,
+              -1);
+    if (end - begin <= kLeafCapacity || depth >= kMaxDepth) {
+        return;
+    }
+    const Eigen::Vector3f center = nodes_[node_index].center_;
+    const float half_size = nodes_[node_index].half_size_;
+    const Eigen::Vector3f origin =
+            center - Eigen::Vector3f::Constant(half_size);
+    const float cell_size = 2.0f * half_size / kNodeGridResolution;
+
+    // Keep the first point of every occupied grid cell in this node, and
+    // bucket the remaining points by octant (counting sort).
+    std::vector<bool> occupied(kNodeGridResolution * kNodeGridResolution *
+                                       kNodeGridResolution,
+                               false);
+    std::vector<int> octants(end - begin);
+    int child_count[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    int num_kept = 0;
+    for (int i = begin; i < end; i++) {
+        const Eigen::Vector3f p = points[point_order_[i]].cast<float>();
+        Eigen::Vector3i cell = ((p - origin) / cell_size).cast<int>();
+        cell = cell.cwiseMax(0).cwiseMin(kNodeGridResolution - 1);
+        int key = (cell(0) * kNodeGridResolution + cell(1)) *
+                          kNodeGridResolution +
+                  cell(2);
+        if (occupied[key] == false) {
+            occupied[key] = true;
+            octants[i - begin] = -1;
+            num_kept++;
+        } else {
+            int octant = (p(0) >= center(0) ? 1 : 0) |
+                         (p(1) >= center(1) ? 2 : 0) |
+                         (p(2) >= center(2) ? 4 : 0);
+            octants[i - begin] = octant;
+            child_count[octant]++;
+        }
+    }
+    int offsets[9];
+    offsets[0] = begin + num_kept;
+    for (int c = 0; c < 8; c++) {
+        offsets[c + 1] = offsets[c] + child_count[c];
+    }
+    int kept_offset = begin;
+    int write_offsets[8];
+    std::copy(offsets, offsets + 8, write_offsets);
+    for (int i = begin; i < end; i++) {
+        int octant = octants[i - begin];
+        if (octant < 0) {
+            point_order_buffer_[kept_offset++] = point_order_[i];
+        } else {
+            point_order_buffer_[write_offsets[octant]++] = point_order_[i];
+        }
+    }
+    std::copy(point_order_buffer_.begin() + begin,
+              point_order_buffer_.begin() + end, point_order_.begin() + begin);
+    nodes_[node_index].end_ = begin + num_kept;
+    octants.clear();
+    octants.shrink_to_fit();
+
+    for (int c = 0; c < 8; c++) {
+        if (child_count[c] == 0) {
+            continue;
+        }
+        Node child;
+        child.half_size_ = half_size * 0.5f;
+        child.center_ = center + Eigen::Vector3f((c & 1) ? child.half_size_
+                                                         : -child.half_size_,
+                                                 (c & 2) ? child.half_size_
+                                                         : -child.half_size_,
+                                                 (c & 4) ? child.half_size_
+                                                         : -child.half_size_);
+        int child_index = int(nodes_.size());
+        nodes_[node_index].children_[c] = child_index;
+        nodes_.push_back(child);
+        BuildNode(child_index, offsets[c], offsets[c + 1], depth + 1, points);
+    }
+}
+
+bool LODShader::IsNodeVisible(const Node &node,
+                              const GLHelper::GLMatrix4f &mvp) const {
+    // A node is culled if all 8 corners lie outside the same clip plane.
+    int outside[6] = {0, 0, 0, 0, 0, 0};
+    const float h = node.half_size_;
+    for (int i = 0; i < 8; i++) {
+        Eigen::Vector4f corner;
+        corner << node.center_(0) + ((i & 1) ? h : -h),
+                node.center_(1) + ((i & 2) ? h : -h),
+                node.center_(2) + ((i & 4) ? h : -h), 1.0f;
+        Eigen::Vector4f clip = mvp * corner;
+        outside[0] += clip(0) < -clip(3) ? 1 : 0;
+        outside[1] += clip(0) > clip(3) ? 1 : 0;
+        outside[2] += clip(1) < -clip(3) ? 1 : 0;
+        outside[3] += clip(1) > clip(3) ? 1 : 0;
+        outside[4] += clip(2) < -clip(3) ? 1 : 0;
+        outside[5] += clip(2) > clip(3) ? 1 : 0;
+    }
+    for (int i = 0; i < 6; i++) {
+        if (outside[i] == 8) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float LODShader::GetNodePixelSize(const Node &node,
+                                  const ViewControl &view) const {
+    // Projected diameter of the bounding sphere of the node, in pixels.
+    const float radius = node.half_size_ * std::sqrt(3.0f);
+    Eigen::Vector4f center;
+    center << node.center_, 1.0f;
+    const float w = (view.GetMVPMatrix() * center)(3);
+    if (w <= radius) {
+        // The camera is inside or very close to the node.
+        return std::numeric_limits<float>::max();
+    }
+    return radius * view.GetProjectionMatrix()(1, 1) *
+           float(view.GetWindowHeight()) / w;
+}
+
+void LODShader::UploadNode(Node &node,
+                           const geometry::Geometry &geometry,
+                           const RenderOption &option,
+                           const ViewControl &view) {
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    const int count = node.end_ - node.begin_;
+    std::vector<Eigen::Vector3f> points(count);
+    std::vector<Eigen::Vector3f> normals(with_normals_ ? count : 0);
+    std::vector<Eigen::Vector3f> colors(count);
+    for (int i = 0; i < count; i++) {
+        const int pi = point_order_[node.begin_ + i];
+        const auto &point = pointcloud.points_[pi];
+        points[i] = point.cast<float>();
+        if (with_normals_) {
+            normals[i] = pointcloud.normals_[pi].cast<float>();
+        }
+        Eigen::Vector3d color;
+        switch (option.point_color_option_) {
+            case RenderOption::PointColorOption::XCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetXPercentage(point(0)));
+                break;
+            case RenderOption::PointColorOption::YCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetYPercentage(point(1)));
+                break;
+            case RenderOption::PointColorOption::ZCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(point(2)));
+                break;
+            case RenderOption::PointColorOption::Normal:
+                if (pointcloud.HasNormals()) {
+                    color = pointcloud.normals_[pi] * 0.5 +
+                            Eigen::Vector3d::Constant(0.5);
+                    break;
+                }
+            case RenderOption::PointColorOption::Color:
+            case RenderOption::PointColorOption::Default:
+            default:
+                if (pointcloud.HasColors()) {
+                    color = pointcloud.colors_[pi];
+                } else {
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetZPercentage(point(2)));
+                }
+                break;
+        }
+        colors[i] = color.cast<float>();
+    }
+    glGenBuffers(1, &node.position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, node.position_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
+                 points.data(), GL_STATIC_DRAW);
+    if (with_normals_) {
+        glGenBuffers(1, &node.normal_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, node.normal_buffer_);
+        glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
+                     normals.data(), GL_STATIC_DRAW);
+    }
+    glGenBuffers(1, &node.color_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, node.color_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
+                 colors.data(), GL_STATIC_DRAW);
+    node.resident_ = true;
+    resident_points_ += count;
+}
+
+void LODShader::ReleaseNode(Node &node) {
+    if (node.resident_) {
+        glDeleteBuffers(1, &node.position_buffer_);
+        if (with_normals_) {
+            glDeleteBuffers(1, &node.normal_buffer_);
+        }
+        glDeleteBuffers(1, &node.color_buffer_);
+        node.resident_ = false;
+        resident_points_ -= node.end_ - node.begin_;
+    }
+}
+
+void LODShader::EvictNodes(int64_t max_resident_points) {
+    if (resident_points_ <= max_resident_points) {
+        return;
+    }
+    std::vector<int> resident;
+    for (int i = 0; i < int(nodes_.size()); i++) {
+        if (nodes_[i].resident_ && nodes_[i].last_used_frame_ < frame_index_) {
+            resident.push_back(i);
+        }
+    }
+    std::sort(resident.begin(), resident.end(), [this](int a, int b) {
+        return nodes_[a].last_used_frame_ < nodes_[b].last_used_frame_;
+    });
+    for (int i : resident) {
+        if (resident_points_ <= max_resident_points) {
+            break;
+        }
+        ReleaseNode(nodes_[i]);
+    }
+}
+
+bool LODShader::PrepareLODRendering(const geometry::Geometry &geometry,
+                                    const RenderOption &option,
+                                    const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    if (color_option_ != int(option.point_color_option_)) {
+        // Colors are baked into the chunk buffers.
+        for (auto &node : nodes_) {
+            ReleaseNode(node);
+        }
+        color_option_ = int(option.point_color_option_);
+    }
+    glPointSize(GLfloat(option.point_size_));
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+
+    // Select nodes by decreasing projected size within the point budget.
+    // A node is refined while its grid spacing projects to more than a pixel.
+    const GLHelper::GLMatrix4f mvp = view.GetMVPMatrix();
+    const int point_budget = std::max(option.point_budget_, 1);
+    typedef std::pair<float, int> Candidate;
+    std::priority_queue<Candidate> candidates;
+    selected_nodes_.clear();
+    int num_selected_points = 0;
+    int num_uploaded_points = 0;
+    is_streaming_ = false;
+    if (IsNodeVisible(nodes_[0], mvp)) {
+        candidates.push(Candidate(GetNodePixelSize(nodes_[0], view), 0));
+    }
+    while (!candidates.empty()) {
+        const Candidate candidate = candidates.top();
+        candidates.pop();
+        Node &node = nodes_[candidate.second];
+        const int count = node.end_ - node.begin_;
+        // The root is drawn whatever the budget, so that a budget below its
+        // point count still shows the coarsest level instead of nothing.
+        if (candidate.second != 0 &&
+            num_selected_points + count > point_budget) {
+            continue;
+        }
+        if (node.resident_ == false) {
+            if (num_uploaded_points + count > kMaxUploadPointsPerFrame &&
+                num_uploaded_points > 0) {
+                is_streaming_ = true;
+                continue;
+            }
+            UploadNode(node, geometry, option, view);
+            num_uploaded_points += count;
+        }
+        node.last_used_frame_ = frame_index_;
+        selected_nodes_.push_back(candidate.second);
+        num_selected_points += count;
+        if (candidate.first <= float(kNodeGridResolution)) {
+            continue;
+        }
+        for (int c = 0; c < 8; c++) {
+            int child_index = node.children_[c];
+            if (child_index >= 0 && IsNodeVisible(nodes_[child_index], mvp)) {
+                candidates.push(Candidate(
+                        GetNodePixelSize(nodes_[child_index], view),
+                        child_index));
+            }
+        }
+    }
+
+    return true;
+}
+
+void LODShader::DrawSelectedNodes(const RenderOption &option) {
+    glEnableVertexAttribArray(vertex_position_);
+    if (with_normals_) {
+        glEnableVertexAttribArray(vertex_normal_);
+    }
+    glEnableVertexAttribArray(vertex_color_);
+    for (int node_index : selected_nodes_) {
+        const Node &node = nodes_[node_index];
+        glBindBuffer(GL_ARRAY_BUFFER, node.position_buffer_);
+        glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0,
+                              NULL);
+        if (with_normals_) {
+            glBindBuffer(GL_ARRAY_BUFFER, node.normal_buffer_);
+            glVertexAttribPointer(vertex_normal_, 3, GL_FLOAT, GL_FALSE, 0,
+                                  NULL);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, node.color_buffer_);
+        glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+        glDrawArrays(GL_POINTS, 0, node.end_ - node.begin_);
+    }
+    glDisableVertexAttribArray(vertex_position_);
+    if (with_normals_) {
+        glDisableVertexAttribArray(vertex_normal_);
+    }
+    glDisableVertexAttribArray(vertex_color_);
+
+    EvictNodes(int64_t(kMaxResidentBudgetFactor) *
+               std::max(option.point_budget_, 1));
+    frame_index_++;
+}
+
+void LODShader::UnbindGeometry() {
+    if (bound_) {
+        for (auto &node : nodes_) {
+            ReleaseNode(node);
+        }
+        nodes_.clear();
+        selected_nodes_.clear();
+        point_order_.clear();
+        point_order_.shrink_to_fit();
+        is_streaming_ = false;
+        bound_ = false;
+    }
+}
+
+bool SimpleShaderForPointCloudLOD::Compile() {
+    if (CompileShaders(SimpleVertexShader, NULL, SimpleFragmentShader) ==
+        false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void SimpleShaderForPointCloudLOD::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool SimpleShaderForPointCloudLOD::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareLODRendering(geometry, option, view) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    DrawSelectedNodes(option);
+    return true;
+}
+
+bool PhongShaderForPointCloudLOD::Compile() {
+    if (CompileShaders(PhongVertexShader, NULL, PhongFragmentShader) == false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_normal_ = glGetAttribLocation(program_, "vertex_normal");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    V_ = glGetUniformLocation(program_, "V");
+    M_ = glGetUniformLocation(program_, "M");
+    lighting_.GetUniformLocations(program_);
+    return true;
+}
+
+void PhongShaderForPointCloudLOD::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool PhongShaderForPointCloudLOD::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareLODRendering(geometry, option, view) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    lighting_.Update(view, option);
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glUniformMatrix4fv(V_, 1, GL_FALSE, view.GetViewMatrix().data());
+    glUniformMatrix4fv(M_, 1, GL_FALSE, view.GetModelMatrix().data());
+    lighting_.Upload();
+    DrawSelectedNodes(option);
+    return true;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+#include "Open3D/Visualization/Shader/PhongShader.h"
+#include "Open3D/Visualization/Shader/ShaderWrapper.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// Base class of the level-of-detail shaders for large point clouds.
+/// When binding, the point cloud is partitioned into an octree of chunks.
+/// Every node keeps a grid-subsampled part of the points in its cell, so that
+/// a node together with its ancestors is a progressively denser sample of the
+/// cloud. Each frame, nodes are selected front-to-back by projected size from
+/// the MVP matrix of the ViewControl, skipping nodes outside the view frustum,
+/// until RenderOption::point_budget_ is reached. The root node is always
+/// drawn, even if it holds more points than the budget. Chunk buffers are
+/// uploaded lazily, at most a fixed number of points per frame, and the least
+/// recently used chunks are released when GPU residency exceeds a multiple of
+/// the budget.
+class LODShader : public ShaderWrapper {
+public:
+    ~LODShader() override {}
+
+public:
+    /// Returns true if the last rendered frame skipped chunks that were not
+    /// yet uploaded, i.e. another frame is needed to complete the view.
+    bool IsStreaming() const { return is_streaming_; }
+
+protected:
+    LODShader(const std::string &name, bool with_normals)
+        : ShaderWrapper(name), with_normals_(with_normals) {}
+
+protected:
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    /// Selects the nodes to draw in this frame, uploads the missing ones, and
+    /// sets the GL state for drawing points.
+    bool PrepareLODRendering(const geometry::Geometry &geometry,
+                             const RenderOption &option,
+                             const ViewControl &view);
+    /// Draws the selected nodes with the program in use, then releases
+    /// chunks beyond the residency limit.
+    void DrawSelectedNodes(const RenderOption &option);
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_normal_;
+    GLuint vertex_color_;
+    GLuint MVP_;
+
+private:
+    struct Node {
+        Eigen::Vector3f center_;
+        float half_size_;
+        /// Range [begin_, end_) in point_order_ of the points of this node.
+        int begin_;
+        int end_;
+        int children_[8];
+        bool resident_ = false;
+        GLuint position_buffer_;
+        GLuint normal_buffer_;
+        GLuint color_buffer_;
+        int last_used_frame_ = -1;
+    };
+
+    void BuildNode(int node_index,
+                   int begin,
+                   int end,
+                   int depth,
+                   const std::vector<Eigen::Vector3d> &points);
+    bool IsNodeVisible(const Node &node,
+                       const GLHelper::GLMatrix4f &mvp) const;
+    float GetNodePixelSize(const Node &node, const ViewControl &view) const;
+    void UploadNode(Node &node,
+                    const geometry::Geometry &geometry,
+                    const RenderOption &option,
+                    const ViewControl &view);
+    void ReleaseNode(Node &node);
+    void EvictNodes(int64_t max_resident_points);
+
+private:
+    bool with_normals_;
+    std::vector<Node> nodes_;
+    std::vector<int> point_order_;
+    std::vector<int> point_order_buffer_;
+    /// Nodes drawn in the current frame.
+    std::vector<int> selected_nodes_;
+    int64_t resident_points_ = 0;
+    int frame_index_ = 0;
+    int color_option_ = -1;
+    bool is_streaming_ = false;
+};
+
+class SimpleShaderForPointCloudLOD : public LODShader {
+public:
+    SimpleShaderForPointCloudLOD()
+        : LODShader("SimpleShaderForPointCloudLOD", false) {
+        Compile();
+    }
+    ~SimpleShaderForPointCloudLOD() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+};
+
+class PhongShaderForPointCloudLOD : public LODShader {
+public:
+    PhongShaderForPointCloudLOD()
+        : LODShader("PhongShaderForPointCloudLOD", true) {
+        Compile();
+    }
+    ~PhongShaderForPointCloudLOD() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+
+protected:
+    GLuint V_;
+    GLuint M_;
+    PhongLighting lighting_;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -27,7 +27,9 @@
 #include "Open3D/Visualization/Shader/NormalShader.h"
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 #include "Open3D/Visualization/Shader/Shader.h"
 
 namespace open3d {
@@ -35,6 +37,73 @@ namespace visualization {
 
 namespace glsl {
 
+namespace {
+
+template <typename PointCloudT>
+bool BindPointCloud(const ShaderWrapper &shader,
+                    const PointCloudT &pointcloud,
+                    std::vector<Eigen::Vector3f> &points,
+                    std::vector<Eigen::Vector3f> &normals) {
+    if (pointcloud.HasPoints() == false) {
+        shader.PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+    if (pointcloud.HasNormals() == false) {
+        shader.PrintShaderWarning(
+                "Binding failed with pointcloud with no normals.");
+        return false;
+    }
+    points.resize(pointcloud.points_.size());
+    normals.resize(pointcloud.points_.size());
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const auto &point = pointcloud.points_[i];
+        const auto &normal = pointcloud.normals_[i];
+        points[i] = point.template cast<float>();
+        normals[i] = normal.template cast<float>();
+    }
+    return true;
+}
+
+template <typename TriangleMeshT>
+bool BindTriangleMesh(const ShaderWrapper &shader,
+                      const TriangleMeshT &mesh,
+                      const RenderOption &option,
+                      std::vector<Eigen::Vector3f> &points,
+                      std::vector<Eigen::Vector3f> &normals) {
+    if (mesh.HasTriangles() == false) {
+        shader.PrintShaderWarning("Binding failed with empty triangle mesh.");
+        return false;
+    }
+    if (mesh.HasTriangleNormals() == false ||
+        mesh.HasVertexNormals() == false) {
+        shader.PrintShaderWarning(
+                "Binding failed because mesh has no normals.");
+        shader.PrintShaderWarning(
+                "Call ComputeVertexNormals() before binding.");
+        return false;
+    }
+    points.resize(mesh.triangles_.size() * 3);
+    normals.resize(mesh.triangles_.size() * 3);
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const auto &triangle = mesh.triangles_[i];
+        for (size_t j = 0; j < 3; j++) {
+            size_t idx = i * 3 + j;
+            size_t vi = triangle(j);
+            const auto &vertex = mesh.vertices_[vi];
+            points[idx] = vertex.template cast<float>();
+            if (option.mesh_shade_option_ ==
+                RenderOption::MeshShadeOption::FlatShade) {
+                normals[idx] = mesh.triangle_normals_[i].template cast<float>();
+            } else {
+                normals[idx] = mesh.vertex_normals_[vi].template cast<float>();
+            }
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
 bool NormalShader::Compile() {
     if (CompileShaders(NormalVertexShader, NULL, NormalFragmentShader) ==
         false) {
@@ -122,7 +191,9 @@ bool NormalShaderForPointCloud::PrepareRendering(
         const RenderOption &option,
         const ViewControl &view) {
     if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::PointCloud) {
+                geometry::Geometry::GeometryType::PointCloud &&
+        geometry.GetGeometryType() !=
+                geometry::Geometry::GeometryType::PointCloudF) {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
         return false;
     }
@@ -138,29 +209,20 @@ bool NormalShaderForPointCloud::PrepareBinding(
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
         std::vector<Eigen::Vector3f> &normals) {
-    if (geometry.GetGeometryType() !=
+    bool success;
+    if (geometry.GetGeometryType() ==
         geometry::Geometry::GeometryType::PointCloud) {
+        success = BindPointCloud(*this, (const geometry::PointCloud &)geometry,
+                                 points, normals);
+    } else if (geometry.GetGeometryType() ==
+               geometry::Geometry::GeometryType::PointCloudF) {
+        success = BindPointCloud(*this, (const geometry::PointCloudF &)geometry,
+                                 points, normals);
+    } else {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
         return false;
     }
-    const geometry::PointCloud &pointcloud =
-            (const geometry::PointCloud &)geometry;
-    if (pointcloud.HasPoints() == false) {
-        PrintShaderWarning("Binding failed with empty pointcloud.");
-        return false;
-    }
-    if (pointcloud.HasNormals() == false) {
-        PrintShaderWarning("Binding failed with pointcloud with no normals.");
-        return false;
-    }
-    points.resize(pointcloud.points_.size());
-    normals.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        const auto &normal = pointcloud.normals_[i];
-        points[i] = point.cast<float>();
-        normals[i] = normal.cast<float>();
-    }
+    if (!success) return false;
     draw_arrays_mode_ = GL_POINTS;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
@@ -173,7 +235,9 @@ bool NormalShaderForTriangleMesh::PrepareRendering(
     if (geometry.GetGeometryType() !=
                 geometry::Geometry::GeometryType::TriangleMesh &&
         geometry.GetGeometryType() !=
-                geometry::Geometry::GeometryType::HalfEdgeTriangleMesh) {
+                geometry::Geometry::GeometryType::HalfEdgeTriangleMesh &&
+        geometry.GetGeometryType() !=
+                geometry::Geometry::GeometryType::TriangleMeshF) {
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
@@ -200,42 +264,24 @@ bool NormalShaderForTriangleMesh::PrepareBinding(
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
         std::vector<Eigen::Vector3f> &normals) {
-    if (geometry.GetGeometryType() !=
-                geometry::Geometry::GeometryType::TriangleMesh &&
-        geometry.GetGeometryType() !=
+    bool success;
+    if (geometry.GetGeometryType() ==
+                geometry::Geometry::GeometryType::TriangleMesh ||
+        geometry.GetGeometryType() ==
                 geometry::Geometry::GeometryType::HalfEdgeTriangleMesh) {
+        success = BindTriangleMesh(*this,
+                                   (const geometry::TriangleMesh &)geometry,
+                                   option, points, normals);
+    } else if (geometry.GetGeometryType() ==
+               geometry::Geometry::GeometryType::TriangleMeshF) {
+        success = BindTriangleMesh(*this,
+                                   (const geometry::TriangleMeshF &)geometry,
+                                   option, points, normals);
+    } else {
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
-    const geometry::TriangleMesh &mesh =
-            (const geometry::TriangleMesh &)geometry;
-    if (mesh.HasTriangles() == false) {
-        PrintShaderWarning("Binding failed with empty triangle mesh.");
-        return false;
-    }
-    if (mesh.HasTriangleNormals() == false ||
-        mesh.HasVertexNormals() == false) {
-        PrintShaderWarning("Binding failed because mesh has no normals.");
-        PrintShaderWarning("Call ComputeVertexNormals() before binding.");
-        return false;
-    }
-    points.resize(mesh.triangles_.size() * 3);
-    normals.resize(mesh.triangles_.size() * 3);
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
-            if (option.mesh_shade_option_ ==
-                RenderOption::MeshShadeOption::FlatShade) {
-                normals[idx] = mesh.triangle_normals_[i].cast<float>();
-            } else {
-                normals[idx] = mesh.vertex_normals_[vi].cast<float>();
-            }
-        }
-    }
+    if (!success) return false;
     draw_arrays_mode_ = GL_TRIANGLES;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
@@ -27,7 +27,9 @@
 #include "Open3D/Visualization/Shader/PhongShader.h"
 
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 #include "Open3D/Visualization/Shader/Shader.h"
 #include "Open3D/Visualization/Utility/ColorMap.h"
 
@@ -36,6 +38,209 @@ namespace visualization {
 
 namespace glsl {
 
+namespace {
+
+template <typename PointCloudT>
+bool BindPointCloud(const ShaderWrapper &shader,
+                    const PointCloudT &pointcloud,
+                    const RenderOption &option,
+                    const ViewControl &view,
+                    std::vector<Eigen::Vector3f> &points,
+                    std::vector<Eigen::Vector3f> &normals,
+                    std::vector<Eigen::Vector3f> &colors) {
+    if (pointcloud.HasPoints() == false) {
+        shader.PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+    if (pointcloud.HasNormals() == false) {
+        shader.PrintShaderWarning(
+                "Binding failed with pointcloud with no normals.");
+        return false;
+    }
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    points.resize(pointcloud.points_.size());
+    normals.resize(pointcloud.points_.size());
+    colors.resize(pointcloud.points_.size());
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const auto &point = pointcloud.points_[i];
+        const auto &normal = pointcloud.normals_[i];
+        points[i] = point.template cast<float>();
+        normals[i] = normal.template cast<float>();
+        Eigen::Vector3d color;
+        switch (option.point_color_option_) {
+            case RenderOption::PointColorOption::XCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetXPercentage(point(0)));
+                break;
+            case RenderOption::PointColorOption::YCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetYPercentage(point(1)));
+                break;
+            case RenderOption::PointColorOption::ZCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(point(2)));
+                break;
+            case RenderOption::PointColorOption::Color:
+            case RenderOption::PointColorOption::Default:
+            default:
+                if (pointcloud.HasColors()) {
+                    color = pointcloud.colors_[i].template cast<double>();
+                } else {
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetZPercentage(point(2)));
+                }
+                break;
+        }
+        colors[i] = color.cast<float>();
+    }
+    return true;
+}
+
+template <typename TriangleMeshT>
+bool BindTriangleMesh(const ShaderWrapper &shader,
+                      const TriangleMeshT &mesh,
+                      const RenderOption &option,
+                      const ViewControl &view,
+                      std::vector<Eigen::Vector3f> &points,
+                      std::vector<Eigen::Vector3f> &normals,
+                      std::vector<Eigen::Vector3f> &colors,
+                      std::vector<GLuint> &indices) {
+    if (mesh.HasTriangles() == false) {
+        shader.PrintShaderWarning("Binding failed with empty triangle mesh.");
+        return false;
+    }
+    if (mesh.HasTriangleNormals() == false ||
+        mesh.HasVertexNormals() == false) {
+        shader.PrintShaderWarning(
+                "Binding failed because mesh has no normals.");
+        shader.PrintShaderWarning(
+                "Call ComputeVertexNormals() before binding.");
+        return false;
+    }
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    auto GetVertexColor = [&](size_t vi) -> Eigen::Vector3d {
+        const auto &vertex = mesh.vertices_[vi];
+        switch (option.mesh_color_option_) {
+            case RenderOption::MeshColorOption::XCoordinate:
+                return global_color_map.GetColor(
+                        view.GetBoundingBox().GetXPercentage(vertex(0)));
+            case RenderOption::MeshColorOption::YCoordinate:
+                return global_color_map.GetColor(
+                        view.GetBoundingBox().GetYPercentage(vertex(1)));
+            case RenderOption::MeshColorOption::ZCoordinate:
+                return global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(vertex(2)));
+            case RenderOption::MeshColorOption::Color:
+                if (mesh.HasVertexColors()) {
+                    return mesh.vertex_colors_[vi].template cast<double>();
+                }
+            case RenderOption::MeshColorOption::Default:
+            default:
+                return option.default_mesh_color_;
+        }
+    };
+
+    if (option.mesh_shade_option_ == RenderOption::MeshShadeOption::FlatShade) {
+        // Flat shading needs per-face normals, so the vertices are
+        // duplicated per triangle and drawn with glDrawArrays.
+        points.resize(mesh.triangles_.size() * 3);
+        normals.resize(mesh.triangles_.size() * 3);
+        colors.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            for (size_t j = 0; j < 3; j++) {
+                size_t idx = i * 3 + j;
+                size_t vi = triangle(j);
+                points[idx] = mesh.vertices_[vi].template cast<float>();
+                colors[idx] = GetVertexColor(vi).template cast<float>();
+                normals[idx] = mesh.triangle_normals_[i].template cast<float>();
+            }
+        }
+    } else {
+        // Smooth shading only uses per-vertex attributes: upload the shared
+        // vertices once and draw the triangles through an element buffer.
+        points.resize(mesh.vertices_.size());
+        normals.resize(mesh.vertices_.size());
+        colors.resize(mesh.vertices_.size());
+        for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+            points[i] = mesh.vertices_[i].template cast<float>();
+            colors[i] = GetVertexColor(i).template cast<float>();
+            normals[i] = mesh.vertex_normals_[i].template cast<float>();
+        }
+        indices.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            indices[i * 3] = GLuint(triangle(0));
+            indices[i * 3 + 1] = GLuint(triangle(1));
+            indices[i * 3 + 2] = GLuint(triangle(2));
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+void PhongLighting::GetUniformLocations(GLuint program) {
+    light_position_world_ =
+            glGetUniformLocation(program, "light_position_world_4");
+    light_color_ = glGetUniformLocation(program, "light_color_4");
+    light_diffuse_power_ =
+            glGetUniformLocation(program, "light_diffuse_power_4");
+    light_specular_power_ =
+            glGetUniformLocation(program, "light_specular_power_4");
+    light_specular_shininess_ =
+            glGetUniformLocation(program, "light_specular_shininess_4");
+    light_ambient_ = glGetUniformLocation(program, "light_ambient");
+}
+
+void PhongLighting::Update(const ViewControl &view,
+                           const RenderOption &option) {
+    const auto &box = view.GetBoundingBox();
+    light_position_world_data_.setOnes();
+    light_color_data_.setOnes();
+    for (int i = 0; i < 4; i++) {
+        light_position_world_data_.block<3, 1>(0, i) =
+                box.GetCenter().cast<GLfloat>() +
+                (float)box.GetMaxExtent() *
+                        ((float)option.light_position_relative_[i](0) *
+                                 view.GetRight() +
+                         (float)option.light_position_relative_[i](1) *
+                                 view.GetUp() +
+                         (float)option.light_position_relative_[i](2) *
+                                 view.GetFront());
+        light_color_data_.block<3, 1>(0, i) =
+                option.light_color_[i].cast<GLfloat>();
+    }
+    if (option.light_on_) {
+        light_diffuse_power_data_ =
+                Eigen::Vector4d(option.light_diffuse_power_).cast<GLfloat>();
+        light_specular_power_data_ =
+                Eigen::Vector4d(option.light_specular_power_).cast<GLfloat>();
+        light_specular_shininess_data_ =
+                Eigen::Vector4d(option.light_specular_shininess_)
+                        .cast<GLfloat>();
+        light_ambient_data_.block<3, 1>(0, 0) =
+                option.light_ambient_color_.cast<GLfloat>();
+        light_ambient_data_(3) = 1.0f;
+    } else {
+        light_diffuse_power_data_ = GLHelper::GLVector4f::Zero();
+        light_specular_power_data_ = GLHelper::GLVector4f::Zero();
+        light_specular_shininess_data_ = GLHelper::GLVector4f::Ones();
+        light_ambient_data_ = GLHelper::GLVector4f(1.0f, 1.0f, 1.0f, 1.0f);
+    }
+}
+
+void PhongLighting::Upload() const {
+    glUniformMatrix4fv(light_position_world_, 1, GL_FALSE,
+                       light_position_world_data_.data());
+    glUniformMatrix4fv(light_color_, 1, GL_FALSE, light_color_data_.data());
+    glUniform4fv(light_diffuse_power_, 1, light_diffuse_power_data_.data());
+    glUniform4fv(light_specular_power_, 1, light_specular_power_data_.data());
+    glUniform4fv(light_specular_shininess_, 1,
+                 light_specular_shininess_data_.data());
+    glUniform4fv(light_ambient_, 1, light_ambient_data_.data());
+}
+
 bool PhongShader::Compile() {
     if (CompileShaders(PhongVertexShader, NULL, PhongFragmentShader) == false) {
         PrintShaderWarning("Compiling shaders failed.");
@@ -47,16 +252,7 @@ bool PhongShader::Compile() {
     MVP_ = glGetUniformLocation(program_, "MVP");
     V_ = glGetUniformLocation(program_, "V");
     M_ = glGetUniformLocation(program_, "M");
-    light_position_world_ =
-            glGetUniformLocation(program_, "light_position_world_4");
-    light_color_ = glGetUniformLocation(program_, "light_color_4");
-    light_diffuse_power_ =
-            glGetUniformLocation(program_, "light_diffuse_power_4");
-    light_specular_power_ =
-            glGetUniformLocation(program_, "light_specular_power_4");
-    light_specular_shininess_ =
-            glGetUniformLocation(program_, "light_specular_shininess_4");
-    light_ambient_ = glGetUniformLocation(program_, "light_ambient");
+    lighting_.GetUniformLocations(program_);
     return true;
 }
 
@@ -80,8 +276,9 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
     std::vector<Eigen::Vector3f> points;
     std::vector<Eigen::Vector3f> normals;
     std::vector<Eigen::Vector3f> colors;
-    if (PrepareBinding(geometry, option, view, points, normals, colors) ==
-        false) {
+    std::vector<GLuint> indices;
+    if (PrepareBinding(geometry, option, view, points, normals, colors,
+                       indices) == false) {
         PrintShaderWarning("Binding failed when preparing data.");
         return false;
     }
@@ -99,6 +296,7 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
                  colors.data(), GL_STATIC_DRAW);
+    BindElementBuffer(indices);
     bound_ = true;
     return true;
 }
@@ -114,14 +312,7 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
     glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
     glUniformMatrix4fv(V_, 1, GL_FALSE, view.GetViewMatrix().data());
     glUniformMatrix4fv(M_, 1, GL_FALSE, view.GetModelMatrix().data());
-    glUniformMatrix4fv(light_position_world_, 1, GL_FALSE,
-                       light_position_world_data_.data());
-    glUniformMatrix4fv(light_color_, 1, GL_FALSE, light_color_data_.data());
-    glUniform4fv(light_diffuse_power_, 1, light_diffuse_power_data_.data());
-    glUniform4fv(light_specular_power_, 1, light_specular_power_data_.data());
-    glUniform4fv(light_specular_shininess_, 1,
-                 light_specular_shininess_data_.data());
-    glUniform4fv(light_ambient_, 1, light_ambient_data_.data());
+    lighting_.Upload();
     glEnableVertexAttribArray(vertex_position_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
@@ -131,7 +322,7 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
     glEnableVertexAttribArray(vertex_color_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    DrawGeometry();
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_normal_);
     glDisableVertexAttribArray(vertex_color_);
@@ -143,60 +334,26 @@ void PhongShader::UnbindGeometry() {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_normal_buffer_);
         glDeleteBuffers(1, &vertex_color_buffer_);
+        UnbindElementBuffer();
         bound_ = false;
     }
 }
 
-void PhongShader::SetLighting(const ViewControl &view,
-                              const RenderOption &option) {
-    const auto &box = view.GetBoundingBox();
-    light_position_world_data_.setOnes();
-    light_color_data_.setOnes();
-    for (int i = 0; i < 4; i++) {
-        light_position_world_data_.block<3, 1>(0, i) =
-                box.GetCenter().cast<GLfloat>() +
-                (float)box.GetMaxExtent() *
-                        ((float)option.light_position_relative_[i](0) *
-                                 view.GetRight() +
-                         (float)option.light_position_relative_[i](1) *
-                                 view.GetUp() +
-                         (float)option.light_position_relative_[i](2) *
-                                 view.GetFront());
-        light_color_data_.block<3, 1>(0, i) =
-                option.light_color_[i].cast<GLfloat>();
-    }
-    if (option.light_on_) {
-        light_diffuse_power_data_ =
-                Eigen::Vector4d(option.light_diffuse_power_).cast<GLfloat>();
-        light_specular_power_data_ =
-                Eigen::Vector4d(option.light_specular_power_).cast<GLfloat>();
-        light_specular_shininess_data_ =
-                Eigen::Vector4d(option.light_specular_shininess_)
-                        .cast<GLfloat>();
-        light_ambient_data_.block<3, 1>(0, 0) =
-                option.light_ambient_color_.cast<GLfloat>();
-        light_ambient_data_(3) = 1.0f;
-    } else {
-        light_diffuse_power_data_ = GLHelper::GLVector4f::Zero();
-        light_specular_power_data_ = GLHelper::GLVector4f::Zero();
-        light_specular_shininess_data_ = GLHelper::GLVector4f::Ones();
-        light_ambient_data_ = GLHelper::GLVector4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-}
-
 bool PhongShaderForPointCloud::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view) {
     if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::PointCloud) {
+                geometry::Geometry::GeometryType::PointCloud &&
+        geometry.GetGeometryType() !=
+                geometry::Geometry::GeometryType::PointCloudF) {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
         return false;
     }
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GLenum(option.GetGLDepthFunc()));
     glPointSize(GLfloat(option.point_size_));
-    SetLighting(view, option);
+    lighting_.Update(view, option);
     return true;
 }
 
@@ -206,58 +363,23 @@ bool PhongShaderForPointCloud::PrepareBinding(
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
         std::vector<Eigen::Vector3f> &normals,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    bool success;
+    if (geometry.GetGeometryType() ==
         geometry::Geometry::GeometryType::PointCloud) {
+        success = BindPointCloud(*this, (const geometry::PointCloud &)geometry,
+                                 option, view, points, normals, colors);
+    } else if (geometry.GetGeometryType() ==
+               geometry::Geometry::GeometryType::PointCloudF) {
+        success =
+                BindPointCloud(*this, (const geometry::PointCloudF &)geometry,
+                               option, view, points, normals, colors);
+    } else {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
         return false;
     }
-    const geometry::PointCloud &pointcloud =
-            (const geometry::PointCloud &)geometry;
-    if (pointcloud.HasPoints() == false) {
-        PrintShaderWarning("Binding failed with empty pointcloud.");
-        return false;
-    }
-    if (pointcloud.HasNormals() == false) {
-        PrintShaderWarning("Binding failed with pointcloud with no normals.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.resize(pointcloud.points_.size());
-    normals.resize(pointcloud.points_.size());
-    colors.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        const auto &normal = pointcloud.normals_[i];
-        points[i] = point.cast<float>();
-        normals[i] = normal.cast<float>();
-        Eigen::Vector3d color;
-        switch (option.point_color_option_) {
-            case RenderOption::PointColorOption::XCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetXPercentage(point(0)));
-                break;
-            case RenderOption::PointColorOption::YCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetYPercentage(point(1)));
-                break;
-            case RenderOption::PointColorOption::ZCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetZPercentage(point(2)));
-                break;
-            case RenderOption::PointColorOption::Color:
-            case RenderOption::PointColorOption::Default:
-            default:
-                if (pointcloud.HasColors()) {
-                    color = pointcloud.colors_[i];
-                } else {
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(point(2)));
-                }
-                break;
-        }
-        colors[i] = color.cast<float>();
-    }
+    if (!success) return false;
     draw_arrays_mode_ = GL_POINTS;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
@@ -270,7 +392,9 @@ bool PhongShaderForTriangleMesh::PrepareRendering(
     if (geometry.GetGeometryType() !=
                 geometry::Geometry::GeometryType::TriangleMesh &&
         geometry.GetGeometryType() !=
-                geometry::Geometry::GeometryType::HalfEdgeTriangleMesh) {
+                geometry::Geometry::GeometryType::HalfEdgeTriangleMesh &&
+        geometry.GetGeometryType() !=
+                geometry::Geometry::GeometryType::TriangleMeshF) {
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
@@ -288,7 +412,7 @@ bool PhongShaderForTriangleMesh::PrepareRendering(
     } else {
         glDisable(GL_POLYGON_OFFSET_FILL);
     }
-    SetLighting(view, option);
+    lighting_.Update(view, option);
     return true;
 }
 
@@ -298,73 +422,26 @@ bool PhongShaderForTriangleMesh::PrepareBinding(
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
         std::vector<Eigen::Vector3f> &normals,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
-                geometry::Geometry::GeometryType::TriangleMesh &&
-        geometry.GetGeometryType() !=
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    bool success;
+    if (geometry.GetGeometryType() ==
+                geometry::Geometry::GeometryType::TriangleMesh ||
+        geometry.GetGeometryType() ==
                 geometry::Geometry::GeometryType::HalfEdgeTriangleMesh) {
+        success = BindTriangleMesh(
+                *this, (const geometry::TriangleMesh &)geometry, option, view,
+                points, normals, colors, indices);
+    } else if (geometry.GetGeometryType() ==
+               geometry::Geometry::GeometryType::TriangleMeshF) {
+        success = BindTriangleMesh(
+                *this, (const geometry::TriangleMeshF &)geometry, option, view,
+                points, normals, colors, indices);
+    } else {
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
-    const geometry::TriangleMesh &mesh =
-            (const geometry::TriangleMesh &)geometry;
-    if (mesh.HasTriangles() == false) {
-        PrintShaderWarning("Binding failed with empty triangle mesh.");
-        return false;
-    }
-    if (mesh.HasTriangleNormals() == false ||
-        mesh.HasVertexNormals() == false) {
-        PrintShaderWarning("Binding failed because mesh has no normals.");
-        PrintShaderWarning("Call ComputeVertexNormals() before binding.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.resize(mesh.triangles_.size() * 3);
-    normals.resize(mesh.triangles_.size() * 3);
-    colors.resize(mesh.triangles_.size() * 3);
-
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
-
-            Eigen::Vector3d color;
-            switch (option.mesh_color_option_) {
-                case RenderOption::MeshColorOption::XCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetXPercentage(vertex(0)));
-                    break;
-                case RenderOption::MeshColorOption::YCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetYPercentage(vertex(1)));
-                    break;
-                case RenderOption::MeshColorOption::ZCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(vertex(2)));
-                    break;
-                case RenderOption::MeshColorOption::Color:
-                    if (mesh.HasVertexColors()) {
-                        color = mesh.vertex_colors_[vi];
-                        break;
-                    }
-                case RenderOption::MeshColorOption::Default:
-                default:
-                    color = option.default_mesh_color_;
-                    break;
-            }
-            colors[idx] = color.cast<float>();
-
-            if (option.mesh_shade_option_ ==
-                RenderOption::MeshShadeOption::FlatShade) {
-                normals[idx] = mesh.triangle_normals_[i].cast<float>();
-            } else {
-                normals[idx] = mesh.vertex_normals_[vi].cast<float>();
-            }
-        }
-    }
+    if (!success) return false;
     draw_arrays_mode_ = GL_TRIANGLES;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
@@ -36,6 +36,35 @@ namespace visualization {
 
 namespace glsl {
 
+/// \class PhongLighting
+///
+/// \brief Light uniforms of the shaders built on PhongFragmentShader. At most
+/// 4 lights are supported.
+class PhongLighting {
+public:
+    /// Looks up the light uniforms of \p program.
+    void GetUniformLocations(GLuint program);
+    /// Places the lights relative to the bounding box of \p view.
+    void Update(const ViewControl &view, const RenderOption &option);
+    /// Sets the light uniforms of the program in use.
+    void Upload() const;
+
+private:
+    GLuint light_position_world_;
+    GLuint light_color_;
+    GLuint light_diffuse_power_;
+    GLuint light_specular_power_;
+    GLuint light_specular_shininess_;
+    GLuint light_ambient_;
+
+    GLHelper::GLMatrix4f light_position_world_data_;
+    GLHelper::GLMatrix4f light_color_data_;
+    GLHelper::GLVector4f light_diffuse_power_data_;
+    GLHelper::GLVector4f light_specular_power_data_;
+    GLHelper::GLVector4f light_specular_shininess_data_;
+    GLHelper::GLVector4f light_ambient_data_;
+};
+
 class PhongShader : public ShaderWrapper {
 public:
     ~PhongShader() override { Release(); }
@@ -63,10 +92,8 @@ protected:
                                 const ViewControl &view,
                                 std::vector<Eigen::Vector3f> &points,
                                 std::vector<Eigen::Vector3f> &normals,
-                                std::vector<Eigen::Vector3f> &colors) = 0;
-
-protected:
-    void SetLighting(const ViewControl &view, const RenderOption &option);
+                                std::vector<Eigen::Vector3f> &colors,
+                                std::vector<GLuint> &indices) = 0;
 
 protected:
     GLuint vertex_position_;
@@ -78,20 +105,7 @@ protected:
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
-    GLuint light_position_world_;
-    GLuint light_color_;
-    GLuint light_diffuse_power_;
-    GLuint light_specular_power_;
-    GLuint light_specular_shininess_;
-    GLuint light_ambient_;
-
-    // At most support 4 lights
-    GLHelper::GLMatrix4f light_position_world_data_;
-    GLHelper::GLMatrix4f light_color_data_;
-    GLHelper::GLVector4f light_diffuse_power_data_;
-    GLHelper::GLVector4f light_specular_power_data_;
-    GLHelper::GLVector4f light_specular_shininess_data_;
-    GLHelper::GLVector4f light_ambient_data_;
+    PhongLighting lighting_;
 };
 
 class PhongShaderForPointCloud : public PhongShader {
@@ -107,7 +121,8 @@ protected:
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
                         std::vector<Eigen::Vector3f> &normals,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 class PhongShaderForTriangleMesh : public PhongShader {
@@ -123,7 +138,8 @@ protected:
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
                         std::vector<Eigen::Vector3f> &normals,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 }  // namespace glsl
@@ -129,6 +129,131 @@ namespace visualization {
 
 namespace glsl {
 
+const char * const InstancedPhongVertexShader = 
+"#version 330\n"
+"\n"
+"in vec3 vertex_position;\n"
+"in vec3 vertex_normal;\n"
+"in vec3 vertex_color;\n"
+"in mat4 instance_transform;\n"
+"in vec3 instance_color;\n"
+"\n"
+"out vec3 vertex_position_world;\n"
+"out vec3 vertex_normal_camera;\n"
+"out vec3 eye_dir_camera;\n"
+"out mat4 light_dir_camera_4;\n"
+"out vec3 fragment_color;\n"
+"\n"
+"uniform mat4 MVP;\n"
+"uniform mat4 V;\n"
+"uniform mat4 M;\n"
+"uniform mat4 light_position_world_4;\n"
+"uniform bool use_instance_color;\n"
+"\n"
+"void main()\n"
+"{\n"
+"    vec4 position = instance_transform * vec4(vertex_position, 1);\n"
+"    gl_Position = MVP * position;\n"
+"    vertex_position_world = (M * position).xyz;\n"
+"\n"
+"    vec3 vertex_position_camera = (V * M * position).xyz;\n"
+"    eye_dir_camera = vec3(0, 0, 0) - vertex_position_camera;\n"
+"\n"
+"    vec4 v = vec4(vertex_position_camera, 1);\n"
+"    light_dir_camera_4 = V * light_position_world_4 - mat4(v, v, v, v);\n"
+"\n"
+"    vertex_normal_camera =\n"
+"            (V * M * instance_transform * vec4(vertex_normal, 0)).xyz;\n"
+"    if (dot(eye_dir_camera, vertex_normal_camera) < 0.0)\n"
+"        vertex_normal_camera = vertex_normal_camera * -1.0;\n"
+"\n"
+"    fragment_color = use_instance_color ? instance_color : vertex_color;\n"
+"}\n"
+;
+
+}  // namespace open3d::glsl
+
+}  // namespace open3d::visualization
+
+}  // namespace open3d
+
+// clang-format on
+// clang-format off
+namespace open3d {
+
+namespace visualization {
+
+namespace glsl {
+
+const char * const InstancedPickingVertexShader = 
+"#version 330\n"
+"\n"
+"in vec3 vertex_position;\n"
+"in mat4 instance_transform;\n"
+"uniform mat4 MVP;\n"
+"\n"
+"out vec4 fragment_color;\n"
+"\n"
+"void main()\n"
+"{\n"
+"    float r, g, b, a;\n"
+"    float instance_index = float(gl_InstanceID);\n"
+"    gl_Position = MVP * instance_transform * vec4(vertex_position, 1);\n"
+"    r = floor(instance_index / 16777216.0) / 255.0;\n"
+"    g = mod(floor(instance_index / 65536.0), 256.0) / 255.0;\n"
+"    b = mod(floor(instance_index / 256.0), 256.0) / 255.0;\n"
+"    a = mod(instance_index, 256.0) / 255.0;\n"
+"    fragment_color = vec4(r, g, b, a);\n"
+"}\n"
+;
+
+}  // namespace open3d::glsl
+
+}  // namespace open3d::visualization
+
+}  // namespace open3d
+
+// clang-format on
+// clang-format off
+namespace open3d {
+
+namespace visualization {
+
+namespace glsl {
+
+const char * const InstancedSimpleVertexShader = 
+"#version 330\n"
+"\n"
+"in vec3 vertex_position;\n"
+"in vec3 vertex_color;\n"
+"in mat4 instance_transform;\n"
+"in vec3 instance_color;\n"
+"uniform mat4 MVP;\n"
+"uniform bool use_instance_color;\n"
+"\n"
+"out vec3 fragment_color;\n"
+"\n"
+"void main()\n"
+"{\n"
+"    gl_Position = MVP * instance_transform * vec4(vertex_position, 1);\n"
+"    fragment_color = use_instance_color ? instance_color : vertex_color;\n"
+"}\n"
+;
+
+}  // namespace open3d::glsl
+
+}  // namespace open3d::visualization
+
+}  // namespace open3d
+
+// clang-format on
+// clang-format off
+namespace open3d {
+
+namespace visualization {
+
+namespace glsl {
+
 const char * const NormalFragmentShader = 
 "#version 330\n"
 "\n"
@@ -782,3 +907,41 @@ const char * const TextureSimpleVertexShader =
 }  // namespace open3d
 
 // clang-format on
+// clang-format off
+namespace open3d {
+
+namespace visualization {
+
+namespace glsl {
+
+const char * const VoxelVertexShader = 
+"#version 330\n"
+"\n"
+"in vec3 vertex_position;\n"
+"in float vertex_face;\n"
+"in vec3 voxel_origin;\n"
+"in float voxel_size;\n"
+"in vec3 voxel_color;\n"
+"in float voxel_face_mask;\n"
+"uniform mat4 MVP;\n"
+"\n"
+"out vec3 fragment_color;\n"
+"\n"
+"void main()\n"
+"{\n"
+"    // Faces hidden by a neighbouring voxel collapse to a degenerate point,\n"
+"    // which the rasterizer discards.\n"
+"    float visible = mod(floor(voxel_face_mask / exp2(vertex_face)), 2.0);\n"
+"    vec3 position = voxel_origin + vertex_position * voxel_size * visible;\n"
+"    gl_Position = MVP * vec4(position, 1);\n"
+"    fragment_color = voxel_color;\n"
+"}\n"
+;
+
+}  // namespace open3d::glsl
+
+}  // namespace open3d::visualization
+
+}  // namespace open3d
+
+// clang-format on
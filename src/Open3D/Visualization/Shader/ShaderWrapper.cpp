@@ -28,6 +28,7 @@
 
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Visualization/Utility/RenderProfiler.h"
 
 namespace open3d {
 namespace visualization {
@@ -40,14 +41,29 @@ bool ShaderWrapper::Render(const geometry::Geometry &geometry,
     if (compiled_ == false) {
         Compile();
     }
+    RenderProfiler *profiler = RenderProfiler::GetActive();
     if (bound_ == false) {
+        // Binding includes preparing the attributes on the CPU and uploading
+        // them.
+        if (profiler != nullptr) {
+            profiler->BeginZone(shader_name_ + "::Bind");
+        }
         BindGeometry(geometry, option, view);
+        if (profiler != nullptr) {
+            profiler->EndZone();
+        }
     }
     if (compiled_ == false || bound_ == false) {
         PrintShaderWarning("Something is wrong in compiling or binding.");
         return false;
     }
-    return RenderGeometry(geometry, option, view);
+    if (profiler == nullptr) {
+        return RenderGeometry(geometry, option, view);
+    }
+    profiler->BeginZone(shader_name_ + "::Draw");
+    bool success = RenderGeometry(geometry, option, view);
+    profiler->EndZone();
+    return success;
 }
 
 void ShaderWrapper::InvalidateGeometry() {
@@ -135,6 +151,40 @@ void ShaderWrapper::ReleaseProgram() {
     }
 }
 
+void ShaderWrapper::BindElementBuffer(const std::vector<GLuint> &indices) {
+    UnbindElementBuffer();
+    if (indices.empty()) {
+        return;
+    }
+    glGenBuffers(1, &element_buffer_);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer_);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint),
+                 indices.data(), GL_STATIC_DRAW);
+    draw_elements_size_ = GLsizei(indices.size());
+    element_buffer_bound_ = true;
+}
+
+void ShaderWrapper::UnbindElementBuffer() {
+    if (element_buffer_bound_) {
+        glDeleteBuffers(1, &element_buffer_);
+        draw_elements_size_ = 0;
+        element_buffer_bound_ = false;
+    }
+}
+
+void ShaderWrapper::DrawGeometry() {
+    if (element_buffer_bound_) {
+        // The element array binding is part of the VAO state, so it has to be
+        // re-bound for every draw call.
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer_);
+        glDrawElements(draw_arrays_mode_, draw_elements_size_, GL_UNSIGNED_INT,
+                       NULL);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    } else {
+        glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    }
+}
+
 bool ShaderWrapper::ValidateShader(GLuint shader_index) {
     GLint result = GL_FALSE;
     int info_log_length;
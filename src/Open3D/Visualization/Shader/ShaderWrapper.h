@@ -27,6 +27,7 @@
 #pragma once
 
 #include <GL/glew.h>
+#include <vector>
 
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Visualization/Visualizer/RenderOption.h"
@@ -90,6 +91,16 @@ protected:
                         const char *const fragment_shader_code);
     void ReleaseProgram();
 
+    /// Function to upload an element buffer for indexed rendering.
+    /// If \p indices is empty, no element buffer is created and DrawGeometry()
+    /// falls back to glDrawArrays.
+    void BindElementBuffer(const std::vector<GLuint> &indices);
+    void UnbindElementBuffer();
+
+    /// Function to issue the draw call: glDrawElements if an element buffer
+    /// is bound, glDrawArrays otherwise.
+    void DrawGeometry();
+
 protected:
     GLuint vertex_shader_;
     GLuint geometry_shader_;
@@ -97,6 +108,9 @@ protected:
     GLuint program_;
     GLenum draw_arrays_mode_ = GL_POINTS;
     GLsizei draw_arrays_size_ = 0;
+    GLuint element_buffer_;
+    GLsizei draw_elements_size_ = 0;
+    bool element_buffer_bound_ = false;
     bool compiled_ = false;
     bool bound_ = false;
 
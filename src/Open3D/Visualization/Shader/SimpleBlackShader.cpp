@@ -65,7 +65,8 @@ bool SimpleBlackShader::BindGeometry(const geometry::Geometry &geometry,
 
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
-    if (PrepareBinding(geometry, option, view, points) == false) {
+    std::vector<GLuint> indices;
+    if (PrepareBinding(geometry, option, view, points, indices) == false) {
         PrintShaderWarning("Binding failed when preparing data.");
         return false;
     }
@@ -75,7 +76,7 @@ bool SimpleBlackShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
     glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
                  points.data(), GL_STATIC_DRAW);
-
+    BindElementBuffer(indices);
     bound_ = true;
     return true;
 }
@@ -92,7 +93,7 @@ bool SimpleBlackShader::RenderGeometry(const geometry::Geometry &geometry,
     glEnableVertexAttribArray(vertex_position_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    DrawGeometry();
     glDisableVertexAttribArray(vertex_position_);
     return true;
 }
@@ -100,6 +101,7 @@ bool SimpleBlackShader::RenderGeometry(const geometry::Geometry &geometry,
 void SimpleBlackShader::UnbindGeometry() {
     if (bound_) {
         glDeleteBuffers(1, &vertex_position_buffer_);
+        UnbindElementBuffer();
         bound_ = false;
     }
 }
@@ -122,7 +124,8 @@ bool SimpleBlackShaderForPointCloudNormal::PrepareBinding(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points) {
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::PointCloud) {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
@@ -171,7 +174,8 @@ bool SimpleBlackShaderForTriangleMeshWireFrame::PrepareBinding(
         const geometry::Geometry &geometry,
         const RenderOption &option,
         const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points) {
+        std::vector<Eigen::Vector3f> &points,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
                 geometry::Geometry::GeometryType::TriangleMesh &&
         geometry.GetGeometryType() !=
@@ -185,15 +189,25 @@ bool SimpleBlackShaderForTriangleMeshWireFrame::PrepareBinding(
         PrintShaderWarning("Binding failed with empty geometry::TriangleMesh.");
         return false;
     }
-    points.resize(mesh.triangles_.size() * 3);
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+    // The triangles are drawn straight from the mesh with glPolygonMode set
+    // to GL_LINE, so the vertices are shared instead of copied per triangle
+    // and no line set of the edges is built.
+    points.resize(mesh.vertices_.size());
+    indices.resize(mesh.triangles_.size() * 3);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(mesh.vertices_.size()); i++) {
+        points[i] = mesh.vertices_[i].cast<float>();
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(mesh.triangles_.size()); i++) {
         const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
-        }
+        indices[i * 3] = GLuint(triangle(0));
+        indices[i * 3 + 1] = GLuint(triangle(1));
+        indices[i * 3 + 2] = GLuint(triangle(2));
     }
     draw_arrays_mode_ = GL_TRIANGLES;
     draw_arrays_size_ = GLsizei(points.size());
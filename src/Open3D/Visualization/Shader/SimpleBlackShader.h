@@ -63,7 +63,8 @@ protected:
     virtual bool PrepareBinding(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view,
-                                std::vector<Eigen::Vector3f> &points) = 0;
+                                std::vector<Eigen::Vector3f> &points,
+                                std::vector<GLuint> &indices) = 0;
 
 protected:
     GLuint vertex_position_;
@@ -83,7 +84,8 @@ protected:
     bool PrepareBinding(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points) final;
+                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<GLuint> &indices) final;
 };
 
 class SimpleBlackShaderForTriangleMeshWireFrame : public SimpleBlackShader {
@@ -98,7 +100,8 @@ protected:
     bool PrepareBinding(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points) final;
+                        std::vector<Eigen::Vector3f> &points,
+                        std::vector<GLuint> &indices) final;
 };
 
 }  // namespace glsl
@@ -28,11 +28,11 @@
 
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/LineSet.h"
-#include "Open3D/Geometry/Octree.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Geometry/TetraMesh.h"
 #include "Open3D/Geometry/TriangleMesh.h"
-#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
 #include "Open3D/Visualization/Shader/Shader.h"
 #include "Open3D/Visualization/Utility/ColorMap.h"
 
@@ -40,31 +40,113 @@ namespace open3d {
 namespace visualization {
 namespace glsl {
 
-// Coordinates of 8 vertices in a cuboid (assume origin (0,0,0), size 1)
-const static std::vector<Eigen::Vector3i> cuboid_vertex_offsets{
-        Eigen::Vector3i(0, 0, 0), Eigen::Vector3i(1, 0, 0),
-        Eigen::Vector3i(0, 1, 0), Eigen::Vector3i(1, 1, 0),
-        Eigen::Vector3i(0, 0, 1), Eigen::Vector3i(1, 0, 1),
-        Eigen::Vector3i(0, 1, 1), Eigen::Vector3i(1, 1, 1),
-};
+namespace {
 
-// Vertex indices of 12 triangles in a cuboid, for right-handed manifold mesh
-const static std::vector<Eigen::Vector3i> cuboid_triangles_vertex_indices{
-        Eigen::Vector3i(0, 2, 1), Eigen::Vector3i(0, 1, 4),
-        Eigen::Vector3i(0, 4, 2), Eigen::Vector3i(5, 1, 7),
-        Eigen::Vector3i(5, 7, 4), Eigen::Vector3i(5, 4, 1),
-        Eigen::Vector3i(3, 7, 1), Eigen::Vector3i(3, 1, 2),
-        Eigen::Vector3i(3, 2, 7), Eigen::Vector3i(6, 4, 7),
-        Eigen::Vector3i(6, 7, 2), Eigen::Vector3i(6, 2, 4),
-};
+template <typename PointCloudT>
+bool BindPointCloud(const ShaderWrapper &shader,
+                    const PointCloudT &pointcloud,
+                    const RenderOption &option,
+                    const ViewControl &view,
+                    std::vector<Eigen::Vector3f> &points,
+                    std::vector<Eigen::Vector3f> &colors) {
+    if (pointcloud.HasPoints() == false) {
+        shader.PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    points.resize(pointcloud.points_.size());
+    colors.resize(pointcloud.points_.size());
+    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+        const auto &point = pointcloud.points_[i];
+        points[i] = point.template cast<float>();
+        Eigen::Vector3d color;
+        switch (option.point_color_option_) {
+            case RenderOption::PointColorOption::XCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetXPercentage(point(0)));
+                break;
+            case RenderOption::PointColorOption::YCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetYPercentage(point(1)));
+                break;
+            case RenderOption::PointColorOption::ZCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(point(2)));
+                break;
+            case RenderOption::PointColorOption::Color:
+            case RenderOption::PointColorOption::Default:
+            default:
+                if (pointcloud.HasColors()) {
+                    color = pointcloud.colors_[i].template cast<double>();
+                } else {
+                    color = global_color_map.GetColor(
+                            view.GetBoundingBox().GetZPercentage(point(2)));
+                }
+                break;
+        }
+        colors[i] = color.cast<float>();
+    }
+    return true;
+}
 
-// Vertex indices of 12 lines in a cuboid
-const static std::vector<Eigen::Vector2i> cuboid_lines_vertex_indices{
-        Eigen::Vector2i(0, 1), Eigen::Vector2i(0, 2), Eigen::Vector2i(0, 4),
-        Eigen::Vector2i(3, 1), Eigen::Vector2i(3, 2), Eigen::Vector2i(3, 7),
-        Eigen::Vector2i(5, 1), Eigen::Vector2i(5, 4), Eigen::Vector2i(5, 7),
-        Eigen::Vector2i(6, 2), Eigen::Vector2i(6, 4), Eigen::Vector2i(6, 7),
-};
+template <typename TriangleMeshT>
+bool BindTriangleMesh(const ShaderWrapper &shader,
+                      const TriangleMeshT &mesh,
+                      const RenderOption &option,
+                      const ViewControl &view,
+                      std::vector<Eigen::Vector3f> &points,
+                      std::vector<Eigen::Vector3f> &colors,
+                      std::vector<GLuint> &indices) {
+    if (mesh.HasTriangles() == false) {
+        shader.PrintShaderWarning("Binding failed with empty triangle mesh.");
+        return false;
+    }
+    // All attributes are per-vertex, so upload the shared vertices once and
+    // draw the triangles through an element buffer.
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    points.resize(mesh.vertices_.size());
+    colors.resize(mesh.vertices_.size());
+    for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+        const auto &vertex = mesh.vertices_[i];
+        points[i] = vertex.template cast<float>();
+
+        Eigen::Vector3d color;
+        switch (option.mesh_color_option_) {
+            case RenderOption::MeshColorOption::XCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetXPercentage(vertex(0)));
+                break;
+            case RenderOption::MeshColorOption::YCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetYPercentage(vertex(1)));
+                break;
+            case RenderOption::MeshColorOption::ZCoordinate:
+                color = global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(vertex(2)));
+                break;
+            case RenderOption::MeshColorOption::Color:
+                if (mesh.HasVertexColors()) {
+                    color = mesh.vertex_colors_[i].template cast<double>();
+                    break;
+                }
+            case RenderOption::MeshColorOption::Default:
+            default:
+                color = option.default_mesh_color_;
+                break;
+        }
+        colors[i] = color.cast<float>();
+    }
+    indices.resize(mesh.triangles_.size() * 3);
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const auto &triangle = mesh.triangles_[i];
+        indices[i * 3] = GLuint(triangle(0));
+        indices[i * 3 + 1] = GLuint(triangle(1));
+        indices[i * 3 + 2] = GLuint(triangle(2));
+    }
+    return true;
+}
+
+}  // unnamed namespace
 
 bool SimpleShader::Compile() {
     if (CompileShaders(SimpleVertexShader, NULL, SimpleFragmentShader) ==
@@ -97,7 +179,9 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
     std::vector<Eigen::Vector3f> colors;
-    if (PrepareBinding(geometry, option, view, points, colors) == false) {
+    std::vector<GLuint> indices;
+    if (PrepareBinding(geometry, option, view, points, colors, indices) ==
+        false) {
         PrintShaderWarning("Binding failed when preparing data.");
         return false;
     }
@@ -111,6 +195,7 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
                  colors.data(), GL_STATIC_DRAW);
+    BindElementBuffer(indices);
     bound_ = true;
     return true;
 }
@@ -130,7 +215,7 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     glEnableVertexAttribArray(vertex_color_);
     glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
     glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    DrawGeometry();
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_color_);
     return true;
@@ -140,6 +225,7 @@ void SimpleShader::UnbindGeometry() {
     if (bound_) {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_color_buffer_);
+        UnbindElementBuffer();
         bound_ = false;
     }
 }
@@ -149,7 +235,9 @@ bool SimpleShaderForPointCloud::PrepareRendering(
         const RenderOption &option,
         const ViewControl &view) {
     if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::PointCloud) {
+                geometry::Geometry::GeometryType::PointCloud &&
+        geometry.GetGeometryType() !=
+                geometry::Geometry::GeometryType::PointCloudF) {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
         return false;
     }
@@ -164,51 +252,23 @@ bool SimpleShaderForPointCloud::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    bool success;
+    if (geometry.GetGeometryType() ==
         geometry::Geometry::GeometryType::PointCloud) {
+        success = BindPointCloud(*this, (const geometry::PointCloud &)geometry,
+                                 option, view, points, colors);
+    } else if (geometry.GetGeometryType() ==
+               geometry::Geometry::GeometryType::PointCloudF) {
+        success =
+                BindPointCloud(*this, (const geometry::PointCloudF &)geometry,
+                               option, view, points, colors);
+    } else {
         PrintShaderWarning("Rendering type is not geometry::PointCloud.");
         return false;
     }
-    const geometry::PointCloud &pointcloud =
-            (const geometry::PointCloud &)geometry;
-    if (pointcloud.HasPoints() == false) {
-        PrintShaderWarning("Binding failed with empty pointcloud.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.resize(pointcloud.points_.size());
-    colors.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        points[i] = point.cast<float>();
-        Eigen::Vector3d color;
-        switch (option.point_color_option_) {
-            case RenderOption::PointColorOption::XCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetXPercentage(point(0)));
-                break;
-            case RenderOption::PointColorOption::YCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetYPercentage(point(1)));
-                break;
-            case RenderOption::PointColorOption::ZCoordinate:
-                color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetZPercentage(point(2)));
-                break;
-            case RenderOption::PointColorOption::Color:
-            case RenderOption::PointColorOption::Default:
-            default:
-                if (pointcloud.HasColors()) {
-                    color = pointcloud.colors_[i];
-                } else {
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(point(2)));
-                }
-                break;
-        }
-        colors[i] = color.cast<float>();
-    }
+    if (!success) return false;
     draw_arrays_mode_ = GL_POINTS;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
@@ -234,7 +294,8 @@ bool SimpleShaderForLineSet::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::LineSet) {
         PrintShaderWarning("Rendering type is not geometry::LineSet.");
@@ -245,21 +306,40 @@ bool SimpleShaderForLineSet::PrepareBinding(
         PrintShaderWarning("Binding failed with empty geometry::LineSet.");
         return false;
     }
+    draw_arrays_mode_ = GL_LINES;
+    if (lineset.HasColors() == false) {
+        // Without per-line colors the points can be shared between lines, so
+        // they are uploaded once and the lines are drawn as indices.
+        points.resize(lineset.points_.size());
+        colors.assign(lineset.points_.size(), Eigen::Vector3f::Zero());
+        indices.resize(lineset.lines_.size() * 2);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(lineset.points_.size()); i++) {
+            points[i] = lineset.points_[i].cast<float>();
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(lineset.lines_.size()); i++) {
+            indices[i * 2] = GLuint(lineset.lines_[i](0));
+            indices[i * 2 + 1] = GLuint(lineset.lines_[i](1));
+        }
+        draw_arrays_size_ = GLsizei(points.size());
+        return true;
+    }
     points.resize(lineset.lines_.size() * 2);
     colors.resize(lineset.lines_.size() * 2);
-    for (size_t i = 0; i < lineset.lines_.size(); i++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(lineset.lines_.size()); i++) {
         const auto point_pair = lineset.GetLineCoordinate(i);
         points[i * 2] = point_pair.first.cast<float>();
         points[i * 2 + 1] = point_pair.second.cast<float>();
-        Eigen::Vector3d color;
-        if (lineset.HasColors()) {
-            color = lineset.colors_[i];
-        } else {
-            color = Eigen::Vector3d::Zero();
-        }
-        colors[i * 2] = colors[i * 2 + 1] = color.cast<float>();
+        colors[i * 2] = colors[i * 2 + 1] = lineset.colors_[i].cast<float>();
     }
-    draw_arrays_mode_ = GL_LINES;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
 }
@@ -284,7 +364,8 @@ bool SimpleShaderForTetraMesh::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
     typedef decltype(geometry::TetraMesh::tetras_)::value_type TetraIndices;
     typedef decltype(geometry::TetraMesh::tetras_)::value_type::Scalar Index;
     typedef std::tuple<Index, Index> Index2;
@@ -350,7 +431,8 @@ bool SimpleShaderForOrientedBoundingBox::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::OrientedBoundingBox) {
         PrintShaderWarning(
@@ -399,7 +481,8 @@ bool SimpleShaderForAxisAlignedBoundingBox::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
         geometry::Geometry::GeometryType::AxisAlignedBoundingBox) {
         PrintShaderWarning(
@@ -434,7 +517,9 @@ bool SimpleShaderForTriangleMesh::PrepareRendering(
     if (geometry.GetGeometryType() !=
                 geometry::Geometry::GeometryType::TriangleMesh &&
         geometry.GetGeometryType() !=
-                geometry::Geometry::GeometryType::HalfEdgeTriangleMesh) {
+                geometry::Geometry::GeometryType::HalfEdgeTriangleMesh &&
+        geometry.GetGeometryType() !=
+                geometry::Geometry::GeometryType::TriangleMeshF) {
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
@@ -460,414 +545,31 @@ bool SimpleShaderForTriangleMesh::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
-                geometry::Geometry::GeometryType::TriangleMesh &&
-        geometry.GetGeometryType() !=
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLuint> &indices) {
+    bool success;
+    if (geometry.GetGeometryType() ==
+                geometry::Geometry::GeometryType::TriangleMesh ||
+        geometry.GetGeometryType() ==
                 geometry::Geometry::GeometryType::HalfEdgeTriangleMesh) {
+        success = BindTriangleMesh(*this,
+                                   (const geometry::TriangleMesh &)geometry,
+                                   option, view, points, colors, indices);
+    } else if (geometry.GetGeometryType() ==
+               geometry::Geometry::GeometryType::TriangleMeshF) {
+        success = BindTriangleMesh(*this,
+                                   (const geometry::TriangleMeshF &)geometry,
+                                   option, view, points, colors, indices);
+    } else {
         PrintShaderWarning("Rendering type is not geometry::TriangleMesh.");
         return false;
     }
-    const geometry::TriangleMesh &mesh =
-            (const geometry::TriangleMesh &)geometry;
-    if (mesh.HasTriangles() == false) {
-        PrintShaderWarning("Binding failed with empty triangle mesh.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.resize(mesh.triangles_.size() * 3);
-    colors.resize(mesh.triangles_.size() * 3);
-
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-            const auto &vertex = mesh.vertices_[vi];
-            points[idx] = vertex.cast<float>();
-
-            Eigen::Vector3d color;
-            switch (option.mesh_color_option_) {
-                case RenderOption::MeshColorOption::XCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetXPercentage(vertex(0)));
-                    break;
-                case RenderOption::MeshColorOption::YCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetYPercentage(vertex(1)));
-                    break;
-                case RenderOption::MeshColorOption::ZCoordinate:
-                    color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(vertex(2)));
-                    break;
-                case RenderOption::MeshColorOption::Color:
-                    if (mesh.HasVertexColors()) {
-                        color = mesh.vertex_colors_[vi];
-                        break;
-                    }
-                case RenderOption::MeshColorOption::Default:
-                default:
-                    color = option.default_mesh_color_;
-                    break;
-            }
-            colors[idx] = color.cast<float>();
-        }
-    }
+    if (!success) return false;
     draw_arrays_mode_ = GL_TRIANGLES;
     draw_arrays_size_ = GLsizei(points.size());
     return true;
 }
 
-bool SimpleShaderForVoxelGridLine::PrepareRendering(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::VoxelGrid) {
-        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
-        return false;
-    }
-    glDisable(GL_CULL_FACE);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GLenum(option.GetGLDepthFunc()));
-    return true;
-}
-
-bool SimpleShaderForVoxelGridLine::PrepareBinding(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::VoxelGrid) {
-        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
-        return false;
-    }
-    const geometry::VoxelGrid &voxel_grid =
-            (const geometry::VoxelGrid &)geometry;
-    if (voxel_grid.HasVoxels() == false) {
-        PrintShaderWarning("Binding failed with empty voxel grid.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.clear();  // Final size: num_voxels * 12 * 2
-    colors.clear();  // Final size: num_voxels * 12 * 2
-
-    for (auto &it : voxel_grid.voxels_) {
-        const geometry::Voxel &voxel = it.second;
-        // 8 vertices in a voxel
-        Eigen::Vector3f base_vertex =
-                voxel_grid.origin_.cast<float>() +
-                voxel.grid_index_.cast<float>() * voxel_grid.voxel_size_;
-        std::vector<Eigen::Vector3f> vertices;
-        for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-            vertices.push_back(base_vertex + vertex_offset.cast<float>() *
-                                                     voxel_grid.voxel_size_);
-        }
-
-        // Voxel color (applied to all points)
-        Eigen::Vector3d voxel_color;
-        switch (option.mesh_color_option_) {
-            case RenderOption::MeshColorOption::XCoordinate:
-                voxel_color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetXPercentage(base_vertex(0)));
-                break;
-            case RenderOption::MeshColorOption::YCoordinate:
-                voxel_color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetYPercentage(base_vertex(1)));
-                break;
-            case RenderOption::MeshColorOption::ZCoordinate:
-                voxel_color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetZPercentage(base_vertex(2)));
-                break;
-            case RenderOption::MeshColorOption::Color:
-                if (voxel_grid.HasColors()) {
-                    voxel_color = voxel.color_;
-                    break;
-                }
-            case RenderOption::MeshColorOption::Default:
-            default:
-                voxel_color = option.default_mesh_color_;
-                break;
-        }
-        Eigen::Vector3f voxel_color_f = voxel_color.cast<float>();
-
-        // 12 lines
-        for (const Eigen::Vector2i &line_vertex_indices :
-             cuboid_lines_vertex_indices) {
-            points.push_back(vertices[line_vertex_indices(0)]);
-            points.push_back(vertices[line_vertex_indices(1)]);
-            colors.push_back(voxel_color_f);
-            colors.push_back(voxel_color_f);
-        }
-    }
-
-    draw_arrays_mode_ = GL_LINES;
-    draw_arrays_size_ = GLsizei(points.size());
-    return true;
-}
-
-bool SimpleShaderForVoxelGridFace::PrepareRendering(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::VoxelGrid) {
-        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
-        return false;
-    }
-    glDisable(GL_CULL_FACE);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GLenum(option.GetGLDepthFunc()));
-    return true;
-}
-
-bool SimpleShaderForVoxelGridFace::PrepareBinding(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::VoxelGrid) {
-        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
-        return false;
-    }
-    const geometry::VoxelGrid &voxel_grid =
-            (const geometry::VoxelGrid &)geometry;
-    if (voxel_grid.HasVoxels() == false) {
-        PrintShaderWarning("Binding failed with empty voxel grid.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.clear();  // Final size: num_voxels * 36
-    colors.clear();  // Final size: num_voxels * 36
-
-    for (auto &it : voxel_grid.voxels_) {
-        const geometry::Voxel &voxel = it.second;
-        // 8 vertices in a voxel
-        Eigen::Vector3f base_vertex =
-                voxel_grid.origin_.cast<float>() +
-                voxel.grid_index_.cast<float>() * voxel_grid.voxel_size_;
-        std::vector<Eigen::Vector3f> vertices;
-        for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-            vertices.push_back(base_vertex + vertex_offset.cast<float>() *
-                                                     voxel_grid.voxel_size_);
-        }
-
-        // Voxel color (applied to all points)
-        Eigen::Vector3d voxel_color;
-        switch (option.mesh_color_option_) {
-            case RenderOption::MeshColorOption::XCoordinate:
-                voxel_color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetXPercentage(base_vertex(0)));
-                break;
-            case RenderOption::MeshColorOption::YCoordinate:
-                voxel_color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetYPercentage(base_vertex(1)));
-                break;
-            case RenderOption::MeshColorOption::ZCoordinate:
-                voxel_color = global_color_map.GetColor(
-                        view.GetBoundingBox().GetZPercentage(base_vertex(2)));
-                break;
-            case RenderOption::MeshColorOption::Color:
-                if (voxel_grid.HasColors()) {
-                    voxel_color = voxel.color_;
-                    break;
-                }
-            case RenderOption::MeshColorOption::Default:
-            default:
-                voxel_color = option.default_mesh_color_;
-                break;
-        }
-        Eigen::Vector3f voxel_color_f = voxel_color.cast<float>();
-
-        // 12 triangles in a voxel
-        for (const Eigen::Vector3i &triangle_vertex_indices :
-             cuboid_triangles_vertex_indices) {
-            points.push_back(vertices[triangle_vertex_indices(0)]);
-            points.push_back(vertices[triangle_vertex_indices(1)]);
-            points.push_back(vertices[triangle_vertex_indices(2)]);
-            colors.push_back(voxel_color_f);
-            colors.push_back(voxel_color_f);
-            colors.push_back(voxel_color_f);
-        }
-    }
-
-    draw_arrays_mode_ = GL_TRIANGLES;
-    draw_arrays_size_ = GLsizei(points.size());
-
-    return true;
-}
-
-bool SimpleShaderForOctreeFace::PrepareRendering(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::Octree) {
-        PrintShaderWarning("Rendering type is not geometry::Octree.");
-        return false;
-    }
-    glDisable(GL_CULL_FACE);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GLenum(option.GetGLDepthFunc()));
-    return true;
-}
-
-bool SimpleShaderForOctreeFace::PrepareBinding(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::Octree) {
-        PrintShaderWarning("Rendering type is not geometry::Octree.");
-        return false;
-    }
-    const geometry::Octree &octree = (const geometry::Octree &)geometry;
-    if (octree.IsEmpty()) {
-        PrintShaderWarning("Binding failed with empty octree.");
-        return false;
-    }
-    const ColorMap &global_color_map = *GetGlobalColorMap();
-    points.clear();  // Final size: num_voxels * 36
-    colors.clear();  // Final size: num_voxels * 36
-
-    auto f = [&points, &colors, &option, &global_color_map, &view](
-                     const std::shared_ptr<geometry::OctreeNode> &node,
-                     const std::shared_ptr<geometry::OctreeNodeInfo> &node_info)
-            -> void {
-        if (auto leaf_node =
-                    std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
-                            node)) {
-            // All vertex in the voxel share the same color
-            Eigen::Vector3f base_vertex = node_info->origin_.cast<float>();
-            std::vector<Eigen::Vector3f> vertices;
-            for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-                vertices.push_back(base_vertex +
-                                   vertex_offset.cast<float>() *
-                                           float(node_info->size_));
-            }
-
-            Eigen::Vector3d voxel_color;
-            switch (option.mesh_color_option_) {
-                case RenderOption::MeshColorOption::XCoordinate:
-                    voxel_color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetXPercentage(
-                                    base_vertex(0)));
-                    break;
-                case RenderOption::MeshColorOption::YCoordinate:
-                    voxel_color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetYPercentage(
-                                    base_vertex(1)));
-                    break;
-                case RenderOption::MeshColorOption::ZCoordinate:
-                    voxel_color = global_color_map.GetColor(
-                            view.GetBoundingBox().GetZPercentage(
-                                    base_vertex(2)));
-                    break;
-                case RenderOption::MeshColorOption::Color:
-                    voxel_color = leaf_node->color_;
-                    break;
-                case RenderOption::MeshColorOption::Default:
-                default:
-                    voxel_color = option.default_mesh_color_;
-                    break;
-            }
-            Eigen::Vector3f voxel_color_f = voxel_color.cast<float>();
-
-            // 12 triangles in a voxel
-            for (const Eigen::Vector3i &triangle_vertex_indices :
-                 cuboid_triangles_vertex_indices) {
-                points.push_back(vertices[triangle_vertex_indices(0)]);
-                points.push_back(vertices[triangle_vertex_indices(1)]);
-                points.push_back(vertices[triangle_vertex_indices(2)]);
-                colors.push_back(voxel_color_f);
-                colors.push_back(voxel_color_f);
-                colors.push_back(voxel_color_f);
-            }
-        }
-    };
-
-    octree.Traverse(f);
-
-    draw_arrays_mode_ = GL_TRIANGLES;
-    draw_arrays_size_ = GLsizei(points.size());
-
-    return true;
-}
-
-bool SimpleShaderForOctreeLine::PrepareRendering(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::Octree) {
-        PrintShaderWarning("Rendering type is not geometry::Octree.");
-        return false;
-    }
-    glDisable(GL_CULL_FACE);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GLenum(option.GetGLDepthFunc()));
-    return true;
-}
-
-bool SimpleShaderForOctreeLine::PrepareBinding(
-        const geometry::Geometry &geometry,
-        const RenderOption &option,
-        const ViewControl &view,
-        std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector3f> &colors) {
-    if (geometry.GetGeometryType() !=
-        geometry::Geometry::GeometryType::Octree) {
-        PrintShaderWarning("Rendering type is not geometry::Octree.");
-        return false;
-    }
-    const geometry::Octree &octree = (const geometry::Octree &)geometry;
-    if (octree.IsEmpty()) {
-        PrintShaderWarning("Binding failed with empty octree.");
-        return false;
-    }
-    points.clear();  // Final size: num_voxels * 36
-    colors.clear();  // Final size: num_voxels * 36
-
-    auto f = [&points, &colors](
-                     const std::shared_ptr<geometry::OctreeNode> &node,
-                     const std::shared_ptr<geometry::OctreeNodeInfo> &node_info)
-            -> void {
-        Eigen::Vector3f base_vertex = node_info->origin_.cast<float>();
-        std::vector<Eigen::Vector3f> vertices;
-        for (const Eigen::Vector3i &vertex_offset : cuboid_vertex_offsets) {
-            vertices.push_back(base_vertex + vertex_offset.cast<float>() *
-                                                     float(node_info->size_));
-        }
-        Eigen::Vector3f voxel_color = Eigen::Vector3f::Zero();
-        if (auto leaf_node =
-                    std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
-                            node)) {
-            voxel_color = leaf_node->color_.cast<float>();
-        }
-
-        for (const Eigen::Vector2i &line_vertex_indices :
-             cuboid_lines_vertex_indices) {
-            points.push_back(vertices[line_vertex_indices(0)]);
-            points.push_back(vertices[line_vertex_indices(1)]);
-            colors.push_back(voxel_color);
-            colors.push_back(voxel_color);
-        }
-    };
-
-    octree.Traverse(f);
-
-    draw_arrays_mode_ = GL_LINES;
-    draw_arrays_size_ = GLsizei(points.size());
-
-    return true;
-}
-
 }  // namespace glsl
 }  // namespace visualization
 }  // namespace open3d
@@ -62,7 +62,8 @@ protected:
                                 const RenderOption &option,
                                 const ViewControl &view,
                                 std::vector<Eigen::Vector3f> &points,
-                                std::vector<Eigen::Vector3f> &colors) = 0;
+                                std::vector<Eigen::Vector3f> &colors,
+                                std::vector<GLuint> &indices) = 0;
 
 protected:
     GLuint vertex_position_;
@@ -84,7 +85,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 class SimpleShaderForLineSet : public SimpleShader {
@@ -99,7 +101,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 class SimpleShaderForTetraMesh : public SimpleShader {
@@ -114,7 +117,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 class SimpleShaderForOrientedBoundingBox : public SimpleShader {
@@ -130,7 +134,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 class SimpleShaderForAxisAlignedBoundingBox : public SimpleShader {
@@ -146,7 +151,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 class SimpleShaderForTriangleMesh : public SimpleShader {
@@ -162,69 +168,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
-};
-
-class SimpleShaderForVoxelGridLine : public SimpleShader {
-public:
-    SimpleShaderForVoxelGridLine()
-        : SimpleShader("SimpleShaderForVoxelGridLine") {}
-
-protected:
-    bool PrepareRendering(const geometry::Geometry &geometry,
-                          const RenderOption &option,
-                          const ViewControl &view) final;
-    bool PrepareBinding(const geometry::Geometry &geometry,
-                        const RenderOption &option,
-                        const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
-};
-
-class SimpleShaderForVoxelGridFace : public SimpleShader {
-public:
-    SimpleShaderForVoxelGridFace()
-        : SimpleShader("SimpleShaderForVoxelGridFace") {}
-
-protected:
-    bool PrepareRendering(const geometry::Geometry &geometry,
-                          const RenderOption &option,
-                          const ViewControl &view) final;
-    bool PrepareBinding(const geometry::Geometry &geometry,
-                        const RenderOption &option,
-                        const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
-};
-
-class SimpleShaderForOctreeLine : public SimpleShader {
-public:
-    SimpleShaderForOctreeLine() : SimpleShader("SimpleShaderForOctreeLine") {}
-
-protected:
-    bool PrepareRendering(const geometry::Geometry &geometry,
-                          const RenderOption &option,
-                          const ViewControl &view) final;
-    bool PrepareBinding(const geometry::Geometry &geometry,
-                        const RenderOption &option,
-                        const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
-};
-
-class SimpleShaderForOctreeFace : public SimpleShader {
-public:
-    SimpleShaderForOctreeFace() : SimpleShader("SimpleShaderForOctreeFace") {}
-
-protected:
-    bool PrepareRendering(const geometry::Geometry &geometry,
-                          const RenderOption &option,
-                          const ViewControl &view) final;
-    bool PrepareBinding(const geometry::Geometry &geometry,
-                        const RenderOption &option,
-                        const ViewControl &view,
-                        std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector3f> &colors) final;
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLuint> &indices) final;
 };
 
 }  // namespace glsl
@@ -0,0 +1,366 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Shader/StreamShader.h"
+
+#include <algorithm>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Visualization/Shader/Shader.h"
+#include "Open3D/Visualization/Utility/ColorMap.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+namespace {
+
+// Capacity of the buffers of a cloud that is not streamed in a window, so
+// that the first appends do not reallocate.
+const size_t kMinStreamCapacity = 65536;
+
+Eigen::Vector3d GetPointColor(const geometry::PointCloud &pointcloud,
+                              size_t i,
+                              const RenderOption &option,
+                              const ViewControl &view,
+                              const ColorMap &global_color_map) {
+    const auto &point = pointcloud.points_[i];
+    switch (option.point_color_option_) {
+        case RenderOption::PointColorOption::XCoordinate:
+            return global_color_map.GetColor(
+                    view.GetBoundingBox().GetXPercentage(point(0)));
+        case RenderOption::PointColorOption::YCoordinate:
+            return global_color_map.GetColor(
+                    view.GetBoundingBox().GetYPercentage(point(1)));
+        case RenderOption::PointColorOption::ZCoordinate:
+            return global_color_map.GetColor(
+                    view.GetBoundingBox().GetZPercentage(point(2)));
+        case RenderOption::PointColorOption::Normal:
+            if (pointcloud.HasNormals()) {
+                // Colors are uploaded once, so they are taken from the world
+                // space normal, which does not change with the view.
+                return pointcloud.normals_[i] * 0.5 +
+                       Eigen::Vector3d::Constant(0.5);
+            }
+            // fall through
+        case RenderOption::PointColorOption::Color:
+        case RenderOption::PointColorOption::Default:
+        default:
+            if (pointcloud.HasColors()) {
+                return pointcloud.colors_[i];
+            } else {
+                return global_color_map.GetColor(
+                        view.GetBoundingBox().GetZPercentage(point(2)));
+            }
+    }
+}
+
+}  // unnamed namespace
+
+void StreamShader::SetWindowSize(int window_size) {
+    window_size = std::max(window_size, 0);
+    if (window_size != window_size_) {
+        window_size_ = window_size;
+        InvalidateGeometry();
+    }
+}
+
+bool StreamShader::BindGeometry(const geometry::Geometry &geometry,
+                                const RenderOption &option,
+                                const ViewControl &view) {
+    UnbindGeometry();
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    if (pointcloud.HasPoints() == false) {
+        PrintShaderWarning("Binding failed with empty pointcloud.");
+        return false;
+    }
+    if (with_normals_ && pointcloud.HasNormals() == false) {
+        PrintShaderWarning("Binding failed with pointcloud with no normals.");
+        return false;
+    }
+    // Buffers of a window never grow, so they are allocated to full size.
+    if (window_size_ > 0) {
+        Reserve(size_t(window_size_));
+    } else {
+        Reserve(std::max(pointcloud.points_.size(), kMinStreamCapacity));
+    }
+    UploadRange(pointcloud, option, view, 0, pointcloud.points_.size());
+    bound_ = true;
+    return true;
+}
+
+void StreamShader::UnbindGeometry() {
+    if (bound_) {
+        glDeleteBuffers(1, &vertex_position_buffer_);
+        glDeleteBuffers(1, &vertex_color_buffer_);
+        if (with_normals_) {
+            glDeleteBuffers(1, &vertex_normal_buffer_);
+        }
+        capacity_ = 0;
+        count_ = 0;
+        head_ = 0;
+        uploaded_points_ = 0;
+        bound_ = false;
+    }
+}
+
+bool StreamShader::PrepareStreamRendering(const geometry::Geometry &geometry,
+                                          const RenderOption &option,
+                                          const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::PointCloud) {
+        PrintShaderWarning("Rendering type is not geometry::PointCloud.");
+        return false;
+    }
+    const geometry::PointCloud &pointcloud =
+            (const geometry::PointCloud &)geometry;
+    if (pointcloud.points_.size() < uploaded_points_ ||
+        (with_normals_ && pointcloud.HasNormals() == false)) {
+        // Points were removed, so the buffers can not be appended to.
+        if (BindGeometry(geometry, option, view) == false) {
+            return false;
+        }
+    } else if (pointcloud.points_.size() > uploaded_points_) {
+        UploadRange(pointcloud, option, view, uploaded_points_,
+                    pointcloud.points_.size());
+    }
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    glPointSize(GLfloat(option.point_size_));
+    return true;
+}
+
+void StreamShader::EnableVertexAttributes() {
+    glEnableVertexAttribArray(vertex_position_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    if (with_normals_) {
+        glEnableVertexAttribArray(vertex_normal_);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
+        glVertexAttribPointer(vertex_normal_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    }
+    glEnableVertexAttribArray(vertex_color_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+    glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+}
+
+void StreamShader::DisableVertexAttributes() {
+    glDisableVertexAttribArray(vertex_position_);
+    if (with_normals_) {
+        glDisableVertexAttribArray(vertex_normal_);
+    }
+    glDisableVertexAttribArray(vertex_color_);
+}
+
+void StreamShader::DrawPoints() {
+    // The order of the points in a ring buffer does not matter for drawing.
+    glDrawArrays(GL_POINTS, 0, GLsizei(count_));
+}
+
+void StreamShader::UploadRange(const geometry::PointCloud &pointcloud,
+                               const RenderOption &option,
+                               const ViewControl &view,
+                               size_t begin,
+                               size_t end) {
+    uploaded_points_ = end;
+    if (window_size_ > 0 && end - begin > capacity_) {
+        // Points that would be overwritten in the same upload are skipped.
+        begin = end - capacity_;
+    }
+    const size_t n = end - begin;
+    if (n == 0) {
+        return;
+    }
+
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    std::vector<Eigen::Vector3f> points(n);
+    std::vector<Eigen::Vector3f> normals(with_normals_ ? n : 0);
+    std::vector<Eigen::Vector3f> colors(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(n); i++) {
+        points[i] = pointcloud.points_[begin + i].cast<float>();
+        if (with_normals_) {
+            normals[i] = pointcloud.normals_[begin + i].cast<float>();
+        }
+        colors[i] = GetPointColor(pointcloud, begin + i, option, view,
+                                  global_color_map)
+                            .cast<float>();
+    }
+
+    if (window_size_ > 0) {
+        // Write at the head of the ring buffer, wrapping around at the end.
+        size_t first = std::min(n, capacity_ - head_);
+        WriteBuffers(head_, points, normals, colors, 0, first);
+        WriteBuffers(0, points, normals, colors, first, n - first);
+        head_ = (head_ + n) % capacity_;
+        count_ = std::min(count_ + n, capacity_);
+    } else {
+        Reserve(count_ + n);
+        WriteBuffers(count_, points, normals, colors, 0, n);
+        count_ += n;
+    }
+}
+
+void StreamShader::Reserve(size_t capacity) {
+    if (capacity <= capacity_) {
+        return;
+    }
+    if (window_size_ <= 0) {
+        capacity = std::max(capacity, capacity_ * 2);
+    }
+    auto GrowBuffer = [&](GLuint &buffer) {
+        GLuint new_buffer;
+        glGenBuffers(1, &new_buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, new_buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, capacity * sizeof(Eigen::Vector3f),
+                     NULL, GL_DYNAMIC_DRAW);
+        if (capacity_ > 0) {
+            // The uploaded points are copied on the GPU.
+            glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0,
+                                count_ * sizeof(Eigen::Vector3f));
+            glDeleteBuffers(1, &buffer);
+        }
+        buffer = new_buffer;
+    };
+    GrowBuffer(vertex_position_buffer_);
+    GrowBuffer(vertex_color_buffer_);
+    if (with_normals_) {
+        GrowBuffer(vertex_normal_buffer_);
+    }
+    capacity_ = capacity;
+}
+
+void StreamShader::WriteBuffers(size_t offset,
+                                const std::vector<Eigen::Vector3f> &points,
+                                const std::vector<Eigen::Vector3f> &normals,
+                                const std::vector<Eigen::Vector3f> &colors,
+                                size_t begin,
+                                size_t count) {
+    if (count == 0) {
+        return;
+    }
+    const GLintptr byte_offset = offset * sizeof(Eigen::Vector3f);
+    const GLsizeiptr byte_size = count * sizeof(Eigen::Vector3f);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBufferSubData(GL_ARRAY_BUFFER, byte_offset, byte_size,
+                    points.data() + begin);
+    if (with_normals_) {
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
+        glBufferSubData(GL_ARRAY_BUFFER, byte_offset, byte_size,
+                        normals.data() + begin);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+    glBufferSubData(GL_ARRAY_BUFFER, byte_offset, byte_size,
+                    colors.data() + begin);
+}
+
+bool SimpleShaderForPointCloudStream::Compile() {
+    if (CompileShaders(SimpleVertexShader, NULL, SimpleFragmentShader) ==
+        false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void SimpleShaderForPointCloudStream::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool SimpleShaderForPointCloudStream::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareStreamRendering(geometry, option, view) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    EnableVertexAttributes();
+    DrawPoints();
+    DisableVertexAttributes();
+    return true;
+}
+
+bool PhongShaderForPointCloudStream::Compile() {
+    if (CompileShaders(PhongVertexShader, NULL, PhongFragmentShader) == false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_normal_ = glGetAttribLocation(program_, "vertex_normal");
+    vertex_color_ = glGetAttribLocation(program_, "vertex_color");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    V_ = glGetUniformLocation(program_, "V");
+    M_ = glGetUniformLocation(program_, "M");
+    lighting_.GetUniformLocations(program_);
+    return true;
+}
+
+void PhongShaderForPointCloudStream::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool PhongShaderForPointCloudStream::RenderGeometry(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (PrepareStreamRendering(geometry, option, view) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    lighting_.Update(view, option);
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glUniformMatrix4fv(V_, 1, GL_FALSE, view.GetViewMatrix().data());
+    glUniformMatrix4fv(M_, 1, GL_FALSE, view.GetModelMatrix().data());
+    lighting_.Upload();
+    EnableVertexAttributes();
+    DrawPoints();
+    DisableVertexAttributes();
+    return true;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "Open3D/Visualization/Shader/PhongShader.h"
+#include "Open3D/Visualization/Shader/ShaderWrapper.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}  // namespace geometry
+
+namespace visualization {
+
+namespace glsl {
+
+/// Base class of the shaders for point clouds that grow by appending points,
+/// e.g. the map of a live SLAM system.
+/// The attribute buffers are allocated with spare capacity, which is doubled
+/// on the GPU when exhausted, and every frame only the points appended to the
+/// cloud since the last upload are sent. With a positive window size, the
+/// buffers are used as a ring buffer that keeps the most recently appended
+/// points, and the oldest points are overwritten.
+/// Changes to points that were already uploaded are not detected: they
+/// require InvalidateGeometry(). If the cloud shrinks, it is uploaded again.
+class StreamShader : public ShaderWrapper {
+public:
+    ~StreamShader() override {}
+
+public:
+    /// Sets the number of most recently appended points to draw, 0 to draw
+    /// all points. Changing the window size uploads the cloud again.
+    void SetWindowSize(int window_size);
+    int GetWindowSize() const { return window_size_; }
+
+protected:
+    StreamShader(const std::string &name, bool with_normals)
+        : ShaderWrapper(name), with_normals_(with_normals) {}
+
+protected:
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    /// Uploads the points appended since the last upload, and sets the GL
+    /// state for drawing points.
+    bool PrepareStreamRendering(const geometry::Geometry &geometry,
+                                const RenderOption &option,
+                                const ViewControl &view);
+    void EnableVertexAttributes();
+    void DisableVertexAttributes();
+    void DrawPoints();
+
+private:
+    /// Uploads the points [begin, end) of the cloud after the points already
+    /// in the buffers.
+    void UploadRange(const geometry::PointCloud &pointcloud,
+                     const RenderOption &option,
+                     const ViewControl &view,
+                     size_t begin,
+                     size_t end);
+    /// Grows the buffers to hold at least \p capacity points, keeping the
+    /// uploaded points.
+    void Reserve(size_t capacity);
+    void WriteBuffers(size_t offset,
+                      const std::vector<Eigen::Vector3f> &points,
+                      const std::vector<Eigen::Vector3f> &normals,
+                      const std::vector<Eigen::Vector3f> &colors,
+                      size_t begin,
+                      size_t count);
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_normal_;
+    GLuint vertex_color_;
+    GLuint MVP_;
+
+private:
+    GLuint vertex_position_buffer_;
+    GLuint vertex_normal_buffer_;
+    GLuint vertex_color_buffer_;
+    bool with_normals_;
+    int window_size_ = 0;
+    /// Number of points the buffers can hold.
+    size_t capacity_ = 0;
+    /// Number of points in the buffers.
+    size_t count_ = 0;
+    /// Next position to write to when used as a ring buffer.
+    size_t head_ = 0;
+    /// Number of points of the cloud that have been uploaded.
+    size_t uploaded_points_ = 0;
+};
+
+class SimpleShaderForPointCloudStream : public StreamShader {
+public:
+    SimpleShaderForPointCloudStream()
+        : StreamShader("SimpleShaderForPointCloudStream", false) {
+        Compile();
+    }
+    ~SimpleShaderForPointCloudStream() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+};
+
+class PhongShaderForPointCloudStream : public StreamShader {
+public:
+    PhongShaderForPointCloudStream()
+        : StreamShader("PhongShaderForPointCloudStream", true) {
+        Compile();
+    }
+    ~PhongShaderForPointCloudStream() override { Release(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+
+protected:
+    GLuint V_;
+    GLuint M_;
+    PhongLighting lighting_;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Shader/Shader.h"
+#include "Open3D/Visualization/Shader/TextureSimpleShader.h"
 #include "Open3D/Visualization/Utility/ColorMap.h"
 
 namespace open3d {
@@ -49,16 +50,7 @@ bool TexturePhongShader::Compile() {
     MVP_ = glGetUniformLocation(program_, "MVP");
     V_ = glGetUniformLocation(program_, "V");
     M_ = glGetUniformLocation(program_, "M");
-    light_position_world_ =
-            glGetUniformLocation(program_, "light_position_world_4");
-    light_color_ = glGetUniformLocation(program_, "light_color_4");
-    light_diffuse_power_ =
-            glGetUniformLocation(program_, "light_diffuse_power_4");
-    light_specular_power_ =
-            glGetUniformLocation(program_, "light_specular_power_4");
-    light_specular_shininess_ =
-            glGetUniformLocation(program_, "light_specular_shininess_4");
-    light_ambient_ = glGetUniformLocation(program_, "light_ambient");
+    lighting_.GetUniformLocations(program_);
 
     diffuse_texture_ = glGetUniformLocation(program_, "diffuse_texture");
     return true;
@@ -84,8 +76,10 @@ bool TexturePhongShader::BindGeometry(const geometry::Geometry &geometry,
     std::vector<Eigen::Vector3f> points;
     std::vector<Eigen::Vector3f> normals;
     std::vector<Eigen::Vector2f> uvs;
+    std::vector<GLuint> indices;
 
-    if (PrepareBinding(geometry, option, view, points, normals, uvs) == false) {
+    if (PrepareBinding(geometry, option, view, points, normals, uvs,
+                       indices) == false) {
         PrintShaderWarning("Binding failed when preparing data.");
         return false;
     }
@@ -103,6 +97,7 @@ bool TexturePhongShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_uv_buffer_);
     glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(Eigen::Vector2f),
                  uvs.data(), GL_STATIC_DRAW);
+    BindElementBuffer(indices);
     bound_ = true;
     return true;
 }
@@ -118,14 +113,7 @@ bool TexturePhongShader::RenderGeometry(const geometry::Geometry &geometry,
     glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
     glUniformMatrix4fv(V_, 1, GL_FALSE, view.GetViewMatrix().data());
     glUniformMatrix4fv(M_, 1, GL_FALSE, view.GetModelMatrix().data());
-    glUniformMatrix4fv(light_position_world_, 1, GL_FALSE,
-                       light_position_world_data_.data());
-    glUniformMatrix4fv(light_color_, 1, GL_FALSE, light_color_data_.data());
-    glUniform4fv(light_diffuse_power_, 1, light_diffuse_power_data_.data());
-    glUniform4fv(light_specular_power_, 1, light_specular_power_data_.data());
-    glUniform4fv(light_specular_shininess_, 1,
-                 light_specular_shininess_data_.data());
-    glUniform4fv(light_ambient_, 1, light_ambient_data_.data());
+    lighting_.Upload();
 
     glUniform1i(diffuse_texture_, 0);
     glActiveTexture(GL_TEXTURE0);
@@ -143,7 +131,7 @@ bool TexturePhongShader::RenderGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_uv_buffer_);
     glVertexAttribPointer(vertex_uv_, 2, GL_FLOAT, GL_FALSE, 0, NULL);
 
-    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    DrawGeometry();
 
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_normal_);
@@ -157,47 +145,11 @@ void TexturePhongShader::UnbindGeometry() {
         glDeleteBuffers(1, &vertex_normal_buffer_);
         glDeleteBuffers(1, &vertex_uv_buffer_);
         glDeleteTextures(1, &diffuse_texture_buffer_);
+        UnbindElementBuffer();
         bound_ = false;
     }
 }
 
-void TexturePhongShader::SetLighting(const ViewControl &view,
-                                     const RenderOption &option) {
-    const auto &box = view.GetBoundingBox();
-    light_position_world_data_.setOnes();
-    light_color_data_.setOnes();
-    for (int i = 0; i < 4; i++) {
-        light_position_world_data_.block<3, 1>(0, i) =
-                box.GetCenter().cast<GLfloat>() +
-                (float)box.GetMaxExtent() *
-                        ((float)option.light_position_relative_[i](0) *
-                                 view.GetRight() +
-                         (float)option.light_position_relative_[i](1) *
-                                 view.GetUp() +
-                         (float)option.light_position_relative_[i](2) *
-                                 view.GetFront());
-        light_color_data_.block<3, 1>(0, i) =
-                option.light_color_[i].cast<GLfloat>();
-    }
-    if (option.light_on_) {
-        light_diffuse_power_data_ =
-                Eigen::Vector4d(option.light_diffuse_power_).cast<GLfloat>();
-        light_specular_power_data_ =
-                Eigen::Vector4d(option.light_specular_power_).cast<GLfloat>();
-        light_specular_shininess_data_ =
-                Eigen::Vector4d(option.light_specular_shininess_)
-                        .cast<GLfloat>();
-        light_ambient_data_.block<3, 1>(0, 0) =
-                option.light_ambient_color_.cast<GLfloat>();
-        light_ambient_data_(3) = 1.0f;
-    } else {
-        light_diffuse_power_data_ = GLHelper::GLVector4f::Zero();
-        light_specular_power_data_ = GLHelper::GLVector4f::Zero();
-        light_specular_shininess_data_ = GLHelper::GLVector4f::Ones();
-        light_ambient_data_ = GLHelper::GLVector4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-}
-
 bool TexturePhongShaderForTriangleMesh::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
@@ -223,7 +175,7 @@ bool TexturePhongShaderForTriangleMesh::PrepareRendering(
     } else {
         glDisable(GL_POLYGON_OFFSET_FILL);
     }
-    SetLighting(view, option);
+    lighting_.Update(view, option);
     return true;
 }
 
@@ -233,7 +185,8 @@ bool TexturePhongShaderForTriangleMesh::PrepareBinding(
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
         std::vector<Eigen::Vector3f> &normals,
-        std::vector<Eigen::Vector2f> &uvs) {
+        std::vector<Eigen::Vector2f> &uvs,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
                 geometry::Geometry::GeometryType::TriangleMesh &&
         geometry.GetGeometryType() !=
@@ -253,24 +206,43 @@ bool TexturePhongShaderForTriangleMesh::PrepareBinding(
         PrintShaderWarning("Call ComputeVertexNormals() before binding.");
         return false;
     }
-    points.resize(mesh.triangles_.size() * 3);
-    normals.resize(mesh.triangles_.size() * 3);
-    uvs.resize(mesh.triangles_.size() * 3);
-
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-
-            points[idx] = mesh.vertices_[vi].cast<float>();
-            uvs[idx] = mesh.triangle_uvs_[idx].cast<float>();
-
-            if (option.mesh_shade_option_ ==
-                RenderOption::MeshShadeOption::FlatShade) {
-                normals[idx] = mesh.triangle_normals_[i].cast<float>();
-            } else {
-                normals[idx] = mesh.vertex_normals_[vi].cast<float>();
+    // Flat shading and texture seams need per-corner attributes; everything
+    // else is drawn indexed from the shared vertices.
+    if (option.mesh_shade_option_ !=
+                RenderOption::MeshShadeOption::FlatShade &&
+        ConvertTriangleUVsToVertexUVs(mesh, uvs)) {
+        points.resize(mesh.vertices_.size());
+        normals.resize(mesh.vertices_.size());
+        for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+            points[i] = mesh.vertices_[i].cast<float>();
+            normals[i] = mesh.vertex_normals_[i].cast<float>();
+        }
+        indices.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            indices[i * 3] = GLuint(triangle(0));
+            indices[i * 3 + 1] = GLuint(triangle(1));
+            indices[i * 3 + 2] = GLuint(triangle(2));
+        }
+    } else {
+        points.resize(mesh.triangles_.size() * 3);
+        normals.resize(mesh.triangles_.size() * 3);
+        uvs.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            for (size_t j = 0; j < 3; j++) {
+                size_t idx = i * 3 + j;
+                size_t vi = triangle(j);
+
+                points[idx] = mesh.vertices_[vi].cast<float>();
+                uvs[idx] = mesh.triangle_uvs_[idx].cast<float>();
+
+                if (option.mesh_shade_option_ ==
+                    RenderOption::MeshShadeOption::FlatShade) {
+                    normals[idx] = mesh.triangle_normals_[i].cast<float>();
+                } else {
+                    normals[idx] = mesh.vertex_normals_[vi].cast<float>();
+                }
             }
         }
     }
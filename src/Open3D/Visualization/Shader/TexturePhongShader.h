@@ -29,6 +29,7 @@
 #include <Eigen/Core>
 #include <vector>
 
+#include "Open3D/Visualization/Shader/PhongShader.h"
 #include "Open3D/Visualization/Shader/ShaderWrapper.h"
 
 namespace open3d {
@@ -65,10 +66,8 @@ protected:
                                 const ViewControl &view,
                                 std::vector<Eigen::Vector3f> &points,
                                 std::vector<Eigen::Vector3f> &normals,
-                                std::vector<Eigen::Vector2f> &uvs) = 0;
-
-protected:
-    void SetLighting(const ViewControl &view, const RenderOption &option);
+                                std::vector<Eigen::Vector2f> &uvs,
+                                std::vector<GLuint> &indices) = 0;
 
 protected:
     GLuint vertex_position_;
@@ -80,23 +79,10 @@ protected:
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
-    GLuint light_position_world_;
-    GLuint light_color_;
-    GLuint light_diffuse_power_;
-    GLuint light_specular_power_;
-    GLuint light_specular_shininess_;
-    GLuint light_ambient_;
+    PhongLighting lighting_;
 
     GLuint diffuse_texture_;
     GLuint diffuse_texture_buffer_;
-
-    // At most support 4 lights
-    GLHelper::GLMatrix4f light_position_world_data_;
-    GLHelper::GLMatrix4f light_color_data_;
-    GLHelper::GLVector4f light_diffuse_power_data_;
-    GLHelper::GLVector4f light_specular_power_data_;
-    GLHelper::GLVector4f light_specular_shininess_data_;
-    GLHelper::GLVector4f light_ambient_data_;
 };
 
 class TexturePhongShaderForTriangleMesh : public TexturePhongShader {
@@ -113,7 +99,8 @@ protected:
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
                         std::vector<Eigen::Vector3f> &normals,
-                        std::vector<Eigen::Vector2f> &uvs) final;
+                        std::vector<Eigen::Vector2f> &uvs,
+                        std::vector<GLuint> &indices) final;
 };
 
 }  // namespace glsl
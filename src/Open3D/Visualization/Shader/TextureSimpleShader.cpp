@@ -34,6 +34,30 @@ namespace open3d {
 namespace visualization {
 namespace glsl {
 
+bool ConvertTriangleUVsToVertexUVs(const geometry::TriangleMesh &mesh,
+                                   std::vector<Eigen::Vector2f> &uvs) {
+    if (mesh.triangle_uvs_.size() != mesh.triangles_.size() * 3) {
+        return false;
+    }
+    std::vector<bool> assigned(mesh.vertices_.size(), false);
+    uvs.assign(mesh.vertices_.size(), Eigen::Vector2f::Zero());
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const auto &triangle = mesh.triangles_[i];
+        for (size_t j = 0; j < 3; j++) {
+            size_t vi = triangle(j);
+            Eigen::Vector2f uv = mesh.triangle_uvs_[i * 3 + j].cast<float>();
+            if (!assigned[vi]) {
+                uvs[vi] = uv;
+                assigned[vi] = true;
+            } else if (uvs[vi] != uv) {
+                uvs.clear();
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 bool TextureSimpleShader::Compile() {
     if (CompileShaders(TextureSimpleVertexShader, NULL,
                        TextureSimpleFragmentShader) == false) {
@@ -66,7 +90,9 @@ bool TextureSimpleShader::BindGeometry(const geometry::Geometry &geometry,
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
     std::vector<Eigen::Vector2f> uvs;
-    if (PrepareBinding(geometry, option, view, points, uvs) == false) {
+    std::vector<GLuint> indices;
+    if (PrepareBinding(geometry, option, view, points, uvs, indices) ==
+        false) {
         PrintShaderWarning("Binding failed when preparing data.");
         return false;
     }
@@ -80,6 +106,7 @@ bool TextureSimpleShader::BindGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_uv_buffer_);
     glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(Eigen::Vector2f),
                  uvs.data(), GL_STATIC_DRAW);
+    BindElementBuffer(indices);
     bound_ = true;
     return true;
 }
@@ -106,7 +133,7 @@ bool TextureSimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     glBindBuffer(GL_ARRAY_BUFFER, vertex_uv_buffer_);
     glVertexAttribPointer(vertex_uv_, 2, GL_FLOAT, GL_FALSE, 0, NULL);
 
-    glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
+    DrawGeometry();
     glDisableVertexAttribArray(vertex_position_);
     glDisableVertexAttribArray(vertex_uv_);
     return true;
@@ -117,6 +144,7 @@ void TextureSimpleShader::UnbindGeometry() {
         glDeleteBuffers(1, &vertex_position_buffer_);
         glDeleteBuffers(1, &vertex_uv_buffer_);
         glDeleteTextures(1, &texture_buffer_);
+        UnbindElementBuffer();
         bound_ = false;
     }
 }
@@ -154,7 +182,8 @@ bool TextureSimpleShaderForTriangleMesh::PrepareBinding(
         const RenderOption &option,
         const ViewControl &view,
         std::vector<Eigen::Vector3f> &points,
-        std::vector<Eigen::Vector2f> &uvs) {
+        std::vector<Eigen::Vector2f> &uvs,
+        std::vector<GLuint> &indices) {
     if (geometry.GetGeometryType() !=
                 geometry::Geometry::GeometryType::TriangleMesh &&
         geometry.GetGeometryType() !=
@@ -168,16 +197,30 @@ bool TextureSimpleShaderForTriangleMesh::PrepareBinding(
         PrintShaderWarning("Binding failed with empty triangle mesh.");
         return false;
     }
-    points.resize(mesh.triangles_.size() * 3);
-    uvs.resize(mesh.triangles_.size() * 3);
-
-    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
-        const auto &triangle = mesh.triangles_[i];
-        for (size_t j = 0; j < 3; j++) {
-            size_t idx = i * 3 + j;
-            size_t vi = triangle(j);
-            points[idx] = mesh.vertices_[vi].cast<float>();
-            uvs[idx] = mesh.triangle_uvs_[idx].cast<float>();
+    if (ConvertTriangleUVsToVertexUVs(mesh, uvs)) {
+        points.resize(mesh.vertices_.size());
+        for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+            points[i] = mesh.vertices_[i].cast<float>();
+        }
+        indices.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            indices[i * 3] = GLuint(triangle(0));
+            indices[i * 3 + 1] = GLuint(triangle(1));
+            indices[i * 3 + 2] = GLuint(triangle(2));
+        }
+    } else {
+        // Texture seams need per-corner UVs, fall back to de-indexed arrays.
+        points.resize(mesh.triangles_.size() * 3);
+        uvs.resize(mesh.triangles_.size() * 3);
+        for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+            const auto &triangle = mesh.triangles_[i];
+            for (size_t j = 0; j < 3; j++) {
+                size_t idx = i * 3 + j;
+                size_t vi = triangle(j);
+                points[idx] = mesh.vertices_[vi].cast<float>();
+                uvs[idx] = mesh.triangle_uvs_[idx].cast<float>();
+            }
         }
     }
 
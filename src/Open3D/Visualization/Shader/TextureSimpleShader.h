@@ -32,10 +32,23 @@
 #include "Open3D/Visualization/Shader/ShaderWrapper.h"
 
 namespace open3d {
+
+namespace geometry {
+class TriangleMesh;
+}
+
 namespace visualization {
 
 namespace glsl {
 
+/// Function to convert the per-corner texture coordinates of a mesh
+/// (TriangleMesh::triangle_uvs_) to per-vertex texture coordinates.
+/// Returns false if a vertex is shared by corners with different texture
+/// coordinates (e.g. along a texture seam), in which case the mesh has to be
+/// rendered de-indexed.
+bool ConvertTriangleUVsToVertexUVs(const geometry::TriangleMesh &mesh,
+                                   std::vector<Eigen::Vector2f> &uvs);
+
 class TextureSimpleShader : public ShaderWrapper {
 public:
     ~TextureSimpleShader() override { Release(); }
@@ -64,7 +77,8 @@ protected:
                                 const RenderOption &option,
                                 const ViewControl &view,
                                 std::vector<Eigen::Vector3f> &points,
-                                std::vector<Eigen::Vector2f> &uvs) = 0;
+                                std::vector<Eigen::Vector2f> &uvs,
+                                std::vector<GLuint> &indices) = 0;
 
 protected:
     GLuint vertex_position_;
@@ -89,7 +103,8 @@ protected:
                         const RenderOption &option,
                         const ViewControl &view,
                         std::vector<Eigen::Vector3f> &points,
-                        std::vector<Eigen::Vector2f> &uvs) final;
+                        std::vector<Eigen::Vector2f> &uvs,
+                        std::vector<GLuint> &indices) final;
 };
 
 }  // namespace glsl
@@ -0,0 +1,565 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Shader/VoxelShader.h"
+
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Visualization/Shader/Shader.h"
+#include "Open3D/Visualization/Utility/ColorMap.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+namespace {
+
+// Coordinates of 8 vertices in a cuboid (assume origin (0,0,0), size 1)
+const std::vector<Eigen::Vector3i> cuboid_vertex_offsets{
+        Eigen::Vector3i(0, 0, 0), Eigen::Vector3i(1, 0, 0),
+        Eigen::Vector3i(0, 1, 0), Eigen::Vector3i(1, 1, 0),
+        Eigen::Vector3i(0, 0, 1), Eigen::Vector3i(1, 0, 1),
+        Eigen::Vector3i(0, 1, 1), Eigen::Vector3i(1, 1, 1),
+};
+
+// Vertex indices of 12 triangles in a cuboid, for right-handed manifold mesh
+const std::vector<Eigen::Vector3i> cuboid_triangles_vertex_indices{
+        Eigen::Vector3i(0, 2, 1), Eigen::Vector3i(0, 1, 4),
+        Eigen::Vector3i(0, 4, 2), Eigen::Vector3i(5, 1, 7),
+        Eigen::Vector3i(5, 7, 4), Eigen::Vector3i(5, 4, 1),
+        Eigen::Vector3i(3, 7, 1), Eigen::Vector3i(3, 1, 2),
+        Eigen::Vector3i(3, 2, 7), Eigen::Vector3i(6, 4, 7),
+        Eigen::Vector3i(6, 7, 2), Eigen::Vector3i(6, 2, 4),
+};
+
+// Vertex indices of 12 lines in a cuboid
+const std::vector<Eigen::Vector2i> cuboid_lines_vertex_indices{
+        Eigen::Vector2i(0, 1), Eigen::Vector2i(0, 2), Eigen::Vector2i(0, 4),
+        Eigen::Vector2i(3, 1), Eigen::Vector2i(3, 2), Eigen::Vector2i(3, 7),
+        Eigen::Vector2i(5, 1), Eigen::Vector2i(5, 4), Eigen::Vector2i(5, 7),
+        Eigen::Vector2i(6, 2), Eigen::Vector2i(6, 4), Eigen::Vector2i(6, 7),
+};
+
+// Face mask with all six faces visible.
+const GLfloat kAllFacesVisible = 63.0f;
+
+// Index of the cuboid face (-x, +x, -y, +y, -z, +z) a triangle lies on, found
+// from the coordinate its three vertices share.
+int GetTriangleFace(const Eigen::Vector3i &triangle) {
+    for (int axis = 0; axis < 3; axis++) {
+        int c = cuboid_vertex_offsets[triangle(0)](axis);
+        if (cuboid_vertex_offsets[triangle(1)](axis) == c &&
+            cuboid_vertex_offsets[triangle(2)](axis) == c) {
+            return axis * 2 + c;
+        }
+    }
+    return 0;
+}
+
+// Color of a voxel. \p color is the color stored in the voxel, or nullptr if
+// the geometry has no colors.
+Eigen::Vector3f GetVoxelColor(const Eigen::Vector3f &base_vertex,
+                              const Eigen::Vector3d *color,
+                              const RenderOption &option,
+                              const ViewControl &view,
+                              const ColorMap &global_color_map) {
+    switch (option.mesh_color_option_) {
+        case RenderOption::MeshColorOption::XCoordinate:
+            return global_color_map
+                    .GetColor(view.GetBoundingBox().GetXPercentage(
+                            base_vertex(0)))
+                    .cast<float>();
+        case RenderOption::MeshColorOption::YCoordinate:
+            return global_color_map
+                    .GetColor(view.GetBoundingBox().GetYPercentage(
+                            base_vertex(1)))
+                    .cast<float>();
+        case RenderOption::MeshColorOption::ZCoordinate:
+            return global_color_map
+                    .GetColor(view.GetBoundingBox().GetZPercentage(
+                            base_vertex(2)))
+                    .cast<float>();
+        case RenderOption::MeshColorOption::Color:
+            if (color != nullptr) {
+                return color->cast<float>();
+            }
+            return option.default_mesh_color_.cast<float>();
+        case RenderOption::MeshColorOption::Default:
+        default:
+            return option.default_mesh_color_.cast<float>();
+    }
+}
+
+void PrepareVoxelGridBinding(const geometry::VoxelGrid &voxel_grid,
+                             const RenderOption &option,
+                             const ViewControl &view,
+                             bool cull_hidden_faces,
+                             std::vector<Eigen::Vector3f> &origins,
+                             std::vector<GLfloat> &sizes,
+                             std::vector<Eigen::Vector3f> &colors,
+                             std::vector<GLfloat> &face_masks) {
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    // The hash map cannot be split between threads, so the voxels are
+    // gathered first and the instance data is filled in parallel.
+    std::vector<const geometry::Voxel *> voxels;
+    voxels.reserve(voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        voxels.push_back(&it.second);
+    }
+    const size_t n = voxels.size();
+    const float voxel_size = float(voxel_grid.voxel_size_);
+    const bool has_colors = voxel_grid.HasColors();
+    origins.resize(n);
+    sizes.assign(n, voxel_size);
+    colors.resize(n);
+    if (cull_hidden_faces) {
+        face_masks.resize(n);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(n); i++) {
+        const geometry::Voxel &voxel = *voxels[i];
+        Eigen::Vector3f base_vertex =
+                voxel_grid.origin_.cast<float>() +
+                voxel.grid_index_.cast<float>() * voxel_size;
+        origins[i] = base_vertex;
+        colors[i] = GetVoxelColor(base_vertex,
+                                  has_colors ? &voxel.color_ : nullptr, option,
+                                  view, global_color_map);
+        if (cull_hidden_faces) {
+            int mask = 0;
+            for (int face = 0; face < 6; face++) {
+                Eigen::Vector3i neighbor = voxel.grid_index_;
+                neighbor(face / 2) += (face % 2 == 0) ? -1 : 1;
+                if (voxel_grid.voxels_.count(neighbor) == 0) {
+                    mask |= 1 << face;
+                }
+            }
+            face_masks[i] = GLfloat(mask);
+        }
+    }
+
+    // Voxels enclosed on all sides are not drawn at all.
+    if (cull_hidden_faces) {
+        size_t k = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (face_masks[i] != 0.0f) {
+                origins[k] = origins[i];
+                colors[k] = colors[i];
+                face_masks[k] = face_masks[i];
+                k++;
+            }
+        }
+        origins.resize(k);
+        sizes.resize(k);
+        colors.resize(k);
+        face_masks.resize(k);
+    }
+}
+
+}  // unnamed namespace
+
+bool VoxelShader::Compile() {
+    if (CompileShaders(VoxelVertexShader, NULL, SimpleFragmentShader) ==
+        false) {
+        PrintShaderWarning("Compiling shaders failed.");
+        return false;
+    }
+    vertex_position_ = glGetAttribLocation(program_, "vertex_position");
+    vertex_face_ = glGetAttribLocation(program_, "vertex_face");
+    voxel_origin_ = glGetAttribLocation(program_, "voxel_origin");
+    voxel_size_ = glGetAttribLocation(program_, "voxel_size");
+    voxel_color_ = glGetAttribLocation(program_, "voxel_color");
+    voxel_face_mask_ = glGetAttribLocation(program_, "voxel_face_mask");
+    MVP_ = glGetUniformLocation(program_, "MVP");
+    return true;
+}
+
+void VoxelShader::Release() {
+    UnbindGeometry();
+    ReleaseProgram();
+}
+
+bool VoxelShader::BindGeometry(const geometry::Geometry &geometry,
+                               const RenderOption &option,
+                               const ViewControl &view) {
+    // If there is already geometry, we first unbind it.
+    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
+    // rebind the geometry.
+    UnbindGeometry();
+
+    // Prepare data to be passed to GPU
+    std::vector<Eigen::Vector3f> origins;
+    std::vector<GLfloat> sizes;
+    std::vector<Eigen::Vector3f> colors;
+    std::vector<GLfloat> face_masks;
+    if (PrepareBinding(geometry, option, view, origins, sizes, colors,
+                       face_masks) == false) {
+        PrintShaderWarning("Binding failed when preparing data.");
+        return false;
+    }
+
+    // The unit cube shared by all instances
+    std::vector<Eigen::Vector3f> points;
+    std::vector<GLfloat> faces;
+    if (draw_arrays_mode_ == GL_LINES) {
+        for (const Eigen::Vector2i &line : cuboid_lines_vertex_indices) {
+            for (int j = 0; j < 2; j++) {
+                points.push_back(
+                        cuboid_vertex_offsets[line(j)].cast<float>());
+                faces.push_back(0.0f);
+            }
+        }
+    } else {
+        for (const Eigen::Vector3i &triangle :
+             cuboid_triangles_vertex_indices) {
+            GLfloat face = GLfloat(GetTriangleFace(triangle));
+            for (int j = 0; j < 3; j++) {
+                points.push_back(
+                        cuboid_vertex_offsets[triangle(j)].cast<float>());
+                faces.push_back(face);
+            }
+        }
+    }
+    draw_arrays_size_ = GLsizei(points.size());
+
+    // Create buffers and bind the geometry
+    glGenBuffers(1, &vertex_position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
+                 points.data(), GL_STATIC_DRAW);
+    glGenBuffers(1, &vertex_face_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_face_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, faces.size() * sizeof(GLfloat),
+                 faces.data(), GL_STATIC_DRAW);
+    glGenBuffers(1, &voxel_origin_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, voxel_origin_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, origins.size() * sizeof(Eigen::Vector3f),
+                 origins.data(), GL_STATIC_DRAW);
+    glGenBuffers(1, &voxel_size_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, voxel_size_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, sizes.size() * sizeof(GLfloat), sizes.data(),
+                 GL_STATIC_DRAW);
+    glGenBuffers(1, &voxel_color_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, voxel_color_buffer_);
+    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
+                 colors.data(), GL_STATIC_DRAW);
+    has_face_masks_ = !face_masks.empty();
+    if (has_face_masks_) {
+        glGenBuffers(1, &voxel_face_mask_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, voxel_face_mask_buffer_);
+        glBufferData(GL_ARRAY_BUFFER, face_masks.size() * sizeof(GLfloat),
+                     face_masks.data(), GL_STATIC_DRAW);
+    }
+    instance_count_ = GLsizei(origins.size());
+    bound_ = true;
+    return true;
+}
+
+bool VoxelShader::RenderGeometry(const geometry::Geometry &geometry,
+                                 const RenderOption &option,
+                                 const ViewControl &view) {
+    if (PrepareRendering(geometry, option, view) == false) {
+        PrintShaderWarning("Rendering failed during preparation.");
+        return false;
+    }
+    if (instance_count_ == 0) {
+        return true;
+    }
+    glUseProgram(program_);
+    glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
+    glEnableVertexAttribArray(vertex_position_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    glEnableVertexAttribArray(vertex_face_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_face_buffer_);
+    glVertexAttribPointer(vertex_face_, 1, GL_FLOAT, GL_FALSE, 0, NULL);
+    // The divisors are part of the VAO state shared with the other shaders,
+    // so they are reset after drawing.
+    glEnableVertexAttribArray(voxel_origin_);
+    glBindBuffer(GL_ARRAY_BUFFER, voxel_origin_buffer_);
+    glVertexAttribPointer(voxel_origin_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    glVertexAttribDivisor(voxel_origin_, 1);
+    glEnableVertexAttribArray(voxel_size_);
+    glBindBuffer(GL_ARRAY_BUFFER, voxel_size_buffer_);
+    glVertexAttribPointer(voxel_size_, 1, GL_FLOAT, GL_FALSE, 0, NULL);
+    glVertexAttribDivisor(voxel_size_, 1);
+    glEnableVertexAttribArray(voxel_color_);
+    glBindBuffer(GL_ARRAY_BUFFER, voxel_color_buffer_);
+    glVertexAttribPointer(voxel_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+    glVertexAttribDivisor(voxel_color_, 1);
+    if (has_face_masks_) {
+        glEnableVertexAttribArray(voxel_face_mask_);
+        glBindBuffer(GL_ARRAY_BUFFER, voxel_face_mask_buffer_);
+        glVertexAttribPointer(voxel_face_mask_, 1, GL_FLOAT, GL_FALSE, 0,
+                              NULL);
+        glVertexAttribDivisor(voxel_face_mask_, 1);
+    } else {
+        glVertexAttrib1f(voxel_face_mask_, kAllFacesVisible);
+    }
+    glDrawArraysInstanced(draw_arrays_mode_, 0, draw_arrays_size_,
+                          instance_count_);
+    glVertexAttribDivisor(voxel_origin_, 0);
+    glVertexAttribDivisor(voxel_size_, 0);
+    glVertexAttribDivisor(voxel_color_, 0);
+    glDisableVertexAttribArray(vertex_position_);
+    glDisableVertexAttribArray(vertex_face_);
+    glDisableVertexAttribArray(voxel_origin_);
+    glDisableVertexAttribArray(voxel_size_);
+    glDisableVertexAttribArray(voxel_color_);
+    if (has_face_masks_) {
+        glVertexAttribDivisor(voxel_face_mask_, 0);
+        glDisableVertexAttribArray(voxel_face_mask_);
+    }
+    return true;
+}
+
+void VoxelShader::UnbindGeometry() {
+    if (bound_) {
+        glDeleteBuffers(1, &vertex_position_buffer_);
+        glDeleteBuffers(1, &vertex_face_buffer_);
+        glDeleteBuffers(1, &voxel_origin_buffer_);
+        glDeleteBuffers(1, &voxel_size_buffer_);
+        glDeleteBuffers(1, &voxel_color_buffer_);
+        if (has_face_masks_) {
+            glDeleteBuffers(1, &voxel_face_mask_buffer_);
+        }
+        has_face_masks_ = false;
+        instance_count_ = 0;
+        bound_ = false;
+    }
+}
+
+bool VoxelShaderForVoxelGridLine::PrepareRendering(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::VoxelGrid) {
+        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
+        return false;
+    }
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    return true;
+}
+
+bool VoxelShaderForVoxelGridLine::PrepareBinding(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<GLfloat> &sizes,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLfloat> &face_masks) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::VoxelGrid) {
+        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
+        return false;
+    }
+    const geometry::VoxelGrid &voxel_grid =
+            (const geometry::VoxelGrid &)geometry;
+    if (voxel_grid.HasVoxels() == false) {
+        PrintShaderWarning("Binding failed with empty voxel grid.");
+        return false;
+    }
+    // Edges are shared by more than two voxels, so they are never culled.
+    PrepareVoxelGridBinding(voxel_grid, option, view, false, origins, sizes,
+                            colors, face_masks);
+    draw_arrays_mode_ = GL_LINES;
+    return true;
+}
+
+bool VoxelShaderForVoxelGridFace::PrepareRendering(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::VoxelGrid) {
+        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
+        return false;
+    }
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    return true;
+}
+
+bool VoxelShaderForVoxelGridFace::PrepareBinding(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<GLfloat> &sizes,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLfloat> &face_masks) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::VoxelGrid) {
+        PrintShaderWarning("Rendering type is not geometry::VoxelGrid.");
+        return false;
+    }
+    const geometry::VoxelGrid &voxel_grid =
+            (const geometry::VoxelGrid &)geometry;
+    if (voxel_grid.HasVoxels() == false) {
+        PrintShaderWarning("Binding failed with empty voxel grid.");
+        return false;
+    }
+    PrepareVoxelGridBinding(voxel_grid, option, view,
+                            option.voxel_cull_hidden_faces_, origins, sizes,
+                            colors, face_masks);
+    draw_arrays_mode_ = GL_TRIANGLES;
+    return true;
+}
+
+bool VoxelShaderForOctreeLine::PrepareRendering(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::Octree) {
+        PrintShaderWarning("Rendering type is not geometry::Octree.");
+        return false;
+    }
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    return true;
+}
+
+bool VoxelShaderForOctreeLine::PrepareBinding(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<GLfloat> &sizes,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLfloat> &face_masks) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::Octree) {
+        PrintShaderWarning("Rendering type is not geometry::Octree.");
+        return false;
+    }
+    const geometry::Octree &octree = (const geometry::Octree &)geometry;
+    if (octree.IsEmpty()) {
+        PrintShaderWarning("Binding failed with empty octree.");
+        return false;
+    }
+
+    auto f = [&origins, &sizes, &colors](
+                     const std::shared_ptr<geometry::OctreeNode> &node,
+                     const std::shared_ptr<geometry::OctreeNodeInfo> &node_info)
+            -> void {
+        Eigen::Vector3f voxel_color = Eigen::Vector3f::Zero();
+        if (auto leaf_node =
+                    std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
+                            node)) {
+            voxel_color = leaf_node->color_.cast<float>();
+        }
+        origins.push_back(node_info->origin_.cast<float>());
+        sizes.push_back(GLfloat(node_info->size_));
+        colors.push_back(voxel_color);
+    };
+
+    octree.Traverse(f);
+
+    draw_arrays_mode_ = GL_LINES;
+    return true;
+}
+
+bool VoxelShaderForOctreeFace::PrepareRendering(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::Octree) {
+        PrintShaderWarning("Rendering type is not geometry::Octree.");
+        return false;
+    }
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GLenum(option.GetGLDepthFunc()));
+    return true;
+}
+
+bool VoxelShaderForOctreeFace::PrepareBinding(
+        const geometry::Geometry &geometry,
+        const RenderOption &option,
+        const ViewControl &view,
+        std::vector<Eigen::Vector3f> &origins,
+        std::vector<GLfloat> &sizes,
+        std::vector<Eigen::Vector3f> &colors,
+        std::vector<GLfloat> &face_masks) {
+    if (geometry.GetGeometryType() !=
+        geometry::Geometry::GeometryType::Octree) {
+        PrintShaderWarning("Rendering type is not geometry::Octree.");
+        return false;
+    }
+    const geometry::Octree &octree = (const geometry::Octree &)geometry;
+    if (octree.IsEmpty()) {
+        PrintShaderWarning("Binding failed with empty octree.");
+        return false;
+    }
+
+    // The tree is walked once to gather the leaves; their colors are then
+    // computed in parallel. Leaves of different sizes can touch, so all their
+    // faces are drawn.
+    std::vector<Eigen::Vector3d> leaf_colors;
+    auto f = [&origins, &sizes, &leaf_colors](
+                     const std::shared_ptr<geometry::OctreeNode> &node,
+                     const std::shared_ptr<geometry::OctreeNodeInfo> &node_info)
+            -> void {
+        if (auto leaf_node =
+                    std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
+                            node)) {
+            origins.push_back(node_info->origin_.cast<float>());
+            sizes.push_back(GLfloat(node_info->size_));
+            leaf_colors.push_back(leaf_node->color_);
+        }
+    };
+
+    octree.Traverse(f);
+
+    const ColorMap &global_color_map = *GetGlobalColorMap();
+    colors.resize(origins.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(origins.size()); i++) {
+        colors[i] = GetVoxelColor(origins[i], &leaf_colors[i], option, view,
+                                  global_color_map);
+    }
+
+    draw_arrays_mode_ = GL_TRIANGLES;
+    return true;
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
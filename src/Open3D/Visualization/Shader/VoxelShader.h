@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "Open3D/Visualization/Shader/ShaderWrapper.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// Base class of the shaders for voxels. A single unit cube is uploaded once
+/// and every voxel is drawn as an instance of it, with the voxel origin, size,
+/// color and the mask of its visible faces as per-instance attributes.
+class VoxelShader : public ShaderWrapper {
+public:
+    ~VoxelShader() override { Release(); }
+
+protected:
+    VoxelShader(const std::string &name) : ShaderWrapper(name) { Compile(); }
+
+protected:
+    bool Compile() final;
+    void Release() final;
+    bool BindGeometry(const geometry::Geometry &geometry,
+                      const RenderOption &option,
+                      const ViewControl &view) final;
+    bool RenderGeometry(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view) final;
+    void UnbindGeometry() final;
+
+protected:
+    virtual bool PrepareRendering(const geometry::Geometry &geometry,
+                                  const RenderOption &option,
+                                  const ViewControl &view) = 0;
+    /// Fills the origin, edge length and color of every voxel. \p face_masks
+    /// holds a bit per face (-x, +x, -y, +y, -z, +z) that is set if the face
+    /// is visible; if it is left empty, all faces are drawn. Sets
+    /// draw_arrays_mode_ to GL_TRIANGLES for faces or GL_LINES for edges.
+    virtual bool PrepareBinding(const geometry::Geometry &geometry,
+                                const RenderOption &option,
+                                const ViewControl &view,
+                                std::vector<Eigen::Vector3f> &origins,
+                                std::vector<GLfloat> &sizes,
+                                std::vector<Eigen::Vector3f> &colors,
+                                std::vector<GLfloat> &face_masks) = 0;
+
+protected:
+    GLuint vertex_position_;
+    GLuint vertex_position_buffer_;
+    GLuint vertex_face_;
+    GLuint vertex_face_buffer_;
+    GLuint voxel_origin_;
+    GLuint voxel_origin_buffer_;
+    GLuint voxel_size_;
+    GLuint voxel_size_buffer_;
+    GLuint voxel_color_;
+    GLuint voxel_color_buffer_;
+    GLuint voxel_face_mask_;
+    GLuint voxel_face_mask_buffer_;
+    GLuint MVP_;
+    bool has_face_masks_ = false;
+    GLsizei instance_count_ = 0;
+};
+
+class VoxelShaderForVoxelGridLine : public VoxelShader {
+public:
+    VoxelShaderForVoxelGridLine()
+        : VoxelShader("VoxelShaderForVoxelGridLine") {}
+
+protected:
+    bool PrepareRendering(const geometry::Geometry &geometry,
+                          const RenderOption &option,
+                          const ViewControl &view) final;
+    bool PrepareBinding(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<GLfloat> &sizes,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLfloat> &face_masks) final;
+};
+
+class VoxelShaderForVoxelGridFace : public VoxelShader {
+public:
+    VoxelShaderForVoxelGridFace()
+        : VoxelShader("VoxelShaderForVoxelGridFace") {}
+
+protected:
+    bool PrepareRendering(const geometry::Geometry &geometry,
+                          const RenderOption &option,
+                          const ViewControl &view) final;
+    bool PrepareBinding(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<GLfloat> &sizes,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLfloat> &face_masks) final;
+};
+
+class VoxelShaderForOctreeLine : public VoxelShader {
+public:
+    VoxelShaderForOctreeLine() : VoxelShader("VoxelShaderForOctreeLine") {}
+
+protected:
+    bool PrepareRendering(const geometry::Geometry &geometry,
+                          const RenderOption &option,
+                          const ViewControl &view) final;
+    bool PrepareBinding(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<GLfloat> &sizes,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLfloat> &face_masks) final;
+};
+
+class VoxelShaderForOctreeFace : public VoxelShader {
+public:
+    VoxelShaderForOctreeFace() : VoxelShader("VoxelShaderForOctreeFace") {}
+
+protected:
+    bool PrepareRendering(const geometry::Geometry &geometry,
+                          const RenderOption &option,
+                          const ViewControl &view) final;
+    bool PrepareBinding(const geometry::Geometry &geometry,
+                        const RenderOption &option,
+                        const ViewControl &view,
+                        std::vector<Eigen::Vector3f> &origins,
+                        std::vector<GLfloat> &sizes,
+                        std::vector<Eigen::Vector3f> &colors,
+                        std::vector<GLfloat> &face_masks) final;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,247 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/AsyncFrameCapture.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Visualization/Utility/GLHelper.h"
+
+namespace open3d {
+namespace visualization {
+
+AsyncFrameCapture::~AsyncFrameCapture() {
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        writer_stop_ = true;
+    }
+    writer_condition_.notify_all();
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+}
+
+std::future<std::shared_ptr<geometry::Image>> AsyncFrameCapture::Capture(
+        BufferType type,
+        int width,
+        int height,
+        double z_near /* = 0.0*/,
+        double z_far /* = 0.0*/,
+        FrameCallback callback /* = nullptr*/) {
+    Poll();
+    while (int(pending_reads_.size()) >= std::max(max_pending_reads_, 1)) {
+        ResolveRead(pending_reads_.front());
+        pending_reads_.pop_front();
+    }
+
+    PendingRead read;
+    read.type_ = type;
+    read.width_ = width;
+    read.height_ = height;
+    read.z_near_ = z_near;
+    read.z_far_ = z_far;
+    read.callback_ = callback;
+    if (free_buffers_.empty()) {
+        glGenBuffers(1, &read.buffer_);
+    } else {
+        read.buffer_ = free_buffers_.back();
+        free_buffers_.pop_back();
+    }
+    GLenum format = GL_RGB;
+    GLenum data_type = GL_FLOAT;
+    int bytes_per_pixel = 12;
+    switch (type) {
+        case BufferType::Color:
+            data_type = GL_UNSIGNED_BYTE;
+            bytes_per_pixel = 3;
+            break;
+        case BufferType::DepthFloat:
+            format = GL_DEPTH_COMPONENT;
+            bytes_per_pixel = 4;
+            break;
+        case BufferType::Index:
+            format = GL_RGBA;
+            data_type = GL_UNSIGNED_BYTE;
+            bytes_per_pixel = 4;
+            break;
+        case BufferType::ColorFloat:
+        default:
+            break;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, read.buffer_);
+    glBufferData(GL_PIXEL_PACK_BUFFER, width * height * bytes_per_pixel, NULL,
+                 GL_STREAM_READ);
+    glReadPixels(0, 0, width, height, format, data_type, NULL);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    read.fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+
+    auto future = read.promise_.get_future();
+    pending_reads_.push_back(std::move(read));
+    return future;
+}
+
+void AsyncFrameCapture::Poll(bool wait /* = false*/) {
+    while (!pending_reads_.empty()) {
+        PendingRead &read = pending_reads_.front();
+        if (!wait) {
+            GLenum status = glClientWaitSync(read.fence_, 0, 0);
+            if (status == GL_TIMEOUT_EXPIRED) {
+                break;
+            }
+        }
+        ResolveRead(read);
+        pending_reads_.pop_front();
+    }
+}
+
+void AsyncFrameCapture::Flush() {
+    Poll(true);
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    writer_condition_.wait(
+            lock, [this] { return writer_jobs_.empty() && !writer_busy_; });
+}
+
+void AsyncFrameCapture::Release() {
+    Flush();
+    if (!free_buffers_.empty()) {
+        glDeleteBuffers(GLsizei(free_buffers_.size()), free_buffers_.data());
+        free_buffers_.clear();
+    }
+}
+
+void AsyncFrameCapture::ResolveRead(PendingRead &read) {
+    // Blocks only if the GPU has not finished the read yet.
+    glClientWaitSync(read.fence_, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(-1));
+    glDeleteSync(read.fence_);
+
+    auto image_ptr = std::make_shared<geometry::Image>();
+    switch (read.type_) {
+        case BufferType::Color:
+            image_ptr->Prepare(read.width_, read.height_, 3, 1);
+            break;
+        case BufferType::ColorFloat:
+            image_ptr->Prepare(read.width_, read.height_, 3, 4);
+            break;
+        case BufferType::DepthFloat:
+        case BufferType::Index:
+        default:
+            image_ptr->Prepare(read.width_, read.height_, 1, 4);
+            break;
+    }
+    // All formats read back with 4 bytes per pixel have 1 float channel on the
+    // CPU side, so the line sizes match.
+    const int bytes_per_line = image_ptr->BytesPerLine();
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, read.buffer_);
+    const uint8_t *src = (const uint8_t *)glMapBufferRange(
+            GL_PIXEL_PACK_BUFFER, 0, bytes_per_line * read.height_,
+            GL_MAP_READ_BIT);
+    if (src == NULL) {
+        utility::LogWarning("[AsyncFrameCapture] Failed to map pixel buffer.");
+    } else {
+        // glReadPixels gets the rows bottom-up; flip them while copying out of
+        // the mapped buffer.
+        for (int i = 0; i < read.height_; i++) {
+            const uint8_t *src_line =
+                    src + bytes_per_line * (read.height_ - i - 1);
+            uint8_t *dst_line = image_ptr->data_.data() + bytes_per_line * i;
+            if (read.type_ == BufferType::Color ||
+                read.type_ == BufferType::ColorFloat) {
+                memcpy(dst_line, src_line, bytes_per_line);
+                continue;
+            }
+            if (read.type_ == BufferType::Index) {
+                float *p_image = (float *)dst_line;
+                for (int j = 0; j < read.width_; j++) {
+                    const uint8_t *rgba = src_line + j * 4;
+                    p_image[j] = (float)GLHelper::ColorCodeToPickIndex(
+                            Eigen::Vector4i(rgba[0], rgba[1], rgba[2],
+                                            rgba[3]));
+                }
+                continue;
+            }
+            const float *p_depth = (const float *)src_line;
+            float *p_image = (float *)dst_line;
+            for (int j = 0; j < read.width_; j++) {
+                if (p_depth[j] == 1.0f) {
+                    p_image[j] = 0.0f;
+                    continue;
+                }
+                double z_depth = 2.0 * read.z_near_ * read.z_far_ /
+                                 (read.z_far_ + read.z_near_ -
+                                  (2.0 * (double)p_depth[j] - 1.0) *
+                                          (read.z_far_ - read.z_near_));
+                p_image[j] = (float)z_depth;
+            }
+        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    free_buffers_.push_back(read.buffer_);
+
+    if (read.callback_) {
+        FrameCallback callback = read.callback_;
+        PushWriterJob([callback, image_ptr]() { callback(*image_ptr); });
+    }
+    read.promise_.set_value(image_ptr);
+}
+
+void AsyncFrameCapture::PushWriterJob(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        if (!writer_thread_.joinable()) {
+            writer_thread_ = std::thread(&AsyncFrameCapture::WriterLoop, this);
+        }
+        writer_jobs_.push_back(std::move(job));
+    }
+    writer_condition_.notify_all();
+}
+
+void AsyncFrameCapture::WriterLoop() {
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    while (true) {
+        writer_condition_.wait(
+                lock, [this] { return writer_stop_ || !writer_jobs_.empty(); });
+        if (writer_jobs_.empty()) {
+            // writer_stop_ is set and all jobs are done.
+            return;
+        }
+        std::function<void()> job = std::move(writer_jobs_.front());
+        writer_jobs_.pop_front();
+        writer_busy_ = true;
+        lock.unlock();
+        job();
+        lock.lock();
+        writer_busy_ = false;
+        writer_condition_.notify_all();
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <GL/glew.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+}
+
+namespace visualization {
+
+/// A utility class to read back the framebuffer without stalling the GL
+/// pipeline.
+/// Each capture issues glReadPixels into a pixel buffer object and returns a
+/// future. The data is mapped and copied (vertically flipped, and converted to
+/// metric depth for depth captures) once the GPU has signaled completion,
+/// which is checked by Poll(). Optional per-frame callbacks run on a single
+/// writer thread, so that encoding or writing frames overlaps with rendering.
+/// All member functions except the callbacks must be called from the thread
+/// that owns the GL context.
+class AsyncFrameCapture {
+public:
+    enum class BufferType {
+        /// 3 channels, 1 byte per channel.
+        Color = 0,
+        /// 3 channels, float.
+        ColorFloat = 1,
+        /// 1 channel, float, metric depth (0 for background).
+        DepthFloat = 2,
+        /// 1 channel, float, point index decoded from a picking pass (-1 for
+        /// background).
+        Index = 3,
+    };
+
+    typedef std::function<void(const geometry::Image &)> FrameCallback;
+
+public:
+    /// \param max_pending_reads Number of reads in flight before Capture()
+    /// blocks on the oldest one.
+    AsyncFrameCapture(int max_pending_reads = 3)
+        : max_pending_reads_(max_pending_reads) {}
+    ~AsyncFrameCapture();
+    AsyncFrameCapture(const AsyncFrameCapture &) = delete;
+    AsyncFrameCapture &operator=(const AsyncFrameCapture &) = delete;
+
+public:
+    /// Function to start reading the current read buffer.
+    /// \param z_near and \param z_far are only used for BufferType::DepthFloat
+    /// to linearize the depth buffer.
+    /// \param callback If set, is called with the image on the writer thread.
+    std::future<std::shared_ptr<geometry::Image>> Capture(
+            BufferType type,
+            int width,
+            int height,
+            double z_near = 0.0,
+            double z_far = 0.0,
+            FrameCallback callback = nullptr);
+
+    /// Function to resolve the reads the GPU has finished. If \param wait is
+    /// true, blocks until all pending reads are resolved.
+    void Poll(bool wait = false);
+
+    /// Function to wait for all pending reads and writer callbacks.
+    void Flush();
+
+    /// Function to release the GL resources. Must be called while the GL
+    /// context is still alive; pending reads are resolved first.
+    void Release();
+
+    bool HasPendingReads() const { return !pending_reads_.empty(); }
+
+    /// Function to run \p job on the writer thread, after all previously
+    /// queued callbacks.
+    void PushWriterJob(std::function<void()> job);
+
+protected:
+    struct PendingRead {
+        GLuint buffer_;
+        GLsync fence_;
+        BufferType type_;
+        int width_;
+        int height_;
+        double z_near_;
+        double z_far_;
+        std::promise<std::shared_ptr<geometry::Image>> promise_;
+        FrameCallback callback_;
+    };
+
+    void ResolveRead(PendingRead &read);
+    void WriterLoop();
+
+protected:
+    int max_pending_reads_;
+    std::deque<PendingRead> pending_reads_;
+    std::vector<GLuint> free_buffers_;
+
+    std::thread writer_thread_;
+    std::mutex writer_mutex_;
+    std::condition_variable writer_condition_;
+    std::deque<std::function<void()>> writer_jobs_;
+    bool writer_busy_ = false;
+    bool writer_stop_ = false;
+};
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,298 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Utility/RenderProfiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <imgui.h>
+#include <imgui_impl_opengl3.h>
+#include <json/json.h>
+#include <memory>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Timer.h"
+
+namespace open3d {
+namespace visualization {
+
+RenderProfiler *RenderProfiler::active_profiler_ = nullptr;
+
+RenderProfiler::RenderProfiler(size_t max_recorded_frames /* = 1000*/)
+    : max_recorded_frames_(max_recorded_frames),
+      start_time_ms_(utility::Timer::GetSystemTimeInMilliseconds()) {}
+
+RenderProfiler::~RenderProfiler() {
+    if (active_profiler_ == this) {
+        active_profiler_ = nullptr;
+    }
+}
+
+void RenderProfiler::BeginFrame() {
+    if (active_profiler_ == this) {
+        EndFrame();
+    }
+    active_profiler_ = this;
+    current_frame_.index_ = frame_index_++;
+    current_frame_.zones_.clear();
+    zone_stack_.clear();
+    BeginZone("Frame");
+}
+
+void RenderProfiler::EndFrame() {
+    if (active_profiler_ != this) {
+        return;
+    }
+    while (!zone_stack_.empty()) {
+        EndZone();
+    }
+    active_profiler_ = nullptr;
+    pending_frames_.push_back(std::move(current_frame_));
+    current_frame_.zones_.clear();
+    // Keep a few frames in flight; older frames are waited for.
+    ResolveFrames(false);
+    while (pending_frames_.size() > 4) {
+        ResolveFrames(true);
+    }
+}
+
+void RenderProfiler::BeginZone(const std::string &name) {
+    PendingZone zone;
+    zone.zone_.name_ = name;
+    zone.zone_.depth_ = int(zone_stack_.size());
+    zone.zone_.cpu_begin_ms_ = GetTimeInMilliseconds();
+    zone.zone_.cpu_end_ms_ = zone.zone_.cpu_begin_ms_;
+    zone.zone_.gpu_begin_ms_ = 0.0;
+    zone.zone_.gpu_end_ms_ = 0.0;
+    zone.begin_query_ = AcquireQuery();
+    zone.end_query_ = AcquireQuery();
+    glQueryCounter(zone.begin_query_, GL_TIMESTAMP);
+    zone_stack_.push_back(current_frame_.zones_.size());
+    current_frame_.zones_.push_back(std::move(zone));
+}
+
+void RenderProfiler::EndZone() {
+    if (zone_stack_.empty()) {
+        return;
+    }
+    PendingZone &zone = current_frame_.zones_[zone_stack_.back()];
+    zone_stack_.pop_back();
+    glQueryCounter(zone.end_query_, GL_TIMESTAMP);
+    zone.zone_.cpu_end_ms_ = GetTimeInMilliseconds();
+}
+
+void RenderProfiler::DrawOverlay(int width, int height) {
+    if (imgui_context_ == nullptr) {
+        imgui_context_ = ImGui::CreateContext();
+        ImGui::SetCurrentContext(imgui_context_);
+        ImGui::GetIO().IniFilename = NULL;
+        ImGui_ImplOpenGL3_Init("#version 330");
+    }
+    ImGui::SetCurrentContext(imgui_context_);
+    ImGuiIO &io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(float(width), float(height));
+    double now = GetTimeInMilliseconds();
+    io.DeltaTime = float(std::max(now - last_overlay_time_ms_, 1.0) / 1000.0);
+    last_overlay_time_ms_ = now;
+
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f));
+    ImGui::SetNextWindowBgAlpha(0.6f);
+    ImGui::Begin("Render profiler", NULL,
+                 ImGuiWindowFlags_NoDecoration |
+                         ImGuiWindowFlags_AlwaysAutoResize |
+                         ImGuiWindowFlags_NoSavedSettings |
+                         ImGuiWindowFlags_NoFocusOnAppearing |
+                         ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoInputs);
+    if (frames_.empty()) {
+        ImGui::Text("Collecting frames...");
+    } else {
+        const Frame &frame = frames_.back();
+        const Zone &total = frame.zones_[0];
+        ImGui::Text("Frame %lld", (long long)frame.index_);
+        ImGui::Text("CPU %.2f ms, GPU %.2f ms",
+                    total.cpu_end_ms_ - total.cpu_begin_ms_,
+                    total.gpu_end_ms_ - total.gpu_begin_ms_);
+        if (frames_.size() > 1) {
+            size_t first = frames_.size() - std::min(frames_.size(), size_t(31));
+            double elapsed = frame.zones_[0].cpu_begin_ms_ -
+                             frames_[first].zones_[0].cpu_begin_ms_;
+            if (elapsed > 0.0) {
+                ImGui::Text("%.1f FPS",
+                            1000.0 * (frames_.size() - 1 - first) / elapsed);
+            }
+        }
+        ImGui::Separator();
+        ImGui::Columns(3, NULL, false);
+        ImGui::Text("Zone");
+        ImGui::NextColumn();
+        ImGui::Text("CPU ms");
+        ImGui::NextColumn();
+        ImGui::Text("GPU ms");
+        ImGui::NextColumn();
+        for (size_t i = 1; i < frame.zones_.size(); i++) {
+            const Zone &zone = frame.zones_[i];
+            ImGui::Text("%*s%s", 2 * (zone.depth_ - 1), "", zone.name_.c_str());
+            ImGui::NextColumn();
+            ImGui::Text("%.3f", zone.cpu_end_ms_ - zone.cpu_begin_ms_);
+            ImGui::NextColumn();
+            ImGui::Text("%.3f", zone.gpu_end_ms_ - zone.gpu_begin_ms_);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+    }
+    ImGui::End();
+    ImGui::Render();
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+}
+
+bool RenderProfiler::WriteTrace(const std::string &filename) const {
+    std::ofstream file_out(filename);
+    if (file_out.is_open() == false) {
+        utility::LogWarning("Write trace failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    Json::Value events(Json::arrayValue);
+    const char *thread_names[2] = {"CPU", "GPU"};
+    for (int tid = 0; tid < 2; tid++) {
+        Json::Value event;
+        event["name"] = "thread_name";
+        event["ph"] = "M";
+        event["pid"] = 0;
+        event["tid"] = tid;
+        event["args"]["name"] = thread_names[tid];
+        events.append(event);
+    }
+    for (const auto &frame : frames_) {
+        for (const auto &zone : frame.zones_) {
+            Json::Value event;
+            event["name"] = zone.name_;
+            event["ph"] = "X";
+            event["pid"] = 0;
+            event["args"]["frame"] = Json::Int64(frame.index_);
+            event["tid"] = 0;
+            event["ts"] = zone.cpu_begin_ms_ * 1000.0;
+            event["dur"] = (zone.cpu_end_ms_ - zone.cpu_begin_ms_) * 1000.0;
+            events.append(event);
+            event["tid"] = 1;
+            event["ts"] = zone.gpu_begin_ms_ * 1000.0;
+            event["dur"] = (zone.gpu_end_ms_ - zone.gpu_begin_ms_) * 1000.0;
+            events.append(event);
+        }
+    }
+    Json::Value root_object;
+    root_object["traceEvents"] = events;
+    root_object["displayTimeUnit"] = "ms";
+    Json::StreamWriterBuilder builder;
+    builder["commentStyle"] = "None";
+    builder["indentation"] = "";
+    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+    writer->write(root_object, &file_out);
+    return true;
+}
+
+void RenderProfiler::Release() {
+    if (active_profiler_ == this) {
+        EndFrame();
+    }
+    while (!pending_frames_.empty()) {
+        ResolveFrames(true);
+    }
+    if (!free_queries_.empty()) {
+        glDeleteQueries(GLsizei(free_queries_.size()), free_queries_.data());
+        free_queries_.clear();
+    }
+    if (imgui_context_ != nullptr) {
+        ImGui::SetCurrentContext(imgui_context_);
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui::DestroyContext(imgui_context_);
+        imgui_context_ = nullptr;
+    }
+}
+
+GLuint RenderProfiler::AcquireQuery() {
+    if (free_queries_.empty()) {
+        free_queries_.resize(64);
+        glGenQueries(GLsizei(free_queries_.size()), free_queries_.data());
+    }
+    GLuint query = free_queries_.back();
+    free_queries_.pop_back();
+    return query;
+}
+
+void RenderProfiler::ResolveFrames(bool wait) {
+    while (!pending_frames_.empty()) {
+        PendingFrame &pending = pending_frames_.front();
+        if (pending.zones_.empty()) {
+            pending_frames_.pop_front();
+            continue;
+        }
+        if (!wait) {
+            // The frame zone ends last, so all other queries are done too.
+            GLint available = 0;
+            glGetQueryObjectiv(pending.zones_[0].end_query_,
+                               GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                return;
+            }
+        }
+        wait = false;
+        Frame frame;
+        frame.index_ = pending.index_;
+        GLuint64 frame_begin = 0;
+        for (size_t i = 0; i < pending.zones_.size(); i++) {
+            PendingZone &zone = pending.zones_[i];
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(zone.begin_query_, GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(zone.end_query_, GL_QUERY_RESULT, &end);
+            if (i == 0) {
+                frame_begin = begin;
+            }
+            double offset = pending.zones_[0].zone_.cpu_begin_ms_;
+            zone.zone_.gpu_begin_ms_ =
+                    offset + double(int64_t(begin - frame_begin)) / 1.0e6;
+            zone.zone_.gpu_end_ms_ =
+                    offset + double(int64_t(end - frame_begin)) / 1.0e6;
+            free_queries_.push_back(zone.begin_query_);
+            free_queries_.push_back(zone.end_query_);
+            frame.zones_.push_back(std::move(zone.zone_));
+        }
+        pending_frames_.pop_front();
+        frames_.push_back(std::move(frame));
+        while (frames_.size() > std::max(max_recorded_frames_, size_t(1))) {
+            frames_.pop_front();
+        }
+    }
+}
+
+double RenderProfiler::GetTimeInMilliseconds() const {
+    return utility::Timer::GetSystemTimeInMilliseconds() - start_time_ms_;
+}
+
+}  // namespace visualization
+}  // namespace open3d
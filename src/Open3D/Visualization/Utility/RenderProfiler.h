@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+struct ImGuiContext;
+
+namespace open3d {
+namespace visualization {
+
+/// A utility class to profile rendering.
+/// Zones are nested time intervals inside a frame, each measured with a CPU
+/// timer and a pair of GL timestamp queries. Query results are collected a
+/// few frames later, so profiling does not stall the GL pipeline. The
+/// collected frames can be shown as an on-screen overlay or written as a
+/// Chrome trace (chrome://tracing) JSON file.
+class RenderProfiler {
+public:
+    struct Zone {
+        std::string name_;
+        /// Nesting level, 0 for the frame itself.
+        int depth_;
+        /// Times in milliseconds since the profiler was created. GPU times
+        /// are aligned so that the frame starts at the same time on the CPU
+        /// and on the GPU.
+        double cpu_begin_ms_;
+        double cpu_end_ms_;
+        double gpu_begin_ms_;
+        double gpu_end_ms_;
+    };
+
+    struct Frame {
+        int64_t index_;
+        /// Zones in the order they began; zones_[0] is the frame itself.
+        std::vector<Zone> zones_;
+    };
+
+public:
+    RenderProfiler(size_t max_recorded_frames = 1000);
+    ~RenderProfiler();
+    RenderProfiler(const RenderProfiler &) = delete;
+    RenderProfiler &operator=(const RenderProfiler &) = delete;
+
+public:
+    /// Function to get the profiler recording the current frame, or nullptr
+    /// if no frame is being profiled.
+    static RenderProfiler *GetActive() { return active_profiler_; }
+
+    void BeginFrame();
+    void EndFrame();
+    void BeginZone(const std::string &name);
+    void EndZone();
+
+    /// Function to draw the statistics of the last collected frame with imgui.
+    void DrawOverlay(int width, int height);
+
+    /// Function to write the collected frames as a Chrome trace JSON file.
+    bool WriteTrace(const std::string &filename) const;
+
+    /// Function to release the GL resources. Must be called while the GL
+    /// context is still alive.
+    void Release();
+
+    const std::deque<Frame> &GetFrames() const { return frames_; }
+
+protected:
+    struct PendingZone {
+        Zone zone_;
+        GLuint begin_query_;
+        GLuint end_query_;
+    };
+
+    struct PendingFrame {
+        int64_t index_;
+        std::vector<PendingZone> zones_;
+    };
+
+    GLuint AcquireQuery();
+    void ResolveFrames(bool wait);
+    double GetTimeInMilliseconds() const;
+
+protected:
+    static RenderProfiler *active_profiler_;
+
+    size_t max_recorded_frames_;
+    double start_time_ms_;
+    int64_t frame_index_ = 0;
+    PendingFrame current_frame_;
+    std::vector<size_t> zone_stack_;
+    std::deque<PendingFrame> pending_frames_;
+    std::deque<Frame> frames_;
+    std::vector<GLuint> free_queries_;
+    ImGuiContext *imgui_context_ = nullptr;
+    double last_overlay_time_ms_ = 0.0;
+};
+
+/// A zone of the active RenderProfiler that ends at the end of the scope.
+/// Does nothing if no frame is being profiled.
+class ScopedRenderZone {
+public:
+    ScopedRenderZone(const char *name)
+        : profiler_(RenderProfiler::GetActive()) {
+        if (profiler_ != nullptr) {
+            profiler_->BeginZone(name);
+        }
+    }
+    ~ScopedRenderZone() {
+        if (profiler_ != nullptr) {
+            profiler_->EndZone();
+        }
+    }
+    ScopedRenderZone(const ScopedRenderZone &) = delete;
+    ScopedRenderZone &operator=(const ScopedRenderZone &) = delete;
+
+private:
+    RenderProfiler *profiler_;
+};
+
+}  // namespace visualization
+}  // namespace open3d
@@ -37,6 +37,123 @@
 namespace open3d {
 namespace visualization {
 
+namespace {
+
+/// Edges of a polygon bucketed into horizontal bands, so that a point only
+/// tests the edges that overlap its band. A point is inside if an odd number
+/// of edges cross its scanline to the left of it, as in FillPolygon().
+class PolygonEdgeTable {
+public:
+    PolygonEdgeTable(const std::vector<Eigen::Vector2d> &polygon) {
+        if (polygon.empty()) {
+            return;
+        }
+        min_y_ = max_y_ = polygon[0](1);
+        for (size_t i = 0; i < polygon.size(); i++) {
+            size_t j = (i + 1) % polygon.size();
+            Edge edge;
+            edge.y0_ = std::min(polygon[i](1), polygon[j](1));
+            edge.y1_ = std::max(polygon[i](1), polygon[j](1));
+            if (edge.y0_ == edge.y1_) {
+                // Horizontal edges never cross a scanline.
+                continue;
+            }
+            edge.x_ = polygon[i](0);
+            edge.y_ = polygon[i](1);
+            edge.dxdy_ = (polygon[j](0) - polygon[i](0)) /
+                         (polygon[j](1) - polygon[i](1));
+            edges_.push_back(edge);
+            min_y_ = std::min(min_y_, edge.y0_);
+            max_y_ = std::max(max_y_, edge.y1_);
+        }
+        if (edges_.empty()) {
+            return;
+        }
+        num_bands_ = int(edges_.size());
+        band_scale_ = num_bands_ / (max_y_ - min_y_);
+        bands_.resize(num_bands_);
+        for (size_t i = 0; i < edges_.size(); i++) {
+            int band0 = GetBand(edges_[i].y0_);
+            int band1 = GetBand(edges_[i].y1_);
+            for (int band = band0; band <= band1; band++) {
+                bands_[band].push_back(int(i));
+            }
+        }
+    }
+
+    bool IsInside(double x, double y) const {
+        if (edges_.empty() || y <= min_y_ || y > max_y_) {
+            return false;
+        }
+        bool inside = false;
+        for (int i : bands_[GetBand(y)]) {
+            const Edge &edge = edges_[i];
+            if (edge.y0_ < y && edge.y1_ >= y &&
+                edge.x_ + (y - edge.y_) * edge.dxdy_ < x) {
+                inside = !inside;
+            }
+        }
+        return inside;
+    }
+
+private:
+    struct Edge {
+        double y0_;
+        double y1_;
+        double x_;
+        double y_;
+        double dxdy_;
+    };
+
+    int GetBand(double y) const {
+        int band = int((y - min_y_) * band_scale_);
+        return std::max(0, std::min(band, num_bands_ - 1));
+    }
+
+    std::vector<Edge> edges_;
+    std::vector<std::vector<int>> bands_;
+    double min_y_ = 0.0;
+    double max_y_ = 0.0;
+    double band_scale_ = 0.0;
+    int num_bands_ = 0;
+};
+
+/// Projects the points to window coordinates in parallel and returns, in
+/// order, the indices of the points for which is_inside(x, y) is true.
+template <typename Func>
+std::vector<size_t> SelectProjectedPoints(
+        const std::vector<Eigen::Vector3d> &input,
+        const ViewControl &view,
+        Func is_inside) {
+    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
+    const Eigen::Vector4d row_x = mvp_matrix.row(0).transpose();
+    const Eigen::Vector4d row_y = mvp_matrix.row(1).transpose();
+    const Eigen::Vector4d row_w = mvp_matrix.row(3).transpose();
+    double half_width = (double)view.GetWindowWidth() * 0.5;
+    double half_height = (double)view.GetWindowHeight() * 0.5;
+    std::vector<uint8_t> mask(input.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < (int)input.size(); k++) {
+        const Eigen::Vector4d pos(input[k](0), input[k](1), input[k](2), 1.0);
+        double w = row_w.dot(pos);
+        if (w == 0.0) continue;
+        double x = (row_x.dot(pos) / w + 1.0) * half_width;
+        double y = (row_y.dot(pos) / w + 1.0) * half_height;
+        mask[k] = is_inside(x, y) ? 1 : 0;
+    }
+    std::vector<size_t> output_index;
+    for (size_t k = 0; k < mask.size(); k++) {
+        if (mask[k]) {
+            output_index.push_back(k);
+        }
+    }
+    return output_index;
+}
+
+}  // unnamed namespace
+
 SelectionPolygon &SelectionPolygon::Clear() {
     polygon_.clear();
     is_closed_ = false;
@@ -229,67 +346,20 @@ SelectionPolygon::CropTriangleMeshInPolygon(const geometry::TriangleMesh &input,
 
 std::vector<size_t> SelectionPolygon::CropInRectangle(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
-    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
-    double half_width = (double)view.GetWindowWidth() * 0.5;
-    double half_height = (double)view.GetWindowHeight() * 0.5;
     auto min_bound = GetMinBound();
     auto max_bound = GetMaxBound();
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t i = 0; i < input.size(); i++) {
-        ++progress_bar;
-        const auto &point = input[i];
-        Eigen::Vector4d pos =
-                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
-        pos /= pos(3);
-        double x = (pos(0) + 1.0) * half_width;
-        double y = (pos(1) + 1.0) * half_height;
-        if (x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
-            y <= max_bound(1)) {
-            output_index.push_back(i);
-        }
-    }
-    return output_index;
+    return SelectProjectedPoints(input, view, [&](double x, double y) {
+        return x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
+               y <= max_bound(1);
+    });
 }
 
 std::vector<size_t> SelectionPolygon::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
-    Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
-    double half_width = (double)view.GetWindowWidth() * 0.5;
-    double half_height = (double)view.GetWindowHeight() * 0.5;
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
-        const auto &point = input[k];
-        Eigen::Vector4d pos =
-                mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
-        pos /= pos(3);
-        double x = (pos(0) + 1.0) * half_width;
-        double y = (pos(1) + 1.0) * half_height;
-        nodes.clear();
-        for (size_t i = 0; i < polygon_.size(); i++) {
-            size_t j = (i + 1) % polygon_.size();
-            if ((polygon_[i](1) < y && polygon_[j](1) >= y) ||
-                (polygon_[j](1) < y && polygon_[i](1) >= y)) {
-                nodes.push_back(polygon_[i](0) +
-                                (y - polygon_[i](1)) /
-                                        (polygon_[j](1) - polygon_[i](1)) *
-                                        (polygon_[j](0) - polygon_[i](0)));
-            }
-        }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), x);
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
-    }
-    return output_index;
+    PolygonEdgeTable edge_table(polygon_);
+    return SelectProjectedPoints(input, view, [&](double x, double y) {
+        return edge_table.IsInside(x, y);
+    });
 }
 
 }  // namespace visualization
@@ -31,6 +31,7 @@
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace visualization {
@@ -140,34 +141,41 @@ std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
         v = 1;
         w = 2;
     }
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
-        const auto &point = input[k];
-        if (point(w) < axis_min_ || point(w) > axis_max_) continue;
-        nodes.clear();
-        for (size_t i = 0; i < bounding_polygon_.size(); i++) {
-            size_t j = (i + 1) % bounding_polygon_.size();
-            if ((bounding_polygon_[i](v) < point(v) &&
-                 bounding_polygon_[j](v) >= point(v)) ||
-                (bounding_polygon_[j](v) < point(v) &&
-                 bounding_polygon_[i](v) >= point(v))) {
-                nodes.push_back(bounding_polygon_[i](u) +
-                                (point(v) - bounding_polygon_[i](v)) /
-                                        (bounding_polygon_[j](v) -
-                                         bounding_polygon_[i](v)) *
-                                        (bounding_polygon_[j](u) -
-                                         bounding_polygon_[i](u)));
+    // Chunks collect their inside indices independently and are merged in
+    // order, so the output stays sorted.
+    auto crop_range = [&](int begin, int end, std::vector<size_t> &inside) {
+        std::vector<double> nodes;
+        for (int k = begin; k < end; k++) {
+            const auto &point = input[k];
+            if (point(w) < axis_min_ || point(w) > axis_max_) continue;
+            nodes.clear();
+            for (size_t i = 0; i < bounding_polygon_.size(); i++) {
+                size_t j = (i + 1) % bounding_polygon_.size();
+                if ((bounding_polygon_[i](v) < point(v) &&
+                     bounding_polygon_[j](v) >= point(v)) ||
+                    (bounding_polygon_[j](v) < point(v) &&
+                     bounding_polygon_[i](v) >= point(v))) {
+                    nodes.push_back(bounding_polygon_[i](u) +
+                                    (point(v) - bounding_polygon_[i](v)) /
+                                            (bounding_polygon_[j](v) -
+                                             bounding_polygon_[i](v)) *
+                                            (bounding_polygon_[j](u) -
+                                             bounding_polygon_[i](u)));
+                }
+            }
+            std::sort(nodes.begin(), nodes.end());
+            auto loc = std::lower_bound(nodes.begin(), nodes.end(), point(u));
+            if (std::distance(nodes.begin(), loc) % 2 == 1) {
+                inside.push_back(size_t(k));
             }
         }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), point(u));
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
-    }
+    };
+    output_index = utility::ParallelReduce(
+            0, int(input.size()), std::vector<size_t>(), crop_range,
+            [](std::vector<size_t> &result,
+               const std::vector<size_t> &inside) {
+                result.insert(result.end(), inside.begin(), inside.end());
+            });
     return output_index;
 }
 
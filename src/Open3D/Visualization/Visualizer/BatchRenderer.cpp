@@ -0,0 +1,408 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Visualization/Visualizer/BatchRenderer.h"
+
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <future>
+#include <limits>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace visualization {
+
+namespace {
+
+typedef std::future<std::shared_ptr<geometry::Image>> ImageFuture;
+
+bool IsImageReady(const ImageFuture &future) {
+    return !future.valid() || future.wait_for(std::chrono::seconds(0)) ==
+                                      std::future_status::ready;
+}
+
+std::shared_ptr<geometry::Image> GetImage(ImageFuture &future) {
+    if (!future.valid()) {
+        return nullptr;
+    }
+    return future.get();
+}
+
+}  // unnamed namespace
+
+BatchRenderer::~BatchRenderer() {
+    if (is_initialized_) {
+        glfwMakeContextCurrent(window_);
+        picking_renderer_ptrs_.clear();
+        frame_capture_.Release();
+        ReleaseFramebuffer();
+    }
+}
+
+bool BatchRenderer::RemoveGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr,
+        bool reset_bounding_box) {
+    glfwMakeContextCurrent(window_);
+    picking_renderer_ptrs_.erase(geometry_ptr.get());
+    return Visualizer::RemoveGeometry(geometry_ptr, reset_bounding_box);
+}
+
+bool BatchRenderer::ClearGeometries() {
+    glfwMakeContextCurrent(window_);
+    picking_renderer_ptrs_.clear();
+    return Visualizer::ClearGeometries();
+}
+
+bool BatchRenderer::UpdateGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr) {
+    bool success = Visualizer::UpdateGeometry(geometry_ptr);
+    for (const auto &renderer : picking_renderer_ptrs_) {
+        if (geometry_ptr == nullptr || renderer.first == geometry_ptr.get()) {
+            success = (success && renderer.second->UpdateGeometry());
+        }
+    }
+    return success;
+}
+
+bool BatchRenderer::UpdateGeometryAppended(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr,
+        int window_size /* = 0*/) {
+    bool success =
+            Visualizer::UpdateGeometryAppended(geometry_ptr, window_size);
+    // The picking renderers do not stream, so they bind the whole cloud again.
+    for (const auto &renderer : picking_renderer_ptrs_) {
+        if (renderer.first == geometry_ptr.get()) {
+            success = (success && renderer.second->UpdateGeometry());
+        }
+    }
+    return success;
+}
+
+bool BatchRenderer::RenderViews(
+        const std::vector<camera::PinholeCameraParameters> &parameters,
+        const ViewCallback &callback,
+        bool render_color /* = true*/,
+        bool render_depth /* = true*/,
+        bool render_normal /* = false*/,
+        bool render_index /* = false*/) {
+    if (is_initialized_ == false) {
+        utility::LogWarning(
+                "[BatchRenderer] RenderViews() failed because the window is "
+                "not created.");
+        return false;
+    }
+    if (parameters.empty()) {
+        return true;
+    }
+    const int width = parameters[0].intrinsic_.width_;
+    const int height = parameters[0].intrinsic_.height_;
+    for (const auto &parameter : parameters) {
+        if (parameter.intrinsic_.width_ != width ||
+            parameter.intrinsic_.height_ != height) {
+            utility::LogWarning(
+                    "[BatchRenderer] RenderViews() failed because the views "
+                    "have different image sizes.");
+            return false;
+        }
+    }
+
+    glfwMakeContextCurrent(window_);
+    if (InitFramebuffer(width, height) == false) {
+        return false;
+    }
+    if (render_index) {
+        for (const auto &geometry_ptr : geometry_ptrs_) {
+            if (geometry_ptr->GetGeometryType() !=
+                        geometry::Geometry::GeometryType::PointCloud ||
+                picking_renderer_ptrs_.count(geometry_ptr.get()) > 0) {
+                continue;
+            }
+            auto renderer_ptr =
+                    std::make_shared<glsl::PointCloudPickingRenderer>();
+            if (renderer_ptr->AddGeometry(geometry_ptr)) {
+                picking_renderer_ptrs_[geometry_ptr.get()] = renderer_ptr;
+            }
+        }
+    }
+
+    // The view control follows the framebuffer size while rendering views.
+    const int window_width = view_control_ptr_->GetWindowWidth();
+    const int window_height = view_control_ptr_->GetWindowHeight();
+    view_control_ptr_->ChangeWindowSize(width, height);
+    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_);
+
+    struct InFlightView {
+        int index_;
+        ImageFuture color_;
+        ImageFuture depth_;
+        ImageFuture normal_;
+        ImageFuture index_image_;
+    };
+    std::deque<InFlightView> in_flight_views;
+    auto dispatch_views = [&](bool wait) {
+        frame_capture_.Poll(wait);
+        while (!in_flight_views.empty()) {
+            InFlightView &view = in_flight_views.front();
+            if (!IsImageReady(view.color_) || !IsImageReady(view.depth_) ||
+                !IsImageReady(view.normal_) ||
+                !IsImageReady(view.index_image_)) {
+                break;
+            }
+            RenderedView rendered;
+            rendered.color_ = GetImage(view.color_);
+            rendered.depth_ = GetImage(view.depth_);
+            rendered.normal_ = GetImage(view.normal_);
+            rendered.index_ = GetImage(view.index_image_);
+            if (rendered.normal_) {
+                // Unpack the normals from [0, 1] colors.
+                float *p = (float *)rendered.normal_->data_.data();
+                size_t size = rendered.normal_->data_.size() / sizeof(float);
+                for (size_t i = 0; i < size; i++) {
+                    p[i] = p[i] * 2.0f - 1.0f;
+                }
+            }
+            if (callback) {
+                callback(view.index_, rendered);
+            }
+            in_flight_views.pop_front();
+        }
+    };
+
+    bool success = true;
+    for (size_t i = 0; i < parameters.size(); i++) {
+        if (view_control_ptr_->ConvertFromPinholeCameraParameters(
+                    parameters[i]) == false) {
+            utility::LogWarning("[BatchRenderer] Skipping view {:d}.", i);
+            success = false;
+            continue;
+        }
+        InFlightView view;
+        view.index_ = int(i);
+        if (render_color || render_depth) {
+            RenderColorPass();
+            if (render_color) {
+                view.color_ = frame_capture_.Capture(
+                        AsyncFrameCapture::BufferType::Color, width, height);
+            }
+            if (render_depth) {
+                view.depth_ = frame_capture_.Capture(
+                        AsyncFrameCapture::BufferType::DepthFloat, width,
+                        height, view_control_ptr_->GetZNear(),
+                        view_control_ptr_->GetZFar());
+            }
+        }
+        if (render_normal) {
+            RenderNormalPass();
+            view.normal_ = frame_capture_.Capture(
+                    AsyncFrameCapture::BufferType::ColorFloat, width, height);
+        }
+        if (render_index) {
+            RenderIndexPass();
+            view.index_image_ = frame_capture_.Capture(
+                    AsyncFrameCapture::BufferType::Index, width, height);
+        }
+        in_flight_views.push_back(std::move(view));
+        dispatch_views(false);
+    }
+    dispatch_views(true);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    view_control_ptr_->ChangeWindowSize(window_width, window_height);
+    UpdateRender();
+    return success;
+}
+
+bool BatchRenderer::RenderViewsToFiles(
+        const std::vector<camera::PinholeCameraParameters> &parameters,
+        const std::string &directory,
+        double depth_scale /* = 1000.0*/,
+        bool render_color /* = true*/,
+        bool render_depth /* = true*/) {
+    if (!utility::filesystem::DirectoryExists(directory) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory)) {
+        utility::LogWarning("[BatchRenderer] Failed to create directory {}.",
+                            directory);
+        return false;
+    }
+    auto write_view = [&](int index, const RenderedView &rendered) {
+        auto color = rendered.color_;
+        auto depth = rendered.depth_;
+        std::string color_filename =
+                fmt::format("{}/color_{:06d}.png", directory, index);
+        std::string depth_filename =
+                fmt::format("{}/depth_{:06d}.png", directory, index);
+        frame_capture_.PushWriterJob([=]() {
+            if (color) {
+                io::WriteImage(color_filename, *color);
+            }
+            if (depth) {
+                geometry::Image png_image;
+                png_image.Prepare(depth->width_, depth->height_, 1, 2);
+                const float *p_depth = (const float *)depth->data_.data();
+                uint16_t *p_png = (uint16_t *)png_image.data_.data();
+                // Pixels without depth stay 0; larger depths saturate.
+                const double max_depth =
+                        (double)std::numeric_limits<uint16_t>::max();
+                for (int i = 0; i < depth->width_ * depth->height_; i++) {
+                    if (!(p_depth[i] > 0.0f)) {
+                        p_png[i] = 0;
+                        continue;
+                    }
+                    p_png[i] = (uint16_t)std::min(
+                            std::round(depth_scale * p_depth[i]), max_depth);
+                }
+                io::WriteImage(depth_filename, png_image);
+            }
+        });
+    };
+    bool success = RenderViews(parameters, write_view, render_color,
+                               render_depth, false, false);
+    frame_capture_.Flush();
+    return success;
+}
+
+bool BatchRenderer::InitFramebuffer(int width, int height) {
+    if (frame_buffer_ != 0 && frame_buffer_width_ == width &&
+        frame_buffer_height_ == height) {
+        return true;
+    }
+    ReleaseFramebuffer();
+    if (!GLEW_ARB_framebuffer_object) {
+        utility::LogWarning(
+                "[BatchRenderer] Your GPU does not provide framebuffer "
+                "objects.");
+        return false;
+    }
+    glGenFramebuffers(1, &frame_buffer_);
+    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_);
+    // A float color target keeps the normal pass precise; 8 bit color and
+    // picking codes are stored exactly.
+    glGenRenderbuffers(1, &color_render_buffer_);
+    glBindRenderbuffer(GL_RENDERBUFFER, color_render_buffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA32F, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, color_render_buffer_);
+    glGenRenderbuffers(1, &depth_render_buffer_);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_render_buffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width,
+                          height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, depth_render_buffer_);
+    GLenum draw_buffers[1] = {GL_COLOR_ATTACHMENT0};
+    glDrawBuffers(1, draw_buffers);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) ==
+                    GL_FRAMEBUFFER_COMPLETE;
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        utility::LogWarning("[BatchRenderer] Something is wrong with FBO.");
+        ReleaseFramebuffer();
+        return false;
+    }
+    frame_buffer_width_ = width;
+    frame_buffer_height_ = height;
+    return true;
+}
+
+void BatchRenderer::ReleaseFramebuffer() {
+    if (frame_buffer_ != 0) {
+        glDeleteFramebuffers(1, &frame_buffer_);
+        glDeleteRenderbuffers(1, &color_render_buffer_);
+        glDeleteRenderbuffers(1, &depth_render_buffer_);
+        frame_buffer_ = 0;
+        color_render_buffer_ = 0;
+        depth_render_buffer_ = 0;
+        frame_buffer_width_ = 0;
+        frame_buffer_height_ = 0;
+    }
+}
+
+void BatchRenderer::RenderColorPass() {
+    view_control_ptr_->SetViewMatrices();
+    glDisable(GL_BLEND);
+    auto &background_color = render_option_ptr_->background_color_;
+    glClearColor((GLclampf)background_color(0), (GLclampf)background_color(1),
+                 (GLclampf)background_color(2), 1.0f);
+    glClearDepth(1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+        renderer_ptr->Render(*render_option_ptr_, *view_control_ptr_);
+    }
+    for (const auto &renderer_ptr : utility_renderer_ptrs_) {
+        RenderOption *opt = render_option_ptr_.get();
+        auto optIt = utility_renderer_opts_.find(renderer_ptr);
+        if (optIt != utility_renderer_opts_.end()) {
+            opt = &optIt->second;
+        }
+        renderer_ptr->Render(*opt, *view_control_ptr_);
+    }
+}
+
+void BatchRenderer::RenderNormalPass() {
+    RenderOption option = *render_option_ptr_;
+    option.point_color_option_ = RenderOption::PointColorOption::Normal;
+    option.mesh_color_option_ = RenderOption::MeshColorOption::Normal;
+    option.point_show_normal_ = false;
+    option.mesh_show_wireframe_ = false;
+    view_control_ptr_->SetViewMatrices();
+    glDisable(GL_BLEND);
+    // Gray decodes to a zero normal.
+    glClearColor(0.5f, 0.5f, 0.5f, 1.0f);
+    glClearDepth(1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+        renderer_ptr->Render(option, *view_control_ptr_);
+    }
+}
+
+void BatchRenderer::RenderIndexPass() {
+    view_control_ptr_->SetViewMatrices();
+    glDisable(GL_BLEND);
+    glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
+    glClearDepth(1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    // Other geometries only write depth, so that they occlude the points.
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+        if (renderer_ptr->GetGeometry()->GetGeometryType() !=
+            geometry::Geometry::GeometryType::PointCloud) {
+            renderer_ptr->Render(*render_option_ptr_, *view_control_ptr_);
+        }
+    }
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    for (const auto &renderer : picking_renderer_ptrs_) {
+        renderer.second->Render(*render_option_ptr_, *view_control_ptr_);
+    }
+}
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Visualization/Utility/AsyncFrameCapture.h"
+#include "Open3D/Visualization/Visualizer/Visualizer.h"
+
+namespace open3d {
+
+namespace geometry {
+class Image;
+}
+
+namespace visualization {
+
+namespace glsl {
+class PointCloudPickingRenderer;
+}
+
+/// \class BatchRenderer
+///
+/// \brief Visualizer that renders many camera views of the same geometries
+/// into an offscreen framebuffer.
+///
+/// Geometries stay resident on the GPU across views and across calls. Reads
+/// of view i overlap with rendering of the following views, and results are
+/// delivered in view order. The window can be invisible, or an OSMesa context
+/// when built with ENABLE_HEADLESS_RENDERING.
+class BatchRenderer : public Visualizer {
+public:
+    /// Buffers rendered for one view. Buffers that were not requested are
+    /// nullptr.
+    struct RenderedView {
+        /// 3 channels, 1 byte per channel.
+        std::shared_ptr<geometry::Image> color_;
+        /// 1 channel, float, metric depth along the optical axis (0 for
+        /// background).
+        std::shared_ptr<geometry::Image> depth_;
+        /// 3 channels, float, camera space normals in OpenGL convention (0 for
+        /// background).
+        std::shared_ptr<geometry::Image> normal_;
+        /// 1 channel, float, index of the point in its PointCloud (-1 for
+        /// background). Only point clouds are rendered in this buffer.
+        std::shared_ptr<geometry::Image> index_;
+    };
+
+    typedef std::function<void(int, const RenderedView &)> ViewCallback;
+
+public:
+    BatchRenderer() {}
+    ~BatchRenderer() override;
+    BatchRenderer(const BatchRenderer &) = delete;
+    BatchRenderer &operator=(const BatchRenderer &) = delete;
+
+public:
+    bool RemoveGeometry(std::shared_ptr<const geometry::Geometry> geometry_ptr,
+                        bool reset_bounding_box = true) override;
+    bool ClearGeometries() override;
+    bool UpdateGeometry(std::shared_ptr<const geometry::Geometry> geometry_ptr =
+                                nullptr) override;
+    bool UpdateGeometryAppended(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr,
+            int window_size = 0) override;
+
+    /// Function to render all views.
+    /// \param parameters Camera parameters of the views. All views must share
+    /// the same image size, and the principal point must be the image center.
+    /// \param callback Called on the calling thread with the view index and
+    /// buffers, in view order.
+    bool RenderViews(
+            const std::vector<camera::PinholeCameraParameters> &parameters,
+            const ViewCallback &callback,
+            bool render_color = true,
+            bool render_depth = true,
+            bool render_normal = false,
+            bool render_index = false);
+
+    /// Function to render all views and write color_XXXXXX.png and
+    /// depth_XXXXXX.png (16 bit, scaled by \p depth_scale) into \p directory.
+    /// Files are written on a background thread.
+    bool RenderViewsToFiles(
+            const std::vector<camera::PinholeCameraParameters> &parameters,
+            const std::string &directory,
+            double depth_scale = 1000.0,
+            bool render_color = true,
+            bool render_depth = true);
+
+protected:
+    bool InitFramebuffer(int width, int height);
+    void ReleaseFramebuffer();
+    void RenderColorPass();
+    void RenderNormalPass();
+    void RenderIndexPass();
+
+protected:
+    GLuint frame_buffer_ = 0;
+    GLuint color_render_buffer_ = 0;
+    GLuint depth_render_buffer_ = 0;
+    int frame_buffer_width_ = 0;
+    int frame_buffer_height_ = 0;
+
+    AsyncFrameCapture frame_capture_{8};
+    std::unordered_map<const geometry::Geometry *,
+                       std::shared_ptr<glsl::PointCloudPickingRenderer>>
+            picking_renderer_ptrs_;
+};
+
+}  // namespace visualization
+}  // namespace open3d
@@ -98,6 +98,7 @@ bool RenderOption::ConvertToJsonValue(Json::Value &value) const {
     value["point_size"] = point_size_;
     value["point_color_option"] = (int)point_color_option_;
     value["point_show_normal"] = point_show_normal_;
+    value["point_budget"] = point_budget_;
 
     value["mesh_shade_option"] = (int)mesh_shade_option_;
     value["mesh_color_option"] = (int)mesh_color_option_;
@@ -110,6 +111,8 @@ bool RenderOption::ConvertToJsonValue(Json::Value &value) const {
 
     value["line_width"] = line_width_;
 
+    value["voxel_cull_hidden_faces"] = voxel_cull_hidden_faces_;
+
     value["image_stretch_option"] = (int)image_stretch_option_;
     value["image_max_depth"] = image_max_depth_;
 
@@ -221,6 +224,7 @@ bool RenderOption::ConvertFromJsonValue(const Json::Value &value) {
                     .asInt();
     point_show_normal_ =
             value.get("point_show_normal", point_show_normal_).asBool();
+    point_budget_ = value.get("point_budget", point_budget_).asInt();
 
     mesh_shade_option_ =
             (MeshShadeOption)value
@@ -241,6 +245,10 @@ bool RenderOption::ConvertFromJsonValue(const Json::Value &value) {
 
     line_width_ = value.get("line_width", line_width_).asDouble();
 
+    voxel_cull_hidden_faces_ =
+            value.get("voxel_cull_hidden_faces", voxel_cull_hidden_faces_)
+                    .asBool();
+
     image_stretch_option_ =
             (ImageStretchOption)value
                     .get("image_stretch_option", (int)image_stretch_option_)
@@ -193,6 +193,11 @@ public:
     double point_size_ = POINT_SIZE_DEFAULT;
     PointColorOption point_color_option_ = PointColorOption::Default;
     bool point_show_normal_ = false;
+    /// Maximum number of points drawn per point cloud and frame. Point clouds
+    /// with more points are drawn with view-dependent level of detail, which
+    /// does not draw point_show_normal_ lines. 0 disables level-of-detail
+    /// rendering.
+    int point_budget_ = 0;
 
     // TriangleMesh options
     MeshShadeOption mesh_shade_option_ = MeshShadeOption::FlatShade;
@@ -204,6 +209,11 @@ public:
     // LineSet options
     double line_width_ = LINE_WIDTH_DEFAULT;
 
+    // VoxelGrid options
+    /// Skip the faces shared by two neighbouring voxels when drawing a voxel
+    /// grid. Only the outer surface of solid grids is drawn.
+    bool voxel_cull_hidden_faces_ = true;
+
     // Image options
     ImageStretchOption image_stretch_option_ =
             ImageStretchOption::StretchKeepRatio;
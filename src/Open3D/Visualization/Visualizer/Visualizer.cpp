@@ -205,6 +205,11 @@ bool Visualizer::CreateVisualizerWindow(
 
 void Visualizer::DestroyVisualizerWindow() {
     is_initialized_ = false;
+    async_frame_capture_.Release();
+    if (render_profiler_ptr_) {
+        render_profiler_ptr_->Release();
+        render_profiler_ptr_.reset();
+    }
     glDeleteVertexArrays(1, &vao_id_);
     glfwDestroyWindow(window_);
 }
@@ -278,6 +283,7 @@ bool Visualizer::WaitEvents() {
         WindowRefreshCallback(window_);
     }
     animation_callback_func_in_loop_ = animation_callback_func_;
+    async_frame_capture_.Poll();
     glfwWaitEvents();
     return !glfwWindowShouldClose(window_);
 }
@@ -291,6 +297,7 @@ bool Visualizer::PollEvents() {
         WindowRefreshCallback(window_);
     }
     animation_callback_func_in_loop_ = animation_callback_func_;
+    async_frame_capture_.Poll();
     glfwPollEvents();
     return !glfwWindowShouldClose(window_);
 }
@@ -312,6 +319,12 @@ bool Visualizer::AddGeometry(
         if (renderer_ptr->AddGeometry(geometry_ptr) == false) {
             return false;
         }
+    } else if (geometry_ptr->GetGeometryType() ==
+               geometry::Geometry::GeometryType::PointCloudF) {
+        renderer_ptr = std::make_shared<glsl::PointCloudFRenderer>();
+        if (renderer_ptr->AddGeometry(geometry_ptr) == false) {
+            return false;
+        }
     } else if (geometry_ptr->GetGeometryType() ==
                geometry::Geometry::GeometryType::VoxelGrid) {
         renderer_ptr = std::make_shared<glsl::VoxelGridRenderer>();
@@ -338,6 +351,12 @@ bool Visualizer::AddGeometry(
         if (renderer_ptr->AddGeometry(geometry_ptr) == false) {
             return false;
         }
+    } else if (geometry_ptr->GetGeometryType() ==
+               geometry::Geometry::GeometryType::TriangleMeshF) {
+        renderer_ptr = std::make_shared<glsl::TriangleMeshFRenderer>();
+        if (renderer_ptr->AddGeometry(geometry_ptr) == false) {
+            return false;
+        }
     } else if (geometry_ptr->GetGeometryType() ==
                geometry::Geometry::GeometryType::Image) {
         renderer_ptr = std::make_shared<glsl::ImageRenderer>();
@@ -368,6 +387,12 @@ bool Visualizer::AddGeometry(
         if (renderer_ptr->AddGeometry(geometry_ptr) == false) {
             return false;
         }
+    } else if (geometry_ptr->GetGeometryType() ==
+               geometry::Geometry::GeometryType::InstancedGeometry) {
+        renderer_ptr = std::make_shared<glsl::InstancedGeometryRenderer>();
+        if (renderer_ptr->AddGeometry(geometry_ptr) == false) {
+            return false;
+        }
     } else {
         return false;
     }
@@ -431,6 +456,21 @@ bool Visualizer::UpdateGeometry(
     return success;
 }
 
+bool Visualizer::UpdateGeometryAppended(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr,
+        int window_size /* = 0*/) {
+    glfwMakeContextCurrent(window_);
+    bool success = true;
+    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+        if (renderer_ptr->HasGeometry(geometry_ptr)) {
+            success = (success &&
+                       renderer_ptr->UpdateGeometryAppended(window_size));
+        }
+    }
+    UpdateRender();
+    return success;
+}
+
 void Visualizer::UpdateRender() { is_redraw_required_ = true; }
 
 bool Visualizer::HasGeometry() const { return !geometry_ptrs_.empty(); }
@@ -456,6 +496,7 @@ void Visualizer::PrintVisualizerHelp() {
     utility::LogInfo("    P, PrtScn    : Take a screen capture.");
     utility::LogInfo("    D            : Take a depth capture.");
     utility::LogInfo("    O            : Take a capture of current rendering settings.");
+    utility::LogInfo("    F1           : Turn on/off the render profiler overlay.");
     utility::LogInfo("");
     utility::LogInfo("  -- Render mode control --");
     utility::LogInfo("    L            : Turn on/off lighting.");
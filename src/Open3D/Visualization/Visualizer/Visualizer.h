@@ -34,6 +34,7 @@
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -41,7 +42,9 @@
 
 #include "Open3D/Geometry/Geometry.h"
 #include "Open3D/Visualization/Shader/GeometryRenderer.h"
+#include "Open3D/Visualization/Utility/AsyncFrameCapture.h"
 #include "Open3D/Visualization/Utility/ColorMap.h"
+#include "Open3D/Visualization/Utility/RenderProfiler.h"
 #include "Open3D/Visualization/Visualizer/RenderOption.h"
 #include "Open3D/Visualization/Visualizer/ViewControl.h"
 
@@ -50,6 +53,7 @@ namespace open3d {
 namespace geometry {
 class TriangleMesh;
 class Image;
+class InstancedGeometry;
 }  // namespace geometry
 
 namespace visualization {
@@ -146,6 +150,18 @@ public:
     /// updates the geometry specified.
     virtual bool UpdateGeometry(
             std::shared_ptr<const geometry::Geometry> geometry_ptr = nullptr);
+    /// Function to update a point cloud to which points have been appended
+    /// 1. Only the points appended since the last update are uploaded, into
+    /// GPU buffers that grow as needed. Modifying or removing points that were
+    /// already drawn requires UpdateGeometry().
+    /// 2. If \p window_size is positive, only the window_size most recently
+    /// appended points are drawn, for a sliding-window display.
+    /// 3. Other geometry types are updated as with UpdateGeometry().
+    /// 4. Normal lines (RenderOption::point_show_normal_) are not streamed:
+    /// they are drawn for the whole cloud and uploaded again on every update.
+    virtual bool UpdateGeometryAppended(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr,
+            int window_size = 0);
     virtual bool HasGeometry() const;
 
     /// Function to set the redraw flag as dirty
@@ -170,6 +186,37 @@ public:
                                 bool do_render = true,
                                 bool convert_to_world_coordinate = false);
     void CaptureRenderOption(const std::string &filename = "");
+    /// Function to capture the screen without waiting for the GPU.
+    /// The returned future becomes ready in a later capture call, in
+    /// PollEvents()/WaitEvents(), or in FlushAsyncCaptures(); it must not be
+    /// waited on before one of those is called.
+    std::future<std::shared_ptr<geometry::Image>> CaptureScreenFloatBufferAsync(
+            bool do_render = true);
+    /// Function to capture the depth buffer without waiting for the GPU. See
+    /// CaptureScreenFloatBufferAsync().
+    std::future<std::shared_ptr<geometry::Image>> CaptureDepthFloatBufferAsync(
+            bool do_render = true);
+    /// Function to capture the screen to an image file without waiting for
+    /// the GPU. The file is written on a background thread.
+    void CaptureScreenImageAsync(const std::string &filename = "",
+                                 bool do_render = true);
+    /// Function to wait for all asynchronous captures and file writes.
+    void FlushAsyncCaptures();
+    /// Function to turn the render profiler on or off. If \p show_overlay is
+    /// true, the CPU and GPU times of the zones in a recent frame are drawn
+    /// over the scene.
+    void EnableRenderProfiler(bool enable, bool show_overlay = true);
+    /// Function to write the frames collected by the render profiler as a
+    /// Chrome trace JSON file.
+    bool WriteRenderProfilerTrace(const std::string &filename) const;
+    /// Function to find the instance of \p instanced visible at window
+    /// coordinates (\p x, \p y). Returns the index into
+    /// InstancedGeometry::transforms_, or -1 if no instance is drawn there.
+    /// The geometry must have been added with AddGeometry().
+    int PickInstance(
+            std::shared_ptr<const geometry::InstancedGeometry> instanced,
+            double x,
+            double y);
     void ResetViewPoint(bool reset_bounding_box = false);
 
     const std::string &GetWindowName() const { return window_name_; }
@@ -221,9 +268,21 @@ protected:
     // control
     MouseControl mouse_control_;
     bool is_redraw_required_ = true;
+    bool is_render_pending_ = false;
     bool is_initialized_ = false;
     GLuint vao_id_;
 
+    // asynchronous frame capture
+    AsyncFrameCapture async_frame_capture_;
+
+    // render profiling
+    std::unique_ptr<RenderProfiler> render_profiler_ptr_;
+    bool show_render_profiler_overlay_ = false;
+
+    // renders instance indices for PickInstance(), created on first use
+    std::shared_ptr<glsl::InstancedGeometryPickingRenderer>
+            instance_picking_renderer_ptr_;
+
     // view control
     std::unique_ptr<ViewControl> view_control_ptr_;
 
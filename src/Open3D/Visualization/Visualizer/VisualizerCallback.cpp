@@ -33,6 +33,12 @@ void Visualizer::WindowRefreshCallback(GLFWwindow *window) {
     if (is_redraw_required_) {
         Render();
         is_redraw_required_ = false;
+        if (is_render_pending_) {
+            // Keep rendering until all renderers are done, and wake up the
+            // event loop in case it is blocked in glfwWaitEvents().
+            is_redraw_required_ = true;
+            glfwPostEmptyEvent();
+        }
     }
 }
 
@@ -158,6 +164,11 @@ void Visualizer::KeyPressCallback(
         case GLFW_KEY_O:
             CaptureRenderOption();
             break;
+        case GLFW_KEY_F1:
+            EnableRenderProfiler(!render_profiler_ptr_);
+            utility::LogDebug("[Visualizer] Render profiler {}.",
+                              render_profiler_ptr_ ? "ON" : "OFF");
+            break;
         case GLFW_KEY_L:
             render_option_ptr_->ToggleLightOn();
             utility::LogDebug("[Visualizer] Lighting {}.",
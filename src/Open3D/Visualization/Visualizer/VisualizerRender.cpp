@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/InstancedGeometry.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
@@ -66,6 +67,9 @@ bool Visualizer::InitOpenGL() {
 
 void Visualizer::Render() {
     glfwMakeContextCurrent(window_);
+    if (render_profiler_ptr_) {
+        render_profiler_ptr_->BeginFrame();
+    }
 
     view_control_ptr_->SetViewMatrices();
 
@@ -77,19 +81,104 @@ void Visualizer::Render() {
     glClearDepth(1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
-        renderer_ptr->Render(*render_option_ptr_, *view_control_ptr_);
+    is_render_pending_ = false;
+    {
+        ScopedRenderZone zone("Geometries");
+        for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+            renderer_ptr->Render(*render_option_ptr_, *view_control_ptr_);
+            is_render_pending_ |= renderer_ptr->IsRenderPending();
+        }
     }
-    for (const auto &renderer_ptr : utility_renderer_ptrs_) {
-        RenderOption *opt = render_option_ptr_.get();
-        auto optIt = utility_renderer_opts_.find(renderer_ptr);
-        if (optIt != utility_renderer_opts_.end()) {
-            opt = &optIt->second;
+    {
+        ScopedRenderZone zone("Utilities");
+        for (const auto &renderer_ptr : utility_renderer_ptrs_) {
+            RenderOption *opt = render_option_ptr_.get();
+            auto optIt = utility_renderer_opts_.find(renderer_ptr);
+            if (optIt != utility_renderer_opts_.end()) {
+                opt = &optIt->second;
+            }
+            renderer_ptr->Render(*opt, *view_control_ptr_);
         }
-        renderer_ptr->Render(*opt, *view_control_ptr_);
+    }
+    if (render_profiler_ptr_ && show_render_profiler_overlay_) {
+        ScopedRenderZone zone("Overlay");
+        render_profiler_ptr_->DrawOverlay(view_control_ptr_->GetWindowWidth(),
+                                          view_control_ptr_->GetWindowHeight());
     }
 
-    glfwSwapBuffers(window_);
+    {
+        ScopedRenderZone zone("SwapBuffers");
+        glfwSwapBuffers(window_);
+    }
+    if (render_profiler_ptr_) {
+        render_profiler_ptr_->EndFrame();
+    }
+}
+
+int Visualizer::PickInstance(
+        std::shared_ptr<const geometry::InstancedGeometry> instanced,
+        double x,
+        double y) {
+    if (is_initialized_ == false) {
+        return -1;
+    }
+    if (geometry_ptrs_.count(instanced) == 0) {
+        utility::LogWarning(
+                "[Visualizer] PickInstance() failed because the geometry has "
+                "not been added.");
+        return -1;
+    }
+    const auto &view = GetViewControl();
+    // glReadPixels uses GL coordinates: (x, y) is lower left and +y is up
+    int pixel_x = int(x + 0.5);
+    int pixel_y = int(view.GetWindowHeight() - y - 0.5);
+    if (pixel_x < 0 || pixel_x >= view.GetWindowWidth() || pixel_y < 0 ||
+        pixel_y >= view.GetWindowHeight()) {
+        return -1;
+    }
+    glfwMakeContextCurrent(window_);
+    if (!instance_picking_renderer_ptr_) {
+        instance_picking_renderer_ptr_ =
+                std::make_shared<glsl::InstancedGeometryPickingRenderer>();
+    }
+    // The instances may have changed since the last pick, so they are bound
+    // again.
+    if (instance_picking_renderer_ptr_->AddGeometry(instanced) == false) {
+        return -1;
+    }
+    view_control_ptr_->SetViewMatrices();
+
+    // Render into the back buffer, which is cleared by the next Render()
+    // before it is shown.
+    const GLboolean multisample = glIsEnabled(GL_MULTISAMPLE);
+    glDisable(GL_MULTISAMPLE);  // we need pixelation for correct pick colors
+    glDisable(GL_BLEND);
+    glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
+    glClearDepth(1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Other geometries only occlude the instances
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    for (const auto &renderer_ptr : geometry_renderer_ptrs_) {
+        if (!renderer_ptr->HasGeometry(instanced)) {
+            renderer_ptr->Render(*render_option_ptr_, *view_control_ptr_);
+        }
+    }
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    instance_picking_renderer_ptr_->Render(*render_option_ptr_,
+                                           *view_control_ptr_);
+    if (multisample == GL_TRUE) {
+        glEnable(GL_MULTISAMPLE);
+    }
+
+    uint8_t rgba[4];
+    GLint read_buffer;
+    glGetIntegerv(GL_READ_BUFFER, &read_buffer);
+    glReadBuffer(GL_BACK);
+    glReadPixels(pixel_x, pixel_y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+    glReadBuffer(GLenum(read_buffer));
+    return GLHelper::ColorCodeToPickIndex(
+            Eigen::Vector4i(rgba[0], rgba[1], rgba[2], rgba[3]));
 }
 
 void Visualizer::ResetViewPoint(bool reset_bounding_box /* = false*/) {
@@ -143,11 +232,29 @@ void Visualizer::CopyViewStatusFromClipboard() {
     }
 }
 
+namespace {
+
+/// Flips the rows of an image in place, swapping through one line buffer.
+void FlipImageRowsInPlace(geometry::Image &image) {
+    int bytes_per_line = image.BytesPerLine();
+    std::vector<uint8_t> line(bytes_per_line);
+    for (int i = 0; i < image.height_ / 2; i++) {
+        uint8_t *top = image.data_.data() + bytes_per_line * i;
+        uint8_t *bottom =
+                image.data_.data() + bytes_per_line * (image.height_ - i - 1);
+        memcpy(line.data(), top, bytes_per_line);
+        memcpy(top, bottom, bytes_per_line);
+        memcpy(bottom, line.data(), bytes_per_line);
+    }
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<geometry::Image> Visualizer::CaptureScreenFloatBuffer(
         bool do_render /* = true*/) {
-    geometry::Image screen_image;
-    screen_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                         view_control_ptr_->GetWindowHeight(), 3, 4);
+    auto image_ptr = std::make_shared<geometry::Image>();
+    image_ptr->Prepare(view_control_ptr_->GetWindowWidth(),
+                       view_control_ptr_->GetWindowHeight(), 3, 4);
     if (do_render) {
         Render();
         is_redraw_required_ = false;
@@ -155,20 +262,11 @@ std::shared_ptr<geometry::Image> Visualizer::CaptureScreenFloatBuffer(
     glFinish();
     glReadPixels(0, 0, view_control_ptr_->GetWindowWidth(),
                  view_control_ptr_->GetWindowHeight(), GL_RGB, GL_FLOAT,
-                 screen_image.data_.data());
+                 image_ptr->data_.data());
 
     // glReadPixels get the screen in a vertically flipped manner
     // Thus we should flip it back.
-    auto image_ptr = std::make_shared<geometry::Image>();
-    image_ptr->Prepare(view_control_ptr_->GetWindowWidth(),
-                       view_control_ptr_->GetWindowHeight(), 3, 4);
-    int bytes_per_line = screen_image.BytesPerLine();
-    for (int i = 0; i < screen_image.height_; i++) {
-        memcpy(image_ptr->data_.data() + bytes_per_line * i,
-               screen_image.data_.data() +
-                       bytes_per_line * (screen_image.height_ - i - 1),
-               bytes_per_line);
-    }
+    FlipImageRowsInPlace(*image_ptr);
     return image_ptr;
 }
 
@@ -181,9 +279,9 @@ void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
         png_filename = "ScreenCapture_" + timestamp + ".png";
         camera_filename = "ScreenCamera_" + timestamp + ".json";
     }
-    geometry::Image screen_image;
-    screen_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                         view_control_ptr_->GetWindowHeight(), 3, 1);
+    geometry::Image png_image;
+    png_image.Prepare(view_control_ptr_->GetWindowWidth(),
+                      view_control_ptr_->GetWindowHeight(), 3, 1);
     if (do_render) {
         Render();
         is_redraw_required_ = false;
@@ -191,20 +289,11 @@ void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
     glFinish();
     glReadPixels(0, 0, view_control_ptr_->GetWindowWidth(),
                  view_control_ptr_->GetWindowHeight(), GL_RGB, GL_UNSIGNED_BYTE,
-                 screen_image.data_.data());
+                 png_image.data_.data());
 
     // glReadPixels get the screen in a vertically flipped manner
     // Thus we should flip it back.
-    geometry::Image png_image;
-    png_image.Prepare(view_control_ptr_->GetWindowWidth(),
-                      view_control_ptr_->GetWindowHeight(), 3, 1);
-    int bytes_per_line = screen_image.BytesPerLine();
-    for (int i = 0; i < screen_image.height_; i++) {
-        memcpy(png_image.data_.data() + bytes_per_line * i,
-               screen_image.data_.data() +
-                       bytes_per_line * (screen_image.height_ - i - 1),
-               bytes_per_line);
-    }
+    FlipImageRowsInPlace(png_image);
 
     utility::LogDebug("[Visualizer] Screen capture to {}",
                       png_filename.c_str());
@@ -218,6 +307,91 @@ void Visualizer::CaptureScreenImage(const std::string &filename /* = ""*/,
     }
 }
 
+std::future<std::shared_ptr<geometry::Image>>
+Visualizer::CaptureScreenFloatBufferAsync(bool do_render /* = true*/) {
+    if (do_render) {
+        Render();
+        is_redraw_required_ = false;
+    }
+    return async_frame_capture_.Capture(
+            AsyncFrameCapture::BufferType::ColorFloat,
+            view_control_ptr_->GetWindowWidth(),
+            view_control_ptr_->GetWindowHeight());
+}
+
+std::future<std::shared_ptr<geometry::Image>>
+Visualizer::CaptureDepthFloatBufferAsync(bool do_render /* = true*/) {
+    if (do_render) {
+        Render();
+        is_redraw_required_ = false;
+    }
+    return async_frame_capture_.Capture(
+            AsyncFrameCapture::BufferType::DepthFloat,
+            view_control_ptr_->GetWindowWidth(),
+            view_control_ptr_->GetWindowHeight(),
+            view_control_ptr_->GetZNear(), view_control_ptr_->GetZFar());
+}
+
+void Visualizer::CaptureScreenImageAsync(const std::string &filename /* = ""*/,
+                                         bool do_render /* = true*/) {
+    std::string png_filename = filename;
+    if (png_filename.empty()) {
+        std::string timestamp = utility::GetCurrentTimeStamp();
+        png_filename = "ScreenCapture_" + timestamp + ".png";
+        std::string camera_filename = "ScreenCamera_" + timestamp + ".json";
+        utility::LogDebug("[Visualizer] Screen camera capture to {}",
+                          camera_filename.c_str());
+        camera::PinholeCameraParameters parameter;
+        view_control_ptr_->ConvertToPinholeCameraParameters(parameter);
+        io::WriteIJsonConvertible(camera_filename, parameter);
+    }
+    if (do_render) {
+        Render();
+        is_redraw_required_ = false;
+    }
+    utility::LogDebug("[Visualizer] Screen capture to {}",
+                      png_filename.c_str());
+    async_frame_capture_.Capture(
+            AsyncFrameCapture::BufferType::Color,
+            view_control_ptr_->GetWindowWidth(),
+            view_control_ptr_->GetWindowHeight(), 0.0, 0.0,
+            [png_filename](const geometry::Image &image) {
+                io::WriteImage(png_filename, image);
+            });
+}
+
+void Visualizer::FlushAsyncCaptures() {
+    if (is_initialized_ == false) {
+        return;
+    }
+    glfwMakeContextCurrent(window_);
+    async_frame_capture_.Flush();
+}
+
+void Visualizer::EnableRenderProfiler(bool enable,
+                                      bool show_overlay /* = true*/) {
+    show_render_profiler_overlay_ = show_overlay;
+    if (enable && !render_profiler_ptr_) {
+        render_profiler_ptr_ =
+                std::unique_ptr<RenderProfiler>(new RenderProfiler());
+    } else if (!enable && render_profiler_ptr_) {
+        glfwMakeContextCurrent(window_);
+        render_profiler_ptr_->Release();
+        render_profiler_ptr_.reset();
+    }
+    UpdateRender();
+}
+
+bool Visualizer::WriteRenderProfilerTrace(const std::string &filename) const {
+    if (!render_profiler_ptr_) {
+        utility::LogWarning(
+                "[Visualizer] WriteRenderProfilerTrace() failed because the "
+                "render profiler is not enabled.");
+        return false;
+    }
+    return render_profiler_ptr_->WriteTrace(filename);
+}
+
 std::shared_ptr<geometry::Image> Visualizer::CaptureDepthFloatBuffer(
         bool do_render /* = true*/) {
     geometry::Image depth_image;
@@ -26,6 +26,7 @@
 
 #include "Open3D/Visualization/Visualizer/VisualizerWithVertexSelection.h"
 
+#include <algorithm>
 #include <tinyfiledialogs/tinyfiledialogs.h>
 
 #include "Open3D/Geometry/HalfEdgeTriangleMesh.h"
@@ -55,46 +56,15 @@ static const Eigen::Vector3d CHOOSE_POINTS_COLOR(1, 0, 1);
 static const Eigen::Vector3d SELECTED_POINTS_COLOR(0, 1, 0);
 static const int START_RECT_DIST = 3;
 
-bool BindFramebuffer(int width, int height) {
-    GLuint frame_buffer_name = 0;
-    glGenFramebuffers(1, &frame_buffer_name);
-    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_name);
-    GLuint fbo_texture;
-    glGenTextures(1, &fbo_texture);
-    glBindTexture(GL_TEXTURE_2D, fbo_texture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
-                 GL_UNSIGNED_BYTE, 0);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    if (!GLEW_ARB_framebuffer_object) {
-        // OpenGL 2.1 doesn't require this, 3.1+ does
-        utility::LogWarning(
-                "[BindFramebuffwer] Your GPU does not provide framebuffer "
-                "objects. "
-                "Use a texture instead.");
-        return false;
-    }
-    GLuint depth_render_buffer;
-    glGenRenderbuffers(1, &depth_render_buffer);
-    glBindRenderbuffer(GL_RENDERBUFFER, depth_render_buffer);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
-                              GL_RENDERBUFFER, depth_render_buffer);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                           fbo_texture, 0);
-    GLenum DrawBuffers[1] = {GL_COLOR_ATTACHMENT0};
-    glDrawBuffers(1, DrawBuffers);  // "1" is the size of DrawBuffers
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        utility::LogWarning("[BindFramebuffer] Something is wrong with FBO.");
-        return false;
+}  // namespace
+
+VisualizerWithVertexSelection::~VisualizerWithVertexSelection() {
+    if (is_initialized_) {
+        glfwMakeContextCurrent(window_);
+        ReleasePickingFramebuffer();
     }
-    return true;
 }
 
-}  // namespace
-
 bool VisualizerWithVertexSelection::AddGeometry(
         std::shared_ptr<const geometry::Geometry> geometry_in_ptr,
         bool reset_bounding_box) {
@@ -134,6 +104,9 @@ bool VisualizerWithVertexSelection::AddGeometry(
         case geometry::Geometry::GeometryType::Octree:
         case geometry::Geometry::GeometryType::OrientedBoundingBox:
         case geometry::Geometry::GeometryType::AxisAlignedBoundingBox:
+        case geometry::Geometry::GeometryType::PointCloudF:
+        case geometry::Geometry::GeometryType::TriangleMeshF:
+        case geometry::Geometry::GeometryType::InstancedGeometry:
         case geometry::Geometry::GeometryType::Unspecified:
             return false;
     }
@@ -148,6 +121,9 @@ bool VisualizerWithVertexSelection::AddGeometry(
     ui_points_geometry_ptr_ = std::make_shared<geometry::PointCloud>();
     ui_points_renderer_ptr_ = std::make_shared<glsl::PointCloudRenderer>();
     ui_points_renderer_ptr_->AddGeometry(ui_points_geometry_ptr_);
+    ui_points_picking_renderer_ptr_ =
+            std::make_shared<glsl::PointCloudPickingRenderer>();
+    ui_points_picking_renderer_ptr_->AddGeometry(ui_points_geometry_ptr_);
     ui_selected_points_geometry_ptr_ = std::make_shared<geometry::PointCloud>();
     ui_selected_points_renderer_ptr_ =
             std::make_shared<glsl::PointCloudRenderer>();
@@ -227,18 +203,31 @@ bool VisualizerWithVertexSelection::UpdateGeometry(
         case geometry::Geometry::GeometryType::Octree:
         case geometry::Geometry::GeometryType::OrientedBoundingBox:
         case geometry::Geometry::GeometryType::AxisAlignedBoundingBox:
+        case geometry::Geometry::GeometryType::PointCloudF:
+        case geometry::Geometry::GeometryType::TriangleMeshF:
+        case geometry::Geometry::GeometryType::InstancedGeometry:
         case geometry::Geometry::GeometryType::Unspecified:
             break;
     }
 
     ui_points_geometry_ptr_->PaintUniformColor(CHOOSE_POINTS_COLOR);
     ui_points_renderer_ptr_->UpdateGeometry();
+    ui_points_picking_renderer_ptr_->UpdateGeometry();
+    is_picking_buffer_valid_ = false;
 
     geometry_renderer_ptr_->UpdateGeometry();
 
     return result;
 }
 
+bool VisualizerWithVertexSelection::UpdateGeometryAppended(
+        std::shared_ptr<const geometry::Geometry> geometry_ptr,
+        int window_size /* = 0*/) {
+    // The selectable points are copied from the geometry, so the copies are
+    // rebuilt as for any other change.
+    return UpdateGeometry();
+}
+
 void VisualizerWithVertexSelection::PrintVisualizerHelp() {
     Visualizer::PrintVisualizerHelp();
     // clang-format off
@@ -307,11 +296,12 @@ void VisualizerWithVertexSelection::BuildUtilities() {
 float VisualizerWithVertexSelection::GetDepth(int winX, int winY) {
     const auto &view = GetViewControl();
 
-    // Render to FBO
-    if (!BindFramebuffer(view.GetWindowWidth(), view.GetWindowHeight())) {
+    // Render to FBO. This overwrites the depth of the picking buffer.
+    if (!BindPickingFramebuffer()) {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
         return {};
     }
+    is_picking_buffer_valid_ = false;
 
     view_control_ptr_->SetViewMatrices();
     // We only need the depth information, so reduce time rendering colors
@@ -349,19 +339,118 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
                                                            double w,
                                                            double h) {
     points_in_rect_.clear();
-
-    auto renderer_ptr = std::make_shared<glsl::PointCloudPickingRenderer>();
-    if (renderer_ptr->AddGeometry(ui_points_geometry_ptr_) == false) {
+    if (!ui_points_picking_renderer_ptr_) {
         return {};
     }
     const auto &view = GetViewControl();
-    // Render to FBO
-    if (!BindFramebuffer(view.GetWindowWidth(), view.GetWindowHeight())) {
+    if (!BindPickingFramebuffer()) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return {};
+    }
+    RenderPickingBuffer();
+
+    // glReadPixels uses GL coordinates: (x, y) is lower left and +y is up
+    int width = int(std::ceil(w));
+    int height = int(std::ceil(h));
+    int lowerLeftX = int(winX + 0.5);
+    int lowerLeftY = int(view.GetWindowHeight() - winY - height + 0.5);
+    // Only read back the part of the rectangle inside the window
+    int x0 = std::max(lowerLeftX, 0);
+    int y0 = std::max(lowerLeftY, 0);
+    int x1 = std::min(lowerLeftX + width, view.GetWindowWidth());
+    int y1 = std::min(lowerLeftY + height, view.GetWindowHeight());
+    if (x1 <= x0 || y1 <= y0) {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
         return {};
     }
+    width = x1 - x0;
+    height = y1 - y0;
+    std::vector<uint8_t> rgba(4 * width * height, 0);
+    glReadPixels(x0, y0, width, height, GL_RGBA, GL_UNSIGNED_BYTE,
+                 rgba.data());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    std::vector<int> indices;
+    for (int i = 0; i < width * height; ++i) {
+        const uint8_t *rgbaPtr = rgba.data() + 4 * i;
+        int index = GLHelper::ColorCodeToPickIndex(Eigen::Vector4i(
+                rgbaPtr[0], rgbaPtr[1], rgbaPtr[2], rgbaPtr[3]));
+        if (index >= 0) {
+            indices.push_back(index);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    points_in_rect_ = indices;
+    return indices;
+}
+
+bool VisualizerWithVertexSelection::BindPickingFramebuffer() {
+    const auto &view = GetViewControl();
+    int width = view.GetWindowWidth();
+    int height = view.GetWindowHeight();
+    if (picking_frame_buffer_ != 0 && picking_buffer_width_ == width &&
+        picking_buffer_height_ == height) {
+        glBindFramebuffer(GL_FRAMEBUFFER, picking_frame_buffer_);
+        return true;
+    }
+    ReleasePickingFramebuffer();
+    if (!GLEW_ARB_framebuffer_object) {
+        // OpenGL 2.1 doesn't require this, 3.1+ does
+        utility::LogWarning(
+                "[BindPickingFramebuffer] Your GPU does not provide "
+                "framebuffer objects.");
+        return false;
+    }
+    glGenFramebuffers(1, &picking_frame_buffer_);
+    glBindFramebuffer(GL_FRAMEBUFFER, picking_frame_buffer_);
+    glGenRenderbuffers(1, &picking_color_buffer_);
+    glBindRenderbuffer(GL_RENDERBUFFER, picking_color_buffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, picking_color_buffer_);
+    glGenRenderbuffers(1, &picking_depth_buffer_);
+    glBindRenderbuffer(GL_RENDERBUFFER, picking_depth_buffer_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, picking_depth_buffer_);
+    GLenum DrawBuffers[1] = {GL_COLOR_ATTACHMENT0};
+    glDrawBuffers(1, DrawBuffers);  // "1" is the size of DrawBuffers
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        utility::LogWarning(
+                "[BindPickingFramebuffer] Something is wrong with FBO.");
+        ReleasePickingFramebuffer();
+        return false;
+    }
+    picking_buffer_width_ = width;
+    picking_buffer_height_ = height;
+    is_picking_buffer_valid_ = false;
+    return true;
+}
 
+void VisualizerWithVertexSelection::ReleasePickingFramebuffer() {
+    if (picking_frame_buffer_ != 0) {
+        glDeleteFramebuffers(1, &picking_frame_buffer_);
+        glDeleteRenderbuffers(1, &picking_color_buffer_);
+        glDeleteRenderbuffers(1, &picking_depth_buffer_);
+        picking_frame_buffer_ = 0;
+        picking_color_buffer_ = 0;
+        picking_depth_buffer_ = 0;
+        picking_buffer_width_ = 0;
+        picking_buffer_height_ = 0;
+    }
+    is_picking_buffer_valid_ = false;
+}
+
+void VisualizerWithVertexSelection::RenderPickingBuffer() {
     view_control_ptr_->SetViewMatrices();
+    const auto &view = GetViewControl();
+    if (is_picking_buffer_valid_ &&
+        picking_mvp_matrix_ == view.GetMVPMatrix()) {
+        return;
+    }
+
     glDisable(GL_MULTISAMPLE);  // we need pixelation for correct pick colors
     glDisable(GL_BLEND);
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -381,40 +470,12 @@ std::vector<int> VisualizerWithVertexSelection::PickPoints(double winX,
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
     // Now render the points
-    renderer_ptr->Render(pick_point_opts_, GetViewControl());
-
-    glFinish();
-
-    // glReadPixels uses GL coordinates: (x, y) is lower left and +y is up
-    int width = int(std::ceil(w));
-    int height = int(std::ceil(h));
-    int lowerLeftX = int(winX + 0.5);
-    int lowerLeftY = int(view.GetWindowHeight() - winY - height + 0.5);
-    std::vector<uint8_t> rgba(4 * width * height, 0);
-
-    glReadPixels(lowerLeftX, lowerLeftY, width, height, GL_RGBA,
-                 GL_UNSIGNED_BYTE, rgba.data());
-    // Recover rendering state
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    ui_points_picking_renderer_ptr_->Render(pick_point_opts_,
+                                            GetViewControl());
     glEnable(GL_MULTISAMPLE);
 
-    std::unordered_set<int> indexSet;
-    for (int i = 0; i < width * height; ++i) {
-        const uint8_t *rgbaPtr = rgba.data() + 4 * i;
-        int index = GLHelper::ColorCodeToPickIndex(Eigen::Vector4i(
-                rgbaPtr[0], rgbaPtr[1], rgbaPtr[2], rgbaPtr[3]));
-        if (index >= 0) {
-            indexSet.insert(index);
-        }
-    }
-
-    std::vector<int> indices;
-    indices.reserve(indexSet.size());
-    for (int idx : indexSet) {
-        indices.push_back(idx);
-    }
-    points_in_rect_ = indices;
-    return indices;
+    picking_mvp_matrix_ = view.GetMVPMatrix();
+    is_picking_buffer_valid_ = true;
 }
 
 std::vector<VisualizerWithVertexSelection::PickedPoint>
@@ -793,6 +854,9 @@ const std::vector<Eigen::Vector3d>
         case geometry::Geometry::GeometryType::Octree:
         case geometry::Geometry::GeometryType::OrientedBoundingBox:
         case geometry::Geometry::GeometryType::AxisAlignedBoundingBox:
+        case geometry::Geometry::GeometryType::PointCloudF:
+        case geometry::Geometry::GeometryType::TriangleMeshF:
+        case geometry::Geometry::GeometryType::InstancedGeometry:
         case geometry::Geometry::GeometryType::Unspecified:
             points = nullptr;
             break;
@@ -817,6 +881,7 @@ Eigen::Vector3d VisualizerWithVertexSelection::CalcDragDelta(int winX,
 void VisualizerWithVertexSelection::SetPointSize(double size) {
     size = std::max(size, MIN_POINT_SIZE);
     pick_point_opts_.SetPointSize(size);
+    is_picking_buffer_valid_ = false;
     auto *opt = &utility_renderer_opts_[ui_points_renderer_ptr_];
     opt->SetPointSize(size);
     opt = &utility_renderer_opts_[ui_selected_points_renderer_ptr_];
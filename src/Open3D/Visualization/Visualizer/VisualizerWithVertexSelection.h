@@ -46,7 +46,7 @@ public:
 
 public:
     VisualizerWithVertexSelection() {}
-    ~VisualizerWithVertexSelection() override {}
+    ~VisualizerWithVertexSelection() override;
     VisualizerWithVertexSelection(const VisualizerWithVertexSelection &) =
             delete;
     VisualizerWithVertexSelection &operator=(
@@ -57,6 +57,9 @@ public:
                      bool reset_bounding_box = true) override;
     bool UpdateGeometry(std::shared_ptr<const geometry::Geometry> geometry_ptr =
                                 nullptr) override;
+    bool UpdateGeometryAppended(
+            std::shared_ptr<const geometry::Geometry> geometry_ptr,
+            int window_size = 0) override;
     void PrintVisualizerHelp() override;
     void UpdateWindowTitle() override;
     void BuildUtilities() override;
@@ -96,6 +99,13 @@ protected:
     void AddPickedPoints(const std::vector<int> indices);
     void RemovePickedPoints(const std::vector<int> indices);
     float GetDepth(int winX, int winY);
+    /// Binds the framebuffer used for picking and depth queries, (re)creating
+    /// it if the window size changed.
+    bool BindPickingFramebuffer();
+    void ReleasePickingFramebuffer();
+    /// Renders the point indices into the picking framebuffer, unless the
+    /// buffer is still valid for the current view.
+    void RenderPickingBuffer();
     Eigen::Vector3d CalcDragDelta(int winX, int winY);
     enum DragType { DRAG_MOVING, DRAG_END };
     void DragSelectedPoints(const Eigen::Vector3d &delta, DragType type);
@@ -122,6 +132,18 @@ protected:
 
     std::shared_ptr<geometry::PointCloud> ui_points_geometry_ptr_;
     std::shared_ptr<glsl::GeometryRenderer> ui_points_renderer_ptr_;
+    std::shared_ptr<glsl::PointCloudPickingRenderer>
+            ui_points_picking_renderer_ptr_;
+
+    // Picking framebuffer, kept between picks. The index buffer is valid until
+    // the geometry, the view or the point size changes.
+    GLuint picking_frame_buffer_ = 0;
+    GLuint picking_color_buffer_ = 0;
+    GLuint picking_depth_buffer_ = 0;
+    int picking_buffer_width_ = 0;
+    int picking_buffer_height_ = 0;
+    bool is_picking_buffer_valid_ = false;
+    GLHelper::GLMatrix4f picking_mvp_matrix_;
 
     std::unordered_map<int, Eigen::Vector3d> selected_points_;
     std::unordered_map<int, Eigen::Vector3d> selected_points_before_drag_;
@@ -29,6 +29,7 @@
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Progress.h"
 
 #include "open3d_pybind/color_map/color_map.h"
 #include "open3d_pybind/docstring.h"
@@ -182,13 +183,17 @@ void pybind_color_map_methods(py::module &m) {
           "optimization for 3D Reconstruction with Consumer Depth Cameras, "
           "SIGGRAPH 2014.",
           "mesh"_a, "imgs_rgbd"_a, "camera"_a,
-          "option"_a = color_map::ColorMapOptimizationOption());
+          "option"_a = color_map::ColorMapOptimizationOption(),
+          "progress"_a = nullptr, py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(
             m, "color_map_optimization",
             {{"mesh", "The input geometry mesh."},
              {"imgs_rgbd", "A list of RGBD images seen by cameras."},
              {"camera", "Cameras' parameters."},
-             {"option", "The ColorMap optimization option."}});
+             {"option", "The ColorMap optimization option."},
+             {"progress",
+              "Optional ProgressToken. The mesh and cameras are left unchanged "
+              "if it is cancelled."}});
 }
 
 void pybind_color_map(py::module &m) {
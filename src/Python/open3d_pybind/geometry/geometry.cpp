@@ -90,6 +90,12 @@ void pybind_geometry_classes(py::module &m) {
             .value("Image", geometry::Geometry::GeometryType::Image)
             .value("RGBDImage", geometry::Geometry::GeometryType::RGBDImage)
             .value("TetraMesh", geometry::Geometry::GeometryType::TetraMesh)
+            .value("InstancedGeometry",
+                   geometry::Geometry::GeometryType::InstancedGeometry)
+            .value("PointCloudF",
+                   geometry::Geometry::GeometryType::PointCloudF)
+            .value("TriangleMeshF",
+                   geometry::Geometry::GeometryType::TriangleMeshF)
             .export_values();
 
     py::class_<geometry::Geometry3D, PyGeometry3D<geometry::Geometry3D>,
@@ -193,13 +199,16 @@ void pybind_geometry(py::module &m) {
     pybind_geometry_classes(m_submodule);
     pybind_kdtreeflann(m_submodule);
     pybind_pointcloud(m_submodule);
+    pybind_pointcloudf(m_submodule);
     pybind_voxelgrid(m_submodule);
     pybind_lineset(m_submodule);
     pybind_meshbase(m_submodule);
     pybind_trianglemesh(m_submodule);
+    pybind_trianglemeshf(m_submodule);
     pybind_halfedgetrianglemesh(m_submodule);
     pybind_image(m_submodule);
     pybind_tetramesh(m_submodule);
+    pybind_instancedgeometry(m_submodule);
     pybind_pointcloud_methods(m_submodule);
     pybind_voxelgrid_methods(m_submodule);
     pybind_meshbase_methods(m_submodule);
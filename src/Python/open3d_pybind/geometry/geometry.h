@@ -31,13 +31,16 @@
 void pybind_geometry(py::module &m);
 
 void pybind_pointcloud(py::module &m);
+void pybind_pointcloudf(py::module &m);
 void pybind_voxelgrid(py::module &m);
 void pybind_lineset(py::module &m);
 void pybind_meshbase(py::module &m);
 void pybind_trianglemesh(py::module &m);
+void pybind_trianglemeshf(py::module &m);
 void pybind_halfedgetrianglemesh(py::module &m);
 void pybind_image(py::module &m);
 void pybind_tetramesh(py::module &m);
+void pybind_instancedgeometry(py::module &m);
 void pybind_kdtreeflann(py::module &m);
 void pybind_pointcloud_methods(py::module &m);
 void pybind_voxelgrid_methods(py::module &m);
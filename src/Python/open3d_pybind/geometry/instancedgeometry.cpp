@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/InstancedGeometry.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+#include "open3d_pybind/geometry/geometry_trampoline.h"
+
+using namespace open3d;
+
+void pybind_instancedgeometry(py::module &m) {
+    py::class_<geometry::InstancedGeometry,
+               PyGeometry3D<geometry::InstancedGeometry>,
+               std::shared_ptr<geometry::InstancedGeometry>,
+               geometry::Geometry3D>
+            instanced(m, "InstancedGeometry",
+                      "InstancedGeometry draws many copies of one "
+                      "TriangleMesh or LineSet, each with its own "
+                      "transformation and color, with a single draw call.");
+    py::detail::bind_default_constructor<geometry::InstancedGeometry>(
+            instanced);
+    py::detail::bind_copy_functions<geometry::InstancedGeometry>(instanced);
+    instanced
+            .def(py::init([](std::shared_ptr<geometry::Geometry3D> base) {
+                     return new geometry::InstancedGeometry(base);
+                 }),
+                 "Create an InstancedGeometry from a base TriangleMesh or "
+                 "LineSet.",
+                 "base_geometry"_a)
+            .def("__repr__",
+                 [](const geometry::InstancedGeometry &instanced) {
+                     return std::string("geometry::InstancedGeometry with ") +
+                            std::to_string(instanced.transforms_.size()) +
+                            " instances.";
+                 })
+            .def("has_instances", &geometry::InstancedGeometry::HasInstances,
+                 "Returns ``True`` if the object contains instances.")
+            .def("has_colors", &geometry::InstancedGeometry::HasColors,
+                 "Returns ``True`` if the instances have colors.")
+            .def("add_instance",
+                 (geometry::InstancedGeometry &
+                  (geometry::InstancedGeometry::*)(const Eigen::Matrix4d &)) &
+                         geometry::InstancedGeometry::AddInstance,
+                 "Appends an instance.", "transformation"_a)
+            .def("add_instance",
+                 (geometry::InstancedGeometry &
+                  (geometry::InstancedGeometry::*)(const Eigen::Matrix4d &,
+                                                   const Eigen::Vector3d &)) &
+                         geometry::InstancedGeometry::AddInstance,
+                 "Appends an instance with a color.", "transformation"_a,
+                 "color"_a)
+            .def("paint_uniform_color",
+                 &geometry::InstancedGeometry::PaintUniformColor,
+                 "Assigns each instance the same color.", "color"_a)
+            .def_property(
+                    "base_geometry",
+                    [](const geometry::InstancedGeometry &instanced) {
+                        return std::const_pointer_cast<geometry::Geometry3D>(
+                                instanced.base_geometry_);
+                    },
+                    [](geometry::InstancedGeometry &instanced,
+                       std::shared_ptr<geometry::Geometry3D> base) {
+                        instanced.base_geometry_ = base;
+                    },
+                    "The TriangleMesh or LineSet drawn for every instance.")
+            .def_readwrite("transforms",
+                           &geometry::InstancedGeometry::transforms_,
+                           "List of ``float64`` arrays of shape ``(4, 4)``: "
+                           "Transformation of each instance.")
+            .def_readwrite("colors", &geometry::InstancedGeometry::colors_,
+                           "``float64`` array of shape ``(num_instances, 3)``, "
+                           "range ``[0, 1]`` , use ``numpy.asarray()`` to "
+                           "access data: RGB colors of instances.");
+    docstring::ClassMethodDocInject(m, "InstancedGeometry", "has_instances");
+    docstring::ClassMethodDocInject(m, "InstancedGeometry", "has_colors");
+    docstring::ClassMethodDocInject(
+            m, "InstancedGeometry", "add_instance",
+            {{"transformation", "Transformation of the base geometry."},
+             {"color", "Color of the instance."}});
+    docstring::ClassMethodDocInject(m, "InstancedGeometry",
+                                    "paint_uniform_color",
+                                    {{"color", "Color for the instances."}});
+}
@@ -24,12 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
 #include <vector>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointAttribute.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Progress.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -37,7 +40,90 @@
 
 using namespace open3d;
 
+namespace {
+
+std::string PointAttributeFormat(geometry::PointAttribute::Dtype dtype) {
+    switch (dtype) {
+        case geometry::PointAttribute::Dtype::UInt8:
+            return py::format_descriptor<uint8_t>::format();
+        case geometry::PointAttribute::Dtype::Int32:
+            return py::format_descriptor<int32_t>::format();
+        case geometry::PointAttribute::Dtype::Int64:
+            return py::format_descriptor<int64_t>::format();
+        case geometry::PointAttribute::Dtype::Float32:
+            return py::format_descriptor<float>::format();
+        case geometry::PointAttribute::Dtype::Float64:
+        default:
+            return py::format_descriptor<double>::format();
+    }
+}
+
+// Copies a (num_points,) or (num_points, dimension) array into the attribute
+// \p name. Returns false if the array does not hold values of type \p T.
+template <typename T>
+bool SetAttributeFromArray(geometry::PointCloud &pcd,
+                           const std::string &name,
+                           py::array array) {
+    if (!py::isinstance<py::array_t<T>>(array)) {
+        return false;
+    }
+    auto values = py::array_t<T, py::array::c_style>::ensure(array);
+    if (values.ndim() < 1 || values.ndim() > 2 ||
+        size_t(values.shape(0)) != pcd.points_.size()) {
+        throw py::value_error(
+                "Attribute array must have shape (num_points,) or "
+                "(num_points, dimension).");
+    }
+    int dimension = values.ndim() == 1 ? 1 : int(values.shape(1));
+    auto &attribute = pcd.AddAttribute(
+            name, geometry::PointAttribute::DtypeOf<T>(), dimension);
+    if (!attribute.IsEmpty()) {
+        std::memcpy(attribute.GetData(), values.data(),
+                    attribute.GetSize() * attribute.GetRowByteSize());
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
 void pybind_pointcloud(py::module &m) {
+    py::class_<geometry::PointAttribute> pointattribute(
+            m, "PointAttribute", py::buffer_protocol(),
+            "PointAttribute class. A column of per-point values with a fixed "
+            "dtype and dimension. Use ``numpy.asarray()`` to access the "
+            "values without copying.");
+    py::enum_<geometry::PointAttribute::Dtype>(pointattribute, "Dtype",
+                                               py::arithmetic())
+            .value("UInt8", geometry::PointAttribute::Dtype::UInt8)
+            .value("Int32", geometry::PointAttribute::Dtype::Int32)
+            .value("Int64", geometry::PointAttribute::Dtype::Int64)
+            .value("Float32", geometry::PointAttribute::Dtype::Float32)
+            .value("Float64", geometry::PointAttribute::Dtype::Float64)
+            .export_values();
+    pointattribute
+            .def_buffer([](geometry::PointAttribute &attribute)
+                                -> py::buffer_info {
+                size_t item_size = geometry::PointAttribute::SizeOfDtype(
+                        attribute.GetDtype());
+                return py::buffer_info(
+                        attribute.GetData(), item_size,
+                        PointAttributeFormat(attribute.GetDtype()), 2,
+                        {attribute.GetSize(), size_t(attribute.GetDimension())},
+                        {attribute.GetRowByteSize(), item_size});
+            })
+            .def("__repr__",
+                 [](const geometry::PointAttribute &attribute) {
+                     return std::string("geometry::PointAttribute with ") +
+                            std::to_string(attribute.GetSize()) +
+                            " rows of dimension " +
+                            std::to_string(attribute.GetDimension()) +
+                            ".\nUse numpy.asarray() to access data.";
+                 })
+            .def("__len__", &geometry::PointAttribute::GetSize)
+            .def_property_readonly("dtype", &geometry::PointAttribute::GetDtype)
+            .def_property_readonly("dimension",
+                                   &geometry::PointAttribute::GetDimension);
+
     py::class_<geometry::PointCloud, PyGeometry3D<geometry::PointCloud>,
                std::shared_ptr<geometry::PointCloud>, geometry::Geometry3D>
             pointcloud(m, "PointCloud",
@@ -62,6 +148,51 @@ void pybind_pointcloud(py::module &m) {
                  "Returns ``True`` if the point cloud contains point normals.")
             .def("has_colors", &geometry::PointCloud::HasColors,
                  "Returns ``True`` if the point cloud contains point colors.")
+            .def("has_attribute", &geometry::PointCloud::HasAttribute,
+                 "Returns ``True`` if the point cloud contains the named "
+                 "attribute with one row per point.",
+                 "name"_a)
+            .def("add_attribute", &geometry::PointCloud::AddAttribute,
+                 "Adds a zero-filled attribute with one row per point.",
+                 "name"_a, "dtype"_a, "dimension"_a = 1,
+                 py::return_value_policy::reference_internal)
+            .def("get_attribute",
+                 [](geometry::PointCloud &pcd,
+                    const std::string &name) -> geometry::PointAttribute & {
+                     return pcd.GetAttribute(name);
+                 },
+                 "Returns the named attribute. ``numpy.asarray()`` on the "
+                 "result shares memory with the point cloud.",
+                 "name"_a, py::return_value_policy::reference_internal)
+            .def("set_attribute",
+                 [](geometry::PointCloud &pcd, const std::string &name,
+                    py::array values) {
+                     if (!SetAttributeFromArray<uint8_t>(pcd, name, values) &&
+                         !SetAttributeFromArray<int32_t>(pcd, name, values) &&
+                         !SetAttributeFromArray<int64_t>(pcd, name, values) &&
+                         !SetAttributeFromArray<float>(pcd, name, values) &&
+                         !SetAttributeFromArray<double>(pcd, name, values)) {
+                         throw py::type_error(
+                                 "Attribute dtype must be uint8, int32, "
+                                 "int64, float32 or float64.");
+                     }
+                 },
+                 "Sets the named attribute to a copy of a numpy array of "
+                 "shape ``(num_points,)`` or ``(num_points, dimension)``.",
+                 "name"_a, "values"_a)
+            .def("remove_attribute", &geometry::PointCloud::RemoveAttribute,
+                 "Removes the named attribute. Returns ``False`` if it does "
+                 "not exist.",
+                 "name"_a)
+            .def("get_attribute_names",
+                 [](const geometry::PointCloud &pcd) {
+                     std::vector<std::string> names;
+                     for (const auto &attribute : pcd.attributes_) {
+                         names.push_back(attribute.first);
+                     }
+                     return names;
+                 },
+                 "Returns the names of all attributes.")
             .def("normalize_normals", &geometry::PointCloud::NormalizeNormals,
                  "Normalize point normals to length 1.")
             .def("paint_uniform_color",
@@ -74,7 +205,10 @@ void pybind_pointcloud(py::module &m) {
                  "``True`` to "
                  "invert the selection of indices.",
                  "indices"_a, "invert"_a = false)
-            .def("voxel_down_sample", &geometry::PointCloud::VoxelDownSample,
+            .def("voxel_down_sample",
+                 [](const geometry::PointCloud &pcd, double voxel_size) {
+                     return pcd.VoxelDownSample(voxel_size);
+                 },
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel",
@@ -171,14 +305,23 @@ void pybind_pointcloud(py::module &m) {
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
-                 "eps"_a, "min_points"_a, "print_progress"_a = false)
+                 "eps"_a, "min_points"_a, "print_progress"_a = false,
+                 "progress"_a = nullptr,
+                 py::call_guard<py::gil_scoped_release>())
             .def("segment_plane", &geometry::PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
                  "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
             .def_static(
                     "create_from_depth_image",
-                    &geometry::PointCloud::CreateFromDepthImage,
+                    [](const geometry::Image &depth,
+                       const camera::PinholeCameraIntrinsic &intrinsic,
+                       const Eigen::Matrix4d &extrinsic, double depth_scale,
+                       double depth_trunc, int stride) {
+                        return geometry::PointCloud::CreateFromDepthImage(
+                                depth, intrinsic, extrinsic, depth_scale,
+                                depth_trunc, stride);
+                    },
                     R"(Factory function to create a pointcloud from a depth image and a
         camera. Given depth value d at (u, v) image coordinate, the corresponding 3d
         point is:
@@ -193,7 +336,12 @@ void pybind_pointcloud(py::module &m) {
                     "stride"_a = 1)
             .def_static(
                     "create_from_rgbd_image",
-                    &geometry::PointCloud::CreateFromRGBDImage,
+                    [](const geometry::RGBDImage &image,
+                       const camera::PinholeCameraIntrinsic &intrinsic,
+                       const Eigen::Matrix4d &extrinsic) {
+                        return geometry::PointCloud::CreateFromRGBDImage(
+                                image, intrinsic, extrinsic);
+                    },
                     R"(Factory function to create a pointcloud from an RGB-D image and a
         camera. Given depth value d at (u, v) image coordinate, the corresponding 3d
         point is:
@@ -220,6 +368,21 @@ void pybind_pointcloud(py::module &m) {
     docstring::ClassMethodDocInject(m, "PointCloud", "has_colors");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_normals");
     docstring::ClassMethodDocInject(m, "PointCloud", "has_points");
+    docstring::ClassMethodDocInject(m, "PointCloud", "has_attribute",
+                                    {{"name", "Name of the attribute."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "add_attribute",
+            {{"name", "Name of the attribute."},
+             {"dtype", "Type of the attribute values."},
+             {"dimension", "Number of values per point."}});
+    docstring::ClassMethodDocInject(m, "PointCloud", "get_attribute",
+                                    {{"name", "Name of the attribute."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "set_attribute",
+            {{"name", "Name of the attribute."},
+             {"values", "Attribute values, one row per point."}});
+    docstring::ClassMethodDocInject(m, "PointCloud", "remove_attribute",
+                                    {{"name", "Name of the attribute."}});
     docstring::ClassMethodDocInject(m, "PointCloud", "normalize_normals");
     docstring::ClassMethodDocInject(
             m, "PointCloud", "paint_uniform_color",
@@ -297,7 +460,10 @@ void pybind_pointcloud(py::module &m) {
               "Density parameter that is used to find neighbouring points."},
              {"min_points", "Minimum number of points to form a cluster."},
              {"print_progress",
-              "If true the progress is visualized in the console."}});
+              "If true the progress is visualized in the console."},
+             {"progress",
+              "Optional ProgressToken to report progress to and to cancel "
+              "the clustering with. If given, print_progress is ignored."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "segment_plane",
             {{"distance_threshold",
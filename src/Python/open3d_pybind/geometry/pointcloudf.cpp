@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
+#include "Open3D/Geometry/RGBDImage.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+#include "open3d_pybind/geometry/geometry_trampoline.h"
+
+using namespace open3d;
+
+void pybind_pointcloudf(py::module &m) {
+    py::class_<geometry::PointCloudF, PyGeometry3D<geometry::PointCloudF>,
+               std::shared_ptr<geometry::PointCloudF>, geometry::Geometry3D>
+            pointcloudf(m, "PointCloudF",
+                        "PointCloudF class. A single-precision point cloud "
+                        "with ``float32`` points, and optionally colors and "
+                        "normals, at half the memory of PointCloud.");
+    py::detail::bind_default_constructor<geometry::PointCloudF>(pointcloudf);
+    py::detail::bind_copy_functions<geometry::PointCloudF>(pointcloudf);
+    pointcloudf
+            .def(py::init<const std::vector<Eigen::Vector3f> &>(),
+                 "Create a PointCloudF from points", "points"_a)
+            .def(py::init<const geometry::PointCloud &>(),
+                 "Create a PointCloudF from a PointCloud", "cloud"_a)
+            .def("__repr__",
+                 [](const geometry::PointCloudF &pcd) {
+                     return std::string("geometry::PointCloudF with ") +
+                            std::to_string(pcd.points_.size()) + " points.";
+                 })
+            .def(py::self + py::self)
+            .def(py::self += py::self)
+            .def("has_points", &geometry::PointCloudF::HasPoints,
+                 "Returns ``True`` if the point cloud contains points.")
+            .def("has_normals", &geometry::PointCloudF::HasNormals,
+                 "Returns ``True`` if the point cloud contains point normals.")
+            .def("has_colors", &geometry::PointCloudF::HasColors,
+                 "Returns ``True`` if the point cloud contains point colors.")
+            .def("normalize_normals", &geometry::PointCloudF::NormalizeNormals,
+                 "Normalize point normals to length 1.")
+            .def("paint_uniform_color",
+                 &geometry::PointCloudF::PaintUniformColor, "color"_a,
+                 "Assigns each point in the PointCloudF the same color.")
+            .def("to_point_cloud", &geometry::PointCloudF::ToPointCloud,
+                 "Converts the point cloud to a double-precision PointCloud.")
+            .def("remove_none_finite_points",
+                 &geometry::PointCloudF::RemoveNoneFinitePoints,
+                 "Function to remove none-finite points from the PointCloudF",
+                 "remove_nan"_a = true, "remove_infinite"_a = true)
+            .def("select_down_sample",
+                 &geometry::PointCloudF::SelectDownSample,
+                 "Function to select points from input pointcloud into output "
+                 "pointcloud.",
+                 "indices"_a, "invert"_a = false)
+            .def("voxel_down_sample",
+                 [](const geometry::PointCloudF &pcd, double voxel_size) {
+                     return pcd.VoxelDownSample(voxel_size);
+                 },
+                 "Function to downsample input pointcloud into output "
+                 "pointcloud with a voxel",
+                 "voxel_size"_a)
+            .def("uniform_down_sample",
+                 &geometry::PointCloudF::UniformDownSample,
+                 "Function to downsample input pointcloud into output "
+                 "pointcloud uniformly.",
+                 "every_k_points"_a)
+            .def("estimate_normals", &geometry::PointCloudF::EstimateNormals,
+                 "Function to compute the normals of a point cloud. Normals "
+                 "are oriented with respect to the input point cloud if "
+                 "normals exist",
+                 "search_param"_a = geometry::KDTreeSearchParamKNN(),
+                 "fast_normal_computation"_a = true)
+            .def_static(
+                    "create_from_depth_image",
+                    [](const geometry::Image &depth,
+                       const camera::PinholeCameraIntrinsic &intrinsic,
+                       const Eigen::Matrix4d &extrinsic, double depth_scale,
+                       double depth_trunc, int stride) {
+                        return geometry::PointCloudF::CreateFromDepthImage(
+                                depth, intrinsic, extrinsic, depth_scale,
+                                depth_trunc, stride);
+                    },
+                    "Same as PointCloud.create_from_depth_image, with a "
+                    "single-precision result.",
+                    "depth"_a, "intrinsic"_a,
+                    "extrinsic"_a = Eigen::Matrix4d::Identity(),
+                    "depth_scale"_a = 1000.0, "depth_trunc"_a = 1000.0,
+                    "stride"_a = 1)
+            .def_static(
+                    "create_from_rgbd_image",
+                    [](const geometry::RGBDImage &image,
+                       const camera::PinholeCameraIntrinsic &intrinsic,
+                       const Eigen::Matrix4d &extrinsic) {
+                        return geometry::PointCloudF::CreateFromRGBDImage(
+                                image, intrinsic, extrinsic);
+                    },
+                    "Same as PointCloud.create_from_rgbd_image, with a "
+                    "single-precision result.",
+                    "image"_a, "intrinsic"_a,
+                    "extrinsic"_a = Eigen::Matrix4d::Identity())
+            .def_readwrite("points", &geometry::PointCloudF::points_,
+                           "``float32`` array of shape ``(num_points, 3)``, "
+                           "use ``numpy.asarray()`` to access data: Points "
+                           "coordinates.")
+            .def_readwrite("normals", &geometry::PointCloudF::normals_,
+                           "``float32`` array of shape ``(num_points, 3)``, "
+                           "use ``numpy.asarray()`` to access data: Points "
+                           "normals.")
+            .def_readwrite(
+                    "colors", &geometry::PointCloudF::colors_,
+                    "``float32`` array of shape ``(num_points, 3)``, "
+                    "range ``[0, 1]`` , use ``numpy.asarray()`` to access "
+                    "data: RGB colors of points.");
+    docstring::ClassMethodDocInject(m, "PointCloudF", "has_colors");
+    docstring::ClassMethodDocInject(m, "PointCloudF", "has_normals");
+    docstring::ClassMethodDocInject(m, "PointCloudF", "has_points");
+    docstring::ClassMethodDocInject(m, "PointCloudF", "normalize_normals");
+    docstring::ClassMethodDocInject(
+            m, "PointCloudF", "paint_uniform_color",
+            {{"color", "RGB color for the PointCloudF."}});
+    docstring::ClassMethodDocInject(m, "PointCloudF", "to_point_cloud");
+    docstring::ClassMethodDocInject(
+            m, "PointCloudF", "remove_none_finite_points",
+            {{"remove_nan", "Remove NaN values from the PointCloudF"},
+             {"remove_infinite",
+              "Remove infinite values from the PointCloudF"}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloudF", "select_down_sample",
+            {{"indices", "Indices of points to be selected."},
+             {"invert",
+              "Set to ``True`` to invert the selection of indices."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloudF", "voxel_down_sample",
+            {{"voxel_size", "Voxel size to downsample into."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloudF", "uniform_down_sample",
+            {{"every_k_points",
+              "Sample rate, the selected point indices are [0, k, 2k, ...]"}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloudF", "estimate_normals",
+            {{"search_param",
+              "The KDTree search parameters for neighborhood search."},
+             {"fast_normal_computation",
+              "If true, the normal estiamtion uses a non-iterative method to "
+              "extract the eigenvector from the covariance matrix. This is "
+              "faster, but is not as numerical stable."}});
+    docstring::ClassMethodDocInject(m, "PointCloudF",
+                                    "create_from_depth_image");
+    docstring::ClassMethodDocInject(m, "PointCloudF", "create_from_rgbd_image");
+}
@@ -27,6 +27,7 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Progress.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/geometry/geometry.h"
@@ -332,7 +333,8 @@ void pybind_trianglemesh(py::module &m) {
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "pcd"_a, "radii"_a, "progress"_a = nullptr,
+                    py::call_guard<py::gil_scoped_release>())
             .def_static("create_from_point_cloud_poisson",
                         &geometry::TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -342,7 +344,8 @@ void pybind_trianglemesh(py::module &m) {
                         "This function uses the original implementation by "
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false)
+                        "linear_fit"_a = false, "progress"_a = nullptr,
+                        py::call_guard<py::gil_scoped_release>())
             .def_static("create_box", &geometry::TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -630,7 +633,10 @@ void pybind_trianglemesh(py::module &m) {
               "reconstructed. Has to contain normals."},
              {"radii",
               "The radii of the ball that are used for the surface "
-              "reconstruction."}});
+              "reconstruction."},
+             {"progress",
+              "Optional ProgressToken. An empty mesh is returned if it is "
+              "cancelled."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -651,7 +657,10 @@ void pybind_trianglemesh(py::module &m) {
               "reconstruction and the diameter of the samples' bounding cube."},
              {"linear_fit",
               "If true, the reconstructor use linear interpolation to estimate "
-              "the positions of iso-vertices."}});
+              "the positions of iso-vertices."},
+             {"progress",
+              "Optional ProgressToken. An empty mesh is returned if it is "
+              "cancelled."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "create_box",
                                     {{"width", "x-directional length."},
                                      {"height", "y-directional length."},
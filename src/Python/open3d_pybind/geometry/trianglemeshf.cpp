@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/geometry/geometry.h"
+#include "open3d_pybind/geometry/geometry_trampoline.h"
+
+using namespace open3d;
+
+void pybind_trianglemeshf(py::module &m) {
+    py::class_<geometry::TriangleMeshF, PyGeometry3D<geometry::TriangleMeshF>,
+               std::shared_ptr<geometry::TriangleMeshF>, geometry::Geometry3D>
+            trianglemeshf(m, "TriangleMeshF",
+                          "TriangleMeshF class. A single-precision triangle "
+                          "mesh with ``float32`` vertices, and optionally "
+                          "vertex colors and normals, at half the memory of "
+                          "TriangleMesh.");
+    py::detail::bind_default_constructor<geometry::TriangleMeshF>(
+            trianglemeshf);
+    py::detail::bind_copy_functions<geometry::TriangleMeshF>(trianglemeshf);
+    trianglemeshf
+            .def(py::init<const std::vector<Eigen::Vector3f> &,
+                          const std::vector<Eigen::Vector3i> &>(),
+                 "Create a triangle mesh from vertices and triangle indices",
+                 "vertices"_a, "triangles"_a)
+            .def(py::init<const geometry::TriangleMesh &>(),
+                 "Create a TriangleMeshF from a TriangleMesh", "mesh"_a)
+            .def("__repr__",
+                 [](const geometry::TriangleMeshF &mesh) {
+                     return std::string("geometry::TriangleMeshF with ") +
+                            std::to_string(mesh.vertices_.size()) +
+                            " points and " +
+                            std::to_string(mesh.triangles_.size()) +
+                            " triangles.";
+                 })
+            .def(py::self + py::self)
+            .def(py::self += py::self)
+            .def("has_vertices", &geometry::TriangleMeshF::HasVertices,
+                 "Returns ``True`` if the mesh contains vertices.")
+            .def("has_triangles", &geometry::TriangleMeshF::HasTriangles,
+                 "Returns ``True`` if the mesh contains triangles.")
+            .def("has_vertex_normals",
+                 &geometry::TriangleMeshF::HasVertexNormals,
+                 "Returns ``True`` if the mesh contains vertex normals.")
+            .def("has_vertex_colors", &geometry::TriangleMeshF::HasVertexColors,
+                 "Returns ``True`` if the mesh contains vertex colors.")
+            .def("has_triangle_normals",
+                 &geometry::TriangleMeshF::HasTriangleNormals,
+                 "Returns ``True`` if the mesh contains triangle normals.")
+            .def("normalize_normals",
+                 &geometry::TriangleMeshF::NormalizeNormals,
+                 "Normalize both triangle normals and vertex normals to "
+                 "length 1.")
+            .def("paint_uniform_color",
+                 &geometry::TriangleMeshF::PaintUniformColor, "color"_a,
+                 "Assigns each vertex in the TriangleMeshF the same color.")
+            .def("compute_triangle_normals",
+                 &geometry::TriangleMeshF::ComputeTriangleNormals,
+                 "Function to compute triangle normals, usually called before "
+                 "rendering",
+                 "normalized"_a = true)
+            .def("compute_vertex_normals",
+                 &geometry::TriangleMeshF::ComputeVertexNormals,
+                 "Function to compute vertex normals, usually called before "
+                 "rendering",
+                 "normalized"_a = true)
+            .def("to_triangle_mesh", &geometry::TriangleMeshF::ToTriangleMesh,
+                 "Converts the mesh to a double-precision TriangleMesh.")
+            .def_readwrite("vertices", &geometry::TriangleMeshF::vertices_,
+                           "``float32`` array of shape ``(num_vertices, 3)``, "
+                           "use ``numpy.asarray()`` to access data: Vertex "
+                           "coordinates.")
+            .def_readwrite("vertex_normals",
+                           &geometry::TriangleMeshF::vertex_normals_,
+                           "``float32`` array of shape ``(num_vertices, 3)``, "
+                           "use ``numpy.asarray()`` to access data: Vertex "
+                           "normals.")
+            .def_readwrite(
+                    "vertex_colors", &geometry::TriangleMeshF::vertex_colors_,
+                    "``float32`` array of shape ``(num_vertices, 3)``, "
+                    "range ``[0, 1]`` , use ``numpy.asarray()`` to access "
+                    "data: RGB colors of vertices.")
+            .def_readwrite("triangles", &geometry::TriangleMeshF::triangles_,
+                           "``int`` array of shape ``(num_triangles, 3)``, use "
+                           "``numpy.asarray()`` to access data: List of "
+                           "triangles denoted by the index of points forming "
+                           "the triangle.")
+            .def_readwrite("triangle_normals",
+                           &geometry::TriangleMeshF::triangle_normals_,
+                           "``float32`` array of shape ``(num_triangles, 3)``, "
+                           "use ``numpy.asarray()`` to access data: Triangle "
+                           "normals.");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF", "has_vertices");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF", "has_triangles");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF", "has_vertex_normals");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF", "has_vertex_colors");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF",
+                                    "has_triangle_normals");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF", "normalize_normals");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMeshF", "paint_uniform_color",
+            {{"color", "RGB color for the TriangleMeshF."}});
+    docstring::ClassMethodDocInject(m, "TriangleMeshF",
+                                    "compute_triangle_normals");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF",
+                                    "compute_vertex_normals");
+    docstring::ClassMethodDocInject(m, "TriangleMeshF", "to_triangle_mesh");
+}
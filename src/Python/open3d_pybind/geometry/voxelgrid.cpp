@@ -112,6 +112,14 @@ void pybind_voxelgrid(py::module &m) {
                  "(pixel value > 0). The point is not carved if none of the "
                  "boundary points of the voxel projects to a valid image "
                  "location.")
+            .def("carve_depth_maps", &geometry::VoxelGrid::CarveDepthMaps,
+                 "depth_maps"_a, "camera_params"_a,
+                 "Carve the VoxelGrid with several depth maps in a single "
+                 "pass, as calling carve_depth_map for every view.")
+            .def("carve_silhouettes", &geometry::VoxelGrid::CarveSilhouettes,
+                 "silhouette_masks"_a, "camera_params"_a,
+                 "Carve the VoxelGrid with several silhouette masks in a "
+                 "single pass, as calling carve_silhouette for every view.")
             .def("to_octree", &geometry::VoxelGrid::ToOctree, "max_depth"_a,
                  "Convert to Octree.")
             .def("create_from_octree", &geometry::VoxelGrid::CreateFromOctree,
@@ -134,12 +142,13 @@ void pybind_voxelgrid(py::module &m) {
             .def_static("create_from_triangle_mesh",
                         &geometry::VoxelGrid::CreateFromTriangleMesh,
                         "Function to make voxels from a TriangleMesh",
-                        "input"_a, "voxel_size"_a)
+                        "input"_a, "voxel_size"_a, "solid"_a = false)
             .def_static(
                     "create_from_triangle_mesh_within_bounds",
                     &geometry::VoxelGrid::CreateFromTriangleMeshWithinBounds,
                     "Function to make voxels from a PointCloud", "input"_a,
-                    "voxel_size"_a, "min_bound"_a, "max_bound"_a)
+                    "voxel_size"_a, "min_bound"_a, "max_bound"_a,
+                    "solid"_a = false)
             .def_readwrite("origin", &geometry::VoxelGrid::origin_,
                            "``float64`` vector of length 3: Coorindate of the "
                            "origin point.")
@@ -162,6 +171,18 @@ void pybind_voxelgrid(py::module &m) {
               "Silhouette mask (Image) used for VoxelGrid carving."},
              {"camera_parameters",
               "PinholeCameraParameters used to record the given depth_map."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_depth_maps",
+            {{"depth_maps", "Depth maps (Image) used for VoxelGrid carving."},
+             {"camera_params",
+              "PinholeCameraParameters used to record each depth map."}});
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_silhouettes",
+            {{"silhouette_masks",
+              "Silhouette masks (Image) used for VoxelGrid carving."},
+             {"camera_params",
+              "PinholeCameraParameters used to record each silhouette "
+              "mask."}});
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "to_octree",
             {{"max_depth", "int: Maximum depth of the octree."}});
@@ -190,7 +211,10 @@ void pybind_voxelgrid(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "create_from_triangle_mesh",
             {{"input", "The input TriangleMesh"},
-             {"voxel_size", "Voxel size of of the VoxelGrid construction."}});
+             {"voxel_size", "Voxel size of of the VoxelGrid construction."},
+             {"solid",
+              "If true, the voxels inside the closed mesh are added as "
+              "well."}});
     docstring::ClassMethodDocInject(
             m, "VoxelGrid", "create_from_triangle_mesh_within_bounds",
             {{"input", "The input TriangleMesh"},
@@ -198,7 +222,10 @@ void pybind_voxelgrid(py::module &m) {
              {"min_bound",
               "Minimum boundary point for the VoxelGrid to create."},
              {"max_bound",
-              "Maximum boundary point for the VoxelGrid to create."}});
+              "Maximum boundary point for the VoxelGrid to create."},
+             {"solid",
+              "If true, the voxels inside the closed mesh are added as "
+              "well."}});
 }
 
 void pybind_voxelgrid_methods(py::module &m) {}
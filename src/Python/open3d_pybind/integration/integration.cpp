@@ -53,6 +53,23 @@ public:
         PYBIND11_OVERLOAD_PURE(std::shared_ptr<geometry::TriangleMesh>,
                                TSDFVolumeBase, );
     }
+    std::shared_ptr<geometry::PointCloudF> ExtractPointCloudF() override {
+        PYBIND11_OVERLOAD(std::shared_ptr<geometry::PointCloudF>,
+                          TSDFVolumeBase, );
+    }
+    std::shared_ptr<geometry::TriangleMeshF> ExtractTriangleMeshF() override {
+        PYBIND11_OVERLOAD(std::shared_ptr<geometry::TriangleMeshF>,
+                          TSDFVolumeBase, );
+    }
+    std::shared_ptr<integration::TSDFRaycastResult> RaycastImpl(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min,
+            double depth_max) const override {
+        PYBIND11_OVERLOAD_NAME(std::shared_ptr<integration::TSDFRaycastResult>,
+                               TSDFVolumeBase, "raycast", RaycastImpl,
+                               intrinsic, extrinsic, depth_min, depth_max);
+    }
 };
 
 void pybind_integration_classes(py::module &m) {
@@ -71,6 +88,46 @@ void pybind_integration_classes(py::module &m) {
             }),
             py::none(), py::none(), "");
 
+    // open3d.integration.VolumeUnitEvictionPolicy
+    py::enum_<integration::VolumeUnitEvictionPolicy> eviction_policy(
+            m, "VolumeUnitEvictionPolicy");
+    eviction_policy
+            .value("LeastRecentlyUsed",
+                   integration::VolumeUnitEvictionPolicy::LeastRecentlyUsed)
+            .value("FarthestFromCamera",
+                   integration::VolumeUnitEvictionPolicy::FarthestFromCamera)
+            .export_values();
+    eviction_policy.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for VolumeUnitEvictionPolicy.";
+            }),
+            py::none(), py::none(), "");
+
+    // open3d.integration.TSDFRaycastResult
+    py::class_<integration::TSDFRaycastResult,
+               std::shared_ptr<integration::TSDFRaycastResult>>
+            raycast_result(m, "TSDFRaycastResult",
+                           "Images rendered by raycasting a TSDF volume. "
+                           "Pixels whose ray does not hit the surface are "
+                           "zero in every image.");
+    py::detail::bind_default_constructor<integration::TSDFRaycastResult>(
+            raycast_result);
+    raycast_result
+            .def_readwrite("depth", &integration::TSDFRaycastResult::depth_,
+                           "open3d.geometry.Image: Float depth along the "
+                           "camera z axis.")
+            .def_readwrite("vertex_map",
+                           &integration::TSDFRaycastResult::vertex_map_,
+                           "open3d.geometry.Image: 3-channel float surface "
+                           "points in world coordinates.")
+            .def_readwrite("normal_map",
+                           &integration::TSDFRaycastResult::normal_map_,
+                           "open3d.geometry.Image: 3-channel float unit "
+                           "surface normals in world coordinates.")
+            .def_readwrite("color", &integration::TSDFRaycastResult::color_,
+                           "open3d.geometry.Image: 3-channel float colors in "
+                           "[0, 1]. Empty if the volume has no color.");
+
     // open3d.integration.TSDFVolume
     py::class_<integration::TSDFVolume, PyTSDFVolume<integration::TSDFVolume>>
             tsdfvolume(m, "TSDFVolume", R"(Base class of the Truncated
@@ -95,6 +152,18 @@ In SIGGRAPH, 1996)");
             .def("extract_triangle_mesh",
                  &integration::TSDFVolume::ExtractTriangleMesh,
                  "Function to extract a triangle mesh")
+            .def("extract_point_cloud_f",
+                 &integration::TSDFVolume::ExtractPointCloudF,
+                 "Function to extract a single-precision point cloud with "
+                 "normals")
+            .def("extract_triangle_mesh_f",
+                 &integration::TSDFVolume::ExtractTriangleMeshF,
+                 "Function to extract a single-precision triangle mesh")
+            .def("raycast", &integration::TSDFVolume::Raycast,
+                 "Function to render the zero crossing of the TSDF seen by "
+                 "a camera",
+                 "intrinsic"_a, "extrinsic"_a, "depth_min"_a = 0.1,
+                 "depth_max"_a = 3.0)
             .def_readwrite("voxel_length",
                            &integration::TSDFVolume::voxel_length_,
                            "float: Voxel size.")
@@ -106,11 +175,20 @@ In SIGGRAPH, 1996)");
                            "TSDF volume.");
     docstring::ClassMethodDocInject(m, "TSDFVolume", "extract_point_cloud");
     docstring::ClassMethodDocInject(m, "TSDFVolume", "extract_triangle_mesh");
+    docstring::ClassMethodDocInject(m, "TSDFVolume", "extract_point_cloud_f");
+    docstring::ClassMethodDocInject(m, "TSDFVolume",
+                                    "extract_triangle_mesh_f");
     docstring::ClassMethodDocInject(
             m, "TSDFVolume", "integrate",
             {{"image", "RGBD image."},
              {"intrinsic", "Pinhole camera intrinsic parameters."},
              {"extrinsic", "Extrinsic parameters."}});
+    docstring::ClassMethodDocInject(
+            m, "TSDFVolume", "raycast",
+            {{"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters."},
+             {"depth_min", "Depth at which rays start."},
+             {"depth_max", "Depth at which rays stop."}});
     docstring::ClassMethodDocInject(m, "TSDFVolume", "reset");
 
     // open3d.integration.UniformTSDFVolume: open3d.integration.TSDFVolume
@@ -202,9 +280,50 @@ In SIGGRAPH, 2013)");
             .def("extract_voxel_point_cloud",
                  &integration::ScalableTSDFVolume::ExtractVoxelPointCloud,
                  "Debug function to extract the voxel data into a point "
-                 "cloud.");
+                 "cloud.")
+            .def("prune_volume_units",
+                 &integration::ScalableTSDFVolume::PruneVolumeUnits,
+                 "Removes the volume units in which no voxel reached "
+                 "``min_weight``. Returns the number of removed units.",
+                 "min_weight"_a)
+            .def("evict_volume_units",
+                 &integration::ScalableTSDFVolume::EvictVolumeUnits,
+                 "Evicts volume units in the order of ``eviction_policy`` "
+                 "until at most ``max_volume_units`` remain. Returns the "
+                 "number of evicted units.",
+                 "max_volume_units"_a)
+            .def("restore_spilled_volume_units",
+                 &integration::ScalableTSDFVolume::RestoreSpilledVolumeUnits,
+                 "Loads all spilled volume units back into memory.")
+            .def("get_memory_usage",
+                 &integration::ScalableTSDFVolume::GetMemoryUsage,
+                 "Returns the approximate memory held by resident volume "
+                 "units in bytes.")
+            .def_readwrite("memory_budget",
+                           &integration::ScalableTSDFVolume::memory_budget_,
+                           "int: Memory budget of resident volume units in "
+                           "bytes, 0 for no limit. ``integrate`` evicts "
+                           "volume units once the budget is exceeded.")
+            .def_readwrite("eviction_policy",
+                           &integration::ScalableTSDFVolume::eviction_policy_,
+                           "integration.VolumeUnitEvictionPolicy: Order in "
+                           "which volume units are evicted.")
+            .def_readwrite("spill_directory",
+                           &integration::ScalableTSDFVolume::spill_directory_,
+                           "str: Directory evicted volume units are written "
+                           "to. Evicted units are discarded if empty.");
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "prune_volume_units",
+            {{"min_weight", "Minimum voxel weight a unit must reach."}});
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "evict_volume_units",
+            {{"max_volume_units", "Number of volume units to keep."}});
+    docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
+                                    "restore_spilled_volume_units");
+    docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
+                                    "get_memory_usage");
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -31,6 +31,7 @@
 #include "open3d_pybind/integration/integration.h"
 #include "open3d_pybind/io/io.h"
 #include "open3d_pybind/odometry/odometry.h"
+#include "open3d_pybind/reconstruction/reconstruction.h"
 #include "open3d_pybind/registration/registration.h"
 #include "open3d_pybind/utility/utility.h"
 #include "open3d_pybind/visualization/visualization.h"
@@ -48,5 +49,6 @@ PYBIND11_MODULE(open3d, m) {
     pybind_io(m);
     pybind_registration(m);
     pybind_odometry(m);
+    pybind_reconstruction(m);
     pybind_visualization(m);
 }
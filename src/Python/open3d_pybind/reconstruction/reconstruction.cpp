@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Reconstruction/ReconstructionPipeline.h"
+#include "Open3D/Utility/Progress.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/reconstruction/reconstruction.h"
+
+using namespace open3d;
+
+void pybind_reconstruction_classes(py::module &m) {
+    // open3d.reconstruction.ReconstructionICPMethod
+    py::enum_<reconstruction::ReconstructionICPMethod> icp_method(
+            m, "ReconstructionICPMethod");
+    icp_method
+            .value("PointToPoint",
+                   reconstruction::ReconstructionICPMethod::PointToPoint)
+            .value("PointToPlane",
+                   reconstruction::ReconstructionICPMethod::PointToPlane)
+            .value("Color", reconstruction::ReconstructionICPMethod::Color)
+            .export_values();
+    icp_method.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for ReconstructionICPMethod.";
+            }),
+            py::none(), py::none(), "");
+
+    // open3d.reconstruction.ReconstructionGlobalRegistration
+    py::enum_<reconstruction::ReconstructionGlobalRegistration>
+            global_registration(m, "ReconstructionGlobalRegistration");
+    global_registration
+            .value("RANSAC",
+                   reconstruction::ReconstructionGlobalRegistration::RANSAC)
+            .value("FGR", reconstruction::ReconstructionGlobalRegistration::FGR)
+            .export_values();
+    global_registration.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for ReconstructionGlobalRegistration.";
+            }),
+            py::none(), py::none(), "");
+
+    // open3d.reconstruction.ReconstructionOption
+    py::class_<reconstruction::ReconstructionOption> option(
+            m, "ReconstructionOption",
+            "Options of run_reconstruction_pipeline. The defaults match the "
+            "Python reconstruction system.");
+    py::detail::bind_default_constructor<reconstruction::ReconstructionOption>(
+            option);
+    option.def_readwrite("n_frames_per_fragment",
+                         &reconstruction::ReconstructionOption::
+                                 n_frames_per_fragment_,
+                         "int: (Default ``100``) Number of consecutive frames "
+                         "fused into one fragment.")
+            .def_readwrite("n_keyframes_per_n_frame",
+                           &reconstruction::ReconstructionOption::
+                                   n_keyframes_per_n_frame_,
+                           "int: (Default ``5``) Every n-th frame of a "
+                           "fragment is a keyframe; keyframe pairs are "
+                           "matched for loop closure.")
+            .def_readwrite(
+                    "depth_scale",
+                    &reconstruction::ReconstructionOption::depth_scale_,
+                    "float: (Default ``1000.0``) Scale of the depth images.")
+            .def_readwrite("max_depth",
+                           &reconstruction::ReconstructionOption::max_depth_,
+                           "float: (Default ``3.0``) Depth values beyond "
+                           "``max_depth`` in meters are discarded.")
+            .def_readwrite(
+                    "max_depth_diff",
+                    &reconstruction::ReconstructionOption::max_depth_diff_,
+                    "float: (Default ``0.07``) Maximum depth difference of "
+                    "corresponding pixels in RGB-D odometry.")
+            .def_readwrite("voxel_size",
+                           &reconstruction::ReconstructionOption::voxel_size_,
+                           "float: (Default ``0.05``) Voxel size of the "
+                           "down-sampled fragments used for registration.")
+            .def_readwrite(
+                    "tsdf_cubic_size",
+                    &reconstruction::ReconstructionOption::tsdf_cubic_size_,
+                    "float: (Default ``3.0``) Side length of the space "
+                    "covered by 512 TSDF voxels.")
+            .def_readwrite("preference_loop_closure_odometry",
+                           &reconstruction::ReconstructionOption::
+                                   preference_loop_closure_odometry_,
+                           "float: (Default ``0.1``) Loop closure preference "
+                           "of the fragment pose graphs.")
+            .def_readwrite("preference_loop_closure_registration",
+                           &reconstruction::ReconstructionOption::
+                                   preference_loop_closure_registration_,
+                           "float: (Default ``5.0``) Loop closure preference "
+                           "of the scene pose graph.")
+            .def_readwrite("icp_method",
+                           &reconstruction::ReconstructionOption::icp_method_,
+                           "reconstruction.ReconstructionICPMethod: (Default "
+                           "``Color``) Local registration between fragments.")
+            .def_readwrite("global_registration",
+                           &reconstruction::ReconstructionOption::
+                                   global_registration_,
+                           "reconstruction.ReconstructionGlobalRegistration: "
+                           "(Default ``RANSAC``) Global registration of "
+                           "non-adjacent fragments.")
+            .def_readwrite(
+                    "max_cached_frames",
+                    &reconstruction::ReconstructionOption::max_cached_frames_,
+                    "int: (Default ``256``) Number of decoded frames kept in "
+                    "memory and shared by all stages, ``0`` disables the "
+                    "cache.")
+            .def_readwrite(
+                    "scene_memory_budget",
+                    &reconstruction::ReconstructionOption::scene_memory_budget_,
+                    "int: (Default ``0``) Memory budget of the scene TSDF "
+                    "volume in bytes, ``0`` for no limit.")
+            .def_readwrite(
+                    "spill_directory",
+                    &reconstruction::ReconstructionOption::spill_directory_,
+                    "str: (Default ``''``) Directory the scene TSDF volume "
+                    "spills evicted units to. Without it, evicted units are "
+                    "lost.")
+            .def("__repr__", [](const reconstruction::ReconstructionOption
+                                        &option) {
+                return fmt::format(
+                        "reconstruction::ReconstructionOption with "
+                        "{:d} frames per fragment and voxel size {:f}",
+                        option.n_frames_per_fragment_, option.voxel_size_);
+            });
+
+    // open3d.reconstruction.ReconstructionResult
+    py::class_<reconstruction::ReconstructionResult,
+               std::shared_ptr<reconstruction::ReconstructionResult>>
+            result(m, "ReconstructionResult",
+                   "Output of run_reconstruction_pipeline.");
+    py::detail::bind_default_constructor<reconstruction::ReconstructionResult>(
+            result);
+    result.def_readwrite("fragment_pose_graphs",
+                         &reconstruction::ReconstructionResult::
+                                 fragment_pose_graphs_,
+                         "List[registration.PoseGraph]: Optimized pose graph "
+                         "of every fragment.")
+            .def_readwrite("fragment_point_clouds",
+                           &reconstruction::ReconstructionResult::
+                                   fragment_point_clouds_,
+                           "List[geometry.PointCloud]: Point cloud of every "
+                           "fragment in its own coordinate frame.")
+            .def_readwrite(
+                    "scene_pose_graph",
+                    &reconstruction::ReconstructionResult::scene_pose_graph_,
+                    "registration.PoseGraph: Refined and optimized pose "
+                    "graph of the fragments.")
+            .def_readwrite("trajectory",
+                           &reconstruction::ReconstructionResult::trajectory_,
+                           "camera.PinholeCameraTrajectory: Intrinsic and "
+                           "world-to-camera extrinsic of every frame.")
+            .def_readwrite("mesh", &reconstruction::ReconstructionResult::mesh_,
+                           "geometry.TriangleMesh: Mesh of the scene.")
+            .def("__repr__",
+                 [](const reconstruction::ReconstructionResult &result) {
+                     return fmt::format(
+                             "reconstruction::ReconstructionResult with {:d} "
+                             "fragments and {:d} frames",
+                             result.fragment_pose_graphs_.size(),
+                             result.trajectory_.parameters_.size());
+                 });
+}
+
+void pybind_reconstruction_methods(py::module &m) {
+    m.def("run_reconstruction_pipeline",
+          &reconstruction::RunReconstructionPipeline,
+          "Function to reconstruct a scene from an RGB-D sequence. Fragment "
+          "odometry, fragment integration, fragment registration, "
+          "refinement and scene integration run as one parallel task graph. "
+          "Returns None if a frame cannot be read or the progress token is "
+          "cancelled.",
+          "color_files"_a, "depth_files"_a, "intrinsic"_a,
+          "option"_a = reconstruction::ReconstructionOption(),
+          "progress"_a = nullptr, py::call_guard<py::gil_scoped_release>());
+    docstring::FunctionDocInject(
+            m, "run_reconstruction_pipeline",
+            {{"color_files", "Paths of the color images."},
+             {"depth_files", "Paths of the depth images."},
+             {"intrinsic", "Intrinsic of the camera."},
+             {"option", "The reconstruction option."},
+             {"progress", "Optional ProgressToken."}});
+}
+
+void pybind_reconstruction(py::module &m) {
+    py::module m_submodule = m.def_submodule("reconstruction");
+    pybind_reconstruction_classes(m_submodule);
+    pybind_reconstruction_methods(m_submodule);
+}
@@ -28,6 +28,7 @@
 #include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
 #include "Open3D/Registration/GlobalOptimizationMethod.h"
 #include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Progress.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/registration/registration.h"
@@ -171,14 +172,24 @@ void pybind_global_optimization(py::module &m) {
                     "Base class for global optimization method.");
     global_optimization_method.def(
             "OptimizePoseGraph",
-            &registration::GlobalOptimizationMethod::OptimizePoseGraph,
-            "pose_graph"_a, "criteria"_a, "option"_a,
+            [](const registration::GlobalOptimizationMethod &method,
+               registration::PoseGraph &pose_graph,
+               const registration::GlobalOptimizationConvergenceCriteria
+                       &criteria,
+               const registration::GlobalOptimizationOption &option,
+               utility::ProgressToken *progress) {
+                method.OptimizePoseGraphWithProgress(pose_graph, criteria,
+                                                     option, progress);
+            },
+            "pose_graph"_a, "criteria"_a, "option"_a, "progress"_a = nullptr,
             "Run pose graph optimization.");
     docstring::ClassMethodDocInject(
             m, "GlobalOptimizationMethod", "OptimizePoseGraph",
             {{"pose_graph", "The pose graph to be optimized (in-place)."},
              {"criteria", "Convergence criteria."},
-             {"option", "Global optimization options."}});
+             {"option", "Global optimization options."},
+             {"progress",
+              "Optional ProgressToken advanced once per iteration."}});
 
     py::class_<registration::GlobalOptimizationLevenbergMarquardt,
                PyGlobalOptimizationMethod<
@@ -357,12 +368,14 @@ void pybind_global_optimization_methods(py::module &m) {
              const registration::GlobalOptimizationMethod &method,
              const registration::GlobalOptimizationConvergenceCriteria
                      &criteria,
-             const registration::GlobalOptimizationOption &option) {
+             const registration::GlobalOptimizationOption &option,
+             utility::ProgressToken *progress) {
               registration::GlobalOptimization(pose_graph, method, criteria,
-                                               option);
+                                               option, progress);
           },
           "Function to optimize registration::PoseGraph", "pose_graph"_a,
-          "method"_a, "criteria"_a, "option"_a);
+          "method"_a, "criteria"_a, "option"_a, "progress"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
     docstring::FunctionDocInject(
             m, "global_optimization",
             {{"pose_graph", "The pose_graph to be optimized (in-place)."},
@@ -371,5 +384,8 @@ void pybind_global_optimization_methods(py::module &m) {
               "``registration::GlobalOptimizationGaussNewton()`` or "
               "``registration::GlobalOptimizationLevenbergMarquardt()``."},
              {"criteria", "Global optimization convergence criteria."},
-             {"option", "Global optimization option."}});
+             {"option", "Global optimization option."},
+             {"progress",
+              "Optional ProgressToken. The pose graph is left unchanged if it "
+              "is cancelled."}});
 }
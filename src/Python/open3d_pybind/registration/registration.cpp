@@ -26,6 +26,7 @@
 
 #include "Open3D/Registration/Registration.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "Open3D/Registration/ColoredICP.h"
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
@@ -510,20 +511,53 @@ static const std::unordered_map<std::string, std::string>
                  "``target``"}};
 
 void pybind_registration_methods(py::module &m) {
-    m.def("evaluate_registration", &registration::EvaluateRegistration,
+    m.def("evaluate_registration",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &)>(
+                  &registration::EvaluateRegistration),
           "Function for evaluating registration between point clouds",
           "source"_a, "target"_a, "max_correspondence_distance"_a,
           "transformation"_a = Eigen::Matrix4d::Identity());
+    m.def("evaluate_registration",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloudF &, const geometry::PointCloudF &,
+                  double, const Eigen::Matrix4d &)>(
+                  &registration::EvaluateRegistration),
+          "Function for evaluating registration between single-precision "
+          "point clouds",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "transformation"_a = Eigen::Matrix4d::Identity());
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &registration::RegistrationICP,
+    m.def("registration_icp",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &,
+                  const registration::ICPConvergenceCriteria &)>(
+                  &registration::RegistrationICP),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a =
                   registration::TransformationEstimationPointToPoint(false),
           "criteria"_a = registration::ICPConvergenceCriteria());
+    m.def("registration_icp",
+          static_cast<registration::RegistrationResult (*)(
+                  const geometry::PointCloudF &, const geometry::PointCloudF &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &,
+                  const registration::ICPConvergenceCriteria &)>(
+                  &registration::RegistrationICP),
+          "Function for single-precision ICP registration. Only point to "
+          "point and point to plane estimation are supported",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          "criteria"_a = registration::ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
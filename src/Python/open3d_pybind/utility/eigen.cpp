@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/open3d_pybind.h"
 
@@ -62,12 +64,35 @@ std::vector<EigenVector> py_array_to_vectors_double(
         throw py::cast_error();
     }
     std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
+    // The EigenVector here must be a double-typed eigen vector, since only
+    // open3d::Vector3dVector binds to py_array_to_vectors_double. The
+    // c_style array and the vector share the same packed layout, so the
+    // whole array is copied at once.
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(double) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be tightly packed.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    eigen_vectors.size() * sizeof(EigenVector));
+    }
+    return eigen_vectors;
+}
+
+template <typename EigenVector>
+std::vector<EigenVector> py_array_to_vectors_float(
+        py::array_t<float, py::array::c_style | py::array::forcecast> array) {
+    size_t eigen_vector_size = EigenVector::SizeAtCompileTime;
+    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
+        throw py::cast_error();
+    }
+    std::vector<EigenVector> eigen_vectors(array.shape(0));
+    // Same as py_array_to_vectors_double, for open3d::Vector3fVector.
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(float) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must be tightly packed.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    eigen_vectors.size() * sizeof(EigenVector));
     }
     return eigen_vectors;
 }
@@ -359,6 +384,32 @@ Example usage
     # From numpy to Open3D
     pcd.points = open3d.utility.Vector3dVector(np_points)
 
+    # From Open3D to numpy
+    np_points = np.asarray(pcd.points)
+)";
+            }),
+            py::none(), py::none(), "");
+
+    auto vector3fvector = pybind_eigen_vector_of_vector<Eigen::Vector3f>(
+            m, "Vector3fVector", "std::vector<Eigen::Vector3f>",
+            py::py_array_to_vectors_float<Eigen::Vector3f>);
+    vector3fvector.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return R"(Convert float32 numpy array of shape ``(n, 3)`` to Open3D format..
+
+Example usage
+
+.. code-block:: python
+
+    import open3d
+    import numpy as np
+
+    pcd = open3d.geometry.PointCloudF()
+    np_points = np.random.rand(100, 3).astype(np.float32)
+
+    # From numpy to Open3D
+    pcd.points = open3d.utility.Vector3fVector(np_points)
+
     # From Open3D to numpy
     np_points = np.asarray(pcd.points)
 )";
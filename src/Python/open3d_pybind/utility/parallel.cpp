@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+
+using namespace open3d;
+
+void pybind_parallel(py::module &m) {
+    py::enum_<utility::ParallelBackend> backend(m, "ParallelBackend",
+                                                "ParallelBackend");
+    backend.value("ThreadPool", utility::ParallelBackend::ThreadPool)
+            .value("OpenMP", utility::ParallelBackend::OpenMP)
+            .export_values();
+    backend.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for the runtime of parallel loops.";
+            }),
+            py::none(), py::none(), "");
+
+    m.def("set_max_threads", &utility::SetMaxThreads,
+          "Set the number of threads used by parallel loops. 0 restores the "
+          "hardware concurrency.",
+          "num_threads"_a);
+    m.def("get_max_threads", &utility::GetMaxThreads,
+          "Returns the number of threads used by parallel loops.");
+    m.def("set_parallel_backend", &utility::SetParallelBackend,
+          "Select the runtime of parallel loops.", "backend"_a);
+    m.def("get_parallel_backend", &utility::GetParallelBackend,
+          "Returns the runtime of parallel loops.");
+    docstring::FunctionDocInject(
+            m, "set_max_threads",
+            {{"num_threads", "Number of threads, 0 for all cores."}});
+}
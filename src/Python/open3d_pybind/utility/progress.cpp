@@ -0,0 +1,71 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Progress.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+
+using namespace open3d;
+
+void pybind_progress(py::module &m) {
+    py::class_<utility::ProgressToken, std::shared_ptr<utility::ProgressToken>>
+            token(m, "ProgressToken",
+                  "Reports the progress of a long-running function and lets "
+                  "the caller cancel it. The callback may run on a worker "
+                  "thread.");
+    token.def(py::init([](py::object callback, double report_interval_ms) {
+                  if (callback.is_none()) {
+                      return std::make_shared<utility::ProgressToken>();
+                  }
+                  py::function func = callback.cast<py::function>();
+                  return std::make_shared<utility::ProgressToken>(
+                          [func](double fraction) {
+                              py::gil_scoped_acquire acquire;
+                              func(fraction);
+                          },
+                          report_interval_ms);
+              }),
+              "callback"_a = py::none(), "report_interval_ms"_a = 100.0)
+            .def("cancel", &utility::ProgressToken::Cancel,
+                 "Requests cancellation of the running function.")
+            .def("is_cancelled", &utility::ProgressToken::IsCancelled,
+                 "Returns True once cancellation has been requested.")
+            .def("fraction", &utility::ProgressToken::GetFraction,
+                 "Returns the completed fraction in [0, 1].")
+            .def("__repr__", [](const utility::ProgressToken &t) {
+                return std::string("ProgressToken with ") +
+                       std::to_string(t.GetCompleted()) + std::string("/") +
+                       std::to_string(t.GetTotal()) +
+                       std::string(" units done");
+            });
+    docstring::ClassMethodDocInject(
+            m, "ProgressToken", "__init__",
+            {{"callback",
+              "Optional function called with the completed fraction."},
+             {"report_interval_ms",
+              "Minimum time between two intermediate callbacks."}});
+}
@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Trace.h"
+
+#include "open3d_pybind/docstring.h"
+#include "open3d_pybind/open3d_pybind.h"
+
+using namespace open3d;
+
+void pybind_trace(py::module &m) {
+    m.def("set_tracing_enabled",
+          [](bool enabled) {
+              utility::Tracer::GetInstance().SetEnabled(enabled);
+          },
+          "Enable or disable recording of tracing zones and metrics. Zones "
+          "are only compiled in when Open3D is built with ENABLE_TRACING.",
+          "enabled"_a);
+    m.def("is_tracing_enabled",
+          []() { return utility::Tracer::GetInstance().IsEnabled(); },
+          "Returns True if tracing zones and metrics are being recorded.");
+    m.def("clear_trace", []() { utility::Tracer::GetInstance().Clear(); },
+          "Drop all recorded zones and reset counters and histograms.");
+    m.def("print_trace_summary",
+          []() { utility::Tracer::GetInstance().PrintSummary(); },
+          "Print per-zone timings, counters and histograms.");
+    m.def("get_trace_counters",
+          []() { return utility::Tracer::GetInstance().GetCounterValues(); },
+          "Returns a dict mapping counter names to their values.");
+    m.def("write_chrome_trace",
+          [](const std::string &filename) {
+              return utility::Tracer::GetInstance().WriteChromeTrace(filename);
+          },
+          "Write recorded zones and counters in the Chrome trace event "
+          "format.",
+          "filename"_a);
+    docstring::FunctionDocInject(
+            m, "write_chrome_trace",
+            {{"filename", "Path of the JSON file to write."}});
+}
@@ -34,4 +34,7 @@ void pybind_utility(py::module &m) {
     py::module m_submodule = m.def_submodule("utility");
     pybind_console(m_submodule);
     pybind_eigen(m_submodule);
+    pybind_parallel(m_submodule);
+    pybind_progress(m_submodule);
+    pybind_trace(m_submodule);
 }
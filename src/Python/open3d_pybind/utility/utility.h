@@ -32,3 +32,6 @@ void pybind_utility(py::module &m);
 
 void pybind_console(py::module &m);
 void pybind_eigen(py::module &m);
+void pybind_parallel(py::module &m);
+void pybind_progress(py::module &m);
+void pybind_trace(py::module &m);
@@ -74,9 +74,20 @@ void pybind_renderoption(py::module &m) {
             .def_readwrite("line_width",
                            &visualization::RenderOption::line_width_,
                            "float: Line width for ``LineSet``.")
+            .def_readwrite(
+                    "voxel_cull_hidden_faces",
+                    &visualization::RenderOption::voxel_cull_hidden_faces_,
+                    "bool: Whether to skip the faces shared by neighbouring "
+                    "voxels for ``VoxelGrid``.")
             .def_readwrite("point_show_normal",
                            &visualization::RenderOption::point_show_normal_,
                            "bool: Whether to show normal for ``PointCloud``.")
+            .def_readwrite("point_budget",
+                           &visualization::RenderOption::point_budget_,
+                           "int: Maximum number of points drawn per "
+                           "``PointCloud``. Larger point clouds are rendered "
+                           "with level of detail, without normal lines. 0 "
+                           "disables it.")
             .def_readwrite("show_coordinate_frame",
                            &visualization::RenderOption::show_coordinate_frame_,
                            "bool: Whether to show coordinate frame.")
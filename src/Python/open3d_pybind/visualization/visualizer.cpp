@@ -26,6 +26,8 @@
 
 #include "Open3D/Visualization/Visualizer/Visualizer.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/InstancedGeometry.h"
+#include "Open3D/Visualization/Visualizer/BatchRenderer.h"
 #include "Open3D/Visualization/Visualizer/VisualizerWithEditing.h"
 #include "Open3D/Visualization/Visualizer/VisualizerWithKeyCallback.h"
 #include "Open3D/Visualization/Visualizer/VisualizerWithVertexSelection.h"
@@ -43,13 +45,23 @@ static const std::unordered_map<std::string, std::string>
                 {"depth_scale",
                  "Scale depth value when capturing the depth image."},
                 {"do_render", "Set to ``True`` to do render."},
+                {"enable", "Set to ``True`` to turn the feature on."},
                 {"filename", "Path to file."},
                 {"geometry", "The ``Geometry`` object."},
                 {"height", "Height of window."},
+                {"instanced", "The ``InstancedGeometry`` object."},
+                {"show_overlay",
+                 "Set to ``True`` to draw the profiler statistics over the "
+                 "scene."},
                 {"left", "Left margin of the window to the screen."},
                 {"top", "Top margin of the window to the screen."},
                 {"visible", "Whether the window is visible."},
                 {"width", "Width of the window."},
+                {"window_size",
+                 "Number of most recently appended points to draw, 0 to draw "
+                 "all points."},
+                {"x", "Horizontal window coordinate in pixels."},
+                {"y", "Vertical window coordinate in pixels, from the top."},
                 {"window_name", "Window title name."},
                 {"convert_to_world_coordinate",
                  "Set to ``True`` to convert to world coordinates"},
@@ -88,6 +100,11 @@ void pybind_visualizer(py::module &m) {
                  "Function to reset view point")
             .def("update_geometry", &visualization::Visualizer::UpdateGeometry,
                  "Function to update geometry")
+            .def("update_geometry_appended",
+                 &visualization::Visualizer::UpdateGeometryAppended,
+                 "Function to upload only the points appended to a point "
+                 "cloud since the last update",
+                 "geometry"_a, "window_size"_a = 0)
             .def("update_renderer", &visualization::Visualizer::UpdateRender,
                  "Function to inform render needed to be updated")
             .def("poll_events", &visualization::Visualizer::PollEvents,
@@ -129,6 +146,32 @@ void pybind_visualizer(py::module &m) {
                  &visualization::Visualizer::CaptureDepthPointCloud,
                  "Function to capture and save local point cloud", "filename"_a,
                  "do_render"_a = false, "convert_to_world_coordinate"_a = false)
+            .def("capture_screen_image_async",
+                 &visualization::Visualizer::CaptureScreenImageAsync,
+                 "Function to capture a screen image and save it on a "
+                 "background thread, without waiting for the GPU",
+                 "filename"_a, "do_render"_a = false)
+            .def("flush_async_captures",
+                 &visualization::Visualizer::FlushAsyncCaptures,
+                 "Function to wait for all asynchronous captures to be saved")
+            .def("enable_render_profiler",
+                 &visualization::Visualizer::EnableRenderProfiler,
+                 "Function to turn the render profiler on or off",
+                 "enable"_a, "show_overlay"_a = true)
+            .def("write_render_profiler_trace",
+                 &visualization::Visualizer::WriteRenderProfilerTrace,
+                 "Function to write the profiled frames as a Chrome trace "
+                 "JSON file",
+                 "filename"_a)
+            .def("pick_instance",
+                 [](visualization::Visualizer &vis,
+                    std::shared_ptr<geometry::InstancedGeometry> instanced,
+                    double x, double y) {
+                     return vis.PickInstance(instanced, x, y);
+                 },
+                 "Function to find the index of the instance visible at a "
+                 "window position, or -1 if there is none",
+                 "instanced"_a, "x"_a, "y"_a)
             .def("get_window_name", &visualization::Visualizer::GetWindowName);
 
     py::class_<visualization::VisualizerWithKeyCallback,
@@ -216,6 +259,45 @@ void pybind_visualizer(py::module &m) {
                            &visualization::VisualizerWithVertexSelection::
                                    PickedPoint::coord);
 
+    py::class_<visualization::BatchRenderer,
+               PyVisualizer<visualization::BatchRenderer>,
+               std::shared_ptr<visualization::BatchRenderer>>
+            batch_renderer(m, "BatchRenderer", visualizer,
+                           "Visualizer that renders many camera views "
+                           "offscreen.");
+    py::detail::bind_default_constructor<visualization::BatchRenderer>(
+            batch_renderer);
+    batch_renderer
+            .def("__repr__",
+                 [](const visualization::BatchRenderer &vis) {
+                     return std::string("BatchRenderer with name ") +
+                            vis.GetWindowName();
+                 })
+            .def("render_views", &visualization::BatchRenderer::RenderViews,
+                 "Function to render all views and call ``callback(index, "
+                 "rendered_view)`` for each of them in order",
+                 "parameters"_a, "callback"_a, "render_color"_a = true,
+                 "render_depth"_a = true, "render_normal"_a = false,
+                 "render_index"_a = false)
+            .def("render_views_to_files",
+                 &visualization::BatchRenderer::RenderViewsToFiles,
+                 "Function to render all views and write color and depth "
+                 "images into a directory",
+                 "parameters"_a, "directory"_a, "depth_scale"_a = 1000.0,
+                 "render_color"_a = true, "render_depth"_a = true);
+
+    py::class_<visualization::BatchRenderer::RenderedView>
+            batch_renderer_rendered_view(m, "RenderedView");
+    batch_renderer_rendered_view
+            .def_readonly("color",
+                          &visualization::BatchRenderer::RenderedView::color_)
+            .def_readonly("depth",
+                          &visualization::BatchRenderer::RenderedView::depth_)
+            .def_readonly("normal",
+                          &visualization::BatchRenderer::RenderedView::normal_)
+            .def_readonly("index",
+                          &visualization::BatchRenderer::RenderedView::index_);
+
     docstring::ClassMethodDocInject(m, "Visualizer", "add_geometry",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "remove_geometry",
@@ -233,18 +315,25 @@ void pybind_visualizer(py::module &m) {
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "capture_screen_image",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer",
+                                    "capture_screen_image_async",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "close",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "create_window",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "destroy_window",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "enable_render_profiler",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "get_render_option",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "get_view_control",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "get_window_name",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer", "pick_instance",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "poll_events",
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer",
@@ -256,6 +345,9 @@ void pybind_visualizer(py::module &m) {
                                     map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "update_geometry",
                                     map_visualizer_docstrings);
+    docstring::ClassMethodDocInject(m, "Visualizer",
+                                    "update_geometry_appended",
+                                    map_visualizer_docstrings);
     docstring::ClassMethodDocInject(m, "Visualizer", "update_renderer",
                                     map_visualizer_docstrings);
 }
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/InstancedGeometry.h"
+#include "Open3D/Geometry/LineSet.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+std::shared_ptr<geometry::LineSet> CreateUnitLine() {
+    return std::make_shared<geometry::LineSet>(
+            std::vector<Vector3d>{Vector3d(0.0, 0.0, 0.0),
+                                  Vector3d(1.0, 0.0, 0.0)},
+            std::vector<Vector2i>{Vector2i(0, 1)});
+}
+
+Matrix4d CreateTranslation(const Vector3d &translation) {
+    Matrix4d transformation = Matrix4d::Identity();
+    transformation.block<3, 1>(0, 3) = translation;
+    return transformation;
+}
+
+}  // unnamed namespace
+
+TEST(InstancedGeometry, Constructor) {
+    geometry::InstancedGeometry instanced;
+
+    EXPECT_EQ(geometry::Geometry::GeometryType::InstancedGeometry,
+              instanced.GetGeometryType());
+    EXPECT_EQ(3, instanced.Dimension());
+
+    EXPECT_TRUE(instanced.IsEmpty());
+    EXPECT_FALSE(instanced.HasValidBaseGeometry());
+    EXPECT_FALSE(instanced.HasInstances());
+    EXPECT_FALSE(instanced.HasColors());
+
+    ExpectEQ(Zero3d, instanced.GetMinBound());
+    ExpectEQ(Zero3d, instanced.GetMaxBound());
+}
+
+TEST(InstancedGeometry, HasValidBaseGeometry) {
+    geometry::InstancedGeometry instanced(CreateUnitLine());
+    EXPECT_TRUE(instanced.HasValidBaseGeometry());
+    EXPECT_TRUE(instanced.IsEmpty());
+
+    instanced.AddInstance(Matrix4d::Identity());
+    EXPECT_FALSE(instanced.IsEmpty());
+
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    pcd->points_.push_back(Vector3d(0.0, 0.0, 0.0));
+    instanced.base_geometry_ = pcd;
+    EXPECT_FALSE(instanced.HasValidBaseGeometry());
+    EXPECT_TRUE(instanced.IsEmpty());
+}
+
+TEST(InstancedGeometry, AddInstance) {
+    geometry::InstancedGeometry instanced(CreateUnitLine());
+
+    instanced.AddInstance(Matrix4d::Identity());
+    EXPECT_TRUE(instanced.HasInstances());
+    EXPECT_FALSE(instanced.HasColors());
+
+    instanced.AddInstance(CreateTranslation(Vector3d(0.0, 2.0, 0.0)),
+                          Vector3d(1.0, 0.0, 0.0));
+    EXPECT_EQ(2u, instanced.transforms_.size());
+    EXPECT_TRUE(instanced.HasColors());
+    ExpectEQ(Vector3d(1.0, 1.0, 1.0), instanced.colors_[0]);
+    ExpectEQ(Vector3d(1.0, 0.0, 0.0), instanced.colors_[1]);
+
+    instanced.AddInstance(CreateTranslation(Vector3d(0.0, 4.0, 0.0)));
+    EXPECT_TRUE(instanced.HasColors());
+    ExpectEQ(Vector3d(1.0, 0.0, 0.0), instanced.colors_[1]);
+    ExpectEQ(Vector3d(1.0, 1.0, 1.0), instanced.colors_[2]);
+
+    instanced.PaintUniformColor(Vector3d(0.0, 0.0, 1.0));
+    ExpectEQ(Vector3d(0.0, 0.0, 1.0), instanced.colors_[0]);
+    ExpectEQ(Vector3d(0.0, 0.0, 1.0), instanced.colors_[2]);
+}
+
+TEST(InstancedGeometry, Bounds) {
+    geometry::InstancedGeometry instanced(CreateUnitLine());
+    instanced.AddInstance(CreateTranslation(Vector3d(0.0, 0.0, 1.0)));
+    Matrix4d rotation = Matrix4d::Identity();
+    rotation.block<3, 3>(0, 0) =
+            AngleAxisd(M_PI / 2.0, Vector3d::UnitZ()).toRotationMatrix();
+    instanced.AddInstance(rotation);
+
+    ExpectEQ(Vector3d(0.0, 0.0, 0.0), instanced.GetMinBound());
+    ExpectEQ(Vector3d(1.0, 1.0, 1.0), instanced.GetMaxBound());
+    ExpectEQ(Vector3d(0.25, 0.25, 0.5), instanced.GetCenter());
+}
+
+TEST(InstancedGeometry, Transform) {
+    geometry::InstancedGeometry instanced(CreateUnitLine());
+    instanced.AddInstance(Matrix4d::Identity());
+    instanced.AddInstance(CreateTranslation(Vector3d(0.0, 2.0, 0.0)));
+
+    instanced.Translate(Vector3d(1.0, 0.0, 0.0));
+    ExpectEQ(Vector3d(1.0, 0.0, 0.0), instanced.GetMinBound());
+    ExpectEQ(Vector3d(2.0, 2.0, 0.0), instanced.GetMaxBound());
+
+    instanced.Translate(Vector3d(0.0, 0.0, 0.0), false);
+    ExpectEQ(Vector3d(0.0, 0.0, 0.0), instanced.GetCenter());
+
+    instanced.Scale(2.0, true);
+    ExpectEQ(Vector3d(-1.0, -2.0, 0.0), instanced.GetMinBound());
+    ExpectEQ(Vector3d(1.0, 2.0, 0.0), instanced.GetMaxBound());
+
+    // The base geometry is shared and not modified
+    const auto &base =
+            (const geometry::LineSet &)(*instanced.base_geometry_);
+    ExpectEQ(Vector3d(1.0, 0.0, 0.0), base.points_[1]);
+}
@@ -26,6 +26,7 @@
 
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
 #include "TestUtility/Raw.h"
 #include "TestUtility/UnitTest.h"
 
@@ -473,3 +474,19 @@ TEST(LineSet, CreateLineSetFromPointCloudCorrespondences) {
     ExpectEQ(ref_points, ls->points_);
     ExpectEQ(ref_lines, ls->lines_);
 }
+
+TEST(LineSet, CreateFromTriangleMesh) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0.0, 0.0, 0.0},
+                      {1.0, 0.0, 0.0},
+                      {0.0, 1.0, 0.0},
+                      {1.0, 1.0, 0.0}};
+    mesh.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+
+    vector<Vector2i> ref_lines = {{0, 1}, {1, 2}, {2, 0}, {1, 3}, {3, 2}};
+
+    auto ls = geometry::LineSet::CreateFromTriangleMesh(mesh);
+
+    ExpectEQ(mesh.vertices_, ls->points_);
+    ExpectEQ(ref_lines, ls->lines_);
+}
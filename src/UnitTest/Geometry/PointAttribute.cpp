@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointAttribute.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(PointAttribute, Constructor) {
+    geometry::PointAttribute attribute(geometry::PointAttribute::Dtype::Int32,
+                                       3, 5);
+
+    EXPECT_EQ(attribute.GetDtype(), geometry::PointAttribute::Dtype::Int32);
+    EXPECT_EQ(attribute.GetDimension(), 3);
+    EXPECT_EQ(attribute.GetSize(), 5u);
+    EXPECT_EQ(attribute.GetRowByteSize(), 12u);
+    const int32_t *values = attribute.GetDataPtr<int32_t>();
+    for (size_t i = 0; i < 15; i++) {
+        EXPECT_EQ(values[i], 0);
+    }
+}
+
+TEST(PointAttribute, GetDataPtrWrongType) {
+    geometry::PointAttribute attribute(geometry::PointAttribute::Dtype::Float32,
+                                       1, 2);
+
+    EXPECT_ANY_THROW(attribute.GetDataPtr<double>());
+}
+
+TEST(PointAttribute, Select) {
+    geometry::PointAttribute attribute(geometry::PointAttribute::Dtype::Float64,
+                                       2, 4);
+    double *values = attribute.GetDataPtr<double>();
+    for (int i = 0; i < 8; i++) {
+        values[i] = double(i);
+    }
+
+    geometry::PointAttribute selected = attribute.Select({3, 0});
+    ASSERT_EQ(selected.GetSize(), 2u);
+    const double *selected_values = selected.GetDataPtr<double>();
+    EXPECT_EQ(selected_values[0], 6.0);
+    EXPECT_EQ(selected_values[1], 7.0);
+    EXPECT_EQ(selected_values[2], 0.0);
+    EXPECT_EQ(selected_values[3], 1.0);
+
+    attribute.SelectInPlace({1, 2});
+    ASSERT_EQ(attribute.GetSize(), 2u);
+    values = attribute.GetDataPtr<double>();
+    EXPECT_EQ(values[0], 2.0);
+    EXPECT_EQ(values[1], 3.0);
+    EXPECT_EQ(values[2], 4.0);
+    EXPECT_EQ(values[3], 5.0);
+}
+
+TEST(PointAttribute, Append) {
+    geometry::PointAttribute attribute(geometry::PointAttribute::Dtype::UInt8,
+                                       1, 2);
+    attribute.GetDataPtr<uint8_t>()[0] = 1;
+    attribute.GetDataPtr<uint8_t>()[1] = 2;
+
+    EXPECT_TRUE(attribute.Append(attribute));
+    ASSERT_EQ(attribute.GetSize(), 4u);
+    const uint8_t *values = attribute.GetDataPtr<uint8_t>();
+    EXPECT_EQ(values[2], 1);
+    EXPECT_EQ(values[3], 2);
+
+    geometry::PointAttribute other(geometry::PointAttribute::Dtype::UInt8, 2,
+                                   1);
+    EXPECT_FALSE(attribute.Append(other));
+    EXPECT_EQ(attribute.GetSize(), 4u);
+}
@@ -31,6 +31,8 @@
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Memory.h"
+#include "Open3D/Utility/Progress.h"
 #include "TestUtility/UnitTest.h"
 
 using namespace Eigen;
@@ -191,6 +193,26 @@ TEST(PointCloud, Transform) {
     ExpectEQ(ref_normals, pc.normals_);
 }
 
+TEST(PointCloud, RotateFarFromOrigin) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Vector3d(1e6, 1e6, 1e6),
+         Vector3d(1e6 + 1.0, 1e6 + 1.0, 1e6 + 1.0), 0);
+    const Matrix3d R = geometry::Geometry3D::GetRotationMatrixFromXYZ(
+            Vector3d(0.3, -0.7, 1.1));
+    const Vector3d center = pc.GetCenter();
+    vector<Vector3d> expected = pc.points_;
+    for (auto &point : expected) {
+        point = R * (point - center) + center;
+    }
+
+    // Rotating A * p + (c - A * c) would be off by several ulps here.
+    pc.Rotate(R, true);
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_LE((pc.points_[i] - expected[i]).cwiseAbs().maxCoeff(), 1e-10);
+    }
+}
+
 TEST(PointCloud, HasPoints) {
     int size = 100;
 
@@ -525,6 +547,30 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ref_points, output_pc->points_);
     ExpectEQ(ref_normals, output_pc->normals_);
     ExpectEQ(ref_colors, output_pc->colors_);
+
+    // Down sampling into an existing cloud reuses its buffers.
+    geometry::PointCloud reused_pc;
+    pc.VoxelDownSample(voxel_size, reused_pc);
+    const Vector3d *points_data = reused_pc.points_.data();
+    pc.VoxelDownSample(voxel_size, reused_pc);
+    EXPECT_EQ(points_data, reused_pc.points_.data());
+    Sort::Do(reused_pc.points_);
+    Sort::Do(reused_pc.normals_);
+    Sort::Do(reused_pc.colors_);
+    ExpectEQ(ref_points, reused_pc.points_);
+    ExpectEQ(ref_normals, reused_pc.normals_);
+    ExpectEQ(ref_colors, reused_pc.colors_);
+
+    // A caller-owned arena keeps the voxel map memory across calls.
+    utility::Arena arena(1 << 10, "UnitTestVoxelDownSample");
+    pc.VoxelDownSample(voxel_size, reused_pc, &arena);
+    size_t capacity = arena.GetCapacity();
+    EXPECT_GT(capacity, size_t(0));
+    pc.VoxelDownSample(voxel_size, reused_pc, &arena);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+    EXPECT_EQ(arena.GetNumBlocks(), size_t(1));
+    Sort::Do(reused_pc.points_);
+    ExpectEQ(ref_points, reused_pc.points_);
 }
 
 TEST(PointCloud, UniformDownSample) {
@@ -956,6 +1002,14 @@ void TEST_CreatePointCloudFromRGBDImage(const int& color_num_of_channels,
 
     ExpectEQ(ref_points, output_pc->points_);
     ExpectEQ(ref_colors, output_pc->colors_);
+
+    geometry::PointCloud reused_pc;
+    reused_pc.normals_.resize(3);
+    EXPECT_TRUE(geometry::PointCloud::CreateFromRGBDImage(
+            rgbd_image, intrinsic, Matrix4d::Identity(), reused_pc));
+    ExpectEQ(ref_points, reused_pc.points_);
+    ExpectEQ(ref_colors, reused_pc.colors_);
+    EXPECT_FALSE(reused_pc.HasNormals());
 }
 
 // ----------------------------------------------------------------------------
@@ -1078,3 +1132,98 @@ TEST(PointCloud, SegmentPlane) {
 
     ExpectEQ(ref, output_pc->points_);
 }
+
+TEST(PointCloud, ClusterDBSCAN) {
+    // Two well separated lines of points and one isolated point.
+    geometry::PointCloud pc;
+    for (int i = 0; i < 10; i++) {
+        pc.points_.push_back(Vector3d(0.1 * i, 0.0, 0.0));
+        pc.points_.push_back(Vector3d(0.1 * i, 5.0, 0.0));
+    }
+    pc.points_.push_back(Vector3d(10.0, 10.0, 10.0));
+
+    utility::ProgressToken progress;
+    vector<int> labels = pc.ClusterDBSCAN(0.15, 2, false, &progress);
+    ASSERT_EQ(labels.size(), pc.points_.size());
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(labels[2 * i], labels[0]);
+        EXPECT_EQ(labels[2 * i + 1], labels[1]);
+    }
+    EXPECT_NE(labels[0], labels[1]);
+    EXPECT_EQ(labels.back(), -1);
+    EXPECT_DOUBLE_EQ(progress.GetFraction(), 1.0);
+
+    progress.Cancel();
+    EXPECT_TRUE(pc.ClusterDBSCAN(0.15, 2, false, &progress).empty());
+}
+
+TEST(PointCloud, Attributes) {
+    geometry::PointCloud pc({{0.0, 0.0, 0.0},
+                             {0.05, 0.0, 0.0},
+                             {1.0, 0.0, 0.0},
+                             {NAN, 0.0, 0.0}});
+    auto &label = pc.AddAttribute(
+            "label", geometry::PointAttribute::Dtype::Int32, 1);
+    for (int i = 0; i < 4; i++) {
+        label.GetDataPtr<int32_t>()[i] = 10 + i;
+    }
+    EXPECT_TRUE(pc.HasAttribute("label"));
+    EXPECT_FALSE(pc.HasAttribute("intensity"));
+    EXPECT_ANY_THROW(pc.GetAttribute("intensity"));
+
+    auto selected = pc.SelectDownSample({0, 2});
+    ASSERT_TRUE(selected->HasAttribute("label"));
+    EXPECT_EQ(selected->GetAttribute("label").GetDataPtr<int32_t>()[0], 10);
+    EXPECT_EQ(selected->GetAttribute("label").GetDataPtr<int32_t>()[1], 12);
+
+    pc.RemoveNoneFinitePoints();
+    ASSERT_TRUE(pc.HasAttribute("label"));
+    EXPECT_EQ(pc.GetAttribute("label").GetSize(), 3u);
+
+    auto downsampled = pc.VoxelDownSample(0.5);
+    ASSERT_EQ(downsampled->points_.size(), 2u);
+    ASSERT_TRUE(downsampled->HasAttribute("label"));
+    std::vector<int32_t> labels(
+            downsampled->GetAttribute("label").GetDataPtr<int32_t>(),
+            downsampled->GetAttribute("label").GetDataPtr<int32_t>() + 2);
+    std::sort(labels.begin(), labels.end());
+    EXPECT_EQ(labels[0], 10);
+    EXPECT_EQ(labels[1], 12);
+
+    geometry::PointCloud other = pc;
+    other.RemoveAttribute("label");
+    pc += pc;
+    ASSERT_TRUE(pc.HasAttribute("label"));
+    EXPECT_EQ(pc.GetAttribute("label").GetDataPtr<int32_t>()[4], 11);
+    pc += other;
+    EXPECT_FALSE(pc.HasAttribute("label"));
+}
+
+TEST(PointCloud, VoxelDownSampleAndTraceAttributes) {
+    geometry::PointCloud pc(
+            {{0.0, 0.0, 0.0}, {0.05, 0.0, 0.0}, {1.0, 0.0, 0.0}});
+    auto &label = pc.AddAttribute(
+            "label", geometry::PointAttribute::Dtype::Int32, 1);
+    for (int i = 0; i < 3; i++) {
+        label.GetDataPtr<int32_t>()[i] = 10 + i;
+    }
+
+    std::shared_ptr<geometry::PointCloud> downsampled;
+    Eigen::MatrixXi cubic_id;
+    std::tie(downsampled, cubic_id) = pc.VoxelDownSampleAndTrace(
+            0.5, Eigen::Vector3d::Constant(-0.25),
+            Eigen::Vector3d::Constant(1.25));
+    ASSERT_EQ(downsampled->points_.size(), 2u);
+    ASSERT_TRUE(downsampled->HasAttribute("label"));
+    const auto &output_label = downsampled->GetAttribute("label");
+    ASSERT_EQ(output_label.GetSize(), 2u);
+    // Every voxel takes the label of its first point.
+    for (int i = 0; i < 2; i++) {
+        int first_id = -1;
+        for (int c = 0; c < 8 && first_id < 0; c++) {
+            first_id = cubic_id(i, c);
+        }
+        int32_t expected = first_id == 2 ? 12 : 10;
+        EXPECT_EQ(output_label.GetDataPtr<int32_t>()[i], expected);
+    }
+}
@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/TriangleMeshF.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+namespace {
+
+geometry::PointCloud CreateRandomPointCloud(int size) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(size);
+    pcd.colors_.resize(size);
+    Rand(pcd.points_, Vector3d(0.0, 0.0, 0.0), Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pcd.colors_, Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0), 1);
+    return pcd;
+}
+
+}  // unnamed namespace
+
+TEST(PointCloudF, Constructor) {
+    geometry::PointCloudF pcd;
+
+    EXPECT_EQ(geometry::Geometry::GeometryType::PointCloudF,
+              pcd.GetGeometryType());
+    EXPECT_EQ(3, pcd.Dimension());
+    EXPECT_TRUE(pcd.IsEmpty());
+}
+
+TEST(PointCloudF, ConvertToAndFromPointCloud) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(100);
+    pcd.normals_.resize(100, Vector3d(0.0, 0.0, 1.0));
+
+    geometry::PointCloudF pcd_f(pcd);
+    ASSERT_EQ(pcd.points_.size(), pcd_f.points_.size());
+    EXPECT_TRUE(pcd_f.HasNormals());
+    EXPECT_TRUE(pcd_f.HasColors());
+    EXPECT_EQ(pcd.GetMinBound().cast<float>(),
+              pcd_f.GetMinBound().cast<float>());
+
+    auto pcd_d = pcd_f.ToPointCloud();
+    ASSERT_EQ(pcd.points_.size(), pcd_d->points_.size());
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        EXPECT_LT((pcd.points_[i] - pcd_d->points_[i]).norm(), 1e-5);
+        EXPECT_LT((pcd.colors_[i] - pcd_d->colors_[i]).norm(), 1e-6);
+    }
+}
+
+TEST(PointCloudF, Transform) {
+    geometry::PointCloudF pcd(vector<Vector3f>{Vector3f(1.0f, 0.0f, 0.0f)});
+    pcd.normals_ = {Vector3f(1.0f, 0.0f, 0.0f)};
+    Matrix4d transformation = Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            geometry::Geometry3D::GetRotationMatrixFromXYZ(
+                    Vector3d(0.0, 0.0, M_PI / 2));
+    transformation.block<3, 1>(0, 3) = Vector3d(0.0, 0.0, 2.0);
+
+    pcd.Transform(transformation);
+    ExpectEQ(Vector3d(0.0, 1.0, 2.0), Vector3d(pcd.points_[0].cast<double>()));
+    ExpectEQ(Vector3d(0.0, 1.0, 0.0), Vector3d(pcd.normals_[0].cast<double>()));
+}
+
+TEST(PointCloudF, RotateFarFromOrigin) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Vector3d(1e6, 1e6, 1e6),
+         Vector3d(1e6 + 1.0, 1e6 + 1.0, 1e6 + 1.0), 0);
+    geometry::PointCloudF pcd_f(pcd);
+    const Matrix3d R = geometry::Geometry3D::GetRotationMatrixFromXYZ(
+            Vector3d(0.3, -0.7, 1.1));
+    const Vector3d center = pcd_f.GetCenter();
+    vector<Vector3d> expected(pcd_f.points_.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        expected[i] = R * (pcd_f.points_[i].cast<double>() - center) + center;
+    }
+
+    // One float ulp at 1e6 is 0.0625; rotating A * p + (c - A * c) in single
+    // precision would be off by a few of them.
+    pcd_f.Rotate(R, true);
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_LE((pcd_f.points_[i].cast<double>() - expected[i])
+                          .cwiseAbs()
+                          .maxCoeff(),
+                  0.0625);
+    }
+}
+
+TEST(PointCloudF, VoxelDownSample) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    geometry::PointCloudF pcd_f(pcd);
+
+    auto down = pcd.VoxelDownSample(2.5);
+    geometry::PointCloudF down_f;
+    pcd_f.VoxelDownSample(2.5, down_f);
+    ASSERT_EQ(down->points_.size(), down_f.points_.size());
+    ASSERT_EQ(down->colors_.size(), down_f.colors_.size());
+
+    // Both use the same voxel map layout, so the order matches.
+    for (size_t i = 0; i < down->points_.size(); i++) {
+        EXPECT_LT((down->points_[i] - down_f.points_[i].cast<double>()).norm(),
+                  1e-4);
+    }
+
+    // Reusing the output keeps its storage.
+    const Vector3f *data = down_f.points_.data();
+    pcd_f.VoxelDownSample(2.5, down_f);
+    EXPECT_EQ(data, down_f.points_.data());
+}
+
+TEST(PointCloudF, EstimateNormals) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    geometry::PointCloudF pcd_f(pcd);
+
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    pcd_f.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    ASSERT_TRUE(pcd_f.HasNormals());
+
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        // Normals are only defined up to sign.
+        double cos_angle =
+                std::abs(pcd.normals_[i].dot(pcd_f.normals_[i].cast<double>()));
+        EXPECT_NEAR(1.0, cos_angle, 1e-3);
+    }
+}
+
+TEST(PointCloudF, KDTreeFlann) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    geometry::PointCloudF pcd_f(pcd);
+
+    geometry::KDTreeFlann kdtree(pcd);
+    geometry::KDTreeFlann kdtree_f(pcd_f);
+    vector<int> indices, indices_f;
+    vector<double> distance2, distance2_f;
+    for (size_t i = 0; i < 20; i++) {
+        int k = kdtree.SearchKNN(pcd.points_[i], 5, indices, distance2);
+        int k_f = kdtree_f.SearchKNN(pcd_f.points_[i], 5, indices_f,
+                                     distance2_f);
+        ASSERT_EQ(k, k_f);
+        EXPECT_EQ(indices, indices_f);
+        for (int j = 0; j < k; j++) {
+            EXPECT_NEAR(distance2[j], distance2_f[j], 1e-3);
+        }
+
+        k = kdtree.SearchRadius(pcd.points_[i], 1.5, indices, distance2);
+        k_f = kdtree_f.SearchRadius(pcd.points_[i], 1.5, indices_f,
+                                    distance2_f);
+        EXPECT_EQ(k, k_f);
+
+        k = kdtree.SearchHybrid(pcd.points_[i], 1.5, 3, indices, distance2);
+        k_f = kdtree_f.SearchHybrid(pcd_f.points_[i], 1.5, 3, indices_f,
+                                    distance2_f);
+        ASSERT_EQ(k, k_f);
+        EXPECT_EQ(indices, indices_f);
+    }
+}
+
+TEST(TriangleMeshF, ComputeVertexNormals) {
+    auto mesh = geometry::TriangleMesh::CreateBox();
+    mesh->ComputeVertexNormals();
+    geometry::TriangleMeshF mesh_f(*mesh);
+    mesh_f.vertex_normals_.clear();
+    mesh_f.triangle_normals_.clear();
+
+    mesh_f.ComputeVertexNormals();
+    EXPECT_EQ(geometry::Geometry::GeometryType::TriangleMeshF,
+              mesh_f.GetGeometryType());
+    ASSERT_TRUE(mesh_f.HasVertexNormals());
+    ASSERT_TRUE(mesh_f.HasTriangleNormals());
+    for (size_t i = 0; i < mesh->vertices_.size(); i++) {
+        ExpectEQ(mesh->vertex_normals_[i],
+                 Vector3d(mesh_f.vertex_normals_[i].cast<double>()));
+    }
+
+    auto mesh_d = mesh_f.ToTriangleMesh();
+    EXPECT_EQ(mesh->triangles_, mesh_d->triangles_);
+    ExpectEQ(mesh->GetMaxBound(), mesh_d->GetMaxBound());
+}
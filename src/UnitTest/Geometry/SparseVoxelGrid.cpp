@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "Open3D/Geometry/SparseVoxelGrid.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/VoxelGrid.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(SparseVoxelGrid, PackKey) {
+    const std::vector<Eigen::Vector3i> grid_indices = {
+            {0, 0, 0},
+            {-1, 2, -3},
+            {geometry::SparseVoxelGrid::kMinIndex, 5,
+             geometry::SparseVoxelGrid::kMaxIndex}};
+    for (const Eigen::Vector3i &grid_index : grid_indices) {
+        uint64_t key = geometry::SparseVoxelGrid::PackKey(grid_index);
+        ExpectEQ(geometry::SparseVoxelGrid::UnpackKey(key), grid_index);
+    }
+    EXPECT_LT(geometry::SparseVoxelGrid::PackKey(Eigen::Vector3i(-1, 9, 9)),
+              geometry::SparseVoxelGrid::PackKey(Eigen::Vector3i(0, -9, -9)));
+}
+
+TEST(SparseVoxelGrid, CreateFromPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.1, 0.1, 0.1}, {0.2, 0.3, 0.4}, {1.5, 0.1, 0.1},
+                   {0.1, 2.5, 0.1}, {1.6, 0.2, 0.3}};
+    pcd.colors_ = {{1.0, 0.0, 0.0},
+                   {0.0, 1.0, 0.0},
+                   {0.0, 0.0, 1.0},
+                   {1.0, 1.0, 1.0},
+                   {0.0, 0.0, 0.0}};
+    auto grid = geometry::SparseVoxelGrid::CreateFromPointCloudWithinBounds(
+            pcd, 1.0, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(3, 3, 3));
+
+    auto ref = geometry::VoxelGrid::CreateFromPointCloudWithinBounds(
+            pcd, 1.0, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(3, 3, 3));
+    EXPECT_EQ(grid->GetNumVoxels(), ref->voxels_.size());
+    for (const auto &it : ref->voxels_) {
+        int64_t i = grid->Find(it.first);
+        ASSERT_GE(i, 0);
+        ExpectEQ(grid->GetColor(size_t(i)), it.second.color_, 1.0 / 255.0);
+    }
+    EXPECT_FALSE(grid->Contains(Eigen::Vector3i(2, 2, 2)));
+
+    std::vector<bool> included = grid->CheckIfIncluded(
+            {{0.5, 0.5, 0.5}, {2.5, 2.5, 2.5}, {1.1, 0.9, 0.9}});
+    EXPECT_TRUE(included[0]);
+    EXPECT_FALSE(included[1]);
+    EXPECT_TRUE(included[2]);
+}
+
+TEST(SparseVoxelGrid, ConvertVoxelGrid) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.5;
+    voxel_grid.origin_ = Eigen::Vector3d(1, 2, 3);
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(3, -2, 1),
+                                        Eigen::Vector3d(1, 0, 0)));
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(-4, 0, 7),
+                                        Eigen::Vector3d(0, 1, 0)));
+
+    auto sparse = geometry::SparseVoxelGrid::CreateFromVoxelGrid(voxel_grid);
+    EXPECT_EQ(sparse->GetNumVoxels(), size_t(2));
+    EXPECT_TRUE(sparse->HasColors());
+    ExpectEQ(sparse->GetGridIndex(0), Eigen::Vector3i(-4, 0, 7));
+    ExpectEQ(sparse->GetMinBound(), voxel_grid.GetMinBound());
+    ExpectEQ(sparse->GetMaxBound(), voxel_grid.GetMaxBound());
+
+    auto converted = sparse->ToVoxelGrid();
+    EXPECT_EQ(converted->voxels_.size(), voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        ASSERT_EQ(converted->voxels_.count(it.first), size_t(1));
+        ExpectEQ(converted->voxels_[it.first].color_, it.second.color_);
+    }
+}
+
+TEST(SparseVoxelGrid, ConvertVoxelGridWithoutColors) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = 0.5;
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(3, -2, 1)));
+
+    auto sparse = geometry::SparseVoxelGrid::CreateFromVoxelGrid(voxel_grid);
+    EXPECT_EQ(sparse->GetNumVoxels(), size_t(1));
+    EXPECT_FALSE(sparse->HasColors());
+    EXPECT_TRUE(sparse->colors_.empty());
+    auto converted = sparse->ToVoxelGrid();
+    ASSERT_EQ(converted->voxels_.size(), size_t(1));
+    ExpectEQ(converted->voxels_.begin()->second.color_,
+             Eigen::Vector3d(0, 0, 0));
+}
+
+TEST(SparseVoxelGrid, CarveSilhouettes) {
+    std::vector<geometry::Image> masks(2);
+    std::vector<camera::PinholeCameraParameters> params(2);
+    for (int view = 0; view < 2; view++) {
+        masks[view].Prepare(64, 64, 1, 4);
+        for (int v = 0; v < 64; v++) {
+            for (int u = 0; u < 64; u++) {
+                // The first view sees the left half, the second the top half.
+                bool set = view == 0 ? u < 24 : v < 24;
+                *masks[view].PointerAt<float>(u, v) = set ? 1.0f : 0.0f;
+            }
+        }
+        params[view].intrinsic_.SetIntrinsics(64, 64, 50.0, 50.0, 31.5, 31.5);
+        params[view].extrinsic_ = Eigen::Matrix4d::Identity();
+        params[view].extrinsic_(2, 3) = 5.0;
+    }
+    auto dense = geometry::VoxelGrid::CreateDense(
+            Eigen::Vector3d(-1, -1, -1), 0.25, 2.0, 2.0, 2.0);
+    for (auto &it : dense->voxels_) {
+        it.second.color_ = (it.first.cast<double>().array() + 1.0) / 8.0;
+    }
+    auto sparse = geometry::SparseVoxelGrid::CreateFromVoxelGrid(*dense);
+    ASSERT_TRUE(sparse->HasColors());
+
+    dense->CarveSilhouettes(masks, params);
+    sparse->CarveSilhouettes(masks, params);
+
+    EXPECT_GT(sparse->GetNumVoxels(), size_t(0));
+    EXPECT_EQ(sparse->GetNumVoxels(), dense->voxels_.size());
+    EXPECT_TRUE(std::is_sorted(sparse->keys_.begin(), sparse->keys_.end()));
+    for (size_t i = 0; i < sparse->GetNumVoxels(); i++) {
+        auto it = dense->voxels_.find(sparse->GetGridIndex(i));
+        ASSERT_TRUE(it != dense->voxels_.end());
+        ExpectEQ(sparse->GetColor(i), it->second.color_, 1.0 / 255.0);
+    }
+}
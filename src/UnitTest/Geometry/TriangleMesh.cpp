@@ -27,6 +27,7 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Progress.h"
 #include "TestUtility/UnitTest.h"
 
 using namespace Eigen;
@@ -1811,6 +1812,30 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
             geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, 2);
     ExpectEQ(*mesh_es, mesh_gt, 1e-4);
     ExpectEQ(densities_es, densities_gt, 1e-4);
+
+    utility::ProgressToken progress;
+    std::tie(mesh_es, densities_es) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd, 2, 0, 1.1f, false, &progress);
+    ExpectEQ(*mesh_es, mesh_gt, 1e-4);
+    EXPECT_DOUBLE_EQ(progress.GetFraction(), 1.0);
+
+    progress.Cancel();
+    std::tie(mesh_es, densities_es) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd, 2, 0, 1.1f, false, &progress);
+    EXPECT_TRUE(mesh_es->IsEmpty());
+    EXPECT_TRUE(densities_es.empty());
+
+    // A throwing progress callback leaves the reconstruction usable.
+    utility::ProgressToken throwing(
+            [](double) { throw std::runtime_error("progress"); }, 0.0);
+    EXPECT_THROW(geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                         pcd, 2, 0, 1.1f, false, &throwing),
+                 std::runtime_error);
+    std::tie(mesh_es, densities_es) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, 2);
+    ExpectEQ(*mesh_es, mesh_gt, 1e-4);
 }
 
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
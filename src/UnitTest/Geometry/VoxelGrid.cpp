@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/VoxelGrid.h"
+#include "Open3D/Camera/PinholeCameraParameters.h"
+#include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/LineSet.h"
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
@@ -73,3 +75,57 @@ TEST(VoxelGrid, Visualization) {
     // Uncomment the line below for visualization test
     // visualization::DrawGeometries({voxel_grid});
 }
+
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateBox(0.94, 0.94, 0.94);
+    mesh->Translate(Eigen::Vector3d(0.03, 0.03, 0.03));
+    const Eigen::Vector3d min_bound(-0.1, -0.1, -0.1);
+    const Eigen::Vector3d max_bound(1.1, 1.1, 1.1);
+
+    // Voxels 3 to 21 along each axis have their centers inside the box, and
+    // the faces of the box cross the voxels 3 and 21.
+    auto surface = geometry::VoxelGrid::CreateFromTriangleMeshWithinBounds(
+            *mesh, 0.05, min_bound, max_bound);
+    EXPECT_EQ(surface->voxels_.size(), size_t(19 * 19 * 19 - 17 * 17 * 17));
+    EXPECT_EQ(surface->voxels_.count(Eigen::Vector3i(3, 10, 10)), size_t(1));
+    EXPECT_EQ(surface->voxels_.count(Eigen::Vector3i(10, 10, 10)), size_t(0));
+
+    auto solid = geometry::VoxelGrid::CreateFromTriangleMeshWithinBounds(
+            *mesh, 0.05, min_bound, max_bound, true);
+    EXPECT_EQ(solid->voxels_.size(), size_t(19 * 19 * 19));
+    EXPECT_EQ(solid->voxels_.count(Eigen::Vector3i(10, 10, 10)), size_t(1));
+    EXPECT_EQ(solid->voxels_.count(Eigen::Vector3i(2, 10, 10)), size_t(0));
+}
+
+TEST(VoxelGrid, CarveSilhouettes) {
+    std::vector<geometry::Image> masks(2);
+    std::vector<camera::PinholeCameraParameters> params(2);
+    for (int view = 0; view < 2; view++) {
+        masks[view].Prepare(64, 64, 1, 4);
+        for (int v = 0; v < 64; v++) {
+            for (int u = 0; u < 64; u++) {
+                // The first view sees the left half, the second the top half.
+                bool set = view == 0 ? u < 24 : v < 24;
+                *masks[view].PointerAt<float>(u, v) = set ? 1.0f : 0.0f;
+            }
+        }
+        params[view].intrinsic_.SetIntrinsics(64, 64, 50.0, 50.0, 31.5, 31.5);
+        params[view].extrinsic_ = Eigen::Matrix4d::Identity();
+        params[view].extrinsic_(2, 3) = 5.0;
+    }
+    auto dense = geometry::VoxelGrid::CreateDense(
+            Eigen::Vector3d(-1, -1, -1), 0.25, 2.0, 2.0, 2.0);
+
+    geometry::VoxelGrid sequential = *dense;
+    sequential.CarveSilhouette(masks[0], params[0]);
+    sequential.CarveSilhouette(masks[1], params[1]);
+    geometry::VoxelGrid batched = *dense;
+    batched.CarveSilhouettes(masks, params);
+
+    EXPECT_GT(batched.voxels_.size(), size_t(0));
+    EXPECT_LT(batched.voxels_.size(), dense->voxels_.size());
+    EXPECT_EQ(batched.voxels_.size(), sequential.voxels_.size());
+    for (const auto &it : sequential.voxels_) {
+        EXPECT_EQ(batched.voxels_.count(it.first), size_t(1));
+    }
+}
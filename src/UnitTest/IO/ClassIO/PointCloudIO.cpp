@@ -24,8 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(PointCloudIO, DISABLED_CreatePointCloudFromFile) {
     unit_test::NotImplemented();
 }
@@ -81,3 +84,32 @@ TEST(PointCloudIO, DISABLED_ReadPointCloudFromPTS) {
 TEST(PointCloudIO, DISABLED_WritePointCloudToPTS) {
     unit_test::NotImplemented();
 }
+
+TEST(PointCloudIO, PointCloudFPLYWriteRead) {
+    geometry::PointCloudF src;
+    src.points_ = {Eigen::Vector3f(0.1f, 0.2f, 0.3f),
+                   Eigen::Vector3f(-1.5f, 2.25f, 1e3f)};
+    src.normals_ = {Eigen::Vector3f(0.0f, 0.0f, 1.0f),
+                    Eigen::Vector3f(1.0f, 0.0f, 0.0f)};
+    src.colors_ = {Eigen::Vector3f(1.0f, 0.0f, 0.0f),
+                   Eigen::Vector3f(0.0f, 1.0f, 0.0f)};
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_pcd_f.ply";
+    EXPECT_TRUE(io::WritePointCloud(file_name, src));
+
+    // Float properties are read back bit-exact.
+    geometry::PointCloudF dst;
+    EXPECT_TRUE(io::ReadPointCloud(file_name, dst));
+    EXPECT_EQ(src.points_, dst.points_);
+    EXPECT_EQ(src.normals_, dst.normals_);
+    EXPECT_EQ(src.colors_, dst.colors_);
+
+    // The double-precision reader accepts the same file.
+    geometry::PointCloud dst_d;
+    EXPECT_TRUE(io::ReadPointCloud(file_name, dst_d));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+    ASSERT_EQ(src.points_.size(), dst_d.points_.size());
+    for (size_t i = 0; i < src.points_.size(); i++) {
+        EXPECT_EQ(src.points_[i].cast<double>(), dst_d.points_[i]);
+    }
+}
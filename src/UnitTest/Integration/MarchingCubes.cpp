@@ -0,0 +1,292 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/MarchingCubes.h"
+#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
+#include "TestUtility/UnitTest.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+/// Fills \p voxel with the truncated distance to a sphere of radius 0.6
+/// centered at (1, 1, 1).
+void SetSphereVoxel(geometry::TSDFVoxel &voxel,
+                    const Eigen::Vector3d &center,
+                    double sdf_trunc) {
+    double sdf = (center - Eigen::Vector3d(1.0, 1.0, 1.0)).norm() - 0.6;
+    voxel.tsdf_ = float(std::max(-1.0, std::min(1.0, sdf / sdf_trunc)));
+    voxel.weight_ = 1.0f;
+    voxel.color_ = center * 100.0;
+}
+
+std::vector<Eigen::Vector3d> SortedVertices(
+        const geometry::TriangleMesh &mesh) {
+    std::vector<Eigen::Vector3d> vertices = mesh.vertices_;
+    std::sort(vertices.begin(), vertices.end(),
+              [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                  return std::lexicographical_compare(a.data(), a.data() + 3,
+                                                      b.data(), b.data() + 3);
+              });
+    return vertices;
+}
+
+/// Fills \p volume with the sphere of SetSphereVoxel.
+void SetSphereVolume(integration::UniformTSDFVolume &volume,
+                     double sdf_trunc) {
+    for (int x = 0; x < volume.resolution_; x++) {
+        for (int y = 0; y < volume.resolution_; y++) {
+            for (int z = 0; z < volume.resolution_; z++) {
+                Eigen::Vector3d center =
+                        (Eigen::Vector3d(x, y, z) +
+                         Eigen::Vector3d::Constant(0.5)) *
+                        volume.voxel_length_;
+                SetSphereVoxel(volume.voxels_[volume.IndexOf(x, y, z)],
+                               center, sdf_trunc);
+            }
+        }
+    }
+}
+
+/// The serial marching cubes of UniformTSDFVolume before the block-wise
+/// extraction, which shares vertices through a map from cube edges.
+std::shared_ptr<geometry::TriangleMesh> ExtractReferenceTriangleMesh(
+        const integration::UniformTSDFVolume &volume) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    const double voxel_length = volume.voxel_length_;
+    const double half_voxel_length = voxel_length * 0.5;
+    std::unordered_map<
+            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
+            std::equal_to<Eigen::Vector4i>,
+            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
+            edgeindex_to_vertexindex;
+    int edge_to_index[12];
+    for (int x = 0; x < volume.resolution_ - 1; x++) {
+        for (int y = 0; y < volume.resolution_ - 1; y++) {
+            for (int z = 0; z < volume.resolution_ - 1; z++) {
+                int cube_index = 0;
+                float f[8];
+                Eigen::Vector3d c[8];
+                for (int i = 0; i < 8; i++) {
+                    const geometry::TSDFVoxel &voxel =
+                            volume.voxels_[volume.IndexOf(
+                                    Eigen::Vector3i(x, y, z) + shift[i])];
+                    if (voxel.weight_ == 0.0f) {
+                        cube_index = 0;
+                        break;
+                    }
+                    f[i] = voxel.tsdf_;
+                    if (f[i] < 0.0f) {
+                        cube_index |= (1 << i);
+                    }
+                    c[i] = voxel.color_ / 255.0;
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                for (int i = 0; i < 12; i++) {
+                    if (!(edge_table[cube_index] & (1 << i))) {
+                        continue;
+                    }
+                    Eigen::Vector4i edge_index =
+                            Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                    auto it = edgeindex_to_vertexindex.find(edge_index);
+                    if (it != edgeindex_to_vertexindex.end()) {
+                        edge_to_index[i] = it->second;
+                        continue;
+                    }
+                    edge_to_index[i] = (int)mesh->vertices_.size();
+                    edgeindex_to_vertexindex[edge_index] = edge_to_index[i];
+                    Eigen::Vector3d pt =
+                            edge_index.head<3>().cast<double>() *
+                                    voxel_length +
+                            Eigen::Vector3d::Constant(half_voxel_length);
+                    double f0 = std::abs((double)f[edge_to_vert[i][0]]);
+                    double f1 = std::abs((double)f[edge_to_vert[i][1]]);
+                    pt(edge_index(3)) += f0 * voxel_length / (f0 + f1);
+                    mesh->vertices_.push_back(pt + volume.origin_);
+                    mesh->vertex_colors_.push_back(
+                            (f1 * c[edge_to_vert[i][0]] +
+                             f0 * c[edge_to_vert[i][1]]) /
+                            (f0 + f1));
+                }
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    mesh->triangles_.push_back(Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index][i + 1]]));
+                }
+            }
+        }
+    }
+    return mesh;
+}
+
+typedef Eigen::Matrix<double, 6, 1> Vector6d;
+typedef Eigen::Matrix<double, 9, 1> Vector9d;
+
+template <int N>
+bool LexicographicLess(const Eigen::Matrix<double, N, 1> &a,
+                       const Eigen::Matrix<double, N, 1> &b) {
+    return std::lexicographical_compare(a.data(), a.data() + N, b.data(),
+                                        b.data() + N);
+}
+
+/// Positions and colors of the vertices, independent of the vertex order.
+std::vector<Vector6d> SortedColoredVertices(
+        const geometry::TriangleMesh &mesh) {
+    std::vector<Vector6d> vertices(mesh.vertices_.size());
+    for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+        vertices[i] << mesh.vertices_[i], mesh.vertex_colors_[i];
+    }
+    std::sort(vertices.begin(), vertices.end(), LexicographicLess<6>);
+    return vertices;
+}
+
+/// Corner positions of the triangles in winding order, independent of the
+/// vertex and triangle order.
+std::vector<Vector9d> SortedTriangles(const geometry::TriangleMesh &mesh) {
+    std::vector<Vector9d> triangles(mesh.triangles_.size());
+    for (size_t i = 0; i < mesh.triangles_.size(); i++) {
+        const Eigen::Vector3i &t = mesh.triangles_[i];
+        triangles[i] << mesh.vertices_[t(0)], mesh.vertices_[t(1)],
+                mesh.vertices_[t(2)];
+    }
+    std::sort(triangles.begin(), triangles.end(), LexicographicLess<9>);
+    return triangles;
+}
+
+}  // unnamed namespace
+
+TEST(MarchingCubes, UniformTSDFVolume) {
+    const double sdf_trunc = 0.15;
+    integration::UniformTSDFVolume volume(
+            2.0, 40, sdf_trunc, integration::TSDFVolumeColorType::RGB8);
+    SetSphereVolume(volume, sdf_trunc);
+
+    std::shared_ptr<geometry::TriangleMesh> serial_mesh;
+    {
+        utility::ScopedMaxThreads max_threads(1);
+        serial_mesh = volume.ExtractTriangleMesh();
+    }
+    auto mesh = volume.ExtractTriangleMesh();
+    EXPECT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_TRUE(mesh->IsWatertight());
+    EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    // The output does not depend on the number of threads.
+    ASSERT_EQ(mesh->vertices_.size(), serial_mesh->vertices_.size());
+    ASSERT_EQ(mesh->triangles_.size(), serial_mesh->triangles_.size());
+    for (size_t i = 0; i < mesh->vertices_.size(); i++) {
+        EXPECT_EQ(mesh->vertices_[i], serial_mesh->vertices_[i]);
+        EXPECT_EQ(mesh->vertex_colors_[i], serial_mesh->vertex_colors_[i]);
+    }
+    for (size_t i = 0; i < mesh->triangles_.size(); i++) {
+        EXPECT_EQ(mesh->triangles_[i], serial_mesh->triangles_[i]);
+    }
+    for (const auto &vertex : mesh->vertices_) {
+        EXPECT_NEAR((vertex - Eigen::Vector3d(1.0, 1.0, 1.0)).norm(), 0.6,
+                    0.01);
+    }
+}
+
+TEST(MarchingCubes, MatchesEdgeMapExtraction) {
+    const double sdf_trunc = 0.15;
+    integration::UniformTSDFVolume volume(
+            2.0, 40, sdf_trunc, integration::TSDFVolumeColorType::RGB8);
+    SetSphereVolume(volume, sdf_trunc);
+
+    auto mesh = volume.ExtractTriangleMesh();
+    auto reference = ExtractReferenceTriangleMesh(volume);
+    ASSERT_GT(reference->triangles_.size(), 0u);
+    ASSERT_EQ(mesh->vertices_.size(), reference->vertices_.size());
+    ASSERT_EQ(mesh->triangles_.size(), reference->triangles_.size());
+    ExpectEQ(SortedColoredVertices(*mesh), SortedColoredVertices(*reference));
+    ExpectEQ(SortedTriangles(*mesh), SortedTriangles(*reference));
+}
+
+TEST(MarchingCubes, ScalableTSDFVolume) {
+    const double voxel_length = 0.05;
+    const double sdf_trunc = 0.15;
+    const int unit_resolution = 8;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, sdf_trunc, integration::TSDFVolumeColorType::RGB8,
+            unit_resolution);
+    integration::UniformTSDFVolume reference(
+            2.0, 40, sdf_trunc, integration::TSDFVolumeColorType::RGB8);
+    for (int i = 0; i < 5 * 5 * 5; i++) {
+        Eigen::Vector3i index(i / 25, i / 5 % 5, i % 5);
+        auto &unit = volume.volume_units_[index];
+        unit.index_ = index;
+        unit.volume_ = std::make_shared<integration::UniformTSDFVolume>(
+                volume.volume_unit_length_, unit_resolution, sdf_trunc,
+                integration::TSDFVolumeColorType::RGB8,
+                index.cast<double>() * volume.volume_unit_length_);
+        for (int x = 0; x < unit_resolution; x++) {
+            for (int y = 0; y < unit_resolution; y++) {
+                for (int z = 0; z < unit_resolution; z++) {
+                    Eigen::Vector3i g =
+                            index * unit_resolution + Eigen::Vector3i(x, y, z);
+                    Eigen::Vector3d center = (g.cast<double>() +
+                                              Eigen::Vector3d::Constant(0.5)) *
+                                             voxel_length;
+                    SetSphereVoxel(
+                            unit.volume_->voxels_[unit.volume_->IndexOf(x, y,
+                                                                         z)],
+                            center, sdf_trunc);
+                    SetSphereVoxel(reference.voxels_[reference.IndexOf(g)],
+                                   center, sdf_trunc);
+                }
+            }
+        }
+    }
+
+    // Meshing across volume units matches meshing one uniform volume.
+    auto mesh = volume.ExtractTriangleMesh();
+    auto reference_mesh = reference.ExtractTriangleMesh();
+    EXPECT_TRUE(mesh->IsWatertight());
+    ASSERT_EQ(mesh->vertices_.size(), reference_mesh->vertices_.size());
+    EXPECT_EQ(mesh->triangles_.size(), reference_mesh->triangles_.size());
+    std::vector<Eigen::Vector3d> vertices = SortedVertices(*mesh);
+    std::vector<Eigen::Vector3d> reference_vertices =
+            SortedVertices(*reference_mesh);
+    for (size_t i = 0; i < vertices.size(); i++) {
+        ExpectEQ(vertices[i], reference_vertices[i]);
+    }
+
+    // Dropping a unit opens the surface.
+    volume.volume_units_.erase(Eigen::Vector3i(2, 2, 0));
+    mesh = volume.ExtractTriangleMesh();
+    EXPECT_LT(mesh->triangles_.size(), reference_mesh->triangles_.size());
+    EXPECT_FALSE(mesh->IsWatertight());
+}
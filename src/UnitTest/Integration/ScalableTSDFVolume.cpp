@@ -24,8 +24,139 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "Open3D/Utility/FileSystem.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// Returns a 64x48 depth-only image of a plane at depth 1.
+geometry::RGBDImage CreatePlaneImage() {
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    return rgbd;
+}
+
+/// Integrates \p rgbd into \p volume one voxel at a time, with the original
+/// per-frame algorithm of UniformTSDFVolume::Integrate, as a baseline for
+/// the batched kernel.
+void IntegrateReference(integration::UniformTSDFVolume &volume,
+                        const geometry::RGBDImage &rgbd,
+                        const camera::PinholeCameraIntrinsic &intrinsic,
+                        const Eigen::Matrix4d &extrinsic) {
+    auto multiplier =
+            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
+                    intrinsic);
+    const float fx = float(intrinsic.GetFocalLength().first);
+    const float fy = float(intrinsic.GetFocalLength().second);
+    const float cx = float(intrinsic.GetPrincipalPoint().first);
+    const float cy = float(intrinsic.GetPrincipalPoint().second);
+    const Eigen::Matrix4f extrinsic_f = extrinsic.cast<float>();
+    const float voxel_length = float(volume.voxel_length_);
+    const float sdf_trunc = float(volume.sdf_trunc_);
+    for (int x = 0; x < volume.resolution_; x++) {
+        for (int y = 0; y < volume.resolution_; y++) {
+            for (int z = 0; z < volume.resolution_; z++) {
+                Eigen::Vector4f pt(
+                        float(voxel_length * (x + 0.5f) + volume.origin_(0)),
+                        float(voxel_length * (y + 0.5f) + volume.origin_(1)),
+                        float(voxel_length * (z + 0.5f) + volume.origin_(2)),
+                        1.0f);
+                Eigen::Vector4f pt_camera = extrinsic_f * pt;
+                if (pt_camera(2) <= 0) {
+                    continue;
+                }
+                float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
+                float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
+                if (!(u_f >= 0.0001f && u_f < intrinsic.width_ - 0.0001f &&
+                      v_f >= 0.0001f && v_f < intrinsic.height_ - 0.0001f)) {
+                    continue;
+                }
+                int u = int(u_f);
+                int v = int(v_f);
+                float d = *rgbd.depth_.PointerAt<float>(u, v);
+                if (!(d > 0.0f)) {
+                    continue;
+                }
+                float sdf = (d - pt_camera(2)) *
+                            *multiplier->PointerAt<float>(u, v);
+                if (sdf <= -sdf_trunc) {
+                    continue;
+                }
+                auto &voxel = volume.voxels_[volume.IndexOf(x, y, z)];
+                float tsdf = std::min(1.0f, sdf / sdf_trunc);
+                voxel.tsdf_ = (voxel.tsdf_ * voxel.weight_ + tsdf) /
+                              (voxel.weight_ + 1.0f);
+                const uint8_t *rgb = rgbd.color_.PointerAt<uint8_t>(u, v, 0);
+                voxel.color_ = (voxel.color_ * voxel.weight_ +
+                                Eigen::Vector3d(rgb[0], rgb[1], rgb[2])) /
+                               (voxel.weight_ + 1.0f);
+                voxel.weight_ += 1.0f;
+            }
+        }
+    }
+}
+
+Eigen::Matrix4d CameraAt(double x) {
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = -x;
+    return extrinsic;
+}
+
+bool IsIntegrated(const integration::ScalableTSDFVolume::VolumeUnit &unit) {
+    for (const auto &voxel : unit.volume_->voxels_) {
+        if (voxel.weight_ > 0.0f) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the number of volume units holding at least one integrated voxel.
+size_t CountIntegratedVolumeUnits(
+        const integration::ScalableTSDFVolume &volume) {
+    size_t count = 0;
+    for (const auto &unit : volume.volume_units_) {
+        count += IsIntegrated(unit.second) ? 1 : 0;
+    }
+    return count;
+}
+
+// Creates a new, uniquely named directory for spill files in the temporary
+// directory, so that concurrent test runs do not share spill files.
+std::string CreateSpillDirectory() {
+    const char *tmp_directory = std::getenv("TMPDIR");
+    const std::string prefix =
+            utility::filesystem::GetRegularizedDirectoryName(
+                    tmp_directory != nullptr ? tmp_directory : "/tmp") +
+            "open3d_spill_test_";
+    std::random_device random_device;
+    std::string spill_directory;
+    do {
+        spill_directory = prefix + std::to_string(random_device());
+    } while (utility::filesystem::DirectoryExists(spill_directory));
+    utility::filesystem::MakeDirectoryHierarchy(spill_directory);
+    return spill_directory;
+}
+
+}  // unnamed namespace
+
 TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { unit_test::NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { unit_test::NotImplemented(); }
@@ -36,7 +167,342 @@ TEST(ScalableTSDFVolume, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Reset) { unit_test::NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { unit_test::NotImplemented(); }
+TEST(ScalableTSDFVolume, Integrate) {
+    const int width = 64;
+    const int height = 48;
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(width, height, 1, 4);
+    rgbd.color_.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            // Holes and invalid (NaN) depth must both be skipped.
+            float d = 1.0f + 0.002f * u - 0.001f * v;
+            if (u % 17 == 3 && v % 13 == 5) {
+                d = 0.0f;
+            } else if (u % 11 == 7 && v % 7 == 2) {
+                d = std::numeric_limits<float>::quiet_NaN();
+            }
+            *rgbd.depth_.PointerAt<float>(u, v) = d;
+            for (int c = 0; c < 3; c++) {
+                *rgbd.color_.PointerAt<uint8_t>(u, v, c) =
+                        uint8_t(u * 2 + v + c * 20);
+            }
+        }
+    }
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 31.5,
+                                             23.5);
+    Eigen::Matrix4d extrinsic_0 = Eigen::Matrix4d::Identity();
+    extrinsic_0.block<3, 1>(0, 3) = Eigen::Vector3d(0.05, -0.03, 0.0);
+    Eigen::Matrix4d extrinsic_1 = extrinsic_0;
+    extrinsic_1.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02, Eigen::Vector3d::UnitY()).matrix();
+
+    integration::ScalableTSDFVolume volume(
+            0.02, 0.06, integration::TSDFVolumeColorType::RGB8);
+    volume.Integrate(rgbd, intrinsic, extrinsic_0);
+    volume.Integrate(rgbd, intrinsic, extrinsic_1);
+    EXPECT_FALSE(volume.volume_units_.empty());
+    // Units only see the frames that touch them.
+    integration::ScalableTSDFVolume frame_0(
+            0.02, 0.06, integration::TSDFVolumeColorType::RGB8);
+    frame_0.Integrate(rgbd, intrinsic, extrinsic_0);
+    integration::ScalableTSDFVolume frame_1(
+            0.02, 0.06, integration::TSDFVolumeColorType::RGB8);
+    frame_1.Integrate(rgbd, intrinsic, extrinsic_1);
+
+    // Every unit must match the per-frame baseline integration of the same
+    // region. The batched kernel multiplies by a reciprocal, so a voxel that
+    // projects onto a pixel border may pick the neighbouring pixel, which
+    // differs by at most 0.002 in depth and 2 in color.
+    size_t num_observed = 0;
+    size_t num_exact = 0;
+    for (const auto &unit : volume.volume_units_) {
+        // Only units near the surface may be allocated, not units at the
+        // garbage locations of invalid depth.
+        const Eigen::Vector3i &index = unit.first;
+        EXPECT_LE(index.head<2>().cwiseAbs().maxCoeff(), 3);
+        EXPECT_GE(index(2), 2);
+        EXPECT_LE(index(2), 3);
+        integration::UniformTSDFVolume reference(
+                volume.volume_unit_length_, volume.volume_unit_resolution_,
+                0.06, integration::TSDFVolumeColorType::RGB8,
+                index.cast<double>() * volume.volume_unit_length_);
+        if (frame_0.volume_units_.count(index) != 0) {
+            IntegrateReference(reference, rgbd, intrinsic, extrinsic_0);
+        }
+        if (frame_1.volume_units_.count(index) != 0) {
+            IntegrateReference(reference, rgbd, intrinsic, extrinsic_1);
+        }
+        const auto &voxels = unit.second.volume_->voxels_;
+        ASSERT_EQ(voxels.size(), reference.voxels_.size());
+        for (size_t i = 0; i < voxels.size(); i++) {
+            const auto &voxel = voxels[i];
+            const auto &expected = reference.voxels_[i];
+            ASSERT_FALSE(std::isnan(voxel.tsdf_));
+            if (voxel.weight_ == 0.0f && expected.weight_ == 0.0f) {
+                continue;
+            }
+            num_observed++;
+            if (voxel.weight_ != expected.weight_) {
+                // A border pixel fell into a hole or out of the truncation.
+                EXPECT_LE(std::abs(voxel.weight_ - expected.weight_), 1.0f);
+                continue;
+            }
+            double tsdf_error = std::abs(voxel.tsdf_ - expected.tsdf_);
+            double color_error =
+                    (voxel.color_ - expected.color_).lpNorm<Eigen::Infinity>();
+            EXPECT_LE(tsdf_error, 0.002 / 0.06 + 1e-4);
+            EXPECT_LE(color_error, 2.0 + 1e-4);
+            if (tsdf_error < 1e-4 && color_error < 1e-4) {
+                num_exact++;
+            }
+        }
+    }
+    EXPECT_GT(num_observed, 0u);
+    EXPECT_GE(num_exact, num_observed * 99 / 100);
+}
+
+TEST(ScalableTSDFVolume, Raycast) {
+    // A plane at depth 1 seen by a camera at the origin.
+    const int width = 64;
+    const int height = 48;
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 31.5,
+                                             23.5);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+
+    integration::ScalableTSDFVolume volume(
+            0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+    volume.Integrate(rgbd, intrinsic, extrinsic);
+
+    auto result = volume.Raycast(intrinsic, extrinsic, 0.1, 3.0);
+    EXPECT_TRUE(result->color_.IsEmpty());
+    for (int v = 4; v < height - 4; v++) {
+        for (int u = 4; u < width - 4; u++) {
+            EXPECT_NEAR(*result->depth_.PointerAt<float>(u, v), 1.0, 0.01);
+            EXPECT_NEAR(*result->normal_map_.PointerAt<float>(u, v, 2), -1.0,
+                        1e-3);
+        }
+    }
+}
+
+TEST(ScalableTSDFVolume, PruneVolumeUnits) {
+    integration::ScalableTSDFVolume volume(
+            0.02, 0.06, integration::TSDFVolumeColorType::NoColor, 8);
+    for (int i = 0; i < 3; i++) {
+        auto &unit = volume.volume_units_[Eigen::Vector3i(i, 0, 0)];
+        unit.index_ = Eigen::Vector3i(i, 0, 0);
+        unit.volume_ = std::make_shared<integration::UniformTSDFVolume>(
+                volume.volume_unit_length_, 8, 0.06,
+                integration::TSDFVolumeColorType::NoColor);
+        unit.volume_->voxels_[5].weight_ = float(i * 2);
+    }
+    EXPECT_EQ(volume.PruneVolumeUnits(3.0), 2u);
+    ASSERT_EQ(volume.volume_units_.size(), 1u);
+    EXPECT_EQ(volume.volume_units_.begin()->first, Eigen::Vector3i(2, 0, 0));
+}
+
+TEST(ScalableTSDFVolume, EvictVolumeUnits) {
+    geometry::RGBDImage rgbd = CreatePlaneImage();
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    integration::ScalableTSDFVolume volume(
+            0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+    volume.Integrate(rgbd, intrinsic, CameraAt(0.0));
+    const size_t num_first = volume.volume_units_.size();
+    volume.Integrate(rgbd, intrinsic, CameraAt(5.0));
+    const size_t num_second = volume.volume_units_.size() - num_first;
+    EXPECT_GT(num_first, 0u);
+    const size_t unit_memory =
+            volume.GetMemoryUsage() / volume.volume_units_.size();
+
+    // Units of the last frame are kept, the older ones go first.
+    integration::ScalableTSDFVolume lru = volume;
+    EXPECT_EQ(lru.EvictVolumeUnits(num_second + 1), num_first - 1);
+    EXPECT_EQ(lru.EvictVolumeUnits(0), 1u);
+    EXPECT_EQ(lru.volume_units_.size(), num_second);
+    for (const auto &unit : lru.volume_units_) {
+        EXPECT_GT(unit.first(0), 10);
+    }
+
+    // Units far from the camera go first.
+    integration::ScalableTSDFVolume farthest = volume;
+    farthest.eviction_policy_ =
+            integration::VolumeUnitEvictionPolicy::FarthestFromCamera;
+    farthest.Integrate(rgbd, intrinsic, CameraAt(10.0));
+    farthest.EvictVolumeUnits(farthest.volume_units_.size() - num_first);
+    for (const auto &unit : farthest.volume_units_) {
+        EXPECT_GT(unit.first(0), 10);
+    }
+
+    // A memory budget evicts during integration.
+    integration::ScalableTSDFVolume budget(
+            0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+    budget.memory_budget_ = unit_memory * num_second;
+    budget.Integrate(rgbd, intrinsic, CameraAt(0.0));
+    budget.Integrate(rgbd, intrinsic, CameraAt(5.0));
+    EXPECT_LE(budget.GetMemoryUsage(), budget.memory_budget_);
+    EXPECT_EQ(budget.volume_units_.size(), num_second);
+
+    // Eviction goes below the budget, so a frame opening a few units fits.
+    integration::ScalableTSDFVolume hysteresis(
+            0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+    hysteresis.memory_budget_ = unit_memory * (num_first + num_second - 1);
+    hysteresis.Integrate(rgbd, intrinsic, CameraAt(0.0));
+    hysteresis.Integrate(rgbd, intrinsic, CameraAt(5.0));
+    EXPECT_LE(hysteresis.GetMemoryUsage(), hysteresis.memory_budget_ / 10 * 9);
+    EXPECT_GT(hysteresis.volume_units_.size(), num_second);
+}
+
+TEST(ScalableTSDFVolume, SpillVolumeUnits) {
+    geometry::RGBDImage rgbd = CreatePlaneImage();
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    const std::string spill_directory = CreateSpillDirectory();
+    ASSERT_TRUE(utility::filesystem::DirectoryExists(spill_directory));
+    std::vector<std::string> spill_files;
+    {
+        integration::ScalableTSDFVolume volume(
+                0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+        volume.spill_directory_ = spill_directory;
+        volume.Integrate(rgbd, intrinsic, CameraAt(0.0));
+        integration::ScalableTSDFVolume reference = volume;
+        volume.Integrate(rgbd, intrinsic, CameraAt(5.0));
+        size_t num_spilled = volume.EvictVolumeUnits(0);
+        EXPECT_EQ(num_spilled, reference.volume_units_.size());
+        // Units without integrated voxels are discarded instead of spilled.
+        EXPECT_LT(CountIntegratedVolumeUnits(reference), num_spilled);
+        EXPECT_EQ(volume.spilled_volume_units_.size(),
+                  CountIntegratedVolumeUnits(reference));
+
+        // Touching a spilled unit again reloads it.
+        volume.Integrate(rgbd, intrinsic, CameraAt(0.0));
+        EXPECT_TRUE(volume.spilled_volume_units_.empty());
+        for (const auto &unit : reference.volume_units_) {
+            const auto &voxels =
+                    volume.volume_units_[unit.first].volume_->voxels_;
+            const auto &reference_voxels = unit.second.volume_->voxels_;
+            for (size_t i = 0; i < voxels.size(); i++) {
+                if (reference_voxels[i].weight_ > 0.0f) {
+                    EXPECT_EQ(voxels[i].weight_,
+                              reference_voxels[i].weight_ + 1);
+                }
+            }
+        }
+
+        // Spilled units can also be restored explicitly, with the frame
+        // they were last integrated in.
+        volume.Integrate(rgbd, intrinsic, CameraAt(5.0));
+        const size_t num_units = CountIntegratedVolumeUnits(volume);
+        integration::ScalableTSDFVolume before_spill = volume;
+        EXPECT_GT(volume.EvictVolumeUnits(0), 0u);
+        EXPECT_TRUE(volume.RestoreSpilledVolumeUnits());
+        EXPECT_TRUE(volume.spilled_volume_units_.empty());
+        EXPECT_EQ(CountIntegratedVolumeUnits(volume), num_units);
+        for (const auto &unit : before_spill.volume_units_) {
+            if (IsIntegrated(unit.second)) {
+                EXPECT_EQ(volume.volume_units_[unit.first]
+                                  .last_integrated_frame_,
+                          unit.second.last_integrated_frame_);
+            }
+        }
+
+        // Units that fail to spill stay resident.
+        volume.spill_directory_ = spill_directory + "/missing";
+        volume.EvictVolumeUnits(0);
+        EXPECT_TRUE(volume.spilled_volume_units_.empty());
+        EXPECT_EQ(CountIntegratedVolumeUnits(volume), num_units);
+        volume.spill_directory_ = spill_directory;
+
+        // Spill files are removed when the volume is destroyed.
+        EXPECT_GT(volume.EvictVolumeUnits(0), 0u);
+        utility::filesystem::ListFilesInDirectory(spill_directory,
+                                                  spill_files);
+        EXPECT_EQ(spill_files.size(), volume.spilled_volume_units_.size());
+    }
+    for (const auto &filename : spill_files) {
+        EXPECT_FALSE(utility::filesystem::FileExists(filename));
+    }
+    EXPECT_TRUE(utility::filesystem::DeleteDirectory(spill_directory));
+}
+
+TEST(ScalableTSDFVolume, CopySpilledVolumeUnits) {
+    geometry::RGBDImage rgbd = CreatePlaneImage();
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    const std::string spill_directory = CreateSpillDirectory();
+    ASSERT_TRUE(utility::filesystem::DirectoryExists(spill_directory));
+    {
+        integration::ScalableTSDFVolume volume(
+                0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+        volume.spill_directory_ = spill_directory;
+        volume.Integrate(rgbd, intrinsic, CameraAt(0.0));
+        integration::ScalableTSDFVolume reference = volume;
+        volume.Integrate(rgbd, intrinsic, CameraAt(5.0));
+        EXPECT_GT(volume.EvictVolumeUnits(0), 0u);
+        EXPECT_FALSE(volume.spilled_volume_units_.empty());
+
+        // The copy owns the spilled units; spilling and destroying it leaves
+        // the units spilled by the original intact.
+        {
+            integration::ScalableTSDFVolume copy = volume;
+            EXPECT_TRUE(copy.spilled_volume_units_.empty());
+            for (const auto &unit : reference.volume_units_) {
+                if (!IsIntegrated(unit.second)) {
+                    continue;
+                }
+                ASSERT_TRUE(copy.volume_units_.count(unit.first) > 0);
+                const auto &voxels =
+                        copy.volume_units_[unit.first].volume_->voxels_;
+                for (size_t i = 0; i < voxels.size(); i++) {
+                    EXPECT_EQ(voxels[i].weight_,
+                              unit.second.volume_->voxels_[i].weight_);
+                }
+            }
+            EXPECT_GT(copy.EvictVolumeUnits(0), 0u);
+        }
+        EXPECT_TRUE(volume.RestoreSpilledVolumeUnits());
+        for (const auto &unit : reference.volume_units_) {
+            if (!IsIntegrated(unit.second)) {
+                continue;
+            }
+            const auto &voxels =
+                    volume.volume_units_[unit.first].volume_->voxels_;
+            for (size_t i = 0; i < voxels.size(); i++) {
+                EXPECT_EQ(voxels[i].weight_,
+                          unit.second.volume_->voxels_[i].weight_);
+            }
+        }
+
+        // Assignment copies the same way and removes the spill files of the
+        // previous content.
+        integration::ScalableTSDFVolume assigned(
+                0.04, 0.12, integration::TSDFVolumeColorType::NoColor);
+        assigned.spill_directory_ = spill_directory;
+        assigned.Integrate(rgbd, intrinsic, CameraAt(5.0));
+        assigned.Integrate(rgbd, intrinsic, CameraAt(0.0));
+        EXPECT_GT(assigned.EvictVolumeUnits(0), 0u);
+        EXPECT_FALSE(assigned.spilled_volume_units_.empty());
+        assigned = volume;
+        std::vector<std::string> spill_files;
+        utility::filesystem::ListFilesInDirectory(spill_directory,
+                                                  spill_files);
+        EXPECT_TRUE(spill_files.empty());
+        EXPECT_EQ(assigned.voxel_length_, volume.voxel_length_);
+        EXPECT_EQ(assigned.volume_unit_length_, volume.volume_unit_length_);
+        ASSERT_EQ(assigned.volume_units_.size(), volume.volume_units_.size());
+        for (const auto &unit : volume.volume_units_) {
+            const auto &assigned_unit = assigned.volume_units_[unit.first];
+            EXPECT_NE(assigned_unit.volume_, unit.second.volume_);
+            EXPECT_EQ(assigned_unit.last_integrated_frame_,
+                      unit.second.last_integrated_frame_);
+        }
+    }
+    EXPECT_TRUE(utility::filesystem::DeleteDirectory(spill_directory));
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) {
     unit_test::NotImplemented();
@@ -46,6 +512,37 @@ TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) {
     unit_test::NotImplemented();
 }
 
+TEST(ScalableTSDFVolume, ExtractSinglePrecision) {
+    geometry::RGBDImage rgbd = CreatePlaneImage();
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    integration::ScalableTSDFVolume volume(
+            0.02, 0.06, integration::TSDFVolumeColorType::NoColor);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+
+    auto pcd = volume.ExtractPointCloud();
+    auto pcd_f = volume.ExtractPointCloudF();
+    ASSERT_FALSE(pcd->points_.empty());
+    ASSERT_EQ(pcd_f->points_.size(), pcd->points_.size());
+    ASSERT_EQ(pcd_f->normals_.size(), pcd->normals_.size());
+    for (size_t i = 0; i < pcd->points_.size(); i++) {
+        EXPECT_TRUE(pcd_f->points_[i].cast<double>().isApprox(
+                pcd->points_[i], 1e-5));
+    }
+
+    auto mesh = volume.ExtractTriangleMesh();
+    auto mesh_f = volume.ExtractTriangleMeshF();
+    ASSERT_FALSE(mesh->triangles_.empty());
+    ASSERT_EQ(mesh_f->vertices_.size(), mesh->vertices_.size());
+    ASSERT_EQ(mesh_f->triangles_.size(), mesh->triangles_.size());
+    for (size_t i = 0; i < mesh->vertices_.size(); i++) {
+        EXPECT_TRUE(mesh_f->vertices_[i].cast<double>().isApprox(
+                mesh->vertices_[i], 1e-5));
+    }
+    for (size_t i = 0; i < mesh->triangles_.size(); i++) {
+        EXPECT_EQ(mesh_f->triangles_[i], mesh->triangles_[i]);
+    }
+}
+
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) {
     unit_test::NotImplemented();
 }
@@ -97,6 +97,70 @@ TEST(UniformTSDFVolume, Constructor) {
     EXPECT_EQ(int(tsdf_volume.voxels_.size()), tsdf_volume.voxel_num_);
 }
 
+TEST(UniformTSDFVolume, Raycast) {
+    // A gray plane at depth 1 seen by a camera at the origin.
+    const int width = 64;
+    const int height = 48;
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(width, height, 1, 4);
+    rgbd.color_.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *rgbd.depth_.PointerAt<float>(u, v) = 1.0f;
+            for (int c = 0; c < 3; c++) {
+                *rgbd.color_.PointerAt<uint8_t>(u, v, c) = 102;
+            }
+        }
+    }
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 31.5,
+                                             23.5);
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+
+    integration::UniformTSDFVolume tsdf_volume(
+            2.0, 64, 0.1, integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d(-1.0, -1.0, 0.0));
+    tsdf_volume.Integrate(rgbd, intrinsic, extrinsic);
+
+    auto result = tsdf_volume.Raycast(intrinsic, extrinsic, 0.1, 3.0);
+    EXPECT_EQ(result->depth_.width_, width);
+    EXPECT_EQ(result->depth_.height_, height);
+    EXPECT_EQ(result->vertex_map_.num_of_channels_, 3);
+    EXPECT_EQ(result->color_.num_of_channels_, 3);
+    for (int v = 8; v < height - 8; v++) {
+        for (int u = 8; u < width - 8; u++) {
+            float depth = *result->depth_.PointerAt<float>(u, v);
+            EXPECT_NEAR(depth, 1.0, 0.01);
+            Eigen::Vector3d vertex(
+                    *result->vertex_map_.PointerAt<float>(u, v, 0),
+                    *result->vertex_map_.PointerAt<float>(u, v, 1),
+                    *result->vertex_map_.PointerAt<float>(u, v, 2));
+            ExpectEQ(vertex,
+                     Eigen::Vector3d((u - 31.5) / 50.0 * depth,
+                                     (v - 23.5) / 50.0 * depth, depth),
+                     1e-4);
+            Eigen::Vector3d normal(
+                    *result->normal_map_.PointerAt<float>(u, v, 0),
+                    *result->normal_map_.PointerAt<float>(u, v, 1),
+                    *result->normal_map_.PointerAt<float>(u, v, 2));
+            ExpectEQ(normal, Eigen::Vector3d(0.0, 0.0, -1.0), 1e-3);
+            EXPECT_NEAR(*result->color_.PointerAt<float>(u, v, 0), 0.4,
+                        1e-4);
+        }
+    }
+
+    // Rays that miss the volume leave the images zero.
+    Eigen::Matrix4d away = Eigen::Matrix4d::Identity();
+    away(2, 2) = -1.0;
+    away(0, 0) = -1.0;
+    away(2, 3) = -5.0;
+    result = tsdf_volume.Raycast(intrinsic, away, 0.1, 3.0);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            EXPECT_EQ(*result->depth_.PointerAt<float>(u, v), 0.0f);
+        }
+    }
+}
+
 TEST(UniformTSDFVolume, RealData) {
     std::string test_data_dir = std::string(TEST_DATA_DIR);
 
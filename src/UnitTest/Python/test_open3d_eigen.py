@@ -67,6 +67,44 @@ def test_Vector3dVector(input_array, expect_exception):
         run_test(input_array)
 
 
+@pytest.mark.parametrize(
+    "input_array, expect_exception",
+    [
+        # Empty case
+        (np.ones((0, 3), dtype=np.float32), False),
+        # Wrong shape
+        (np.ones((2, 4), dtype=np.float32), True),
+        # Non-numpy array
+        ([[1, 2, 3], [4, 5, 6]], False),
+        ([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], False),
+        # Datatypes
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float32), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float64), False),
+        (np.array([[1, 2, 3], [4, 5, 6]], dtype=np.int32), False),
+        # Slice non-contiguous memory
+        (np.array([[1, 2, 3, 4, 5], [6, 7, 8, 9, 10]],
+                  dtype=np.float32)[:, 0:6:2], False),
+        # Transpose view
+        (np.array([[1, 4], [2, 5], [3, 6]], dtype=np.float32).T, False),
+        # Fortran layout
+        (np.asfortranarray(np.array([[1, 2, 3], [4, 5, 6]],
+                                    dtype=np.float32)), False),
+    ])
+def test_Vector3fVector(input_array, expect_exception):
+
+    def run_test(input_array):
+        open3d_array = o3d.utility.Vector3fVector(input_array)
+        output_array = np.asarray(open3d_array)
+        assert output_array.dtype == np.float32
+        np.testing.assert_allclose(input_array, output_array)
+
+    if expect_exception:
+        with pytest.raises(Exception):
+            run_test(input_array)
+    else:
+        run_test(input_array)
+
+
 @pytest.mark.parametrize(
     "input_array, expect_exception",
     [
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Reconstruction/ReconstructionPipeline.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/Utility/Progress.h"
+#include "TestUtility/UnitTest.h"
+
+#include <iomanip>
+#include <sstream>
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void GetRGBDFiles(std::vector<std::string>& color_files,
+                  std::vector<std::string>& depth_files) {
+    for (int i = 0; i < 5; i++) {
+        std::ostringstream name;
+        name << std::setfill('0') << std::setw(5) << i;
+        color_files.push_back(std::string(TEST_DATA_DIR) + "/RGBD/color/" +
+                              name.str() + ".jpg");
+        depth_files.push_back(std::string(TEST_DATA_DIR) + "/RGBD/depth/" +
+                              name.str() + ".png");
+    }
+}
+
+}  // unnamed namespace
+
+TEST(ReconstructionPipeline, RealData) {
+    std::vector<std::string> color_files, depth_files;
+    GetRGBDFiles(color_files, depth_files);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    reconstruction::ReconstructionOption option;
+    option.n_frames_per_fragment_ = 2;
+    option.n_keyframes_per_n_frame_ = 2;
+    option.max_cached_frames_ = 2;
+
+    utility::ProgressToken progress;
+    auto result = reconstruction::RunReconstructionPipeline(
+            color_files, depth_files, intrinsic, option, &progress);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(progress.GetCompleted(), progress.GetTotal());
+
+    // Fragments of frames {0, 1}, {2, 3} and {4}.
+    ASSERT_EQ(result->fragment_pose_graphs_.size(), 3u);
+    EXPECT_EQ(result->fragment_pose_graphs_[0].nodes_.size(), 2u);
+    EXPECT_EQ(result->fragment_pose_graphs_[1].nodes_.size(), 2u);
+    EXPECT_EQ(result->fragment_pose_graphs_[2].nodes_.size(), 1u);
+    ASSERT_EQ(result->fragment_point_clouds_.size(), 3u);
+    for (const auto& point_cloud : result->fragment_point_clouds_) {
+        EXPECT_GT(point_cloud->points_.size(), 0u);
+    }
+    EXPECT_EQ(result->scene_pose_graph_.nodes_.size(), 3u);
+    ASSERT_EQ(result->trajectory_.parameters_.size(), 5u);
+    EXPECT_GT(result->mesh_->vertices_.size(), 0u);
+    EXPECT_TRUE(result->mesh_->HasVertexNormals());
+
+    // The camera motion relative to the first frame matches the reference
+    // odometry.
+    camera::PinholeCameraTrajectory reference;
+    ASSERT_TRUE(io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", reference));
+    const auto& parameters = result->trajectory_.parameters_;
+    for (size_t i = 1; i < parameters.size(); i++) {
+        Eigen::Matrix4d motion =
+                parameters[0].extrinsic_ * parameters[i].extrinsic_.inverse();
+        Eigen::Matrix4d reference_motion =
+                reference.parameters_[0].extrinsic_ *
+                reference.parameters_[i].extrinsic_.inverse();
+        EXPECT_LT((motion.block<3, 1>(0, 3) -
+                   reference_motion.block<3, 1>(0, 3))
+                          .norm(),
+                  0.05);
+    }
+}
+
+TEST(ReconstructionPipeline, Cancelled) {
+    std::vector<std::string> color_files, depth_files;
+    GetRGBDFiles(color_files, depth_files);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    utility::ProgressToken progress;
+    progress.Cancel();
+    EXPECT_EQ(reconstruction::RunReconstructionPipeline(
+                      color_files, depth_files, intrinsic,
+                      reconstruction::ReconstructionOption(), &progress),
+              nullptr);
+}
+
+TEST(ReconstructionPipeline, InvalidInput) {
+    std::vector<std::string> color_files, depth_files;
+    GetRGBDFiles(color_files, depth_files);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    depth_files.pop_back();
+    EXPECT_EQ(reconstruction::RunReconstructionPipeline(
+                      color_files, depth_files, intrinsic),
+              nullptr);
+
+    depth_files.push_back(std::string(TEST_DATA_DIR) + "/RGBD/missing.png");
+    EXPECT_EQ(reconstruction::RunReconstructionPipeline(
+                      color_files, depth_files, intrinsic),
+              nullptr);
+}
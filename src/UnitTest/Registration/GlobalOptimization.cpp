@@ -24,8 +24,51 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/GlobalOptimization.h"
+#include <vector>
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Progress.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+registration::PoseGraph CreateChainPoseGraph(int n_nodes) {
+    registration::PoseGraph pose_graph;
+    Eigen::Matrix4d step = Eigen::Matrix4d::Identity();
+    step(0, 3) = 0.1;
+    Eigen::Matrix4d step_back = Eigen::Matrix4d::Identity();
+    step_back(0, 3) = -0.1;
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    for (int i = 0; i < n_nodes; i++) {
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(pose));
+        pose = pose * step;
+        if (i > 0) {
+            pose_graph.edges_.push_back(
+                    registration::PoseGraphEdge(i - 1, i, step_back));
+        }
+    }
+    return pose_graph;
+}
+
+// A method written against the three-argument OptimizePoseGraph.
+class CountingMethod : public registration::GlobalOptimizationMethod {
+public:
+    void OptimizePoseGraph(
+            registration::PoseGraph &pose_graph,
+            const registration::GlobalOptimizationConvergenceCriteria &criteria,
+            const registration::GlobalOptimizationOption &option)
+            const override {
+        num_calls_++;
+    }
+
+public:
+    mutable int num_calls_ = 0;
+};
+
+}  // unnamed namespace
+
 TEST(GlobalOptimization, DISABLED_Constructor) { unit_test::NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { unit_test::NotImplemented(); }
@@ -45,3 +88,48 @@ TEST(GlobalOptimization, DISABLED_GlobalOptimizationOption) {
 TEST(GlobalOptimization, DISABLED_CreatePoseGraphWithoutInvalidEdges) {
     unit_test::NotImplemented();
 }
+
+TEST(GlobalOptimization, OptimizePoseGraphProgress) {
+    registration::PoseGraph pose_graph = CreateChainPoseGraph(4);
+    registration::GlobalOptimizationConvergenceCriteria criteria;
+    std::vector<double> reported;
+    utility::ProgressToken progress(
+            [&](double fraction) { reported.push_back(fraction); }, 0.0);
+    // A direct call sets the total of the token itself.
+    registration::GlobalOptimizationLevenbergMarquardt()
+            .OptimizePoseGraphWithProgress(
+                    pose_graph, criteria,
+                    registration::GlobalOptimizationOption(), &progress);
+    EXPECT_EQ(criteria.max_iteration_, progress.GetTotal());
+    ASSERT_FALSE(reported.empty());
+    EXPECT_DOUBLE_EQ(1.0, reported.back());
+}
+
+TEST(GlobalOptimization, OptimizePoseGraphWithoutProgressSupport) {
+    registration::PoseGraph pose_graph = CreateChainPoseGraph(4);
+    utility::ProgressToken progress;
+    CountingMethod method;
+    method.OptimizePoseGraphWithProgress(
+            pose_graph, registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(), &progress);
+    EXPECT_EQ(1, method.num_calls_);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationProgress) {
+    registration::PoseGraph pose_graph = CreateChainPoseGraph(4);
+    registration::GlobalOptimizationConvergenceCriteria criteria;
+    std::vector<double> reported;
+    utility::ProgressToken progress(
+            [&](double fraction) { reported.push_back(fraction); }, 0.0);
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            criteria, registration::GlobalOptimizationOption(), &progress);
+    // Both passes report to the same run of the token.
+    EXPECT_EQ(2 * criteria.max_iteration_, progress.GetTotal());
+    EXPECT_EQ(progress.GetTotal(), progress.GetCompleted());
+    ASSERT_FALSE(reported.empty());
+    for (size_t i = 1; i < reported.size(); i++) {
+        EXPECT_LT(reported[i - 1], reported[i]);
+    }
+    EXPECT_DOUBLE_EQ(1.0, reported.back());
+}
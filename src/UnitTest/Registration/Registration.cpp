@@ -24,8 +24,39 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/PointCloudF.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// An estimation without a single-precision variant.
+class DoublePrecisionEstimation
+    : public registration::TransformationEstimation {
+public:
+    registration::TransformationEstimationType
+    GetTransformationEstimationType() const override {
+        return registration::TransformationEstimationType::Unspecified;
+    }
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const registration::CorrespondenceSet &corres)
+            const override {
+        return 0.0;
+    }
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const registration::CorrespondenceSet &corres) const override {
+        return Eigen::Matrix4d::Identity();
+    }
+};
+
+}  // unnamed namespace
+
 TEST(Registration, DISABLED_ICPConvergenceCriteria) {
     unit_test::NotImplemented();
 }
@@ -48,6 +79,56 @@ TEST(Registration, DISABLED_EvaluateRegistration) {
 
 TEST(Registration, DISABLED_RegistrationICP) { unit_test::NotImplemented(); }
 
+TEST(Registration, RegistrationICPSinglePrecision) {
+    // A bumpy surface, so that point to plane ICP is well constrained.
+    geometry::PointCloud target;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            double x = i * 0.02;
+            double y = j * 0.02;
+            target.points_.push_back(Eigen::Vector3d(
+                    x, y, 0.1 * std::sin(8.0 * x) * std::cos(6.0 * y)));
+        }
+    }
+    target.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d::UnitZ()).matrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, -0.02, 0.005);
+    geometry::PointCloud source = target;
+    source.Transform(transformation);
+    geometry::PointCloudF source_f(source);
+    geometry::PointCloudF target_f(target);
+
+    registration::TransformationEstimationPointToPoint point_to_point;
+    registration::TransformationEstimationPointToPlane point_to_plane;
+    for (const registration::TransformationEstimation *estimation :
+         {(const registration::TransformationEstimation *)&point_to_point,
+          (const registration::TransformationEstimation *)&point_to_plane}) {
+        auto result = registration::RegistrationICP(
+                source, target, 0.1, Eigen::Matrix4d::Identity(),
+                *estimation);
+        auto result_f = registration::RegistrationICP(
+                source_f, target_f, 0.1, Eigen::Matrix4d::Identity(),
+                *estimation);
+        EXPECT_NEAR(result_f.fitness_, result.fitness_, 1e-6);
+        EXPECT_TRUE(result_f.transformation_.isApprox(
+                result.transformation_, 1e-4));
+        EXPECT_TRUE(result_f.transformation_.isApprox(
+                transformation.inverse(), 1e-3));
+
+        auto evaluation = registration::EvaluateRegistration(
+                source_f, target_f, 0.1, result_f.transformation_);
+        EXPECT_NEAR(evaluation.fitness_, result_f.fitness_, 1e-6);
+        EXPECT_NEAR(evaluation.inlier_rmse_, result_f.inlier_rmse_, 1e-6);
+    }
+
+    // Other estimations have no single-precision variant.
+    DoublePrecisionEstimation other;
+    EXPECT_ANY_THROW(registration::RegistrationICP(
+            source_f, target_f, 0.1, Eigen::Matrix4d::Identity(), other));
+}
+
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     unit_test::NotImplemented();
 }
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Memory.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(Memory, Arena) {
+    utility::Arena arena(256, "UnitTestArena");
+    for (int frame = 0; frame < 3; frame++) {
+        arena.Reset();
+        for (int i = 0; i < 100; i++) {
+            void *p = arena.Allocate(24, 16);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 16, uintptr_t(0));
+        }
+        EXPECT_EQ(arena.GetUsedBytes(), size_t(2400));
+        if (frame > 0) {
+            // The blocks of the first frame were merged on Reset().
+            EXPECT_EQ(arena.GetNumBlocks(), size_t(1));
+        }
+    }
+    auto &tracker = utility::MemoryTracker::GetInstance();
+    auto statistics = tracker.GetStatistics("UnitTestArena");
+    EXPECT_EQ(statistics.live_bytes_, int64_t(arena.GetCapacity()));
+    EXPECT_GE(statistics.peak_bytes_, statistics.live_bytes_);
+    tracker.ResetPeaks();
+    statistics = tracker.GetStatistics("UnitTestArena");
+    EXPECT_EQ(statistics.peak_bytes_, statistics.live_bytes_);
+    EXPECT_EQ(tracker.GetStatistics("UnitTestUnused").num_allocations_, 0);
+}
+
+TEST(Memory, ArenaAllocator) {
+    utility::Arena arena(1024, "UnitTestArenaAllocator");
+    size_t capacity = 0;
+    for (int frame = 0; frame < 3; frame++) {
+        arena.Reset();
+        {
+            typedef std::pair<const int, double> Entry;
+            std::unordered_map<int, double, std::hash<int>,
+                               std::equal_to<int>,
+                               utility::ArenaAllocator<Entry>>
+                    map(0, std::hash<int>(), std::equal_to<int>(),
+                        utility::ArenaAllocator<Entry>(arena));
+            for (int i = 0; i < 1000; i++) {
+                map[i] = i;
+            }
+            EXPECT_EQ(map.size(), size_t(1000));
+            EXPECT_EQ(map[500], 500.0);
+        }
+        if (frame == 1) {
+            capacity = arena.GetCapacity();
+        } else if (frame == 2) {
+            EXPECT_EQ(arena.GetCapacity(), capacity);
+        }
+    }
+}
@@ -0,0 +1,212 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(Parallel, ParallelFor) {
+    // Makes sure the pool has workers even on single-core machines.
+    utility::SetMaxThreads(4);
+    for (auto backend : {utility::ParallelBackend::ThreadPool,
+                         utility::ParallelBackend::OpenMP}) {
+        utility::SetParallelBackend(backend);
+        std::vector<int> values(10007, 0);
+        utility::ParallelFor(0, int(values.size()),
+                             [&](int i) { values[i] += i; });
+        for (int i = 0; i < int(values.size()); i++) {
+            EXPECT_EQ(values[i], i);
+        }
+    }
+    utility::SetParallelBackend(utility::ParallelBackend::ThreadPool);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, ParallelReduce) {
+    std::vector<int> sequence;
+    sequence = utility::ParallelReduce(
+            0, 1000, std::vector<int>(),
+            [](int begin, int end, std::vector<int> &partial) {
+                for (int i = begin; i < end; i++) {
+                    partial.push_back(i);
+                }
+            },
+            [](std::vector<int> &result, const std::vector<int> &partial) {
+                result.insert(result.end(), partial.begin(), partial.end());
+            });
+    std::vector<int> expected(1000);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(sequence, expected);
+
+    int64_t sum = utility::ParallelReduce(
+            5, 5, int64_t(7),
+            [](int, int, int64_t &partial) { partial += 1; },
+            [](int64_t &result, int64_t partial) { result += partial; });
+    EXPECT_EQ(sum, 7);
+}
+
+TEST(Parallel, ParallelSort) {
+    utility::SetMaxThreads(4);
+    for (size_t size : {size_t(100), size_t(5000), size_t(100000)}) {
+        std::vector<int> data(size);
+        uint32_t seed = 1;
+        for (auto &value : data) {
+            seed = seed * 1664525u + 1013904223u;
+            value = int(seed >> 8) % 1000;
+        }
+        std::vector<int> expected = data;
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+        utility::ParallelSort(data, std::greater<int>());
+        EXPECT_EQ(data, expected);
+    }
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, MaxThreads) {
+    int default_threads = utility::GetMaxThreads();
+    EXPECT_GE(default_threads, 1);
+    utility::SetMaxThreads(3);
+    EXPECT_EQ(utility::GetMaxThreads(), 3);
+    {
+        utility::ScopedMaxThreads limit(1);
+        EXPECT_EQ(utility::GetMaxThreads(), 1);
+        std::atomic<int> num_threads_seen(0);
+        std::thread::id caller = std::this_thread::get_id();
+        utility::ParallelFor(0, 1000, [&](int) {
+            if (std::this_thread::get_id() != caller) {
+                num_threads_seen++;
+            }
+        });
+        EXPECT_EQ(num_threads_seen.load(), 0);
+    }
+    EXPECT_EQ(utility::GetMaxThreads(), 3);
+    EXPECT_EQ(utility::GetParallelThreadCount(100, 2), 2);
+    EXPECT_EQ(utility::GetParallelThreadCount(1), 1);
+    utility::SetMaxThreads(0);
+    EXPECT_EQ(utility::GetMaxThreads(), default_threads);
+}
+
+#ifdef _OPENMP
+TEST(Parallel, FollowsOpenMP) {
+    const int default_threads = omp_get_max_threads();
+    // Without SetMaxThreads, the OpenMP setting caps the parallel loops.
+    omp_set_num_threads(2);
+    EXPECT_EQ(utility::GetMaxThreads(), 2);
+    {
+        utility::ScopedMaxThreads limit(1);
+        EXPECT_EQ(omp_get_max_threads(), 1);
+    }
+    // The OpenMP setting of the caller is restored, not overwritten.
+    EXPECT_EQ(omp_get_max_threads(), 2);
+    utility::SetMaxThreads(3);
+    EXPECT_EQ(omp_get_max_threads(), 3);
+    utility::SetMaxThreads(0);
+    EXPECT_EQ(omp_get_max_threads(), default_threads);
+    EXPECT_EQ(utility::GetMaxThreads(), default_threads);
+    omp_set_num_threads(default_threads);
+}
+#endif
+
+TEST(Parallel, Nested) {
+    utility::SetMaxThreads(4);
+    std::atomic<int> count(0);
+    utility::ParallelFor(0, 16, [&](int) {
+        utility::ParallelFor(0, 16, [&](int) { count++; });
+    });
+    EXPECT_EQ(count.load(), 256);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, TaskGroup) {
+    utility::SetMaxThreads(4);
+    std::atomic<int> count(0);
+    utility::TaskGroup group;
+    for (int i = 0; i < 32; i++) {
+        group.Run([&]() {
+            utility::TaskGroup inner;
+            for (int j = 0; j < 4; j++) {
+                inner.Run([&]() { count++; });
+            }
+            inner.Wait();
+        });
+    }
+    group.Wait();
+    EXPECT_EQ(count.load(), 128);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, TaskGroupMaxThreads) {
+    utility::SetMaxThreads(4);
+    std::atomic<int> running(0);
+    std::atomic<int> max_running(0);
+    {
+        utility::ScopedMaxThreads scoped(2);
+        utility::TaskGroup group;
+        for (int i = 0; i < 16; i++) {
+            group.Run([&]() {
+                int now = ++running;
+                int seen = max_running.load();
+                while (now > seen &&
+                       !max_running.compare_exchange_weak(seen, now)) {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                running--;
+            });
+        }
+        group.Wait();
+    }
+    EXPECT_LE(max_running.load(), 2);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Parallel, Exceptions) {
+    utility::SetMaxThreads(4);
+    EXPECT_THROW(utility::ParallelFor(0, 100,
+                                      [](int i) {
+                                          if (i == 42) {
+                                              throw std::runtime_error("42");
+                                          }
+                                      }),
+                 std::runtime_error);
+    utility::TaskGroup group;
+    group.Run([]() { throw std::runtime_error("task"); });
+    EXPECT_THROW(group.Wait(), std::runtime_error);
+    utility::SetMaxThreads(0);
+}
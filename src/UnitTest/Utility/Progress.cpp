@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Progress.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "Open3D/Utility/Parallel.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(Progress, ConcurrentAdd) {
+    utility::SetMaxThreads(4);
+    utility::ProgressToken progress;
+    progress.Reset(100000);
+    utility::ParallelFor(0, 100000, [&](int) { progress.Add(); });
+    EXPECT_EQ(progress.GetCompleted(), 100000);
+    EXPECT_EQ(progress.GetTotal(), 100000);
+    EXPECT_DOUBLE_EQ(progress.GetFraction(), 1.0);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Progress, Callback) {
+    utility::SetMaxThreads(4);
+    std::mutex mutex;
+    std::vector<double> reported;
+    utility::ProgressToken progress(
+            [&](double fraction) {
+                std::lock_guard<std::mutex> lock(mutex);
+                reported.push_back(fraction);
+            },
+            0.0);
+    progress.Reset(20000);
+    utility::ParallelFor(0, 20000, [&](int) { progress.Add(); });
+
+    ASSERT_FALSE(reported.empty());
+    // At most one report per stride of total / 1000 units.
+    EXPECT_LE(reported.size(), size_t(1000));
+    for (size_t i = 1; i < reported.size(); i++) {
+        EXPECT_LT(reported[i - 1], reported[i]);
+    }
+    EXPECT_DOUBLE_EQ(reported.back(), 1.0);
+    utility::SetMaxThreads(0);
+}
+
+TEST(Progress, CallbackInterval) {
+    int num_reports = 0;
+    utility::ProgressToken progress([&](double) { num_reports++; }, 1e6);
+    progress.Reset(5000);
+    for (int i = 0; i < 5000; i++) {
+        progress.Add();
+    }
+    // Only the final report is not rate-limited.
+    EXPECT_EQ(num_reports, 1);
+}
+
+TEST(Progress, Cancel) {
+    utility::ProgressToken progress;
+    progress.Reset(10);
+    EXPECT_TRUE(progress.Add());
+    EXPECT_FALSE(progress.IsCancelled());
+    progress.Cancel();
+    EXPECT_TRUE(progress.IsCancelled());
+    EXPECT_FALSE(progress.Add());
+}
+
+TEST(Progress, CallbackThrows) {
+    bool throw_in_callback = true;
+    int num_reports = 0;
+    utility::ProgressToken progress(
+            [&](double) {
+                num_reports++;
+                if (throw_in_callback) {
+                    throw std::runtime_error("callback");
+                }
+            },
+            0.0);
+    progress.Reset(10);
+    EXPECT_THROW(progress.Add(5), std::runtime_error);
+    // The final report must not wait for the report that threw.
+    throw_in_callback = false;
+    progress.Add(5);
+    EXPECT_EQ(num_reports, 2);
+}
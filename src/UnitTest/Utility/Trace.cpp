@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/Trace.h"
+
+#include <json/json.h>
+#include <sstream>
+#include <thread>
+
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(Trace, NestedZones) {
+    utility::Tracer &tracer = utility::Tracer::GetInstance();
+    tracer.Clear();
+    tracer.SetEnabled(true);
+    auto work = [] {
+        utility::TraceZone outer("Outer");
+        for (int i = 0; i < 3; i++) {
+            utility::TraceZone inner("Inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+    std::thread thread(work);
+    work();
+    thread.join();
+    tracer.SetEnabled(false);
+    {
+        utility::TraceZone ignored("Ignored");
+    }
+
+    std::vector<utility::TraceZoneStatistics> statistics =
+            tracer.GetZoneStatistics();
+    ASSERT_EQ(statistics.size(), size_t(2));
+    EXPECT_EQ(statistics[0].name_, "Outer");
+    EXPECT_EQ(statistics[0].count_, 2);
+    EXPECT_EQ(statistics[1].name_, "Inner");
+    EXPECT_EQ(statistics[1].count_, 6);
+    EXPECT_GE(statistics[1].total_ms_, 6.0);
+    EXPECT_NEAR(statistics[0].total_ms_ - statistics[0].self_ms_,
+                statistics[1].total_ms_, 1e-6);
+    tracer.Clear();
+    EXPECT_EQ(tracer.GetZoneStatistics().size(), size_t(0));
+}
+
+TEST(Trace, CountersAndHistograms) {
+    utility::Tracer &tracer = utility::Tracer::GetInstance();
+    tracer.Clear();
+    utility::TraceCounter &counter = tracer.GetCounter("TestCounter");
+    EXPECT_EQ(&counter, &tracer.GetCounter("TestCounter"));
+    counter.Add(3);
+    counter.Add(4);
+    EXPECT_EQ(tracer.GetCounterValues()["TestCounter"], 7);
+
+    utility::TraceHistogram &histogram = tracer.GetHistogram("TestHistogram");
+    histogram.Record(0.5);
+    histogram.Record(1.0);
+    histogram.Record(3.0);
+    histogram.Record(1000.0);
+    std::vector<int64_t> buckets = histogram.GetBuckets();
+    EXPECT_EQ(buckets[0], 1);
+    EXPECT_EQ(buckets[1], 1);
+    EXPECT_EQ(buckets[2], 1);
+    EXPECT_EQ(buckets[10], 1);
+    EXPECT_EQ(histogram.GetCount(), 4);
+    EXPECT_DOUBLE_EQ(histogram.GetMin(), 0.5);
+    EXPECT_DOUBLE_EQ(histogram.GetMax(), 1000.0);
+    EXPECT_DOUBLE_EQ(histogram.GetSum(), 1004.5);
+    tracer.Clear();
+    EXPECT_EQ(counter.GetValue(), 0);
+    EXPECT_EQ(histogram.GetCount(), 0);
+}
+
+TEST(Trace, ToChromeTraceJson) {
+    utility::Tracer &tracer = utility::Tracer::GetInstance();
+    tracer.Clear();
+    tracer.SetEnabled(true);
+    {
+        utility::TraceZone zone("Quoted \"zone\"");
+    }
+    tracer.SetEnabled(false);
+    tracer.GetCounter("JsonCounter").Add(5);
+
+    Json::Value root;
+    Json::CharReaderBuilder builder;
+    JSONCPP_STRING errs;
+    std::istringstream json_stream(tracer.ToChromeTraceJson());
+    ASSERT_TRUE(Json::parseFromStream(builder, json_stream, &root, &errs));
+    const Json::Value &events = root["traceEvents"];
+    ASSERT_TRUE(events.isArray());
+    int num_zones = 0;
+    int num_counters = 0;
+    for (const auto &event : events) {
+        if (event["ph"].asString() == "X") {
+            EXPECT_EQ(event["name"].asString(), "Quoted \"zone\"");
+            EXPECT_GE(event["dur"].asDouble(), 0.0);
+            num_zones++;
+        } else if (event["ph"].asString() == "C" &&
+                   event["name"].asString() == "JsonCounter") {
+            EXPECT_EQ(event["args"]["value"].asInt(), 5);
+            num_counters++;
+        }
+    }
+    EXPECT_EQ(num_zones, 1);
+    EXPECT_EQ(num_counters, 1);
+    tracer.Clear();
+}
@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Utility/VectorKernels.h"
+
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Utility/Eigen.h"
+#include "Open3D/Utility/Parallel.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Large enough to be split across several threads.
+std::vector<Eigen::Vector3d> CreateVectors(size_t size) {
+    std::vector<Eigen::Vector3d> vectors(size);
+    for (size_t i = 0; i < size; i++) {
+        double x = double(i % 1000);
+        vectors[i] = Eigen::Vector3d(x, 2.0 * x - 500.0, double(i % 7));
+    }
+    return vectors;
+}
+
+}  // unnamed namespace
+
+TEST(VectorKernels, TransformPoints) {
+    utility::SetMaxThreads(4);
+    std::vector<Eigen::Vector3d> points = CreateVectors(100000);
+    std::vector<Eigen::Vector3f> points_f;
+    utility::CastVectors(points, points_f);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            utility::RotationMatrixX(0.3) * utility::RotationMatrixZ(1.1);
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(1.0, -2.0, 3.0);
+
+    std::vector<Eigen::Vector3d> expected = points;
+    for (auto &point : expected) {
+        point = transformation.block<3, 3>(0, 0) * point +
+                transformation.block<3, 1>(0, 3);
+    }
+    utility::TransformPoints(transformation, points);
+    utility::TransformPoints(transformation, points_f);
+    for (size_t i = 0; i < points.size(); i++) {
+        ExpectEQ(points[i], expected[i]);
+        EXPECT_NEAR((points_f[i].cast<double>() - expected[i]).norm(), 0.0,
+                    1e-3);
+    }
+
+    // Projective transformations divide by the homogeneous coordinate.
+    std::vector<Eigen::Vector3d> projected = {{1.0, 2.0, 3.0}};
+    Eigen::Matrix4d projection = Eigen::Matrix4d::Identity();
+    projection(3, 3) = 2.0;
+    utility::TransformPoints(projection, projected);
+    ExpectEQ(projected[0], Eigen::Vector3d(0.5, 1.0, 1.5));
+    utility::SetMaxThreads(0);
+}
+
+TEST(VectorKernels, TranslateAndScale) {
+    utility::SetMaxThreads(4);
+    std::vector<Eigen::Vector3d> points = CreateVectors(100000);
+    std::vector<Eigen::Vector3f> points_f;
+    utility::CastVectors(points, points_f);
+    const Eigen::Vector3d translation(1.0, -2.0, 3.0);
+    const Eigen::Vector3d center(0.5, 1.5, -2.5);
+
+    std::vector<Eigen::Vector3d> expected = points;
+    for (auto &point : expected) {
+        point = (point + translation - center) * 0.5 + center;
+    }
+    utility::TranslateVectors(translation, points);
+    utility::ScaleVectors(0.5, center, points);
+    utility::TranslateVectors(translation, points_f);
+    utility::ScaleVectors(0.5, center, points_f);
+    for (size_t i = 0; i < points.size(); i++) {
+        ExpectEQ(points[i], expected[i]);
+        EXPECT_NEAR((points_f[i].cast<double>() - expected[i]).norm(), 0.0,
+                    1e-3);
+    }
+
+    // Non-finite coordinates stay in their own component.
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<Eigen::Vector3d> invalid = {{nan, 1.0, 2.0}, {3.0, inf, 4.0}};
+    utility::TranslateVectors(translation, invalid);
+    utility::ScaleVectors(2.0, Eigen::Vector3d::Zero(), invalid);
+    EXPECT_TRUE(std::isnan(invalid[0](0)));
+    EXPECT_EQ(invalid[0](1), -2.0);
+    EXPECT_EQ(invalid[0](2), 10.0);
+    EXPECT_EQ(invalid[1](0), 8.0);
+    EXPECT_EQ(invalid[1](1), inf);
+    EXPECT_EQ(invalid[1](2), 14.0);
+    utility::SetMaxThreads(0);
+}
+
+TEST(VectorKernels, BoundsAndCentroid) {
+    utility::SetMaxThreads(4);
+    std::vector<Eigen::Vector3d> vectors = CreateVectors(100000);
+
+    ExpectEQ(utility::ComputeMinBound(vectors),
+             Eigen::Vector3d(0.0, -500.0, 0.0));
+    ExpectEQ(utility::ComputeMaxBound(vectors),
+             Eigen::Vector3d(999.0, 1498.0, 6.0));
+    Eigen::Vector3d sum(0.0, 0.0, 0.0);
+    for (const auto &v : vectors) {
+        sum += v;
+    }
+    ExpectEQ(utility::ComputeCentroid(vectors),
+             Eigen::Vector3d(sum / double(vectors.size())));
+
+    std::vector<Eigen::Vector3d> empty;
+    ExpectEQ(utility::ComputeMinBound(empty), Eigen::Vector3d(0.0, 0.0, 0.0));
+    ExpectEQ(utility::ComputeCentroid(empty), Eigen::Vector3d(0.0, 0.0, 0.0));
+    utility::SetMaxThreads(0);
+}
+
+TEST(VectorKernels, ComputeMeanAndCovariance) {
+    utility::SetMaxThreads(4);
+    std::vector<Eigen::Vector3d> vectors = CreateVectors(100000);
+    Eigen::Vector3d mean = utility::ComputeCentroid(vectors);
+    Eigen::Matrix3d expected = Eigen::Matrix3d::Zero();
+    for (const auto &v : vectors) {
+        expected += (v - mean) * (v - mean).transpose();
+    }
+    expected /= double(vectors.size());
+
+    Eigen::Vector3d result_mean;
+    Eigen::Matrix3d result_covariance;
+    std::tie(result_mean, result_covariance) =
+            utility::ComputeMeanAndCovariance(vectors);
+    ExpectEQ(result_mean, mean);
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            EXPECT_NEAR(result_covariance(r, c), expected(r, c), 1e-6);
+        }
+    }
+    utility::SetMaxThreads(0);
+}
+
+TEST(VectorKernels, NormalizeAndFill) {
+    std::vector<Eigen::Vector3f> vectors = {
+            {3.0f, 0.0f, 4.0f}, {0.0f, 0.0f, 0.0f}, {NAN, 0.0f, 0.0f}};
+    std::vector<Eigen::Vector3f> with_fallback = vectors;
+
+    utility::NormalizeVectors(vectors);
+    ExpectEQ(Eigen::Vector3d(vectors[0].cast<double>()),
+             Eigen::Vector3d(0.6, 0.0, 0.8));
+    ExpectEQ(Eigen::Vector3d(vectors[1].cast<double>()),
+             Eigen::Vector3d(0.0, 0.0, 0.0));
+
+    utility::NormalizeVectors(with_fallback, Eigen::Vector3d(0.0, 0.0, 1.0));
+    ExpectEQ(Eigen::Vector3d(with_fallback[2].cast<double>()),
+             Eigen::Vector3d(0.0, 0.0, 1.0));
+
+    utility::FillVectors(vectors, 5, Eigen::Vector3d(0.5, 0.25, 1.0));
+    ASSERT_EQ(vectors.size(), 5u);
+    for (const auto &v : vectors) {
+        ExpectEQ(Eigen::Vector3d(v.cast<double>()),
+                 Eigen::Vector3d(0.5, 0.25, 1.0));
+    }
+}